@@ -0,0 +1,155 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "InMemoryMeshPartitioning.h"
+
+#ifdef USE_PETSC
+
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+#include <mpi.h>
+#include <petsc.h>
+
+#include <logog/include/logog.hpp>
+
+#include "BaseLib/Error.h"
+#include "BaseLib/FileTools.h"
+#include "BaseLib/RunTime.h"
+#include "MeshLib/IO/MPI_IO/NodePartitionedMeshReader.h"
+#include "MeshLib/IO/readMeshFromFile.h"
+#include "MeshLib/Mesh.h"
+#include "NodeWiseMeshPartitioner.h"
+
+namespace
+{
+
+int const size_message_tag = 1;
+int const data_message_tag = 2;
+
+void sendBuffer(void const* data, unsigned long const n_bytes, int const rank,
+                MPI_Comm comm)
+{
+    MPI_Send(const_cast<void*>(data), static_cast<int>(n_bytes), MPI_BYTE,
+             rank, data_message_tag, comm);
+}
+
+template <typename T>
+std::vector<T> receiveBuffer(unsigned long const n_bytes, MPI_Comm comm)
+{
+    std::vector<T> buffer(n_bytes / sizeof(T));
+    MPI_Recv(buffer.data(), static_cast<int>(n_bytes), MPI_BYTE, 0,
+             data_message_tag, comm, MPI_STATUS_IGNORE);
+    return buffer;
+}
+
+MeshLib::Mesh* partitionAndDistribute(std::string const& file_name)
+{
+    MPI_Comm const comm = PETSC_COMM_WORLD;
+    int rank, comm_size;
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &comm_size);
+
+    BaseLib::RunTime timer;
+    timer.start();
+
+    MeshLib::IO::NodePartitionedMeshReader builder(comm);
+    std::string const mesh_name =
+        BaseLib::extractBaseNameWithoutExtension(file_name);
+
+    if (rank != 0)
+    {
+        // Four block sizes in bytes, then the blocks.
+        unsigned long sizes[4];
+        MPI_Recv(sizes, 4, MPI_UNSIGNED_LONG, 0, size_message_tag, comm,
+                 MPI_STATUS_IGNORE);
+        auto const config = receiveBuffer<long>(sizes[0], comm);
+        auto const node_data = receiveBuffer<char>(sizes[1], comm);
+        auto const regular_elements =
+            receiveBuffer<unsigned long>(sizes[2], comm);
+        auto const ghost_elements =
+            receiveBuffer<unsigned long>(sizes[3], comm);
+        return builder.readFromBinaryData(config, node_data, regular_elements,
+                                          ghost_elements, mesh_name);
+    }
+
+    // Rank 0: read the full mesh, partition, distribute.
+    std::unique_ptr<MeshLib::Mesh> full_mesh(
+        MeshLib::IO::readMeshFromFileSerial(file_name));
+    if (!full_mesh)
+        OGS_FATAL("Could not read mesh from '%s'.", file_name.c_str());
+    INFO("Partitioning a mesh of %u nodes into %d parts in memory ...",
+         full_mesh->getNumberOfNodes(), comm_size);
+
+    std::string const file_name_base = BaseLib::dropFileExtension(file_name);
+    ApplicationUtils::NodeWiseMeshPartitioner partitioner(
+        comm_size, std::move(full_mesh));
+
+    // METIS computes the node assignment; mpmetis is taken from the PATH.
+    std::string const metis_file = file_name_base + ".mesh";
+    partitioner.writeMETIS(metis_file);
+    std::string const mpmetis_command = "mpmetis -gtype=nodal " + metis_file +
+                                        " " + std::to_string(comm_size);
+    int const status = std::system(mpmetis_command.c_str());
+    if (status != 0)
+        OGS_FATAL("Running '%s' failed with status %d.",
+                  mpmetis_command.c_str(), status);
+
+    partitioner.readMetisData(file_name_base);  // removes the npart files
+    partitioner.partitionByMETIS(false);
+    std::remove(metis_file.c_str());
+
+    // Hand every other rank its partition; build rank 0's own last so the
+    // partitioner's memory is released before the local mesh construction.
+    for (int receiver = 1; receiver < comm_size; ++receiver)
+    {
+        auto const data = partitioner.getPartitionBinaryData(receiver);
+        unsigned long const sizes[4] = {
+            data.config.size() * sizeof(long),
+            data.nodes.size(),
+            data.regular_elements.size() * sizeof(long),
+            data.ghost_elements.size() * sizeof(long)};
+        MPI_Send(const_cast<unsigned long*>(sizes), 4, MPI_UNSIGNED_LONG,
+                 receiver, size_message_tag, comm);
+        sendBuffer(data.config.data(), sizes[0], receiver, comm);
+        sendBuffer(data.nodes.data(), sizes[1], receiver, comm);
+        sendBuffer(data.regular_elements.data(), sizes[2], receiver, comm);
+        sendBuffer(data.ghost_elements.data(), sizes[3], receiver, comm);
+    }
+
+    auto const own = partitioner.getPartitionBinaryData(0);
+    std::vector<unsigned long> const regular_elements(
+        own.regular_elements.begin(), own.regular_elements.end());
+    std::vector<unsigned long> const ghost_elements(
+        own.ghost_elements.begin(), own.ghost_elements.end());
+    auto* const mesh = builder.readFromBinaryData(
+        own.config, own.nodes, regular_elements, ghost_elements, mesh_name);
+
+    INFO("[time] In-memory partitioning and distribution took %g s.",
+         timer.elapsed());
+    return mesh;
+}
+
+}  // anonymous namespace
+
+#endif  // USE_PETSC
+
+namespace ApplicationUtils
+{
+
+void enableInMemoryPartitioning()
+{
+#ifdef USE_PETSC
+    MeshLib::IO::setPartitionedMeshReadFallback(partitionAndDistribute);
+#endif
+}
+
+}  // namespace ApplicationUtils
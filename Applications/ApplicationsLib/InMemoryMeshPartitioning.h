@@ -0,0 +1,33 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+namespace ApplicationUtils
+{
+
+/*! Registers in-memory mesh partitioning as the fallback for parallel mesh
+ * reading.
+ *
+ * With the fallback in place, a parallel run given an unpartitioned mesh
+ * partitions it at simulation start instead of failing: rank 0 reads the
+ * full mesh, runs the node-wise partitioner (METIS node assignment via the
+ * mpmetis executable, which must be on the PATH), and hands every rank its
+ * partition blocks over MPI in the exact layout of the binary
+ * partitioned-mesh files---the hour-scale serialization round trip through
+ * partmesh output files disappears for single-study runs. Meshes with
+ * existing partition files for the current rank count are read from the
+ * files as before, which stays the right choice when one partitioning is
+ * reused across many runs.
+ *
+ * No-op in non-PETSc builds.
+ */
+void enableInMemoryPartitioning();
+
+}  // namespace ApplicationUtils
@@ -15,6 +15,7 @@
 
 #include <logog/include/logog.hpp>
 
+#include "BaseLib/AsyncLogTarget.h"
 #include "BaseLib/LogogSimpleFormatter.h"
 
 namespace ApplicationsLib
@@ -36,6 +37,7 @@ public:
     ~LogogSetup()
     {
         // Objects have to be deleted before shutdown
+        async_target.reset(nullptr);
         fmt.reset(nullptr);
         logog_cout.reset(nullptr);
         LOGOG_SHUTDOWN();
@@ -44,7 +46,21 @@ public:
     void setFormatter(std::unique_ptr<logog::Formatter>&& formatter)
     {
         fmt = std::move(formatter);
-        logog_cout->SetFormatter(*fmt);
+        if (logog_cout)
+            logog_cout->SetFormatter(*fmt);
+        if (async_target)
+            async_target->SetFormatter(*fmt);
+    }
+
+    /// Replaces the synchronous console sink with an asynchronous file
+    /// target, cf. BaseLib::AsyncLogTarget and the --log-file command line
+    /// option. With MPI pass a per-rank file name.
+    void enableAsyncFileLogging(std::string const& file_name)
+    {
+        logog_cout.reset(nullptr);
+        async_target = std::unique_ptr<BaseLib::AsyncLogTarget>(
+            new BaseLib::AsyncLogTarget(file_name));
+        async_target->SetFormatter(*fmt);
     }
 
     void setLevel(LOGOG_LEVEL_TYPE level)
@@ -79,6 +95,7 @@ public:
 private:
     std::unique_ptr<logog::Formatter> fmt;
     std::unique_ptr<logog::Cout> logog_cout;
+    std::unique_ptr<BaseLib::AsyncLogTarget> async_target;
 };
 
 }    // ApplicationsLib
@@ -221,7 +221,8 @@ void NodeWiseMeshPartitioner::renumberNodeIndices
     }
 }
 
-void NodeWiseMeshPartitioner::writeMETIS(const std::string& file_name)
+void NodeWiseMeshPartitioner::writeMETIS(const std::string& file_name,
+                                         const std::string& weight_property)
 {
     std::ofstream os(file_name, std::ios::trunc);
     if (!os.is_open())
@@ -235,10 +236,36 @@ void NodeWiseMeshPartitioner::writeMETIS(const std::string& file_name)
         OGS_FATAL("Error: Cannot write in file %s.", file_name.data());
     }
 
+    // Optional per-element weights for the load balancing, cf. the METIS
+    // mesh file format (flag 1 marks element weights).
+    MeshLib::PropertyVector<int> const* weights = nullptr;
+    if (!weight_property.empty())
+    {
+        weights = _mesh->getProperties().getPropertyVector<int>(
+            weight_property);
+        if (weights == nullptr)
+            OGS_FATAL(
+                "The weight property '%s' was not found in the mesh or is "
+                "not an integer cell property.", weight_property.c_str());
+        if (weights->size() != _mesh->getNumberOfElements())
+            OGS_FATAL("The weight property '%s' is not a cell property.",
+                      weight_property.c_str());
+    }
+
     std::vector<MeshLib::Element*> const& elements = _mesh->getElements();
-    os << elements.size() << " \n";
+    if (weights != nullptr)
+        os << elements.size() << " 1\n";
+    else
+        os << elements.size() << " \n";
     for (const auto* elem : elements)
     {
+        if (weights != nullptr)
+        {
+            int const weight = (*weights)[elem->getID()];
+            if (weight < 1)
+                OGS_FATAL("Partitioning weights must be positive.");
+            os << weight << " ";
+        }
         os << elem->getNodeIndex(0) + 1;
         for (unsigned j = 1; j < elem->getNumberOfNodes(); j++)
         {
@@ -412,6 +439,74 @@ void NodeWiseMeshPartitioner::writeNodesBinary(const std::string& file_name_base
     fclose(of_bin_nod);
 }
 
+NodeWiseMeshPartitioner::PartitionBinaryData
+NodeWiseMeshPartitioner::getPartitionBinaryData(std::size_t part_id) const
+{
+    auto const& partition = _partitions[part_id];
+    PartitionBinaryData data;
+
+    // Configuration header, cf. writeConfigDataBinary(); the file offsets
+    // (entries 10-12) stay zero for the in-memory consumer.
+    data.config.assign(14, 0);
+    data.config[0] = partition.nodes.size();
+    data.config[1] = partition.number_of_base_nodes;
+    data.config[2] = partition.regular_elements.size();
+    data.config[3] = partition.ghost_elements.size();
+    data.config[4] = partition.number_of_non_ghost_base_nodes;
+    data.config[5] = partition.number_of_non_ghost_nodes;
+    data.config[6] = _mesh->getNumberOfBaseNodes();
+    data.config[7] = _mesh->getNumberOfNodes();
+    data.config[8] =
+        getNumberOfIntegerVariablesOfElements(partition.regular_elements);
+    data.config[9] =
+        getNumberOfIntegerVariablesOfElements(partition.ghost_elements);
+
+    // Nodes, cf. writeNodesBinary().
+    data.nodes.resize(partition.nodes.size() * sizeof(NodeStruct));
+    auto* node_structs = reinterpret_cast<NodeStruct*>(data.nodes.data());
+    for (std::size_t i = 0; i < partition.nodes.size(); ++i)
+    {
+        double const* coords = partition.nodes[i]->getCoords();
+        node_structs[i].id = _nodes_global_ids[partition.nodes[i]->getID()];
+        node_structs[i].x = coords[0];
+        node_structs[i].y = coords[1];
+        node_structs[i].z = coords[2];
+    }
+
+    // Element integer variables, cf. writeElementsBinary().
+    IntegerType node_local_id_offset = 0;
+    std::vector<IntegerType> nodes_local_ids(_mesh->getNumberOfNodes(), -1);
+    for (const auto* node : partition.nodes)
+    {
+        nodes_local_ids[node->getID()] = node_local_id_offset;
+        node_local_id_offset++;
+    }
+
+    data.regular_elements.resize(partition.regular_elements.size() +
+                                 data.config[8]);
+    IntegerType counter = partition.regular_elements.size();
+    for (std::size_t j = 0; j < partition.regular_elements.size(); j++)
+    {
+        const auto* elem = partition.regular_elements[j];
+        data.regular_elements[j] = counter;
+        getElementIntegerVariables(*elem, nodes_local_ids,
+                                   data.regular_elements, counter);
+    }
+
+    data.ghost_elements.resize(partition.ghost_elements.size() +
+                               data.config[9]);
+    counter = partition.ghost_elements.size();
+    for (std::size_t j = 0; j < partition.ghost_elements.size(); j++)
+    {
+        const auto* elem = partition.ghost_elements[j];
+        data.ghost_elements[j] = counter;
+        getElementIntegerVariables(*elem, nodes_local_ids,
+                                   data.ghost_elements, counter);
+    }
+
+    return data;
+}
+
 void NodeWiseMeshPartitioner::writeBinary(const std::string& file_name_base)
 {
     const auto elem_integers = writeConfigDataBinary(file_name_base);
@@ -545,7 +640,7 @@ void NodeWiseMeshPartitioner::getElementIntegerVariables(
     const MeshLib::Element& elem,
     const std::vector<IntegerType>& local_node_ids,
     std::vector<IntegerType>& elem_info,
-    IntegerType& counter)
+    IntegerType& counter) const
 {
     unsigned mat_id = 0;  // TODO: Material ID to be set from the mesh data
     const IntegerType nn = elem.getNumberOfNodes();
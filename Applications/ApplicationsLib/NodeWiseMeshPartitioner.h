@@ -72,7 +72,18 @@ public:
 
     /// Write mesh to METIS input file
     /// \param file_name File name with an extension of mesh.
-    void writeMETIS(const std::string& file_name);
+
+    /*!
+        \brief Write the METIS mesh file for mpmetis.
+        \param file_name        output file name.
+        \param weight_property  optional name of an integer cell property
+                                holding per-element partitioning weights
+                                (e.g. measured per-element cost); empty
+                                writes the unweighted format, i.e. balancing
+                                by element count only.
+    */
+    void writeMETIS(const std::string& file_name,
+                    const std::string& weight_property = "");
 
     /// Write the partitions into ASCII files
     /// \param file_name_base The prefix of the file name.
@@ -82,6 +93,24 @@ public:
     /// \param file_name_base The prefix of the file name.
     void writeBinary(const std::string& file_name_base);
 
+    /// One partition's data with the exact layout of the binary
+    /// partitioned-mesh files, cf. writeBinary(): the 14-entry
+    /// configuration header, the NodeStruct array bytes and the integer
+    /// variables of the regular and ghost elements. The file offset entries
+    /// of the header are zero---each consumer holds only its own blocks.
+    struct PartitionBinaryData
+    {
+        std::vector<IntegerType> config;
+        std::vector<char> nodes;
+        std::vector<IntegerType> regular_elements;
+        std::vector<IntegerType> ghost_elements;
+    };
+
+    /// Extracts one partition in the binary-file layout, for handing a
+    /// partition to its rank without the intermediate files, cf. the
+    /// in-memory partitioning at simulation start.
+    PartitionBinaryData getPartitionBinaryData(std::size_t part_id) const;
+
     /// Write the global mesh into a VTU file
     /// \param file_name_base The prefix of the file name.
     void writeGlobalMeshVTU(const std::string& file_name_base);
@@ -133,7 +162,7 @@ private:
     void getElementIntegerVariables(const MeshLib::Element& elem,
                                     const std::vector<IntegerType>& local_node_ids,
                                     std::vector<IntegerType>& elem_info,
-                                    IntegerType& counter);
+                                    IntegerType& counter) const;
 
     /*!
          \brief Write the configuration data of the partition data in
@@ -34,6 +34,10 @@
 
 #include "ProcessLib/UncoupledProcessesTimeLoop.h"
 
+#ifdef OGS_USE_INSITU
+#include "InSituLib/Adaptor.h"
+#endif
+
 #include "ProcessLib/GroundwaterFlow/CreateGroundwaterFlowProcess.h"
 #include "ProcessLib/HeatConduction/CreateHeatConductionProcess.h"
 #include "ProcessLib/HydroMechanics/CreateHydroMechanicsProcess.h"
@@ -114,6 +118,20 @@ ProjectData::ProjectData(BaseLib::ConfigTree const& project_config,
     //! \ogs_file_param{prj__time_loop}
     parseTimeLoop(project_config.getConfigSubtree("time_loop"),
                   output_directory);
+
+    //! \ogs_file_param{prj__insitu}
+    if (auto insitu_config = project_config.getConfigSubtreeOptional("insitu"))
+    {
+#ifdef OGS_USE_INSITU
+        InSituLib::Initialize(
+            //! \ogs_file_param{prj__insitu__scripts}
+            insitu_config->getConfigSubtree("scripts"), project_directory);
+#else
+        OGS_FATAL(
+            "The project file configures in-situ visualization, but OGS was "
+            "built without insitu support (OGS_INSITU).");
+#endif
+    }
 }
 
 ProjectData::~ProjectData()
@@ -293,6 +311,47 @@ void ProjectData::parseProcesses(BaseLib::ConfigTree const& processes_config,
             //! \ogs_file_param{prj__processes__process__integration_order}
             process_config.getConfigParameter<int>("integration_order");
 
+        auto const global_matrix_order =
+            //! \ogs_file_param{prj__processes__process__global_matrix_order}
+            process_config.getConfigParameterOptional<std::string>(
+                "global_matrix_order");
+
+        auto const constant_operators =
+            //! \ogs_file_param{prj__processes__process__constant_operators}
+            process_config.getConfigParameterOptional<bool>(
+                "constant_operators");
+
+        auto const measure_element_costs =
+            //! \ogs_file_param{prj__processes__process__measure_element_costs}
+            process_config.getConfigParameterOptional<bool>(
+                "measure_element_costs");
+
+        // Time-dependent element deactivation, e.g. excavation sequences.
+        std::vector<ProcessLib::DeactivatedSubdomain> deactivated_subdomains;
+        //! \ogs_file_param{prj__processes__process__element_deactivation}
+        if (auto deactivation_config =
+                process_config.getConfigSubtreeOptional("element_deactivation"))
+        {
+            for (auto subdomain_config :
+                 //! \ogs_file_param{prj__processes__process__element_deactivation__deactivated_subdomain}
+                 deactivation_config->getConfigSubtreeList(
+                     "deactivated_subdomain"))
+            {
+                ProcessLib::DeactivatedSubdomain subdomain;
+                subdomain.start_time =
+                    //! \ogs_file_param{prj__processes__process__element_deactivation__deactivated_subdomain__start_time}
+                    subdomain_config.getConfigParameter<double>("start_time");
+                subdomain.end_time =
+                    //! \ogs_file_param{prj__processes__process__element_deactivation__deactivated_subdomain__end_time}
+                    subdomain_config.getConfigParameter<double>("end_time");
+                subdomain.material_ids =
+                    //! \ogs_file_param{prj__processes__process__element_deactivation__deactivated_subdomain__material_ids}
+                    subdomain_config.getConfigParameter<std::vector<int>>(
+                        "material_ids");
+                deactivated_subdomains.push_back(std::move(subdomain));
+            }
+        }
+
         std::unique_ptr<ProcessLib::Process> process;
 
         auto jacobian_assembler = ProcessLib::createJacobianAssembler(
@@ -447,6 +506,31 @@ void ProjectData::parseProcesses(BaseLib::ConfigTree const& processes_config,
             OGS_FATAL("Unknown process type: %s", type.c_str());
         }
 
+        if (global_matrix_order)
+        {
+            if (*global_matrix_order == "BY_LOCATION")
+                process->setGlobalMatrixDOFOrder(
+                    NumLib::ComponentOrder::BY_LOCATION);
+            else if (*global_matrix_order == "BY_COMPONENT")
+                process->setGlobalMatrixDOFOrder(
+                    NumLib::ComponentOrder::BY_COMPONENT);
+            else
+                OGS_FATAL(
+                    "Unknown global matrix order `%s'. Known orders are "
+                    "BY_LOCATION and BY_COMPONENT.",
+                    global_matrix_order->c_str());
+        }
+
+        if (constant_operators)
+            process->setConstantOperators(*constant_operators);
+
+        if (measure_element_costs)
+            process->setMeasureElementCosts(*measure_element_costs);
+
+        if (!deactivated_subdomains.empty())
+            process->setElementDeactivation(
+                std::move(deactivated_subdomains));
+
         BaseLib::insertIfKeyUniqueElseError(_processes,
                                             name,
                                             std::move(process),
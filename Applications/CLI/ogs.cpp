@@ -11,20 +11,39 @@
  */
 
 #include <chrono>
+#include <iostream>
 #include <tclap/CmdLine.h>
 
+#ifdef USE_MPI
+#include <mpi.h>
+#endif
+
 // BaseLib
 #include "BaseLib/BuildInfo.h"
+#include "BaseLib/Deterministic.h"
 #include "BaseLib/ConfigTreeUtil.h"
 #include "BaseLib/DateTools.h"
 #include "BaseLib/FileTools.h"
+#include "BaseLib/HardwareCounters.h"
+#include "BaseLib/MemoryTelemetry.h"
+#include "BaseLib/PhaseTimings.h"
 #include "BaseLib/RunTime.h"
 
 #include "Applications/ApplicationsLib/LinearSolverLibrarySetup.h"
+#ifdef OGS_USE_INSITU
+#include "InSituLib/Adaptor.h"
+#endif
+#include "Applications/ApplicationsLib/InMemoryMeshPartitioning.h"
 #include "Applications/ApplicationsLib/LogogSetup.h"
 #include "Applications/ApplicationsLib/ProjectData.h"
+#include "MeshLib/IO/BinaryMeshIO.h"
+#include "MeshLib/Mesh.h"
 #include "ProcessLib/UncoupledProcessesTimeLoop.h"
+#include "ProcessLib/SimulationStatus.h"
 
+#include "NumLib/DOF/ComputeSparsityPattern.h"
+#include "NumLib/ODESolver/IterationTelemetry.h"
+#include "NumLib/ODESolver/LinearSystemCapture.h"
 #include "NumLib/NumericsConfig.h"
 
 
@@ -41,12 +60,12 @@ int main(int argc, char *argv[])
         ' ',
         BaseLib::BuildInfo::git_describe);
 
-    TCLAP::UnlabeledValueArg<std::string> project_arg(
+    TCLAP::UnlabeledMultiArg<std::string> project_arg(
         "project-file",
-        "Path to the ogs6 project file.",
+        "Path to the ogs6 project file; several files form an ensemble that "
+        "is run within this single launch (serial builds/runs only).",
         true,
-        "",
-        "PROJECT FILE");
+        "PROJECT FILE(S)");
     cmd.add(project_arg);
 
     TCLAP::ValueArg<std::string> outdir_arg(
@@ -79,6 +98,111 @@ int main(int argc, char *argv[])
         "use unbuffered standard output");
     cmd.add(unbuffered_cout_arg);
 
+    TCLAP::ValueArg<std::string> restart_arg(
+        "", "restart-from",
+        "checkpoint file written by <checkpoint_each_steps> to restart the "
+        "simulation from",
+        false,
+        "",
+        "checkpoint file");
+    cmd.add(restart_arg);
+
+    TCLAP::ValueArg<std::string> cache_directory_arg(
+        "", "cache-directory",
+        "directory for cached derived data (sparsity patterns); speeds up "
+        "repeated runs of the same mesh/process combination",
+        false,
+        "",
+        "cache directory");
+    cmd.add(cache_directory_arg);
+
+    TCLAP::ValueArg<std::string> hardware_counters_arg(
+        "", "write-hardware-counters",
+        "accumulate hardware performance counters per instrumentation phase "
+        "and write them to the given CSV file (requires "
+        "OGS_USE_PERF_COUNTERS builds)",
+        false,
+        "",
+        "hardware counters file");
+    cmd.add(hardware_counters_arg);
+
+    TCLAP::SwitchArg compile_arg(
+        "", "compile",
+        "parse and initialize the project once, write the compiled "
+        "artifacts (binary mesh next to the source mesh, sparsity pattern "
+        "cache in the project directory) and exit; subsequent runs pick "
+        "them up automatically and start in seconds");
+    cmd.add(compile_arg);
+
+    TCLAP::SwitchArg deterministic_arg(
+        "", "deterministic",
+        "make parallel assembly and reductions bitwise-reproducible (fixed "
+        "scatter order; trades a few percent of speed)");
+    cmd.add(deterministic_arg);
+
+    TCLAP::ValueArg<std::string> status_file_arg(
+        "", "status-file",
+        "periodically rewrite a JSON run status document (progress, ETA, "
+        "step and iteration histories, phase timings, memory) to the given "
+        "file",
+        false,
+        "",
+        "status file");
+    cmd.add(status_file_arg);
+
+    TCLAP::ValueArg<unsigned> status_port_arg(
+        "", "status-port",
+        "additionally serve the run status document on the given "
+        "localhost-only HTTP port",
+        false,
+        0,
+        "port");
+    cmd.add(status_port_arg);
+
+    TCLAP::ValueArg<std::string> memory_telemetry_arg(
+        "", "write-memory-telemetry",
+        "sample virtual/resident memory at phase boundaries and write them "
+        "to the given CSV file",
+        false,
+        "",
+        "memory telemetry file");
+    cmd.add(memory_telemetry_arg);
+
+    TCLAP::ValueArg<std::string> log_file_arg(
+        "", "log-file",
+        "write the log asynchronously to the given file instead of the "
+        "console (per-rank file recommended with MPI)",
+        false,
+        "",
+        "log file");
+    cmd.add(log_file_arg);
+
+    TCLAP::ValueArg<std::string> dump_worst_systems_arg(
+        "", "dump-worst-systems",
+        "dump the linear systems of the worst-converging nonlinear solves "
+        "into the given directory for offline replay",
+        false,
+        "",
+        "directory");
+    cmd.add(dump_worst_systems_arg);
+
+    TCLAP::ValueArg<std::string> iteration_telemetry_arg(
+        "", "write-iteration-telemetry",
+        "write per-iteration nonlinear solver telemetry to the given CSV "
+        "file",
+        false,
+        "",
+        "telemetry file");
+    cmd.add(iteration_telemetry_arg);
+
+    TCLAP::ValueArg<std::string> phase_timings_arg(
+        "", "write-phase-timings",
+        "write per-process, per-phase timings to the given CSV or JSON file",
+        false,
+        "",
+        "timings file");
+    cmd.add(phase_timings_arg);
+
     cmd.parse(argc, argv);
 
     // deactivate buffer for standard output if specified
@@ -87,6 +211,42 @@ int main(int argc, char *argv[])
 
     ApplicationsLib::LogogSetup logog_setup;
     logog_setup.setLevel(log_level_arg.getValue());
+    if (log_file_arg.isSet())
+        logog_setup.enableAsyncFileLogging(log_file_arg.getValue());
+
+    if (phase_timings_arg.isSet())
+        BaseLib::PhaseTimings::instance().setOutputFile(
+            phase_timings_arg.getValue());
+
+    if (cache_directory_arg.isSet())
+        NumLib::enableSparsityPatternDiskCache(
+            cache_directory_arg.getValue());
+
+    if (iteration_telemetry_arg.isSet())
+        NumLib::IterationTelemetry::instance().setOutputFile(
+            iteration_telemetry_arg.getValue());
+
+    if (dump_worst_systems_arg.isSet())
+        NumLib::LinearSystemCapture::instance().setOutputDirectory(
+            dump_worst_systems_arg.getValue());
+
+    if (deterministic_arg.isSet())
+        BaseLib::setDeterministicParallelMode(true);
+
+    if (status_file_arg.isSet())
+        ProcessLib::SimulationStatus::instance().setStatusFile(
+            status_file_arg.getValue());
+    if (status_port_arg.isSet())
+        ProcessLib::SimulationStatus::instance().setHttpPort(
+            status_port_arg.getValue());
+
+    if (memory_telemetry_arg.isSet())
+        BaseLib::MemoryTelemetry::instance().setOutputFile(
+            memory_telemetry_arg.getValue());
+
+    if (hardware_counters_arg.isSet())
+        BaseLib::HardwareCounters::instance().setOutputFile(
+            hardware_counters_arg.getValue());
 
     INFO("This is OpenGeoSys-6 version %s.",
          BaseLib::BuildInfo::git_describe.c_str());
@@ -104,18 +264,62 @@ int main(int argc, char *argv[])
 
     try
     {
-        bool solver_succeeded = false;
+        ApplicationsLib::LinearSolverLibrarySetup
+            linear_solver_library_setup(argc, argv);
+
+        // Parallel runs given an unpartitioned mesh partition it in memory
+        // at startup instead of failing; existing partition files are used
+        // as before.
+        ApplicationUtils::enableInMemoryPartitioning();
+
+        // Ensemble mode: the configured project files are run one after the
+        // other within this launch, amortizing the process startup and the
+        // warm caches (sparsity patterns, OS page cache of shared meshes)
+        // over all variants. Parallel runs cannot distribute the variants
+        // over the ranks: the partitioned mesh reading, the in-memory
+        // partitioning and the phase-timing aggregation are collective on
+        // the world communicator, so per-rank projects would deadlock.
+        auto const& project_files = project_arg.getValue();
+#ifdef USE_MPI
+        if (project_files.size() > 1)
         {
-            ApplicationsLib::LinearSolverLibrarySetup
-                linear_solver_library_setup(argc, argv);
+            int world_size = 1;
+            MPI_Comm_size(MPI_COMM_WORLD, &world_size);
+            if (world_size > 1)
+                OGS_FATAL(
+                    "Ensembles of project files are not supported in "
+                    "parallel runs; launch the variants as separate jobs.");
+        }
+#endif
 
+        bool all_succeeded = true;
+        for (std::size_t variant = 0; variant < project_files.size();
+             ++variant)
+        {
+        auto const& project_file = project_files[variant];
+        if (project_files.size() > 1)
+            INFO("=== Running ensemble variant %u: %s",
+                 static_cast<unsigned>(variant), project_file.c_str());
+
+        bool solver_succeeded = false;
+        {
             auto project_config = BaseLib::makeConfigTree(
-                project_arg.getValue(), !nonfatal_arg.getValue(),
+                project_file, !nonfatal_arg.getValue(),
                 "OpenGeoSysProject");
 
-            ProjectData project(*project_config,
-                                BaseLib::extractPath(project_arg.getValue()),
-                                outdir_arg.getValue());
+            BaseLib::MemoryTelemetry::instance().sample("startup");
+
+            std::unique_ptr<ProjectData> project_holder;
+            {
+                BaseLib::ScopedPhaseTimer phase_timer(
+                    "startup/project_parsing");
+                project_holder.reset(new ProjectData(
+                    *project_config, BaseLib::extractPath(project_file),
+                    outdir_arg.getValue()));
+            }
+            ProjectData& project = *project_holder;
+
+            BaseLib::MemoryTelemetry::instance().sample("project_loaded");
 
             // Check intermediately that config parsing went fine.
             project_config.checkAndInvalidate();
@@ -123,17 +327,54 @@ int main(int argc, char *argv[])
 
             BaseLib::ConfigTree::assertNoSwallowedErrors();
 
+            if (compile_arg.isSet() && !cache_directory_arg.isSet())
+            {
+                // Default the sparsity cache next to the project, so a
+                // plain re-run finds it via the same default.
+                NumLib::enableSparsityPatternDiskCache(
+                    BaseLib::extractPath(project_file));
+            }
+
             INFO("Initialize processes.");
-            for (auto& p : project.getProcesses())
             {
-                p.second->initialize();
+                BaseLib::ScopedPhaseTimer phase_timer(
+                    "startup/process_initialization");
+                for (auto& p : project.getProcesses())
+                {
+                    p.second->initialize();
+                }
             }
 
             BaseLib::ConfigTree::assertNoSwallowedErrors();
 
+            BaseLib::MemoryTelemetry::instance().sample(
+                "processes_initialized");
+
+            if (compile_arg.isSet())
+            {
+                // Write the compiled meshes and stop before the time loop;
+                // the sparsity patterns were cached during initialization.
+                for (auto const* const mesh : project.getMeshObjects())
+                {
+                    std::string const compiled_name =
+                        BaseLib::joinPaths(BaseLib::extractPath(project_file),
+                                           mesh->getName()) + ".bms";
+                    if (MeshLib::IO::writeMeshToBinaryFile(*mesh,
+                                                           compiled_name))
+                        INFO("Compiled mesh written to '%s'.",
+                             compiled_name.c_str());
+                }
+                INFO("Project compiled; subsequent runs reuse the "
+                     "artifacts.");
+                solver_succeeded = true;
+                continue;
+            }
+
             INFO("Solve processes.");
 
             auto& time_loop = project.getTimeLoop();
+            if (restart_arg.isSet() && project_files.size() == 1)
+                time_loop.setRestartFile(restart_arg.getValue());
             solver_succeeded = time_loop.loop();
         }  // This nested scope ensures that everything that could possibly
            // possess a ConfigTree is destructed before the final check below is
@@ -141,7 +382,19 @@ int main(int argc, char *argv[])
 
         BaseLib::ConfigTree::assertNoSwallowedErrors();
 
-        ogs_status = solver_succeeded ? EXIT_SUCCESS : EXIT_FAILURE;
+        all_succeeded = all_succeeded && solver_succeeded;
+        }  // end of ensemble loop
+
+#ifdef OGS_USE_INSITU
+        InSituLib::Finalize();
+#endif
+        BaseLib::MemoryTelemetry::instance().sample("end_of_run");
+        BaseLib::PhaseTimings::instance().write();
+        NumLib::IterationTelemetry::instance().write();
+        BaseLib::MemoryTelemetry::instance().write();
+        BaseLib::HardwareCounters::instance().write();
+
+        ogs_status = all_succeeded ? EXIT_SUCCESS : EXIT_FAILURE;
     } catch (std::exception& e) {
         ERR(e.what());
         ogs_status = EXIT_FAILURE;
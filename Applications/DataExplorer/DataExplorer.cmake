@@ -49,6 +49,7 @@ add_executable(DataExplorer
 )
 
 target_link_libraries(DataExplorer
+    Qt5::Concurrent
     Qt5::Core
     Qt5::Gui
     Qt5::Widgets
@@ -34,6 +34,8 @@
 
 #include "QVtkDataSetMapper.h"
 #include <vtkActor.h>
+#include <vtkDataSet.h>
+#include <vtkQuadricLODActor.h>
 #include <vtkCellData.h>
 #include <vtkDataSetMapper.h>
 #include <vtkImageAlgorithm.h>
@@ -114,7 +116,26 @@ void VtkVisPointSetItem::Initialize(vtkRenderer* renderer)
     _mapper->SetColorModeToMapScalars();
 
     _mapper->SetInputConnection(_transformFilter->GetOutputPort());
-    _actor = vtkActor::New();
+
+    // Large meshes render through a level-of-detail actor: during camera
+    // interaction a quadric-clustering proxy is shown and the full
+    // resolution returns on the still render, keeping the GUI responsive
+    // for production-size meshes. vtkQuadricLODActor derives from vtkActor,
+    // so the property handling below is unaffected.
+    auto* const data_set =
+        vtkDataSet::SafeDownCast(_transformFilter->GetOutputDataObject(0));
+    QSettings settings;
+    qlonglong const lod_threshold =
+        settings.value("VtkVis/LODCellThreshold", 5000000).toLongLong();
+    if (data_set && lod_threshold > 0 &&
+        data_set->GetNumberOfCells() > lod_threshold)
+    {
+        vtkQuadricLODActor* const lod_actor = vtkQuadricLODActor::New();
+        lod_actor->SetDeferLODConstruction(false);  // build the proxy on load
+        _actor = lod_actor;
+    }
+    else
+        _actor = vtkActor::New();
     static_cast<vtkActor*>(_actor)->SetMapper(_mapper);
     _renderer->AddActor(_actor);
 
@@ -87,7 +87,10 @@
 #include <QDesktopWidget>
 #include <QFileDialog>
 #include <QMessageBox>
+#include <QFutureWatcher>
 #include <QObject>
+#include <QProgressDialog>
+#include <QtConcurrent/QtConcurrentRun>
 #include <QSettings>
 #include <QSignalMapper>
 
@@ -497,23 +500,10 @@ void MainWindow::loadFile(ImportFileType::type t, const QString &fileName)
         // OpenGeoSys mesh files
         else if (fi.suffix().toLower() == "msh" || fi.suffix().toLower() == "vtu")
         {
-#ifndef NDEBUG
-            QTime myTimer0, myTimer1;
-            myTimer0.start();
-#endif
-            std::unique_ptr<MeshLib::Mesh> mesh(
-                MeshLib::IO::readMeshFromFile(fileName.toStdString()));
-#ifndef NDEBUG
-            INFO("Mesh loading time: %d ms.", myTimer0.elapsed());
-            myTimer1.start();
-#endif
-            if (mesh)
-                _meshModel->addMesh(std::move(mesh));
-            else
-                OGSError::box("Failed to load mesh file.");
-#ifndef NDEBUG
-            INFO("Mesh model setup time: %d ms.", myTimer1.elapsed());
-#endif
+            // Read on a worker thread; a 4GB VTU would otherwise freeze the
+            // UI for minutes. The model update happens back on the UI
+            // thread when the future finishes.
+            loadMeshInBackground(fileName);
         }
 
         settings.setValue("lastOpenedFileDirectory", dir.absolutePath());
@@ -1083,6 +1073,37 @@ void MainWindow::showMergeGeometriesDialog()
         OGSError::box("Points are missing for\n at least one geometry.");
 }
 
+void MainWindow::loadMeshInBackground(const QString &fileName)
+{
+    auto* const progress = new QProgressDialog(
+        "Loading " + fileName + "...", "Cancel", 0, 0, this);
+    progress->setWindowModality(Qt::NonModal);
+    auto* const watcher = new QFutureWatcher<MeshLib::Mesh*>(this);
+    connect(watcher, &QFutureWatcher<MeshLib::Mesh*>::finished, this,
+            [this, watcher, progress]() {
+                std::unique_ptr<MeshLib::Mesh> mesh(watcher->result());
+                // Cancelling cannot abort the read itself (the readers have
+                // no interruption points); the result is discarded instead.
+                bool const cancelled = progress->wasCanceled();
+                progress->close();
+                progress->deleteLater();
+                watcher->deleteLater();
+                if (mesh == nullptr)
+                {
+                    if (!cancelled)
+                        OGSError::box("Failed to load mesh file.");
+                    return;
+                }
+                if (!cancelled)
+                    _meshModel->addMesh(std::move(mesh));
+            });
+    std::string const file_name_utf8 = fileName.toStdString();
+    watcher->setFuture(QtConcurrent::run([file_name_utf8]() {
+        return MeshLib::IO::readMeshFromFile(file_name_utf8);
+    }));
+    progress->show();
+}
+
 void MainWindow::showMeshQualitySelectionDialog(MeshLib::VtkMappedMeshSource* mshSource)
 {
     if (mshSource == nullptr)
@@ -1092,11 +1113,35 @@ void MainWindow::showMeshQualitySelectionDialog(MeshLib::VtkMappedMeshSource* ms
     if (dlg.exec() != QDialog::Accepted)
         return;
     MeshLib::MeshQualityType const type (dlg.getSelectedMetric());
-    MeshLib::ElementQualityInterface quality_interface(*mshSource->GetMesh(), type);
-    _vtkVisPipeline->showMeshElementQuality(mshSource, type, quality_interface.getQualityVector());
-
-    if (dlg.getHistogram())
-        quality_interface.writeHistogram(dlg.getHistogramPath());
+    bool const histogram = dlg.getHistogram();
+    std::string const histogram_path = dlg.getHistogramPath();
+
+    // The quality metrics walk every element; compute them on a worker
+    // thread and apply the result on the UI thread when done.
+    auto* const progress = new QProgressDialog(
+        "Computing mesh quality...", "Cancel", 0, 0, this);
+    progress->setWindowModality(Qt::NonModal);
+    auto* const watcher =
+        new QFutureWatcher<std::vector<double>>(this);
+    connect(watcher, &QFutureWatcher<std::vector<double>>::finished, this,
+            [this, watcher, progress, mshSource, type]() {
+                bool const cancelled = progress->wasCanceled();
+                progress->close();
+                progress->deleteLater();
+                watcher->deleteLater();
+                if (!cancelled)
+                    _vtkVisPipeline->showMeshElementQuality(
+                        mshSource, type, watcher->result());
+            });
+    watcher->setFuture(QtConcurrent::run(
+        [mshSource, type, histogram, histogram_path]() {
+            MeshLib::ElementQualityInterface quality_interface(
+                *mshSource->GetMesh(), type);
+            if (histogram)
+                quality_interface.writeHistogram(histogram_path);
+            return quality_interface.getQualityVector();
+        }));
+    progress->show();
 }
 
 void MainWindow::showVisalizationPrefsDialog()
@@ -122,6 +122,9 @@ protected slots:
 private:
     QMenu* createImportFilesMenu();
     void loadFile(ImportFileType::type t, const QString &fileName);
+    /// Reads a mesh on a worker thread and adds it to the model on the UI
+    /// thread when finished, cf. loadFile().
+    void loadMeshInBackground(const QString &fileName);
     void loadFEMConditionsFromFile(const QString &fileName, std::string geoName = "");
     void readSettings();
     void writeSettings();
@@ -0,0 +1,56 @@
+/**
+ * \brief  Converts a mesh file into the native binary mesh format.
+ *
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ */
+
+#include <memory>
+
+#include <tclap/CmdLine.h>
+
+#include "Applications/ApplicationsLib/LogogSetup.h"
+#include "BaseLib/BuildInfo.h"
+#include "MeshLib/IO/BinaryMeshIO.h"
+#include "MeshLib/IO/readMeshFromFile.h"
+#include "MeshLib/Mesh.h"
+
+int main(int argc, char* argv[])
+{
+    ApplicationsLib::LogogSetup logog_setup;
+
+    TCLAP::CmdLine cmd(
+        "Converts a mesh (e.g. vtu) into the native binary mesh format "
+        "(.bms), whose on-disk layout matches the in-memory arrays and can "
+        "be read without parsing.\n\n"
+        "OpenGeoSys-6 software, version " +
+            BaseLib::BuildInfo::git_describe +
+            ".\n"
+            "Copyright (c) 2012-2017, OpenGeoSys Community "
+            "(http://www.opengeosys.org)",
+        ' ', BaseLib::BuildInfo::git_describe);
+    TCLAP::ValueArg<std::string> mesh_in_arg(
+        "i", "mesh-input-file",
+        "the name of the file containing the input mesh", true, "",
+        "file name of input mesh");
+    cmd.add(mesh_in_arg);
+    TCLAP::ValueArg<std::string> mesh_out_arg(
+        "o", "mesh-output-file",
+        "the name of the .bms file the mesh will be written to", true, "",
+        "file name of output mesh");
+    cmd.add(mesh_out_arg);
+    cmd.parse(argc, argv);
+
+    std::unique_ptr<MeshLib::Mesh> const mesh(
+        MeshLib::IO::readMeshFromFile(mesh_in_arg.getValue()));
+    if (!mesh)
+        return EXIT_FAILURE;
+
+    if (!MeshLib::IO::writeMeshToBinaryFile(*mesh, mesh_out_arg.getValue()))
+        return EXIT_FAILURE;
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,144 @@
+/**
+ * \brief  Maps collectively written nodal data back onto the bulk mesh.
+ *
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ */
+
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <vector>
+
+#include <tclap/CmdLine.h>
+
+#include "Applications/ApplicationsLib/LogogSetup.h"
+#include "BaseLib/BuildInfo.h"
+#include "MeshLib/IO/readMeshFromFile.h"
+#include "MeshLib/IO/writeMeshToFile.h"
+#include "MeshLib/Mesh.h"
+
+namespace
+{
+template <typename T>
+bool readValue(std::istream& in, T& value)
+{
+    in.read(reinterpret_cast<char*>(&value), sizeof(T));
+    return static_cast<bool>(in);
+}
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+    ApplicationsLib::LogogSetup logog_setup;
+
+    TCLAP::CmdLine cmd(
+        "Maps a collectively written nodal data file (.ond, produced by the "
+        "MPI-IO output writer of partitioned runs) back onto the bulk mesh "
+        "and writes a single .vtu for ParaView.\n\n"
+        "OpenGeoSys-6 software, version " +
+            BaseLib::BuildInfo::git_describe +
+            ".\n"
+            "Copyright (c) 2012-2017, OpenGeoSys Community "
+            "(http://www.opengeosys.org)",
+        ' ', BaseLib::BuildInfo::git_describe);
+    TCLAP::ValueArg<std::string> mesh_arg(
+        "m", "mesh", "the bulk (unpartitioned) mesh file", true, "",
+        "mesh file");
+    cmd.add(mesh_arg);
+    TCLAP::ValueArg<std::string> data_arg(
+        "i", "node-data-file", "the .ond nodal data file", true, "",
+        "node data file");
+    cmd.add(data_arg);
+    TCLAP::ValueArg<std::string> output_arg(
+        "o", "output-file", "the .vtu file to write", true, "",
+        "output file");
+    cmd.add(output_arg);
+    cmd.parse(argc, argv);
+
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MeshLib::IO::readMeshFromFile(mesh_arg.getValue()));
+    if (!mesh)
+        return EXIT_FAILURE;
+
+    std::ifstream in(data_arg.getValue(), std::ios::binary);
+    if (!in)
+    {
+        ERR("Could not open '%s'.", data_arg.getValue().c_str());
+        return EXIT_FAILURE;
+    }
+
+    char magic[8];
+    in.read(magic, sizeof(magic));
+    if (!in || std::string(magic, 8) != "OGSOND01")
+    {
+        ERR("'%s' is not an OGS node data file.", data_arg.getValue().c_str());
+        return EXIT_FAILURE;
+    }
+
+    std::uint64_t total_count, n_arrays;
+    if (!readValue(in, total_count) || !readValue(in, n_arrays))
+        return EXIT_FAILURE;
+    if (total_count != mesh->getNumberOfNodes())
+    {
+        ERR("The node data file holds %llu nodes, the mesh %lu.",
+            static_cast<unsigned long long>(total_count),
+            static_cast<unsigned long>(mesh->getNumberOfNodes()));
+        return EXIT_FAILURE;
+    }
+
+    struct ArrayInfo
+    {
+        std::string name;
+        std::uint64_t n_components;
+    };
+    std::vector<ArrayInfo> arrays(n_arrays);
+    for (auto& array : arrays)
+    {
+        std::uint64_t name_length;
+        if (!readValue(in, name_length))
+            return EXIT_FAILURE;
+        array.name.resize(name_length);
+        in.read(&array.name[0], name_length);
+        if (!readValue(in, array.n_components))
+            return EXIT_FAILURE;
+    }
+
+    for (auto const& array : arrays)
+    {
+        auto* const property =
+            mesh->getProperties().createNewPropertyVector<double>(
+                array.name, MeshLib::MeshItemType::Node, array.n_components);
+        if (property == nullptr)
+            return EXIT_FAILURE;
+        property->resize(total_count * array.n_components);
+
+        for (std::uint64_t i = 0; i < total_count; ++i)
+        {
+            std::uint64_t global_id;
+            if (!readValue(in, global_id))
+                return EXIT_FAILURE;
+            // Validate the file-provided index before using it as a write
+            // position; a truncated or corrupt file must fail, not scribble.
+            if (global_id >= total_count)
+            {
+                ERR("Corrupt node data file: node id %llu out of range "
+                    "(%llu nodes).",
+                    static_cast<unsigned long long>(global_id),
+                    static_cast<unsigned long long>(total_count));
+                return EXIT_FAILURE;
+            }
+            in.read(reinterpret_cast<char*>(
+                        property->data() + global_id * array.n_components),
+                    array.n_components * sizeof(double));
+            if (!in)
+                return EXIT_FAILURE;
+        }
+    }
+
+    MeshLib::IO::writeMeshToFile(*mesh, output_arg.getValue());
+    return EXIT_SUCCESS;
+}
@@ -18,6 +18,7 @@
 
 #include "Applications/ApplicationsLib/LogogSetup.h"
 
+#include "MeshLib/IO/Legacy/StreamingMeshConversion.h"
 #include "MeshLib/IO/VtkIO/VtuInterface.h"
 #include "MeshLib/IO/readMeshFromFile.h"
 #include "MeshLib/Mesh.h"
@@ -35,8 +36,21 @@ int main (int argc, char* argv[])
                                           "the name of the file the mesh will be written to", true,
                                           "", "file name of output mesh");
     cmd.add(mesh_out);
+    TCLAP::SwitchArg streaming_arg(
+        "s", "streaming",
+        "convert block-wise with bounded memory instead of loading the full "
+        "mesh (OGS legacy .msh input, appended-binary .vtu output)");
+    cmd.add(streaming_arg);
     cmd.parse(argc, argv);
 
+    if (streaming_arg.getValue())
+    {
+        return MeshLib::IO::Legacy::convertMeshToVtuStreaming(
+                   mesh_in.getValue(), mesh_out.getValue())
+                   ? EXIT_SUCCESS
+                   : EXIT_FAILURE;
+    }
+
     std::unique_ptr<MeshLib::Mesh const> mesh(
         MeshLib::IO::readMeshFromFile(mesh_in.getValue()));
     INFO("Mesh read: %d nodes, %d elements.", mesh->getNumberOfNodes(), mesh->getNumberOfElements());
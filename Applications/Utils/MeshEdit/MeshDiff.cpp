@@ -0,0 +1,147 @@
+/**
+ * \brief  Diffs two meshes and writes a property overlay for the variant.
+ *
+ * Between parameter-study variants typically only a property field (e.g. a
+ * permeability realization) changes. This tool compares a variant mesh
+ * against the base mesh and writes the differing or added property vectors
+ * as a mesh overlay (.bmo, cf. MeshLib/IO/BinaryMeshIO.h), so each variant
+ * is stored as the base mesh plus a small delta and loads through
+ * readMeshFromFile() like any other mesh.
+ *
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <tclap/CmdLine.h>
+
+#include "Applications/ApplicationsLib/LogogSetup.h"
+
+#include "MeshLib/IO/BinaryMeshIO.h"
+#include "MeshLib/IO/readMeshFromFile.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/Properties.h"
+#include "MeshLib/PropertyVector.h"
+
+namespace
+{
+
+/// Compares the variant's property vector of type T against the base's.
+/// Returns true (and sets differs) if the variant's vector is of type T.
+template <typename T>
+bool compareAs(MeshLib::Properties const& base_properties,
+               MeshLib::Properties const& variant_properties,
+               std::string const& name, bool& differs)
+{
+    auto const* const variant_values =
+        variant_properties.getPropertyVector<T>(name);
+    if (variant_values == nullptr)
+        return false;
+
+    if (!base_properties.hasPropertyVector(name)) {
+        differs = true;  // added in the variant
+        return true;
+    }
+    auto const* const base_values = base_properties.getPropertyVector<T>(name);
+    differs =
+        base_values == nullptr ||  // type changed
+        base_values->getMeshItemType() != variant_values->getMeshItemType() ||
+        base_values->getNumberOfComponents() !=
+            variant_values->getNumberOfComponents() ||
+        static_cast<std::vector<T> const&>(*base_values) !=
+            static_cast<std::vector<T> const&>(*variant_values);
+    return true;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+    ApplicationsLib::LogogSetup logog_setup;
+
+    TCLAP::CmdLine cmd(
+        "Compares a variant mesh against a base mesh and writes the "
+        "differing property vectors as a mesh overlay (.bmo). The overlay "
+        "references the base mesh file and loads through readMeshFromFile().",
+        ' ', "0.1");
+    TCLAP::ValueArg<std::string> base_arg(
+        "b", "base-mesh-file", "the base mesh shared by all variants", true,
+        "", "base mesh file");
+    cmd.add(base_arg);
+    TCLAP::ValueArg<std::string> variant_arg(
+        "i", "variant-mesh-file", "the variant mesh to diff against the base",
+        true, "", "variant mesh file");
+    cmd.add(variant_arg);
+    TCLAP::ValueArg<std::string> output_arg(
+        "o", "output-file", "the overlay file to write (.bmo)", true, "",
+        "overlay file");
+    cmd.add(output_arg);
+    cmd.parse(argc, argv);
+
+    std::unique_ptr<MeshLib::Mesh> const base_mesh(
+        MeshLib::IO::readMeshFromFile(base_arg.getValue()));
+    std::unique_ptr<MeshLib::Mesh> const variant_mesh(
+        MeshLib::IO::readMeshFromFile(variant_arg.getValue()));
+    if (!base_mesh || !variant_mesh)
+        return EXIT_FAILURE;
+
+    if (base_mesh->getNumberOfNodes() != variant_mesh->getNumberOfNodes() ||
+        base_mesh->getNumberOfElements() !=
+            variant_mesh->getNumberOfElements())
+    {
+        ERR("The meshes differ in geometry (%u/%u nodes, %u/%u elements); "
+            "an overlay only covers property changes.",
+            base_mesh->getNumberOfNodes(), variant_mesh->getNumberOfNodes(),
+            base_mesh->getNumberOfElements(),
+            variant_mesh->getNumberOfElements());
+        return EXIT_FAILURE;
+    }
+
+    auto const& base_properties = base_mesh->getProperties();
+    auto const& variant_properties = variant_mesh->getProperties();
+
+    std::vector<std::string> differing_names;
+    for (auto const& name : variant_properties.getPropertyVectorNames())
+    {
+        bool differs = false;
+        if (compareAs<double>(base_properties, variant_properties, name,
+                              differs) ||
+            compareAs<float>(base_properties, variant_properties, name,
+                             differs) ||
+            compareAs<int>(base_properties, variant_properties, name,
+                           differs) ||
+            compareAs<unsigned>(base_properties, variant_properties, name,
+                                differs) ||
+            compareAs<long>(base_properties, variant_properties, name,
+                            differs) ||
+            compareAs<char>(base_properties, variant_properties, name,
+                            differs))
+        {
+            if (differs)
+                differing_names.push_back(name);
+        }
+        else
+            WARN("Property vector '%s' has an unsupported type and was not "
+                 "compared.", name.c_str());
+    }
+
+    INFO("%u of %u property vectors differ.",
+         static_cast<unsigned>(differing_names.size()),
+         static_cast<unsigned>(
+             variant_properties.getPropertyVectorNames().size()));
+
+    if (!MeshLib::IO::writeMeshOverlayFile(*variant_mesh, base_arg.getValue(),
+                                           differing_names,
+                                           output_arg.getValue()))
+        return EXIT_FAILURE;
+
+    INFO("Overlay written to '%s'.", output_arg.getValue().c_str());
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,61 @@
+/**
+ * \brief  Transfers field data from one mesh onto another.
+ *
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <memory>
+#include <string>
+
+#include <tclap/CmdLine.h>
+
+#include "Applications/ApplicationsLib/LogogSetup.h"
+
+#include "MeshLib/IO/readMeshFromFile.h"
+#include "MeshLib/IO/writeMeshToFile.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshEditing/TransferMeshProperties.h"
+
+int main(int argc, char* argv[])
+{
+    ApplicationsLib::LogogSetup logog_setup;
+
+    TCLAP::CmdLine cmd(
+        "Transfers all double-typed node and cell property vectors from a "
+        "source mesh onto a target mesh (e.g. a refinement of it), so a new "
+        "study stage starts from the projected fields instead of cold "
+        "initial conditions. The written target mesh serves as "
+        "initial-condition source via MeshNode/MeshElement parameters.",
+        ' ', "0.1");
+    TCLAP::ValueArg<std::string> source_arg(
+        "s", "source-mesh-file", "the mesh carrying the fields", true, "",
+        "source mesh file");
+    cmd.add(source_arg);
+    TCLAP::ValueArg<std::string> target_arg(
+        "i", "target-mesh-file", "the mesh the fields are projected onto",
+        true, "", "target mesh file");
+    cmd.add(target_arg);
+    TCLAP::ValueArg<std::string> output_arg(
+        "o", "output-mesh-file", "the target mesh including the fields",
+        true, "", "output mesh file");
+    cmd.add(output_arg);
+    cmd.parse(argc, argv);
+
+    std::unique_ptr<MeshLib::Mesh> const source(
+        MeshLib::IO::readMeshFromFile(source_arg.getValue()));
+    std::unique_ptr<MeshLib::Mesh> target(
+        MeshLib::IO::readMeshFromFile(target_arg.getValue()));
+    if (!source || !target)
+        return EXIT_FAILURE;
+
+    if (!MeshLib::transferMeshProperties(*source, *target))
+        return EXIT_FAILURE;
+
+    MeshLib::IO::writeMeshToFile(*target, output_arg.getValue());
+    return EXIT_SUCCESS;
+}
@@ -85,6 +85,12 @@ int main (int argc, char* argv[])
         false, min_thickness, "minimum layer thickness");
     cmd.add(min_thickness_arg);
 
+    TCLAP::SwitchArg windowed_arg(
+        "w", "windowed",
+        "stream the rasters through the windowed reader with bounded memory "
+        "instead of loading them completely (*.asc rasters only)");
+    cmd.add(windowed_arg);
+
     cmd.parse(argc, argv);
 
     if (min_thickness_arg.isSet())
@@ -114,7 +120,15 @@ int main (int argc, char* argv[])
         return EXIT_FAILURE;
 
     MeshLib::MeshLayerMapper mapper;
-    if (auto rasters = FileIO::readRasters(raster_paths))
+    if (windowed_arg.getValue())
+    {
+        // raster_paths is already ordered bottom-to-top, like the raster
+        // vector of createRasterLayers.
+        if (!mapper.createLayersFromRasterFiles(*sfc_mesh, raster_paths,
+                                                min_thickness))
+            return EXIT_FAILURE;
+    }
+    else if (auto rasters = FileIO::readRasters(raster_paths))
     {
         if (!mapper.createLayers(*sfc_mesh, *rasters, min_thickness))
             return EXIT_FAILURE;
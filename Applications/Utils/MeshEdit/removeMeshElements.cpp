@@ -97,7 +97,7 @@ int main (int argc, char* argv[])
 
     cmd.parse(argc, argv);
 
-    std::unique_ptr<MeshLib::Mesh const> mesh(
+    std::unique_ptr<MeshLib::Mesh> mesh(
         MeshLib::IO::readMeshFromFile(mesh_in.getValue()));
     INFO("Mesh read: %d nodes, %d elements.", mesh->getNumberOfNodes(), mesh->getNumberOfElements());
     MeshLib::ElementSearch searcher(*mesh);
@@ -155,15 +155,17 @@ int main (int argc, char* argv[])
         INFO("%d elements found.", n_removed_elements);
     }
 
-    // remove the elements and create a new mesh object.
-    std::unique_ptr<MeshLib::Mesh const> new_mesh(MeshLib::removeElements(
-        *mesh, searcher.getSearchedElementIDs(), mesh->getName()));
-
-    if (new_mesh == nullptr)
+    // remove the elements in place; this compacts the mesh incrementally
+    // instead of re-running the full mesh constructor.
+    if (searcher.getSearchedElementIDs().size() == mesh->getNumberOfElements())
+    {
+        ERR("All elements of the mesh would be removed.");
         return EXIT_FAILURE;
+    }
+    mesh->removeElements(searcher.getSearchedElementIDs());
 
     // write into a file
-    MeshLib::IO::writeMeshToFile(*new_mesh, mesh_out.getValue());
+    MeshLib::IO::writeMeshToFile(*mesh, mesh_out.getValue());
 
     return EXIT_SUCCESS;
 }
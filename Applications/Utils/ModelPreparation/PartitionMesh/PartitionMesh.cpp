@@ -27,7 +27,7 @@
 
 #include "MeshLib/IO/readMeshFromFile.h"
 
-#include "NodeWiseMeshPartitioner.h"
+#include "Applications/ApplicationsLib/NodeWiseMeshPartitioner.h"
 
 int main(int argc, char* argv[])
 {
@@ -71,6 +71,14 @@ int main(int argc, char* argv[])
     TCLAP::SwitchArg ascii_flag("a", "ascii", "Enable ASCII output.", false);
     cmd.add(ascii_flag);
 
+    TCLAP::ValueArg<std::string> weight_property_arg(
+        "w", "weight-property",
+        "name of an integer cell property with per-element partitioning "
+        "weights (e.g. measured per-element cost); balances weighted load "
+        "instead of element count",
+        false, "", "property name");
+    cmd.add(weight_property_arg);
+
     cmd.parse(argc, argv);
 
     BaseLib::RunTime run_timer;
@@ -93,7 +101,8 @@ int main(int argc, char* argv[])
     {
         INFO("Write the mesh into METIS input file.");
         mesh_partitioner.writeMETIS(BaseLib::dropFileExtension(ifile_name) +
-                                    ".mesh");
+                                        ".mesh",
+                                    weight_property_arg.getValue());
     }
     else
     {
@@ -0,0 +1,214 @@
+/**
+ * \brief  Strong/weak scaling study driver.
+ *
+ * Runs a user-given command template over a ladder of rank counts,
+ * collects the per-phase timings written by ogs --write-phase-timings and
+ * emits a scaling report with the parallel efficiency per phase. Turns a
+ * hand-scripted week of cluster babysitting into one command:
+ *
+ *   ScalingStudy -c "mpirun -np {ranks} bin/ogs model_{ranks}.prj \
+ *                    --write-phase-timings {timings}" -r 1,2,4,8,16
+ *
+ * The {ranks} placeholder is replaced by the current rung, {timings} by a
+ * per-rung file the report is collected from; prj/mesh ladders (refinement
+ * via the mesh generators, partitions via partmesh) are prepared by the
+ * caller and referenced from the command template.
+ *
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <tclap/CmdLine.h>
+
+namespace
+{
+
+std::string replaceAll(std::string text, std::string const& placeholder,
+                       std::string const& value)
+{
+    for (auto pos = text.find(placeholder); pos != std::string::npos;
+         pos = text.find(placeholder, pos + value.size()))
+        text.replace(pos, placeholder.size(), value);
+    return text;
+}
+
+/// Sums the recorded seconds per phase over all time steps and contexts.
+/// Understands both the serial CSV (time column) and the MPI-aggregated CSV
+/// (time_mean column) of BaseLib::PhaseTimings.
+bool collectPhaseTimes(std::string const& filename,
+                       std::map<std::string, double>& phase_times)
+{
+    std::ifstream in(filename);
+    if (!in) {
+        std::fprintf(stderr, "error: no timings file '%s' was produced.\n",
+                     filename.c_str());
+        return false;
+    }
+
+    std::string line;
+    if (!std::getline(in, line)) {
+        std::fprintf(stderr, "error: timings file '%s' is empty.\n",
+                     filename.c_str());
+        return false;
+    }
+
+    // Find the phase and time columns in the header.
+    std::vector<std::string> header;
+    {
+        std::istringstream header_stream(line);
+        std::string field;
+        while (std::getline(header_stream, field, ','))
+            header.push_back(field);
+    }
+    auto const indexOf = [&header](std::string const& name) {
+        auto const it = std::find(header.begin(), header.end(), name);
+        return it == header.end() ? -1 : static_cast<int>(it - header.begin());
+    };
+    int const phase_column = indexOf("phase");
+    int time_column = indexOf("time");
+    if (time_column == -1)
+        time_column = indexOf("time_mean");
+    if (phase_column == -1 || time_column == -1) {
+        std::fprintf(stderr, "error: '%s' is not a phase-timings CSV.\n",
+                     filename.c_str());
+        return false;
+    }
+
+    while (std::getline(in, line)) {
+        std::istringstream line_stream(line);
+        std::string field, phase;
+        double seconds = 0.0;
+        for (int column = 0; std::getline(line_stream, field, ','); ++column) {
+            if (column == phase_column)
+                phase = field;
+            else if (column == time_column)
+                seconds = std::strtod(field.c_str(), nullptr);
+        }
+        if (!phase.empty())
+            phase_times[phase] += seconds;
+    }
+    return true;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+    TCLAP::CmdLine cmd(
+        "Runs a command template over a ladder of rank counts and reports "
+        "the parallel efficiency per phase from the collected "
+        "--write-phase-timings output.",
+        ' ', "0.1");
+    TCLAP::ValueArg<std::string> command_arg(
+        "c", "command",
+        "command template; {ranks} is replaced by the current rung, "
+        "{timings} by the per-rung timings file",
+        true, "", "command template");
+    cmd.add(command_arg);
+    TCLAP::ValueArg<std::string> ranks_arg(
+        "r", "ranks", "comma-separated rank ladder, e.g. 1,2,4,8", true, "",
+        "rank list");
+    cmd.add(ranks_arg);
+    TCLAP::ValueArg<std::string> report_arg(
+        "o", "output", "scaling report CSV (default: scaling_report.csv)",
+        false, "scaling_report.csv", "report file");
+    cmd.add(report_arg);
+    TCLAP::SwitchArg weak_arg(
+        "w", "weak",
+        "weak scaling: the problem grows with the ranks, the ideal time is "
+        "constant (efficiency t_1/t_N instead of t_1/(N t_N))");
+    cmd.add(weak_arg);
+    cmd.parse(argc, argv);
+
+    std::vector<unsigned> ranks;
+    {
+        std::istringstream ranks_stream(ranks_arg.getValue());
+        std::string field;
+        while (std::getline(ranks_stream, field, ','))
+            ranks.push_back(
+                static_cast<unsigned>(std::strtoul(field.c_str(), nullptr, 10)));
+    }
+    if (ranks.empty()) {
+        std::fprintf(stderr, "error: empty rank ladder.\n");
+        return 1;
+    }
+
+    // One phase->seconds map per rung, collected after each run.
+    std::vector<std::map<std::string, double>> ladder_times;
+    for (auto const rung_ranks : ranks)
+    {
+        std::string const timings_file =
+            "scaling_timings_" + std::to_string(rung_ranks) + ".csv";
+        std::string const command = replaceAll(
+            replaceAll(command_arg.getValue(), "{ranks}",
+                       std::to_string(rung_ranks)),
+            "{timings}", timings_file);
+
+        std::printf("== %u ranks: %s\n", rung_ranks, command.c_str());
+        if (std::system(command.c_str()) != 0) {
+            std::fprintf(stderr, "error: the run with %u ranks failed.\n",
+                         rung_ranks);
+            return 1;
+        }
+
+        ladder_times.emplace_back();
+        if (!collectPhaseTimes(timings_file, ladder_times.back()))
+            return 1;
+    }
+
+    std::ofstream report(report_arg.getValue());
+    if (!report) {
+        std::fprintf(stderr, "error: could not open report '%s'.\n",
+                     report_arg.getValue().c_str());
+        return 1;
+    }
+
+    auto const& baseline = ladder_times.front();
+    double const baseline_ranks = ranks.front();
+
+    report << "phase";
+    for (auto const rung_ranks : ranks)
+        report << ",time_" << rung_ranks << ",efficiency_" << rung_ranks;
+    report << '\n';
+
+    for (auto const& phase_baseline : baseline)
+    {
+        auto const& phase = phase_baseline.first;
+        report << phase;
+        std::printf("%-28s", phase.c_str());
+        for (std::size_t rung = 0; rung < ranks.size(); ++rung)
+        {
+            auto const it = ladder_times[rung].find(phase);
+            double const seconds =
+                it != ladder_times[rung].end() ? it->second : 0.0;
+            double const rank_growth = ranks[rung] / baseline_ranks;
+            double efficiency = 0.0;
+            if (seconds > 0.0)
+                efficiency = weak_arg.getValue()
+                                 ? phase_baseline.second / seconds
+                                 : phase_baseline.second /
+                                       (seconds * rank_growth);
+            report << ',' << seconds << ',' << efficiency;
+            std::printf("  %8.3fs (%3.0f%%)", seconds, 100.0 * efficiency);
+        }
+        report << '\n';
+        std::printf("\n");
+    }
+
+    std::printf("Scaling report written to '%s'.\n",
+                report_arg.getValue().c_str());
+    return 0;
+}
@@ -0,0 +1,105 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "AllocationGuard.h"
+
+#ifdef OGS_ENABLE_ALLOCATION_GUARD
+
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+#ifdef __GLIBC__
+#include <execinfo.h>
+#endif
+
+namespace
+{
+thread_local std::size_t allocation_count = 0;
+thread_local bool fail_on_allocation = false;
+thread_local char const* failing_scope_label = nullptr;
+
+void reportCallSite()
+{
+#ifdef __GLIBC__
+    // Print the allocation call stack; addresses resolve with addr2line.
+    void* frames[32];
+    int const n_frames = backtrace(frames, 32);
+    backtrace_symbols_fd(frames, n_frames, 2);
+#endif
+}
+}
+
+// Counting replacements of the global allocation functions. Only compiled
+// into guard-enabled (debugging) builds.
+void* operator new(std::size_t const size)
+{
+    ++allocation_count;
+    if (fail_on_allocation)
+    {
+        fail_on_allocation = false;  // avoid recursion via the I/O below
+        std::fprintf(stderr,
+                     "[allocation guard] %s: allocation in guarded scope\n",
+                     failing_scope_label ? failing_scope_label : "?");
+        reportCallSite();
+        std::abort();
+    }
+    if (void* const p = std::malloc(size))
+        return p;
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t const size)
+{
+    ++allocation_count;
+    if (void* const p = std::malloc(size))
+        return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* const p) noexcept { std::free(p); }
+void operator delete[](void* const p) noexcept { std::free(p); }
+
+namespace BaseLib
+{
+namespace AllocationGuard
+{
+
+std::size_t allocationCount() { return allocation_count; }
+
+ScopedAllocationCheck::ScopedAllocationCheck(char const* label,
+                                             bool const fail)
+    : _label(label),
+      _start_count(allocation_count),
+      _previous_fail_flag(fail_on_allocation)
+{
+    if (fail)
+    {
+        fail_on_allocation = true;
+        failing_scope_label = label;
+    }
+}
+
+ScopedAllocationCheck::~ScopedAllocationCheck()
+{
+    fail_on_allocation = _previous_fail_flag;
+
+    auto const allocations = allocation_count - _start_count;
+    if (allocations > 0)
+    {
+        // Not routed through logog: logging itself allocates.
+        std::fprintf(stderr, "[allocation guard] %s: %zu allocations\n",
+                     _label, allocations);
+    }
+}
+
+}  // namespace AllocationGuard
+}  // namespace BaseLib
+
+#endif  // OGS_ENABLE_ALLOCATION_GUARD
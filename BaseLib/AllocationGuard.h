@@ -0,0 +1,60 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+namespace BaseLib
+{
+
+/// Allocation certification for hot paths, enabled with the
+/// OGS_ENABLE_ALLOCATION_GUARD build option.
+///
+/// With the option on, the global allocation functions count all
+/// allocations per thread; a ScopedAllocationCheck reports (once per label)
+/// how many allocations happened inside its scope, so the assembly loops
+/// can be certified allocation-free after warm-up. Without the option the
+/// guard compiles to nothing.
+namespace AllocationGuard
+{
+#ifdef OGS_ENABLE_ALLOCATION_GUARD
+/// Number of allocations on this thread so far.
+std::size_t allocationCount();
+
+class ScopedAllocationCheck final
+{
+public:
+    /// \param fail_on_allocation if set, the first allocation inside the
+    ///        scope prints its call stack and aborts---usable in tests that
+    ///        protect an allocation-free guarantee. Otherwise allocations
+    ///        are counted and reported (with the first call stack) at scope
+    ///        end.
+    explicit ScopedAllocationCheck(char const* label,
+                                   bool const fail_on_allocation = false);
+    ~ScopedAllocationCheck();
+
+private:
+    char const* const _label;
+    std::size_t const _start_count;
+    bool const _previous_fail_flag;
+};
+#else
+inline std::size_t allocationCount() { return 0; }
+
+class ScopedAllocationCheck final
+{
+public:
+    explicit ScopedAllocationCheck(char const*, bool = false) {}
+};
+#endif  // OGS_ENABLE_ALLOCATION_GUARD
+}  // namespace AllocationGuard
+
+}  // namespace BaseLib
@@ -0,0 +1,198 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace BaseLib
+{
+
+/// Monotonic chunked bump allocator: allocations are O(1) pointer bumps,
+/// deallocation happens wholesale via reset() or destruction. Objects with
+/// nontrivial destructors must be destroyed by the owner before reset().
+///
+/// This is the building block shared by the subsystem-specific arenas (local
+/// assemblers, tree nodes, boundary conditions); reservedBytes() exposes the
+/// footprint for memory reporting next to BaseLib::MemWatch's process-wide
+/// numbers.
+class MonotonicArena
+{
+public:
+    explicit MonotonicArena(std::size_t const chunk_size = 1 << 20)
+        : _chunk_size(chunk_size)
+    {
+    }
+
+    MonotonicArena(MonotonicArena const&) = delete;
+    MonotonicArena& operator=(MonotonicArena const&) = delete;
+
+    void* allocate(std::size_t const size, std::size_t const alignment)
+    {
+        if (size > _chunk_size)
+        {
+            // Oversized allocations get their own chunk; the next small
+            // allocation opens a fresh regular chunk.
+            _chunks.emplace_back(new char[size]);
+            _reserved += size;
+            _pos_chunk_is_oversized = true;
+            return _chunks.back().get();
+        }
+
+        auto const aligned_pos = alignUp(_pos, alignment);
+        if (_chunks.empty() || _pos_chunk_is_oversized ||
+            aligned_pos + size > _chunk_size)
+        {
+            _chunks.emplace_back(new char[_chunk_size]);
+            _reserved += _chunk_size;
+            _pos = size;
+            _pos_chunk_is_oversized = false;
+            return _chunks.back().get();
+        }
+        _pos = aligned_pos + size;
+        return _chunks.back().get() + aligned_pos;
+    }
+
+    /// Drops all chunks; previously handed out memory becomes invalid.
+    void reset()
+    {
+        _chunks.clear();
+        _pos = 0;
+        _reserved = 0;
+    }
+
+    /// Total bytes held by the arena's chunks.
+    std::size_t reservedBytes() const { return _reserved; }
+
+private:
+    static std::size_t alignUp(std::size_t const pos,
+                               std::size_t const alignment)
+    {
+        return (pos + alignment - 1) / alignment * alignment;
+    }
+
+    std::size_t const _chunk_size;
+    std::vector<std::unique_ptr<char[]>> _chunks;
+    std::size_t _pos = 0;
+    std::size_t _reserved = 0;
+    bool _pos_chunk_is_oversized = false;
+};
+
+/// Fixed-size pool for objects of type T with a free list: allocate() and
+/// deallocate() are O(1), memory comes from an internal MonotonicArena in
+/// chunks, freed slots are recycled.
+template <typename T>
+class FixedSizePool
+{
+public:
+    explicit FixedSizePool(std::size_t const objects_per_chunk = 4096)
+        : _arena(objects_per_chunk * slotSize())
+    {
+    }
+
+    /// Allocates raw storage for one T (no construction).
+    void* allocate()
+    {
+        if (_free_list != nullptr)
+        {
+            void* const slot = _free_list;
+            _free_list = _free_list->next;
+            return slot;
+        }
+        return _arena.allocate(slotSize(), alignof(T));
+    }
+
+    /// Returns one slot to the pool (the caller destroys the object).
+    void deallocate(void* const slot)
+    {
+        auto* const node = static_cast<FreeNode*>(slot);
+        node->next = _free_list;
+        _free_list = node;
+    }
+
+    std::size_t reservedBytes() const { return _arena.reservedBytes(); }
+
+private:
+    struct FreeNode
+    {
+        FreeNode* next;
+    };
+
+    static std::size_t slotSize()
+    {
+        return sizeof(T) > sizeof(FreeNode) ? sizeof(T) : sizeof(FreeNode);
+    }
+
+    MonotonicArena _arena;
+    FreeNode* _free_list = nullptr;
+};
+
+/// std-allocator adapter over a MonotonicArena, usable with standard
+/// containers for scoped-lifetime regions: the containers' memory lives and
+/// dies with the arena.
+template <typename T>
+class ArenaAllocator
+{
+public:
+    using value_type = T;
+
+    explicit ArenaAllocator(MonotonicArena& arena) : _arena(&arena) {}
+
+    template <typename U>
+    ArenaAllocator(ArenaAllocator<U> const& other) : _arena(other._arena)
+    {
+    }
+
+    T* allocate(std::size_t const n)
+    {
+        return static_cast<T*>(_arena->allocate(n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T*, std::size_t) {}  // released wholesale by the arena
+
+    template <typename U>
+    bool operator==(ArenaAllocator<U> const& other) const
+    {
+        return _arena == other._arena;
+    }
+    template <typename U>
+    bool operator!=(ArenaAllocator<U> const& other) const
+    {
+        return !(*this == other);
+    }
+
+    // C++11 allocator boilerplate for pre-allocator-traits containers.
+    using pointer = T*;
+    using const_pointer = T const*;
+    using reference = T&;
+    using const_reference = T const&;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    template <typename U>
+    struct rebind
+    {
+        using other = ArenaAllocator<U>;
+    };
+    template <typename U, typename... Args>
+    void construct(U* p, Args&&... args)
+    {
+        ::new (static_cast<void*>(p)) U(std::forward<Args>(args)...);
+    }
+    template <typename U>
+    void destroy(U* p)
+    {
+        p->~U();
+    }
+
+    MonotonicArena* _arena;
+};
+
+}  // namespace BaseLib
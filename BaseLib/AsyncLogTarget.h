@@ -0,0 +1,126 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include <logog/include/logog.hpp>
+
+namespace BaseLib
+{
+
+/// Asynchronous, rate-limited logog target.
+///
+/// Output() only enqueues the formatted line into a bounded buffer; a
+/// background thread drains the buffer into the given file, so the logging
+/// call sites---e.g. the per-iteration prints in the assembly loop---no
+/// longer block on the sink (a shared filesystem, a slow terminal).
+///
+/// The buffer is bounded: when the writer cannot keep up, excess lines are
+/// dropped and a summary line reports the number of dropped messages, which
+/// caps logging overhead instead of stalling the simulation. In MPI setups
+/// pass a per-rank file name, so ranks do not serialize on one file.
+class AsyncLogTarget final : public logog::Target
+{
+public:
+    explicit AsyncLogTarget(std::string const& file_name,
+                            std::size_t const max_buffered_lines = 16384)
+        : _file(file_name), _max_buffered_lines(max_buffered_lines)
+    {
+        _writer = std::thread([this]() { writerLoop(); });
+    }
+
+    ~AsyncLogTarget()
+    {
+        {
+            std::lock_guard<std::mutex> const lock(_mutex);
+            _shutdown = true;
+        }
+        _condition.notify_all();
+        _writer.join();
+    }
+
+    AsyncLogTarget(AsyncLogTarget const&) = delete;
+    AsyncLogTarget& operator=(AsyncLogTarget const&) = delete;
+
+    int Output(const LOGOG_STRING& data) override
+    {
+        std::string line(reinterpret_cast<char const*>(data.c_str()));
+
+        {
+            std::lock_guard<std::mutex> const lock(_mutex);
+            if (_lines.size() >= _max_buffered_lines)
+            {
+                // Rate limiting: drop instead of stalling the simulation.
+                ++_dropped;
+                return 0;
+            }
+            _lines.push_back(std::move(line));
+        }
+        _condition.notify_one();
+        return 0;
+    }
+
+private:
+    void writerLoop()
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        for (;;)
+        {
+            _condition.wait(lock, [this]() {
+                return _shutdown || !_lines.empty();
+            });
+
+            while (!_lines.empty())
+            {
+                auto const line = std::move(_lines.front());
+                _lines.pop_front();
+                lock.unlock();
+                _file << line;
+                lock.lock();
+            }
+
+            if (_dropped > 0)
+            {
+                auto const dropped = _dropped;
+                _dropped = 0;
+                lock.unlock();
+                _file << "[async log] dropped " << dropped
+                      << " messages under load\n";
+                lock.lock();
+            }
+
+            if (_shutdown && _lines.empty())
+            {
+                _file.flush();
+                return;
+            }
+        }
+    }
+
+    std::ofstream _file;
+    std::size_t const _max_buffered_lines;
+
+    std::mutex _mutex;
+    std::condition_variable _condition;
+    std::deque<std::string> _lines;
+    std::size_t _dropped = 0;
+    bool _shutdown = false;
+
+    std::thread _writer;
+};
+
+}  // namespace BaseLib
@@ -9,6 +9,9 @@
 
 #include "ConfigTree.h"
 
+#include <cctype>
+#include <cstdlib>
+
 #include <forward_list>
 #include <logog/include/logog.hpp>
 
@@ -25,6 +28,43 @@ static std::forward_list<std::string> configtree_destructor_error_messages;
 
 namespace BaseLib
 {
+boost::optional<std::vector<double>> ConfigTree::getConfigParameterOptionalImpl(
+    std::string const& param, std::vector<double>*) const
+{
+    auto p = getConfigSubtreeOptional(param);
+    if (!p)
+        return boost::none;
+
+    std::string const raw = p->getValue<std::string>();
+    std::vector<double> result;
+    result.reserve(raw.size() / 8 + 1);
+
+    char const* position = raw.c_str();
+    char* parse_end = nullptr;
+    for (;;)
+    {
+        double const value = std::strtod(position, &parse_end);
+        if (parse_end == position)
+            break;
+        result.push_back(value);
+        position = parse_end;
+    }
+
+    // Only whitespace may remain, otherwise a token was not convertible.
+    while (*position != '\0' && std::isspace(static_cast<unsigned char>(*position)))
+        ++position;
+    if (*position != '\0')
+    {
+        error("Value for key <" + param + "> `" + shortString(raw) +
+              "' not convertible to a vector of the desired type."
+              " Could not convert token no. " +
+              std::to_string(result.size() + 1) + ".");
+        return boost::none;
+    }
+
+    return boost::make_optional(result);
+}
+
 
 const char ConfigTree::pathseparator = '/';
 const std::string ConfigTree::key_chars_start = "abcdefghijklmnopqrstuvwxyz";
@@ -518,6 +518,12 @@ private:
     template<typename T> boost::optional<std::vector<T>>
     getConfigParameterOptionalImpl(std::string const& param, std::vector<T>*) const;
 
+    //! Fast path for bulk double arrays (inlined curve/time-series tables):
+    //! parses the raw string with strtod instead of one istringstream
+    //! extraction per token.
+    boost::optional<std::vector<double>> getConfigParameterOptionalImpl(
+        std::string const& param, std::vector<double>*) const;
+
     struct CountType
     {
         int count;
@@ -0,0 +1,43 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "Deterministic.h"
+
+namespace BaseLib
+{
+
+namespace
+{
+bool deterministic_parallel_mode = false;
+}
+
+void setDeterministicParallelMode(bool const deterministic)
+{
+    deterministic_parallel_mode = deterministic;
+}
+
+bool deterministicParallelMode()
+{
+    return deterministic_parallel_mode;
+}
+
+double pairwiseSum(double const* const data, std::size_t const n)
+{
+    if (n <= 8)
+    {
+        double sum = 0.0;
+        for (std::size_t i = 0; i < n; ++i)
+            sum += data[i];
+        return sum;
+    }
+    std::size_t const half = n / 2;
+    return pairwiseSum(data, half) + pairwiseSum(data + half, n - half);
+}
+
+}  // namespace BaseLib
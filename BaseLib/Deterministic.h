@@ -0,0 +1,39 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+
+namespace BaseLib
+{
+
+/*! Runtime switch for bitwise-reproducible parallel runs, cf. the
+ * \c --deterministic command line option.
+ *
+ * With OpenMP enabled, the order in which concurrently assembled local
+ * contributions reach a shared global matrix or vector entry varies from run
+ * to run, and since floating-point addition is not associative, so do the
+ * low-order bits of the results. In deterministic mode the scatter stages
+ * run in a fixed order---the global assembly stages its contributions and
+ * flushes them sorted by element id, the cheap boundary condition and
+ * extrapolation scatters fall back to serial execution---trading a few
+ * percent of speed for results that are stable run-to-run and across thread
+ * counts, which the performance regression benchmarks compare against.
+ */
+void setDeterministicParallelMode(bool const deterministic);
+
+bool deterministicParallelMode();
+
+/// Fixed-order pairwise tree summation. Independent of the thread count and
+/// more accurate than sequential summation for long arrays; the building
+/// block for deterministic parallel reductions.
+double pairwiseSum(double const* const data, std::size_t const n);
+
+}  // namespace BaseLib
@@ -13,6 +13,16 @@
  */
 
 #include "FileTools.h"
+
+#include <cctype>
+#include <cstdlib>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 #include "StringTools.h"
 
 #include <sys/stat.h>
@@ -20,6 +30,100 @@
 
 namespace BaseLib
 {
+MemoryMappedFile::MemoryMappedFile(std::string const& file_name)
+{
+#ifndef _WIN32
+    _fd = open(file_name.c_str(), O_RDONLY);
+    if (_fd < 0)
+        return;
+    struct stat file_status;
+    if (fstat(_fd, &file_status) != 0)
+        return;
+    _size = static_cast<std::size_t>(file_status.st_size);
+    // The numeric parsers rely on a terminating NUL behind the data. Mapped
+    // pages beyond the file's end read as zero except when the size is an
+    // exact multiple of the page size; fall back to a buffered read (with
+    // explicit terminator) in that case.
+    long const page_size = sysconf(_SC_PAGESIZE);
+    if (page_size > 0 &&
+        _size % static_cast<std::size_t>(page_size) == 0)
+    {
+        _buffer.resize(_size + 1);
+        if (read(_fd, _buffer.data(), _size) !=
+            static_cast<ssize_t>(_size))
+            return;
+        _buffer[_size] = '\0';
+        _data = _buffer.data();
+        return;
+    }
+    _data = static_cast<char const*>(
+        mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, _fd, 0));
+    if (_data == MAP_FAILED)
+        _data = nullptr;
+#else
+    std::ifstream in(file_name, std::ios::binary | std::ios::ate);
+    if (!in)
+        return;
+    _size = static_cast<std::size_t>(in.tellg());
+    _buffer.resize(_size + 1);
+    in.seekg(0);
+    in.read(_buffer.data(), _size);
+    _buffer[_size] = '\0';
+    _data = _buffer.data();
+#endif
+}
+
+MemoryMappedFile::~MemoryMappedFile()
+{
+#ifndef _WIN32
+    if (_data != nullptr && _buffer.empty())
+        munmap(const_cast<char*>(_data), _size);
+    if (_fd >= 0)
+        close(_fd);
+#endif
+}
+
+bool parseDouble(char const*& position, char const* end, double& value)
+{
+    while (position != end &&
+           std::isspace(static_cast<unsigned char>(*position)))
+        ++position;
+    if (position == end)
+        return false;
+
+    char* parse_end = nullptr;
+    value = std::strtod(position, &parse_end);
+    if (parse_end == position)
+        return false;
+    position = parse_end;
+    return true;
+}
+
+bool parseUnsigned(char const*& position, char const* end,
+                   unsigned long& value)
+{
+    while (position != end &&
+           std::isspace(static_cast<unsigned char>(*position)))
+        ++position;
+    if (position == end)
+        return false;
+
+    char* parse_end = nullptr;
+    value = std::strtoul(position, &parse_end, 10);
+    if (parse_end == position)
+        return false;
+    position = parse_end;
+    return true;
+}
+
+BufferedOFStream::BufferedOFStream(std::string const& file_name,
+                                   std::size_t const buffer_size)
+    : _buffer(buffer_size)
+{
+    rdbuf()->pubsetbuf(_buffer.data(), _buffer.size());
+    open(file_name, std::ios::binary);
+}
+
 /**
  * Returns true if given file exists. From http://www.techbytes.ca/techbyte103.html
  */
@@ -29,6 +133,14 @@ bool IsFileExisting(const std::string &strFilename)
     return (stat (strFilename.c_str(), &buffer) == 0);
 }
 
+std::time_t getFileModificationTime(std::string const& file_name)
+{
+    struct stat file_status;
+    if (stat(file_name.c_str(), &file_status) != 0)
+        return 0;
+    return file_status.st_mtime;
+}
+
 double swapEndianness(double const& v)
 {
     union
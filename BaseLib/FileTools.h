@@ -15,6 +15,7 @@
 #pragma once
 
 #include <fstream>
+#include <ctime>
 #include <string>
 #include <vector>
 
@@ -29,6 +30,10 @@ namespace BaseLib
  */
 bool IsFileExisting(const std::string &strFilename);
 
+/// Returns the file's last modification time, or 0 if the file is not
+/// accessible.
+std::time_t getFileModificationTime(std::string const& file_name);
+
 /**
  * \brief write value as binary into the given output stream
  *
@@ -125,6 +130,55 @@ std::string extractBaseNameWithoutExtension(std::string const& pathname);
  */
 std::string getFileExtension(std::string const& filename);
 
+/**
+ * Read-only view of a whole file's content, memory-mapped where the platform
+ * supports it (POSIX) and read into a buffer otherwise.
+ *
+ * Shared helper for the text readers (legacy mesh, GeoLib), which parse the
+ * mapped bytes with the fast numeric parsers below instead of token-by-token
+ * stream extraction.
+ */
+class MemoryMappedFile final
+{
+public:
+    explicit MemoryMappedFile(std::string const& file_name);
+    ~MemoryMappedFile();
+
+    MemoryMappedFile(MemoryMappedFile const&) = delete;
+    MemoryMappedFile& operator=(MemoryMappedFile const&) = delete;
+
+    bool valid() const { return _data != nullptr; }
+    char const* data() const { return _data; }
+    std::size_t size() const { return _size; }
+
+private:
+    char const* _data = nullptr;
+    std::size_t _size = 0;
+    int _fd = -1;
+    std::vector<char> _buffer;
+};
+
+/// Parses the next double starting at \c position (skipping leading
+/// whitespace); advances \c position past the parsed token. Returns false if
+/// no number could be parsed.
+bool parseDouble(char const*& position, char const* end, double& value);
+
+/// Parses the next unsigned integer like parseDouble().
+bool parseUnsigned(char const*& position, char const* end,
+                   unsigned long& value);
+
+/// Output file stream with a large user-space buffer (default 1 MiB), for
+/// writers emitting many small chunks.
+class BufferedOFStream final : public std::ofstream
+{
+public:
+    explicit BufferedOFStream(std::string const& file_name,
+                              std::size_t const buffer_size = 1 << 20);
+
+private:
+    std::vector<char> _buffer;
+};
+
 /**
  * Compares filename's extension with query extension. The comparison is case
  * insensitive.
@@ -0,0 +1,128 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "HardwareCounters.h"
+
+#include <fstream>
+
+#include <logog/include/logog.hpp>
+
+#if defined(OGS_USE_PERF_COUNTERS) && defined(__linux__)
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace BaseLib
+{
+
+namespace
+{
+#if defined(OGS_USE_PERF_COUNTERS) && defined(__linux__)
+int openCounter(std::uint64_t const config)
+{
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = config;
+    attr.disabled = 0;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    return static_cast<int>(
+        syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0));
+}
+
+std::uint64_t readCounter(int const fd)
+{
+    std::uint64_t value = 0;
+    if (fd >= 0 && read(fd, &value, sizeof(value)) != sizeof(value))
+        value = 0;
+    return value;
+}
+#endif
+}  // anonymous namespace
+
+HardwareCounters& HardwareCounters::instance()
+{
+    static HardwareCounters counters;
+    return counters;
+}
+
+HardwareCounters::HardwareCounters()
+{
+#if defined(OGS_USE_PERF_COUNTERS) && defined(__linux__)
+    _fd_instructions = openCounter(PERF_COUNT_HW_INSTRUCTIONS);
+    _fd_cache_misses = openCounter(PERF_COUNT_HW_CACHE_MISSES);
+    _fd_branch_misses = openCounter(PERF_COUNT_HW_BRANCH_MISSES);
+    _counters_available = _fd_instructions >= 0;
+    if (!_counters_available)
+        WARN("Hardware performance counters are not available "
+             "(perf_event_open failed; check perf_event_paranoid).");
+#endif
+}
+
+void HardwareCounters::setOutputFile(std::string const& filename)
+{
+    _output_file = filename;
+}
+
+bool HardwareCounters::enabled() const
+{
+    return _counters_available && !_output_file.empty();
+}
+
+HardwareCounters::Counts HardwareCounters::read() const
+{
+    Counts counts;
+#if defined(OGS_USE_PERF_COUNTERS) && defined(__linux__)
+    if (_counters_available)
+    {
+        counts.instructions = readCounter(_fd_instructions);
+        counts.cache_misses = readCounter(_fd_cache_misses);
+        counts.branch_misses = readCounter(_fd_branch_misses);
+    }
+#endif
+    return counts;
+}
+
+void HardwareCounters::add(std::string const& phase, Counts const& start,
+                           Counts const& end)
+{
+    auto& sums = _per_phase[phase];
+    sums.instructions += end.instructions - start.instructions;
+    sums.cache_misses += end.cache_misses - start.cache_misses;
+    sums.branch_misses += end.branch_misses - start.branch_misses;
+}
+
+void HardwareCounters::write() const
+{
+    if (_output_file.empty() || _per_phase.empty())
+        return;
+
+    std::ofstream out(_output_file);
+    if (!out) {
+        ERR("Could not open file '%s' for writing the hardware counters.",
+            _output_file.c_str());
+        return;
+    }
+
+    out << "phase,instructions,cache_misses,branch_misses\n";
+    for (auto const& phase_counts : _per_phase) {
+        out << phase_counts.first << ','
+            << phase_counts.second.instructions << ','
+            << phase_counts.second.cache_misses << ','
+            << phase_counts.second.branch_misses << '\n';
+    }
+    INFO("Hardware counters written to '%s'.", _output_file.c_str());
+}
+
+}  // namespace BaseLib
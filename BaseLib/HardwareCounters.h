@@ -0,0 +1,66 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <string>
+
+namespace BaseLib
+{
+
+/// Hardware performance counter collection scoped to the instrumentation
+/// phases, compiled in behind the OGS_USE_PERF_COUNTERS option (Linux
+/// perf_event interface; no external PAPI dependency).
+///
+/// When enabled with an output file, every ScopedPhaseTimer additionally
+/// accumulates instructions, cache misses and branch misses for its phase;
+/// write() dumps the per-phase sums as CSV, so bandwidth-bound phases (high
+/// cache misses per instruction) separate from latency/branch-bound ones
+/// without rerunning under an external profiler. Without the build option
+/// or an output file, everything is a no-op.
+class HardwareCounters final
+{
+public:
+    struct Counts
+    {
+        std::uint64_t instructions = 0;
+        std::uint64_t cache_misses = 0;
+        std::uint64_t branch_misses = 0;
+    };
+
+    static HardwareCounters& instance();
+
+    void setOutputFile(std::string const& filename);
+    bool enabled() const;
+
+    /// Reads the current counter values (monotonic sums for this thread).
+    Counts read() const;
+
+    /// Accumulates the difference of two read() results under the phase.
+    void add(std::string const& phase, Counts const& start,
+             Counts const& end);
+
+    /// Writes the per-phase sums as CSV.
+    void write() const;
+
+private:
+    HardwareCounters();
+
+    std::string _output_file;
+    bool _counters_available = false;
+    int _fd_instructions = -1;
+    int _fd_cache_misses = -1;
+    int _fd_branch_misses = -1;
+
+    std::map<std::string, Counts> _per_phase;
+};
+
+}  // namespace BaseLib
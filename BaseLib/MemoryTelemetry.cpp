@@ -0,0 +1,85 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "MemoryTelemetry.h"
+
+#include <fstream>
+
+#include <logog/include/logog.hpp>
+
+#include "MemWatch.h"
+
+namespace BaseLib
+{
+
+MemoryTelemetry& MemoryTelemetry::instance()
+{
+    static MemoryTelemetry telemetry;
+    return telemetry;
+}
+
+void MemoryTelemetry::setOutputFile(std::string const& filename)
+{
+    _output_file = filename;
+}
+
+void MemoryTelemetry::registerAttribution(
+    std::string const& name, std::function<std::size_t()> bytes)
+{
+    _attributions.emplace_back(name, std::move(bytes));
+}
+
+void MemoryTelemetry::sample(std::string const& label)
+{
+    if (!enabled())
+        return;
+
+    MemWatch mem_watch;
+    Sample sample;
+    sample.label = label;
+    sample.virtual_mem = mem_watch.getVirtMemUsage();
+    sample.resident_mem = mem_watch.getResMemUsage();
+    sample.attributed_bytes.reserve(_attributions.size());
+    for (auto const& attribution : _attributions)
+        sample.attributed_bytes.push_back(attribution.second());
+    _samples.push_back(std::move(sample));
+}
+
+void MemoryTelemetry::write() const
+{
+    if (!enabled() || _samples.empty())
+        return;
+
+    std::ofstream out(_output_file);
+    if (!out) {
+        ERR("Could not open file '%s' for writing the memory telemetry.",
+            _output_file.c_str());
+        return;
+    }
+
+    out << "phase,virtual_bytes,resident_bytes";
+    for (auto const& attribution : _attributions)
+        out << ',' << attribution.first << "_bytes";
+    out << '\n';
+
+    for (auto const& sample : _samples) {
+        out << sample.label << ',' << sample.virtual_mem << ','
+            << sample.resident_mem;
+        for (std::size_t i = 0; i < _attributions.size(); ++i)
+            out << ','
+                << (i < sample.attributed_bytes.size()
+                        ? sample.attributed_bytes[i]
+                        : 0);
+        out << '\n';
+    }
+
+    INFO("Memory telemetry written to '%s'.", _output_file.c_str());
+}
+
+}  // namespace BaseLib
@@ -0,0 +1,63 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace BaseLib
+{
+
+/// Run-wide memory telemetry built on MemWatch.
+///
+/// sample(label) records the current virtual/resident memory at phase
+/// boundaries (mesh load, DOF setup, first assembly, time steps); subsystems
+/// can additionally register attribution hooks reporting their own byte
+/// counts (mesh arrays, matrix nonzeros, arenas), which are evaluated with
+/// every sample. write() dumps everything as CSV at the end of the run, cf.
+/// the --write-memory-telemetry command line option. Disabled (no-op
+/// sampling) unless an output file is set.
+class MemoryTelemetry final
+{
+public:
+    static MemoryTelemetry& instance();
+
+    void setOutputFile(std::string const& filename);
+    bool enabled() const { return !_output_file.empty(); }
+
+    /// Registers a named hook reporting a subsystem's current byte count.
+    void registerAttribution(std::string const& name,
+                             std::function<std::size_t()> bytes);
+
+    /// Takes a sample labeled with the current phase.
+    void sample(std::string const& label);
+
+    /// Writes the samples as CSV to the configured file.
+    void write() const;
+
+private:
+    MemoryTelemetry() = default;
+
+    struct Sample
+    {
+        std::string label;
+        unsigned long long virtual_mem;
+        unsigned long long resident_mem;
+        std::vector<std::size_t> attributed_bytes;
+    };
+
+    std::string _output_file;
+    std::vector<std::pair<std::string, std::function<std::size_t()>>>
+        _attributions;
+    std::vector<Sample> _samples;
+};
+
+}  // namespace BaseLib
@@ -0,0 +1,162 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "PhaseTimings.h"
+
+#include <fstream>
+
+#ifdef USE_MPI
+#include <mpi.h>
+#endif
+
+#include <logog/include/logog.hpp>
+
+#include "Error.h"
+#include "FileTools.h"
+
+namespace BaseLib
+{
+
+PhaseTimings& PhaseTimings::instance()
+{
+    static PhaseTimings timings;
+    return timings;
+}
+
+void PhaseTimings::setOutputFile(std::string const& filename)
+{
+    _output_file = filename;
+}
+
+void PhaseTimings::setContext(std::string const& context)
+{
+    std::lock_guard<std::mutex> const lock(_mutex);
+    _context = context;
+}
+
+void PhaseTimings::setTimestep(std::size_t const timestep)
+{
+    std::lock_guard<std::mutex> const lock(_mutex);
+    _timestep = timestep;
+}
+
+void PhaseTimings::add(std::string const& phase, double const seconds)
+{
+    std::lock_guard<std::mutex> const lock(_mutex);
+    auto& entry = _entries[Key{_timestep, _context, phase}];
+    ++entry.count;
+    entry.total_time += seconds;
+}
+
+std::map<std::string, double> PhaseTimings::timingsForTimestep(
+    std::size_t const timestep) const
+{
+    std::lock_guard<std::mutex> const lock(_mutex);
+    std::map<std::string, double> timings;
+    for (auto it = _entries.lower_bound(Key{timestep, "", ""});
+         it != _entries.end() && std::get<0>(it->first) == timestep; ++it)
+        timings[std::get<2>(it->first)] += it->second.total_time;
+    return timings;
+}
+
+void PhaseTimings::write() const
+{
+    if (_output_file.empty())
+        return;
+
+    std::lock_guard<std::mutex> const lock(_mutex);
+
+#ifdef USE_MPI
+    // MPI-aware aggregation: the phase keys are identical on all ranks (the
+    // phases are entered collectively), so three reductions per entry yield
+    // min/mean/max across ranks; rank 0 writes one file with an imbalance
+    // column (max/mean) instead of per-rank log spam.
+    int rank = 0, comm_size = 1;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &comm_size);
+    if (comm_size > 1)
+    {
+        std::vector<double> local_times;
+        local_times.reserve(_entries.size());
+        for (auto const& key_entry : _entries)
+            local_times.push_back(key_entry.second.total_time);
+
+        std::vector<double> min_times(local_times.size()),
+            max_times(local_times.size()), sum_times(local_times.size());
+        MPI_Reduce(local_times.data(), min_times.data(), local_times.size(),
+                   MPI_DOUBLE, MPI_MIN, 0, MPI_COMM_WORLD);
+        MPI_Reduce(local_times.data(), max_times.data(), local_times.size(),
+                   MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD);
+        MPI_Reduce(local_times.data(), sum_times.data(), local_times.size(),
+                   MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD);
+
+        if (rank != 0)
+            return;
+
+        std::ofstream aggregated(_output_file);
+        if (!aggregated) {
+            ERR("Could not open file '%s' for writing the phase timings.",
+                _output_file.c_str());
+            return;
+        }
+        aggregated << "timestep,context,phase,calls,time_min,time_mean,"
+                      "time_max,imbalance\n";
+        std::size_t i = 0;
+        for (auto const& key_entry : _entries) {
+            double const mean = sum_times[i] / comm_size;
+            aggregated << std::get<0>(key_entry.first) << ','
+                       << std::get<1>(key_entry.first) << ','
+                       << std::get<2>(key_entry.first) << ','
+                       << key_entry.second.count << ',' << min_times[i] << ','
+                       << mean << ',' << max_times[i] << ','
+                       << (mean > 0 ? max_times[i] / mean : 1.0) << '\n';
+            ++i;
+        }
+        INFO("Aggregated phase timings written to '%s'.",
+             _output_file.c_str());
+        return;
+    }
+#endif
+
+    std::ofstream out(_output_file);
+    if (!out) {
+        ERR("Could not open file '%s' for writing the phase timings.",
+            _output_file.c_str());
+        return;
+    }
+
+    if (BaseLib::getFileExtension(_output_file) == "json") {
+        out << "[\n";
+        bool first = true;
+        for (auto const& key_entry : _entries) {
+            if (!first)
+                out << ",\n";
+            first = false;
+            out << "  { \"timestep\": " << std::get<0>(key_entry.first)
+                << ", \"context\": \"" << std::get<1>(key_entry.first)
+                << "\", \"phase\": \"" << std::get<2>(key_entry.first)
+                << "\", \"calls\": " << key_entry.second.count
+                << ", \"time\": " << key_entry.second.total_time << " }";
+        }
+        out << "\n]\n";
+    } else {
+        out << "timestep,context,phase,calls,time\n";
+        for (auto const& key_entry : _entries) {
+            out << std::get<0>(key_entry.first) << ','
+                << std::get<1>(key_entry.first) << ','
+                << std::get<2>(key_entry.first) << ','
+                << key_entry.second.count << ','
+                << key_entry.second.total_time << '\n';
+        }
+    }
+
+    INFO("Phase timings written to '%s'.", _output_file.c_str());
+}
+
+}  // namespace BaseLib
@@ -0,0 +1,126 @@
+/**
+ * \brief  Structured per-phase run time instrumentation.
+ *
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <tuple>
+
+#include "HardwareCounters.h"
+#include "RunTime.h"
+
+namespace BaseLib
+{
+
+/// Collects elapsed run times of the individual simulation phases---assembly,
+/// application of Dirichlet BCs, linear solve, extrapolation, output---
+/// aggregated per context (usually one context per process) and per time step.
+///
+/// The collected data is written to a CSV or JSON file at the end of the run,
+/// cf. the \c --write-phase-timings command line option. If no output file is
+/// set, the collection is disabled and the scoped timers are no-ops.
+class PhaseTimings final
+{
+public:
+    static PhaseTimings& instance();
+
+    /// Enables the collection and sets the file the timings are written to.
+    /// Files with the extension \c .json are written as JSON, everything else
+    /// as CSV.
+    void setOutputFile(std::string const& filename);
+
+    /// Forces collection without an output file, e.g. to feed the status
+    /// surface of ProcessLib::SimulationStatus; write() still requires an
+    /// output file.
+    void enableCollection() { _collect = true; }
+
+    bool enabled() const { return _collect || !_output_file.empty(); }
+
+    /// Sets the context, e.g., "process #0", subsequently recorded phases are
+    /// attributed to.
+    void setContext(std::string const& context);
+
+    /// Sets the time step subsequently recorded phases are attributed to.
+    void setTimestep(std::size_t const timestep);
+
+    /// Records \c seconds of elapsed time for the given \c phase under the
+    /// current context and time step. Thread-safe.
+    void add(std::string const& phase, double const seconds);
+
+    /// Writes the aggregated timings to the configured output file.
+    void write() const;
+
+    /// Returns the per-phase total times of the given time step, summed over
+    /// all contexts. Thread-safe.
+    std::map<std::string, double> timingsForTimestep(
+        std::size_t const timestep) const;
+
+private:
+    PhaseTimings() = default;
+
+    struct Entry
+    {
+        unsigned count = 0;
+        double total_time = 0.0;
+    };
+
+    // key: time step, context, phase
+    using Key = std::tuple<std::size_t, std::string, std::string>;
+
+    std::map<Key, Entry> _entries;
+    std::string _output_file;
+    bool _collect = false;
+    std::string _context = "global";
+    std::size_t _timestep = 0;
+    mutable std::mutex _mutex;
+};
+
+/// Adds the run time of the enclosing scope to PhaseTimings under the given
+/// phase name.
+class ScopedPhaseTimer final
+{
+public:
+    explicit ScopedPhaseTimer(std::string phase) : _phase(std::move(phase))
+    {
+        if (PhaseTimings::instance().enabled())
+            _timer.start();
+        if (HardwareCounters::instance().enabled())
+        {
+            _counters_enabled = true;
+            _counters_start = HardwareCounters::instance().read();
+        }
+    }
+
+    ~ScopedPhaseTimer()
+    {
+        auto& timings = PhaseTimings::instance();
+        if (timings.enabled())
+            timings.add(_phase, _timer.elapsed());
+        if (_counters_enabled)
+        {
+            auto& counters = HardwareCounters::instance();
+            counters.add(_phase, _counters_start, counters.read());
+        }
+    }
+
+    ScopedPhaseTimer(ScopedPhaseTimer const&) = delete;
+    ScopedPhaseTimer& operator=(ScopedPhaseTimer const&) = delete;
+
+private:
+    std::string const _phase;
+    RunTime _timer;
+    bool _counters_enabled = false;
+    HardwareCounters::Counts _counters_start;
+};
+
+}  // namespace BaseLib
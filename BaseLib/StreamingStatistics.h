@@ -0,0 +1,233 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+
+namespace BaseLib
+{
+
+/// Streaming statistics accumulator with O(1) memory.
+///
+/// Tracks count, min, max, mean and variance (Welford) exactly, and one
+/// configurable quantile approximately with the P-squared algorithm (five
+/// markers, no buffering)---the online counterpart to BaseLib::Histogram for
+/// consumers that cannot afford to keep the data, e.g. per-step timing
+/// distributions over multi-week runs or mesh-quality metrics streamed
+/// during evaluation.
+///
+/// merge() folds another accumulator in: the exact moments combine exactly;
+/// the quantile markers of the other accumulator are replayed as five
+/// weighted observations, which keeps the estimate usable across threads or
+/// ranks but is approximate (as any fixed-memory quantile merge is).
+class StreamingStatistics final
+{
+public:
+    /// \param quantile the tracked quantile in (0, 1); 0.5 tracks the
+    ///                 median.
+    explicit StreamingStatistics(double const quantile = 0.5)
+        : _quantile(quantile)
+    {
+    }
+
+    void update(double const value)
+    {
+        // Exact moments.
+        ++_count;
+        _min = std::min(_min, value);
+        _max = std::max(_max, value);
+        double const delta = value - _mean;
+        _mean += delta / static_cast<double>(_count);
+        _m2 += delta * (value - _mean);
+
+        // P-squared five-marker update.
+        if (_count <= 5)
+        {
+            _heights[_count - 1] = value;
+            if (_count == 5)
+            {
+                std::sort(_heights.begin(), _heights.end());
+                for (int i = 0; i < 5; ++i)
+                    _positions[i] = i + 1;
+                _desired[0] = 1;
+                _desired[1] = 1 + 2 * _quantile;
+                _desired[2] = 1 + 4 * _quantile;
+                _desired[3] = 3 + 2 * _quantile;
+                _desired[4] = 5;
+                _increments[0] = 0;
+                _increments[1] = _quantile / 2;
+                _increments[2] = _quantile;
+                _increments[3] = (1 + _quantile) / 2;
+                _increments[4] = 1;
+            }
+            return;
+        }
+
+        // Find the cell the observation falls into and adjust the extremes.
+        int cell;
+        if (value < _heights[0])
+        {
+            _heights[0] = value;
+            cell = 0;
+        }
+        else if (value >= _heights[4])
+        {
+            _heights[4] = value;
+            cell = 3;
+        }
+        else
+        {
+            cell = 0;
+            while (cell < 3 && value >= _heights[cell + 1])
+                ++cell;
+        }
+
+        for (int i = cell + 1; i < 5; ++i)
+            ++_positions[i];
+        for (int i = 0; i < 5; ++i)
+            _desired[i] += _increments[i];
+
+        // Adjust the interior markers with parabolic interpolation.
+        for (int i = 1; i <= 3; ++i)
+        {
+            double const d = _desired[i] - _positions[i];
+            if ((d >= 1 && _positions[i + 1] - _positions[i] > 1) ||
+                (d <= -1 && _positions[i - 1] - _positions[i] < -1))
+            {
+                int const sign = (d >= 0) ? 1 : -1;
+                double const candidate = parabolic(i, sign);
+                if (_heights[i - 1] < candidate &&
+                    candidate < _heights[i + 1])
+                    _heights[i] = candidate;
+                else
+                    _heights[i] = linear(i, sign);
+                _positions[i] += sign;
+            }
+        }
+    }
+
+    /// Folds the other accumulator in; see the class description for the
+    /// quantile-merge caveat.
+    void merge(StreamingStatistics const& other)
+    {
+        if (other._count == 0)
+            return;
+
+        // The other's markers (or raw values for small counts) replayed as
+        // weighted observations.
+        std::size_t const n_markers =
+            other._count < 5 ? other._count : std::size_t(5);
+        double const weight =
+            static_cast<double>(other._count) / n_markers;
+        for (std::size_t i = 0; i < n_markers; ++i)
+        {
+            auto const repeats =
+                std::max<std::size_t>(1, static_cast<std::size_t>(
+                                             std::llround(weight)));
+            for (std::size_t r = 0; r < repeats; ++r)
+                updateQuantileOnly(other._heights[i]);
+        }
+
+        // Exact moment combination (Chan et al.).
+        double const delta = other._mean - _mean;
+        auto const total = _count + other._count;
+        _m2 += other._m2 + delta * delta *
+                               static_cast<double>(_count) *
+                               static_cast<double>(other._count) /
+                               static_cast<double>(total);
+        _mean += delta * static_cast<double>(other._count) /
+                 static_cast<double>(total);
+        _count = total;
+        _min = std::min(_min, other._min);
+        _max = std::max(_max, other._max);
+    }
+
+    std::size_t getCount() const { return _count; }
+    double getMinimum() const { return _min; }
+    double getMaximum() const { return _max; }
+    double getMean() const { return _mean; }
+    double getVariance() const
+    {
+        return _count > 1 ? _m2 / static_cast<double>(_count - 1) : 0.0;
+    }
+
+    /// The tracked quantile's current estimate.
+    double getQuantile() const
+    {
+        if (_count == 0)
+            return std::numeric_limits<double>::quiet_NaN();
+        if (_count < 5)
+        {
+            // Not enough observations for the markers: order statistics.
+            std::array<double, 5> sorted = _heights;
+            std::sort(sorted.begin(), sorted.begin() + _count);
+            auto const index = static_cast<std::size_t>(
+                _quantile * static_cast<double>(_count - 1));
+            return sorted[index];
+        }
+        return _heights[2];
+    }
+
+private:
+    void updateQuantileOnly(double const value)
+    {
+        // update() without the moment bookkeeping: temporarily save and
+        // restore the moments.
+        auto const count = _count;
+        auto const mean = _mean;
+        auto const m2 = _m2;
+        auto const min = _min;
+        auto const max = _max;
+        update(value);
+        _count = count;
+        _mean = mean;
+        _m2 = m2;
+        _min = min;
+        _max = max;
+    }
+
+    double parabolic(int const i, int const sign) const
+    {
+        double const d = sign;
+        return _heights[i] +
+               d / (_positions[i + 1] - _positions[i - 1]) *
+                   ((_positions[i] - _positions[i - 1] + d) *
+                        (_heights[i + 1] - _heights[i]) /
+                        (_positions[i + 1] - _positions[i]) +
+                    (_positions[i + 1] - _positions[i] - d) *
+                        (_heights[i] - _heights[i - 1]) /
+                        (_positions[i] - _positions[i - 1]));
+    }
+
+    double linear(int const i, int const sign) const
+    {
+        return _heights[i] + sign * (_heights[i + sign] - _heights[i]) /
+                                 (_positions[i + sign] - _positions[i]);
+    }
+
+    double const _quantile;
+
+    std::size_t _count = 0;
+    double _min = std::numeric_limits<double>::max();
+    double _max = std::numeric_limits<double>::lowest();
+    double _mean = 0.0;
+    double _m2 = 0.0;
+
+    std::array<double, 5> _heights = {{0, 0, 0, 0, 0}};
+    std::array<double, 5> _positions = {{0, 0, 0, 0, 0}};
+    std::array<double, 5> _desired = {{0, 0, 0, 0, 0}};
+    std::array<double, 5> _increments = {{0, 0, 0, 0, 0}};
+};
+
+}  // namespace BaseLib
@@ -12,6 +12,9 @@
 #pragma once
 
 #include <algorithm>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 #include <cassert>
 #include <cstddef>
 #include <iterator>
@@ -51,6 +54,73 @@ void quicksort(T1* array, std::size_t beg, std::size_t end, T2* perm)
     }
 }
 
+/// Parallel merge-based sort with companion permutation array: the zipped
+/// range is split into per-thread blocks sorted concurrently (OpenMP) and
+/// merged pairwise; without OpenMP it degenerates to the serial quicksort().
+/// @pre {end<=array.size() and perm.size()==array.size()}
+template <typename T1, typename T2 = std::size_t>
+void parallelQuicksort(T1* array, std::size_t beg, std::size_t end, T2* perm)
+{
+    assert(beg <= end);
+    std::size_t const n = end - beg;
+
+    // Zip input arrays.
+    std::vector<std::pair<T1, T2>> data;
+    data.reserve(n);
+    std::transform(array + beg, array + end, perm + beg,
+                   std::back_inserter(data),
+                   [](T1 const& t1, T2 const& t2)
+                   { return std::make_pair(t1, t2); });
+
+    auto const less = [](std::pair<T1, T2> const& a,
+                         std::pair<T1, T2> const& b)
+    { return a.first < b.first; };
+
+#ifdef _OPENMP
+    int n_blocks = 1;
+#pragma omp parallel
+    {
+#pragma omp single
+        n_blocks = omp_get_num_threads();
+    }
+
+    std::vector<std::size_t> block_bounds(n_blocks + 1);
+    for (int b = 0; b <= n_blocks; ++b)
+        block_bounds[b] = n * b / n_blocks;
+
+#pragma omp parallel for schedule(static)
+    for (int b = 0; b < n_blocks; ++b)
+        std::sort(data.begin() + block_bounds[b],
+                  data.begin() + block_bounds[b + 1], less);
+
+    // Pairwise merges; the number of sorted runs halves per round.
+    for (std::size_t width = 1;
+         width < static_cast<std::size_t>(n_blocks); width *= 2)
+    {
+#pragma omp parallel for schedule(static)
+        for (int b = 0; b < n_blocks; b += static_cast<int>(2 * width))
+        {
+            auto const middle = b + static_cast<int>(width);
+            auto const last =
+                std::min<int>(b + static_cast<int>(2 * width), n_blocks);
+            if (middle < last)
+                std::inplace_merge(data.begin() + block_bounds[b],
+                                   data.begin() + block_bounds[middle],
+                                   data.begin() + block_bounds[last], less);
+        }
+    }
+#else
+    std::sort(data.begin(), data.end(), less);
+#endif
+
+    // Unzip sorted data.
+    for (std::size_t i = 0; i < data.size(); i++)
+    {
+        array[beg + i] = data[i].first;
+        perm[beg + i] = data[i].second;
+    }
+}
+
 template <typename T1, typename T2 = std::size_t>
 void quicksort(std::vector<T1>& array, std::size_t beg, std::size_t end, std::vector<T2>& perm)
 {
@@ -33,4 +33,22 @@ void reorderVector(std::vector<ValueType>& v,
     }
 }
 
+/*! Parallel permutation gather: out[i] = in[order[i]].
+ *
+ *  The gathers are independent and run under OpenMP when enabled; use for
+ *  the startup-path reorderings over very large arrays (mesh load, geometry
+ *  deduplication).
+ */
+template <typename ValueType, typename IndexType>
+void parallelGather(std::vector<ValueType> const& in,
+                    std::vector<IndexType> const& order,
+                    std::vector<ValueType>& out)
+{
+    out.resize(order.size());
+    std::ptrdiff_t const n = static_cast<std::ptrdiff_t>(order.size());
+#pragma omp parallel for schedule(static)
+    for (std::ptrdiff_t i = 0; i < n; ++i)
+        out[i] = in[order[i]];
+}
+
 } // end of namespace
@@ -0,0 +1,235 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "MathLib/Point3d.h"
+
+namespace GeoLib
+{
+
+/// Bulk-loaded octree over a fixed point set with contiguous node storage.
+///
+/// In contrast to GeoLib::OctTree, which inserts points one at a time and
+/// heap-allocates child arrays per split, this tree is built in one pass:
+/// the points are sorted by their Morton code, and the hierarchy is built
+/// top-down over the sorted ranges into one contiguous node vector (children
+/// referenced by index). Construction is O(n log n) with exactly two
+/// allocations, and range queries descend the implicit bounding boxes.
+///
+/// The tree is immutable; use it for the query-heavy setup passes over
+/// point sets known up front (e.g. LIDAR-derived geometry).
+template <typename POINT>
+class BulkOctTree final
+{
+public:
+    /// Builds the tree over the given points (not owned; must outlive the
+    /// tree).
+    explicit BulkOctTree(std::vector<POINT*> const& points,
+                        std::size_t const max_points_per_leaf = 64)
+        : _points(points)
+    {
+        if (points.empty())
+            return;
+
+        // Bounding cube of all points.
+        for (unsigned d = 0; d < 3; ++d) {
+            _min[d] = (*points[0])[d];
+            _max[d] = (*points[0])[d];
+        }
+        for (auto const* point : points) {
+            for (unsigned d = 0; d < 3; ++d) {
+                _min[d] = std::min(_min[d], (*point)[d]);
+                _max[d] = std::max(_max[d], (*point)[d]);
+            }
+        }
+        double extent = 0;
+        for (unsigned d = 0; d < 3; ++d)
+            extent = std::max(extent, _max[d] - _min[d]);
+        if (extent == 0)
+            extent = 1;
+        for (unsigned d = 0; d < 3; ++d)
+            _max[d] = _min[d] + extent;
+        _inverse_extent = 1.0 / extent;
+
+        // Morton-sort the point ids.
+        std::vector<std::pair<std::uint64_t, std::size_t>> coded(
+            points.size());
+        for (std::size_t i = 0; i < points.size(); ++i)
+            coded[i] = {mortonCode(*points[i]), i};
+        std::sort(coded.begin(), coded.end());
+
+        _point_ids.resize(points.size());
+        _codes.resize(points.size());
+        for (std::size_t i = 0; i < points.size(); ++i) {
+            _codes[i] = coded[i].first;
+            _point_ids[i] = coded[i].second;
+        }
+
+        // Build the node hierarchy over the sorted code ranges.
+        _nodes.reserve(2 * points.size() / max_points_per_leaf + 1);
+        buildNode(0, points.size(), 0, max_points_per_leaf);
+    }
+
+    /// Collects the ids (indices into the constructor's point vector) of all
+    /// points inside the axis-aligned box [min, max).
+    void getPointsInRange(MathLib::Point3d const& min,
+                          MathLib::Point3d const& max,
+                          std::vector<std::size_t>& result) const
+    {
+        if (_nodes.empty())
+            return;
+        queryNode(0, min, max, result);
+    }
+
+    /// Batched range query; one result vector per query box.
+    void getPointsInRanges(
+        std::vector<std::pair<MathLib::Point3d, MathLib::Point3d>> const&
+            ranges,
+        std::vector<std::vector<std::size_t>>& results) const
+    {
+        results.resize(ranges.size());
+        for (std::size_t i = 0; i < ranges.size(); ++i) {
+            results[i].clear();
+            getPointsInRange(ranges[i].first, ranges[i].second, results[i]);
+        }
+    }
+
+    std::size_t getNumberOfNodes() const { return _nodes.size(); }
+
+private:
+    struct Node
+    {
+        std::size_t begin;  //!< first point (index into _point_ids)
+        std::size_t end;    //!< one past the last point
+        double box_min[3];
+        double box_max[3];
+        //! Child node indices; zero (the root's index) means "no child".
+        std::array<std::size_t, 8> children;
+        bool is_leaf;
+    };
+
+    static std::uint64_t spreadBits(std::uint64_t value)
+    {
+        value &= 0x1fffff;
+        value = (value | value << 32) & 0x1f00000000ffff;
+        value = (value | value << 16) & 0x1f0000ff0000ff;
+        value = (value | value << 8) & 0x100f00f00f00f00f;
+        value = (value | value << 4) & 0x10c30c30c30c30c3;
+        value = (value | value << 2) & 0x1249249249249249;
+        return value;
+    }
+
+    std::uint64_t mortonCode(POINT const& point) const
+    {
+        std::uint64_t code = 0;
+        for (unsigned d = 0; d < 3; ++d) {
+            auto const normalized = (point[d] - _min[d]) * _inverse_extent;
+            auto const quantized = static_cast<std::uint64_t>(
+                std::min(std::max(normalized, 0.0), 1.0) * 0x1fffff);
+            code |= spreadBits(quantized) << d;
+        }
+        return code;
+    }
+
+    /// Builds the node over _point_ids[begin, end); level counts the Morton
+    /// octant splits done so far.
+    std::size_t buildNode(std::size_t const begin, std::size_t const end,
+                          unsigned const level,
+                          std::size_t const max_points_per_leaf)
+    {
+        auto const node_index = _nodes.size();
+        _nodes.emplace_back();
+        {
+            auto& node = _nodes.back();
+            node.begin = begin;
+            node.end = end;
+            node.children.fill(0);
+            node.is_leaf =
+                (end - begin <= max_points_per_leaf) || level >= 21;
+
+            for (unsigned d = 0; d < 3; ++d) {
+                node.box_min[d] = (*_points[_point_ids[begin]])[d];
+                node.box_max[d] = node.box_min[d];
+            }
+            for (std::size_t i = begin; i < end; ++i) {
+                auto const& p = *_points[_point_ids[i]];
+                for (unsigned d = 0; d < 3; ++d) {
+                    _nodes[node_index].box_min[d] =
+                        std::min(_nodes[node_index].box_min[d], p[d]);
+                    _nodes[node_index].box_max[d] =
+                        std::max(_nodes[node_index].box_max[d], p[d]);
+                }
+            }
+        }
+
+        if (_nodes[node_index].is_leaf)
+            return node_index;
+
+        // Partition the sorted range by the octant bits of this level.
+        unsigned const shift = 3 * (20 - level);
+        std::size_t range_begin = begin;
+        for (unsigned octant = 0; octant < 8; ++octant) {
+            auto const range_end = std::upper_bound(
+                _codes.begin() + range_begin, _codes.begin() + end,
+                octant, [shift](unsigned const o, std::uint64_t const code) {
+                    return o < ((code >> shift) & 7);
+                }) - _codes.begin();
+
+            if (range_end > static_cast<std::ptrdiff_t>(range_begin)) {
+                auto const child = buildNode(range_begin, range_end, level + 1,
+                                             max_points_per_leaf);
+                _nodes[node_index].children[octant] = child;
+            }
+            range_begin = range_end;
+        }
+        return node_index;
+    }
+
+    void queryNode(std::size_t const node_index, MathLib::Point3d const& min,
+                   MathLib::Point3d const& max,
+                   std::vector<std::size_t>& result) const
+    {
+        auto const& node = _nodes[node_index];
+        for (unsigned d = 0; d < 3; ++d)
+            if (node.box_max[d] < min[d] || node.box_min[d] >= max[d])
+                return;
+
+        if (node.is_leaf) {
+            for (std::size_t i = node.begin; i < node.end; ++i) {
+                auto const& p = *_points[_point_ids[i]];
+                bool inside = true;
+                for (unsigned d = 0; d < 3; ++d)
+                    inside = inside && p[d] >= min[d] && p[d] < max[d];
+                if (inside)
+                    result.push_back(_point_ids[i]);
+            }
+            return;
+        }
+
+        for (auto const child : node.children)
+            if (child != 0)
+                queryNode(child, min, max, result);
+    }
+
+    std::vector<POINT*> const& _points;
+    double _min[3] = {0, 0, 0};
+    double _max[3] = {0, 0, 0};
+    double _inverse_extent = 1;
+    std::vector<std::uint64_t> _codes;
+    std::vector<std::size_t> _point_ids;
+    std::vector<Node> _nodes;
+};
+
+}  // namespace GeoLib
@@ -116,6 +116,10 @@ bool EarClippingTriangulation::isEar(std::size_t v0, std::size_t v1, std::size_t
 {
     for (std::list<std::size_t>::const_iterator it (_vertex_list.begin ());
         it != _vertex_list.end(); ++it) {
+        // Only reflex vertices can lie inside an ear candidate of a simple
+        // polygon; skip the convex ones.
+        if (_is_convex[*it])
+            continue;
         if (*it != v0 && *it != v1 && *it != v2) {
             if (MathLib::isPointInTriangle (*_pnts[*it], *_pnts[v0], *_pnts[v1], *_pnts[v2])) {
                 return false;
@@ -128,6 +132,7 @@ bool EarClippingTriangulation::isEar(std::size_t v0, std::size_t v1, std::size_t
 void EarClippingTriangulation::initVertexList ()
 {
     std::size_t n_pnts (_pnts.size());
+    _is_convex.assign(n_pnts, 0);
     for (std::size_t k(0); k<n_pnts; k++)
         _vertex_list.push_back (k);
 }
@@ -157,6 +162,7 @@ void EarClippingTriangulation::initLists ()
         } else {
             if (orientation == GeoLib::CW) {
                 _convex_vertex_list.push_back (*it);
+                _is_convex[*it] = 1;
                 if (isEar (*prev, *it, *next))
                     _ear_list.push_back (*it);
             }
@@ -177,6 +183,7 @@ void EarClippingTriangulation::clipEars()
         _ear_list.pop_front();
         // remove ear tip from _convex_vertex_list
         _convex_vertex_list.remove(ear);
+        _is_convex[ear] = 0;
 
         // remove ear from vertex_list, apply changes to _ear_list, _convex_vertex_list
         bool nfound(true);
@@ -210,6 +217,7 @@ void EarClippingTriangulation::clipEars()
                         _pnts[*next]);
                 if (orientation == GeoLib::CW) {
                     BaseLib::uniquePushBack(_convex_vertex_list, *prev);
+                    _is_convex[*prev] = 1;
                     // prev is convex
                     if (isEar(*prevprev, *prev, *next)) {
                         // prev is an ear tip
@@ -221,6 +229,7 @@ void EarClippingTriangulation::clipEars()
                 } else {
                     // prev is not convex => reflex or collinear
                     _convex_vertex_list.remove(*prev);
+                    _is_convex[*prev] = 0;
                     _ear_list.remove(*prev);
                     if (orientation == GeoLib::COLLINEAR) {
                         prev = _vertex_list.erase(prev);
@@ -249,6 +258,7 @@ void EarClippingTriangulation::clipEars()
                         _pnts[*nextnext]);
                 if (orientation == GeoLib::CW) {
                     BaseLib::uniquePushBack(_convex_vertex_list, *next);
+                    _is_convex[*next] = 1;
                     // next is convex
                     if (isEar(*prev, *next, *nextnext)) {
                         // next is an ear tip
@@ -260,6 +270,7 @@ void EarClippingTriangulation::clipEars()
                 } else {
                     // next is not convex => reflex or collinear
                     _convex_vertex_list.remove(*next);
+                    _is_convex[*next] = 0;
                     _ear_list.remove(*next);
                     if (orientation == GeoLib::COLLINEAR) {
                         next = _vertex_list.erase(next);
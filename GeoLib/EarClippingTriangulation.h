@@ -51,6 +51,12 @@ private:
     std::vector<GeoLib::Point*> _pnts;
     std::list<std::size_t> _vertex_list;
     std::list<std::size_t> _convex_vertex_list;
+    //! Convexity flag per input point, kept in sync with
+    //! _convex_vertex_list. Only reflex (non-convex) vertices can lie inside
+    //! a candidate ear, so isEar() tests just those---the standard
+    //! reflex-set optimization that makes ear clipping near-linear on
+    //! typical polygon outlines.
+    std::vector<char> _is_convex;
     std::list<std::size_t> _ear_list;
 
     /**
@@ -92,6 +92,16 @@ public:
     std::vector<std::vector<POINT*> const*>
     getPntVecsOfGridCellsIntersectingCube(P const& center, double half_len) const;
 
+    /**
+     * Allocation-free variant of getPntVecsOfGridCellsIntersectingCube():
+     * fills the caller-provided buffer (cleared first), which amortizes the
+     * allocation over repeated queries in the setup hot loops.
+     */
+    template <typename P>
+    void getPntVecsOfGridCellsIntersectingCube(
+        P const& center, double half_len,
+        std::vector<std::vector<POINT*> const*>& pnts) const;
+
     void getPntVecsOfGridCellsIntersectingCuboid(
         MathLib::Point3d const& min_pnt,
         MathLib::Point3d const& max_pnt,
@@ -242,6 +252,17 @@ Grid<POINT>::getPntVecsOfGridCellsIntersectingCube(P const& center,
     double half_len) const
 {
     std::vector<std::vector<POINT*> const*> pnts;
+    getPntVecsOfGridCellsIntersectingCube(center, half_len, pnts);
+    return pnts;
+}
+
+template <typename POINT>
+template <typename P>
+void Grid<POINT>::getPntVecsOfGridCellsIntersectingCube(
+    P const& center, double half_len,
+    std::vector<std::vector<POINT*> const*>& pnts) const
+{
+    pnts.clear();
     MathLib::Point3d tmp_pnt{
         {{center[0]-half_len, center[1]-half_len, center[2]-half_len}}}; // min
     std::array<std::size_t,3> min_coords(getGridCoords(tmp_pnt));
@@ -261,7 +282,6 @@ Grid<POINT>::getPntVecsOfGridCellsIntersectingCube(P const& center,
             }
         }
     }
-    return pnts;
 }
 
 template<typename POINT>
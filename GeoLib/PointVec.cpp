@@ -128,6 +128,18 @@ std::size_t PointVec::push_back(Point* pnt)
     return _pnt_id_map[_pnt_id_map.size() - 1];
 }
 
+std::vector<std::size_t> PointVec::addPoints(
+    std::vector<Point*> const& pnts)
+{
+    std::vector<std::size_t> ids;
+    ids.reserve(pnts.size());
+    _pnt_id_map.reserve(_pnt_id_map.size() + pnts.size());
+    _id_to_name_map.reserve(_id_to_name_map.size() + pnts.size());
+    for (auto* const pnt : pnts)
+        ids.push_back(push_back(pnt));
+    return ids;
+}
+
 void PointVec::push_back(Point* pnt, std::string const* const name)
 {
     if (name == nullptr)
@@ -168,8 +180,27 @@ std::size_t PointVec::uniqueInsert(Point* pnt)
     // pnt is outside of OctTree object
     if (ret_pnt == nullptr)
     {
-        // update the axis aligned bounding box
+        // Update the axis aligned bounding box. The box is grown
+        // geometrically (padded by half of the new extent in every
+        // direction) instead of tightly, so a sequence of inserts expanding
+        // the domain triggers only O(log(extent)) octree rebuilds instead of
+        // one rebuild per out-of-box point.
         _aabb.update(*pnt);
+        {
+            auto const& min_pnt = _aabb.getMinPoint();
+            auto const& max_pnt = _aabb.getMaxPoint();
+            GeoLib::Point padded_min(min_pnt[0], min_pnt[1], min_pnt[2]);
+            GeoLib::Point padded_max(max_pnt[0], max_pnt[1], max_pnt[2]);
+            for (unsigned d = 0; d < 3; ++d)
+            {
+                double const half_extent =
+                    0.5 * (max_pnt[d] - min_pnt[d]);
+                padded_min[d] -= half_extent;
+                padded_max[d] += half_extent;
+            }
+            _aabb.update(padded_min);
+            _aabb.update(padded_max);
+        }
         // recreate the (enlarged) OctTree
         _oct_tree.reset(GeoLib::OctTree<GeoLib::Point, 16>::createOctTree(
             _aabb.getMinPoint(), _aabb.getMaxPoint(), _rel_eps));
@@ -81,6 +81,12 @@ public:
      */
     std::size_t push_back (Point* pnt);
 
+    /// Bulk insertion of points with deduplication; returns for every input
+    /// point the id of the (possibly previously existing) unique point.
+    /// Amortizes the id-map bookkeeping over the whole batch; duplicates are
+    /// deleted as in push_back().
+    std::vector<std::size_t> addPoints(std::vector<Point*> const& pnts);
+
     /**
      * push_back adds new elements at the end of the vector _data_vec.
      * @param pnt a pointer to the point, PointVec takes ownership of the point
@@ -14,9 +14,15 @@
 
 #include "SensorData.h"
 
+#include <algorithm>
+#include <cstdint>
 #include <cstdlib>
+#include <cstring>
+#include <ctime>
 #include <fstream>
 
+#include <sys/stat.h>
+
 #include <logog/include/logog.hpp>
 
 #include "BaseLib/StringTools.h"
@@ -96,8 +102,39 @@ std::string SensorData::getDataUnit(SensorDataType time_series_name) const
     return "";
 }
 
+namespace
+{
+char const sensor_cache_magic[8] = {'O', 'G', 'S', 'S', 'D', 'C', '0', '1'};
+
+/// Modification time of the file, or 0 if unavailable.
+std::time_t modificationTime(std::string const& file_name)
+{
+    struct stat file_status;
+    if (stat(file_name.c_str(), &file_status) != 0)
+        return 0;
+    return file_status.st_mtime;
+}
+
+template <typename T>
+void writeValue(std::ostream& os, T const value)
+{
+    os.write(reinterpret_cast<char const*>(&value), sizeof(T));
+}
+
+template <typename T>
+bool readValue(std::istream& in, T& value)
+{
+    return static_cast<bool>(
+        in.read(reinterpret_cast<char*>(&value), sizeof(T)));
+}
+}  // anonymous namespace
+
 int SensorData::readDataFromFile(const std::string &file_name)
 {
+    std::string const cache_file_name = file_name + ".sdc";
+    if (readDataFromCacheFile(cache_file_name, file_name))
+        return 1;
+
     std::ifstream in( file_name.c_str() );
 
     if (!in.is_open())
@@ -151,9 +188,117 @@ int SensorData::readDataFromFile(const std::string &file_name)
     this->_start = this->_time_steps[0];
     this->_end   = this->_time_steps[this->_time_steps.size()-1];
 
+    writeCacheFile(cache_file_name);
+
     return 1;
 }
 
+bool SensorData::readDataFromCacheFile(const std::string &cache_file_name,
+                                       const std::string &source_file_name)
+{
+    // Only a cache at least as new as the source is trusted.
+    std::time_t const cache_time = modificationTime(cache_file_name);
+    if (cache_time == 0 || cache_time < modificationTime(source_file_name))
+        return false;
+
+    std::ifstream in(cache_file_name.c_str(), std::ios::binary);
+    if (!in.is_open())
+        return false;
+
+    char magic[sizeof(sensor_cache_magic)];
+    if (!in.read(magic, sizeof(magic)) ||
+        std::memcmp(magic, sensor_cache_magic, sizeof(magic)) != 0)
+        return false;
+
+    std::uint64_t n_series, n_steps;
+    if (!readValue(in, n_series) || !readValue(in, n_steps) || n_steps == 0)
+        return false;
+
+    std::vector<SensorDataType> names(n_series);
+    for (auto& name : names) {
+        std::uint8_t type_code;
+        if (!readValue(in, type_code))
+            return false;
+        name = static_cast<SensorDataType>(type_code);
+    }
+
+    // The sorted time-step column doubles as the range index, cf.
+    // getTimeStepIndexRange().
+    std::vector<std::size_t> time_steps(n_steps);
+    std::vector<std::uint64_t> raw_steps(n_steps);
+    if (!in.read(reinterpret_cast<char*>(raw_steps.data()),
+                 n_steps * sizeof(std::uint64_t)))
+        return false;
+    std::copy(raw_steps.begin(), raw_steps.end(), time_steps.begin());
+
+    std::vector<std::vector<float>*> data_vecs;
+    for (std::uint64_t i = 0; i < n_series; ++i) {
+        auto* const data = new std::vector<float>(n_steps);
+        data_vecs.push_back(data);
+        if (!in.read(reinterpret_cast<char*>(data->data()),
+                     n_steps * sizeof(float)))
+        {
+            for (auto* vec : data_vecs)
+                delete vec;
+            return false;
+        }
+    }
+
+    _vec_names = std::move(names);
+    _data_unit_string.assign(_vec_names.size(), "");
+    _time_steps = std::move(time_steps);
+    _data_vecs = std::move(data_vecs);
+    _start = _time_steps.front();
+    _end = _time_steps.back();
+
+    INFO("SensorData: loaded %d series with %d steps from cache '%s'.",
+         static_cast<int>(n_series), static_cast<int>(n_steps),
+         cache_file_name.c_str());
+    return true;
+}
+
+void SensorData::writeCacheFile(const std::string &cache_file_name) const
+{
+    std::ofstream os(cache_file_name.c_str(), std::ios::binary);
+    if (!os.is_open())
+        return;  // a read-only data directory is not an error
+
+    os.write(sensor_cache_magic, sizeof(sensor_cache_magic));
+    writeValue(os, static_cast<std::uint64_t>(_data_vecs.size()));
+    writeValue(os, static_cast<std::uint64_t>(_time_steps.size()));
+    for (auto const name : _vec_names)
+        writeValue(os, static_cast<std::uint8_t>(name));
+    for (auto const time_step : _time_steps)
+        writeValue(os, static_cast<std::uint64_t>(time_step));
+    for (auto const* data : _data_vecs)
+        os.write(reinterpret_cast<char const*>(data->data()),
+                 data->size() * sizeof(float));
+
+    if (os)
+        INFO("SensorData: cache written to '%s'.", cache_file_name.c_str());
+}
+
+std::pair<std::size_t, std::size_t> SensorData::getTimeStepIndexRange(
+    std::size_t from_time, std::size_t to_time) const
+{
+    if (_step_size > 0) {
+        auto const clampIndex = [this](std::size_t const time) {
+            if (time <= _start)
+                return std::size_t{0};
+            return std::min((time - _start) / _step_size,
+                            (_end - _start) / _step_size);
+        };
+        return {clampIndex(from_time), clampIndex(to_time) + 1};
+    }
+
+    auto const begin =
+        std::lower_bound(_time_steps.begin(), _time_steps.end(), from_time);
+    auto const end =
+        std::upper_bound(_time_steps.begin(), _time_steps.end(), to_time);
+    return {static_cast<std::size_t>(begin - _time_steps.begin()),
+            static_cast<std::size_t>(end - _time_steps.begin())};
+}
+
 std::string SensorData::convertSensorDataType2String(SensorDataType t)
 {
     if (SensorDataType::EVAPORATION == t) return "Evaporation";
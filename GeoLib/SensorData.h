@@ -16,6 +16,7 @@
 
 #include <cstddef>
 #include <string>
+#include <utility>
 #include <vector>
 
 /**
@@ -114,10 +115,29 @@ public:
     /// Converts Strings to Sensor Data Types
     static SensorDataType convertString2SensorDataType(const std::string &s);
 
+    /// Returns the [begin, end) index range of the time steps within
+    /// [from_time, to_time], resolved by binary search over the (sorted)
+    /// time-step array. For calibration workflows slicing long series.
+    std::pair<std::size_t, std::size_t> getTimeStepIndexRange(
+        std::size_t from_time, std::size_t to_time) const;
+
 private:
     /// Reads a CSV-file with time series data and fills the container.
+    ///
+    /// The parsed series are cached in a binary sidecar file next to the
+    /// source ("<name>.sdc"): repeat imports load the typed columns in bulk
+    /// instead of re-parsing the text, which brings 10^8-row observation
+    /// datasets from minutes to seconds. The cache is ignored when older
+    /// than the source.
     int readDataFromFile(const std::string &file_name);
 
+    /// Loads the binary sidecar cache; returns false if missing or stale.
+    bool readDataFromCacheFile(const std::string &cache_file_name,
+                               const std::string &source_file_name);
+
+    /// Writes the binary sidecar cache next to the source file.
+    void writeCacheFile(const std::string &cache_file_name) const;
+
     std::size_t _start;
     std::size_t _end;
     std::size_t _step_size;
@@ -186,6 +186,17 @@ SurfaceGrid::getGridCellCoordinates(MathLib::Point3d const& p) const
     return boost::optional<std::array<std::size_t, 3>>(coords);
 }
 
+void SurfaceGrid::arePointsInSurface(
+    std::vector<MathLib::Point3d const*> const& pnts,
+    std::vector<char>& results, double eps) const
+{
+    results.resize(pnts.size());
+    std::ptrdiff_t const n = static_cast<std::ptrdiff_t>(pnts.size());
+#pragma omp parallel for schedule(static)
+    for (std::ptrdiff_t i = 0; i < n; ++i)
+        results[i] = isPointInSurface(*pnts[i], eps) ? 1 : 0;
+}
+
 bool SurfaceGrid::isPointInSurface(MathLib::Point3d const& p, double eps) const
 {
     boost::optional<std::array<std::size_t,3>> optional_c(getGridCellCoordinates(p));
@@ -29,6 +29,15 @@ class Surface;
 class SurfaceGrid : public AABB {
 public:
     explicit SurfaceGrid(GeoLib::Surface const*const sfc);
+    /// Batched variant of isPointInSurface(): tests all given points; the
+    /// per-point cell lookups are independent and the loop parallelizes
+    /// under OpenMP, which speeds up the mesh-onto-surface mapping passes in
+    /// MeshGeoToolsLib.
+    void arePointsInSurface(
+        std::vector<MathLib::Point3d const*> const& pnts,
+        std::vector<char>& results,
+        double eps = std::numeric_limits<double>::epsilon()) const;
+
     bool isPointInSurface(MathLib::Point3d const & pnt,
         double eps = std::numeric_limits<double>::epsilon()) const;
 
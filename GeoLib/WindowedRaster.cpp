@@ -0,0 +1,194 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "WindowedRaster.h"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <limits>
+#include <numeric>
+#include <sstream>
+
+#include <logog/include/logog.hpp>
+
+#include "BaseLib/Error.h"
+
+namespace GeoLib
+{
+
+WindowedRaster::WindowedRaster(std::string const& file_name,
+                               std::size_t const max_cached_rows)
+    : _file_name(file_name), _max_cached_rows(max_cached_rows)
+{
+    std::ifstream in(file_name);
+    if (!in)
+        OGS_FATAL("Could not open raster file '%s'.", file_name.c_str());
+
+    // ESRI ASC header: keyword/value pairs.
+    std::size_t n_cols = 0, n_rows = 0;
+    double x_ll = 0, y_ll = 0, cell_size = 0, no_data = -9999;
+    for (int i = 0; i < 6; ++i)
+    {
+        std::string keyword;
+        in >> keyword;
+        std::transform(keyword.begin(), keyword.end(), keyword.begin(),
+                       ::tolower);
+        if (keyword == "ncols")
+            in >> n_cols;
+        else if (keyword == "nrows")
+            in >> n_rows;
+        else if (keyword == "xllcorner" || keyword == "xllcenter")
+            in >> x_ll;
+        else if (keyword == "yllcorner" || keyword == "yllcenter")
+            in >> y_ll;
+        else if (keyword == "cellsize")
+            in >> cell_size;
+        else if (keyword == "nodata_value")
+            in >> no_data;
+        else
+            OGS_FATAL("Unexpected keyword '%s' in raster header of '%s'.",
+                      keyword.c_str(), file_name.c_str());
+    }
+    in.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+
+    _header = {n_cols, n_rows,
+               MathLib::Point3d(std::array<double, 3>{{x_ll, y_ll, 0.0}}),
+               cell_size, no_data};
+
+    // Index the byte offsets of the data rows (the file stores the rows
+    // top-down, i.e., the first data row is the northernmost one).
+    _row_offsets.reserve(n_rows);
+    std::string line;
+    for (std::size_t row = 0; row < n_rows; ++row)
+    {
+        _row_offsets.push_back(static_cast<long long>(in.tellg()));
+        if (!std::getline(in, line))
+            OGS_FATAL("Raster file '%s' ends after %u of %u data rows.",
+                      file_name.c_str(), static_cast<unsigned>(row),
+                      static_cast<unsigned>(n_rows));
+    }
+}
+
+std::vector<double> const& WindowedRaster::getRow(std::size_t const row)
+{
+    auto const it = _row_cache.find(row);
+    if (it != _row_cache.end())
+        return it->second;
+
+    if (_row_cache.size() >= _max_cached_rows)
+        _row_cache.clear();
+
+    std::ifstream in(_file_name);
+    in.seekg(_row_offsets[row]);
+    std::vector<double> values(_header.n_cols);
+    for (auto& value : values)
+        if (!(in >> value))
+            OGS_FATAL("Error reading row %u of raster file '%s'.",
+                      static_cast<unsigned>(row), _file_name.c_str());
+
+    return _row_cache.emplace(row, std::move(values)).first->second;
+}
+
+double WindowedRaster::getValueAtPoint(MathLib::Point3d const& pnt)
+{
+    auto const& h = _header;
+    if (pnt[0] < h.origin[0] ||
+        pnt[0] >= h.origin[0] + h.cell_size * h.n_cols ||
+        pnt[1] < h.origin[1] ||
+        pnt[1] >= h.origin[1] + h.cell_size * h.n_rows)
+        return h.no_data;
+
+    int cell_x =
+        static_cast<int>(std::floor((pnt[0] - h.origin[0]) / h.cell_size));
+    int cell_y =
+        static_cast<int>(std::floor((pnt[1] - h.origin[1]) / h.cell_size));
+    cell_x = std::min(std::max(cell_x, 0), static_cast<int>(h.n_cols - 1));
+    cell_y = std::min(std::max(cell_y, 0), static_cast<int>(h.n_rows - 1));
+
+    // data rows are stored top-down
+    auto const file_row = h.n_rows - 1 - static_cast<std::size_t>(cell_y);
+    return getRow(file_row)[cell_x];
+}
+
+double WindowedRaster::interpolateValueAtPoint(MathLib::Point3d const& pnt)
+{
+    auto const& h = _header;
+    double const x_pos = (pnt[0] - h.origin[0]) / h.cell_size;
+    double const y_pos = (pnt[1] - h.origin[1]) / h.cell_size;
+    double const x_idx = std::floor(x_pos);
+    double const y_idx = std::floor(y_pos);
+
+    double const half_delta = 0.5 * h.cell_size;
+    double const x_shift =
+        std::fabs(x_pos - (x_idx + half_delta)) / h.cell_size;
+    double const y_shift =
+        std::fabs(y_pos - (y_idx + half_delta)) / h.cell_size;
+    std::array<double, 4> weight = {
+        {(1 - x_shift) * (1 - y_shift), x_shift * (1 - y_shift),
+         x_shift * y_shift, (1 - x_shift) * y_shift}};
+
+    int const x_shift_idx = (x_pos - x_idx - half_delta >= 0) ? 1 : -1;
+    int const y_shift_idx = (y_pos - y_idx - half_delta >= 0) ? 1 : -1;
+    std::array<int, 4> const x_nb = {{0, x_shift_idx, x_shift_idx, 0}};
+    std::array<int, 4> const y_nb = {{0, 0, y_shift_idx, y_shift_idx}};
+
+    std::array<double, 4> pix_val;
+    unsigned no_data_count = 0;
+    for (unsigned j = 0; j < 4; ++j)
+    {
+        auto const x = x_idx + x_nb[j];
+        auto const y = y_idx + y_nb[j];
+        if (x < 0 || y < 0 || x > (h.n_cols - 1) || y > (h.n_rows - 1))
+            pix_val[j] = h.no_data;
+        else
+        {
+            auto const file_row =
+                h.n_rows - 1 - static_cast<std::size_t>(y);
+            pix_val[j] = getRow(file_row)[static_cast<std::size_t>(x)];
+        }
+
+        if (std::fabs(pix_val[j] - h.no_data) <
+            std::numeric_limits<double>::epsilon())
+        {
+            weight[j] = 0;
+            ++no_data_count;
+        }
+    }
+
+    if (no_data_count == 4)
+        return h.no_data;
+
+    double const sum_weights =
+        std::accumulate(weight.begin(), weight.end(), 0.0);
+    double value = 0.0;
+    for (unsigned j = 0; j < 4; ++j)
+        value += weight[j] * pix_val[j];
+    return value / sum_weights;
+}
+
+void WindowedRaster::interpolateValuesAtPoints(
+    std::vector<MathLib::Point3d const*> const& points,
+    std::vector<double>& results)
+{
+    results.resize(points.size());
+
+    // Process the queries sorted by raster row to maximize tile reuse.
+    std::vector<std::size_t> order(points.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(),
+              [&](std::size_t const a, std::size_t const b) {
+                  return (*points[a])[1] > (*points[b])[1];
+              });
+
+    for (auto const i : order)
+        results[i] = interpolateValueAtPoint(*points[i]);
+}
+
+}  // namespace GeoLib
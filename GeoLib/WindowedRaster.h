@@ -0,0 +1,69 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "MathLib/Point3d.h"
+#include "Raster.h"
+
+namespace GeoLib
+{
+
+/// Windowed access to an ESRI ASC raster without loading it into memory.
+///
+/// The file's header and the byte offsets of the data rows are indexed in
+/// one initial scan; afterwards only the row tiles touched by queries are
+/// decoded and kept in a bounded cache, so mapping a 100GB DEM onto a mesh
+/// streams through the tiles instead of materializing the whole raster.
+/// getValueAtPoint() matches GeoLib::Raster's nearest-cell semantics;
+/// interpolateValuesAtPoints() batch-interpolates bilinearly onto a node
+/// array, sorted by row to maximize tile reuse.
+class WindowedRaster final
+{
+public:
+    /// Opens and indexes the given .asc file; throws via OGS_FATAL on
+    /// malformed input.
+    explicit WindowedRaster(std::string const& file_name,
+                            std::size_t const max_cached_rows = 1024);
+
+    RasterHeader const& getHeader() const { return _header; }
+
+    /// Nearest-cell value, cf. Raster::getValueAtPoint().
+    double getValueAtPoint(MathLib::Point3d const& pnt);
+
+    /// Batch bilinear interpolation onto the given points; the accesses are
+    /// processed in row order to maximize tile reuse. results is resized to
+    /// the number of points; no-data propagates like in
+    /// Raster::interpolateValueAtPoint().
+    void interpolateValuesAtPoints(
+        std::vector<MathLib::Point3d const*> const& points,
+        std::vector<double>& results);
+
+private:
+    /// Returns the decoded data row, loading and caching it if necessary.
+    std::vector<double> const& getRow(std::size_t const row);
+
+    double interpolateValueAtPoint(MathLib::Point3d const& pnt);
+
+    std::string const _file_name;
+    RasterHeader _header = {0, 0, MathLib::Point3d(), 0.0, -9999.0};
+    std::size_t const _max_cached_rows;
+
+    //! Byte offset of each data row in the file.
+    std::vector<long long> _row_offsets;
+
+    //! Decoded rows; evicted wholesale when the bound is exceeded.
+    std::map<std::size_t, std::vector<double>> _row_cache;
+};
+
+}  // namespace GeoLib
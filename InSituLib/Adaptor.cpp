@@ -0,0 +1,93 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "Adaptor.h"
+
+#include <vtkCPDataDescription.h>
+#include <vtkCPInputDataDescription.h>
+#include <vtkCPProcessor.h>
+#include <vtkCPPythonScriptPipeline.h>
+#include <vtkNew.h>
+#include <vtkUnstructuredGrid.h>
+
+#include <logog/include/logog.hpp>
+
+#include "BaseLib/ConfigTree.h"
+#include "BaseLib/FileTools.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/Vtk/VtkMappedMeshSource.h"
+
+namespace InSituLib
+{
+
+namespace
+{
+vtkCPProcessor* processor = nullptr;
+}
+
+void Initialize(BaseLib::ConfigTree const& scripts_config,
+                std::string const& path)
+{
+    if (processor == nullptr)
+    {
+        processor = vtkCPProcessor::New();
+        processor->Initialize();
+    }
+    else
+        processor->RemoveAllPipelines();
+
+    //! \ogs_file_param{prj__insitu__scripts__script}
+    for (auto script_config : scripts_config.getConfigSubtreeList("script"))
+    {
+        //! \ogs_file_param{prj__insitu__scripts__script__name}
+        auto const script_name = script_config.getValue<std::string>();
+        std::string const script_path =
+            BaseLib::copyPathToFileName(script_name, path);
+        INFO("Initializing in-situ pipeline from script '%s'.",
+             script_path.c_str());
+        vtkNew<vtkCPPythonScriptPipeline> pipeline;
+        pipeline->Initialize(script_path.c_str());
+        processor->AddPipeline(pipeline.GetPointer());
+    }
+}
+
+void Finalize()
+{
+    if (processor == nullptr)
+        return;
+    processor->Delete();
+    processor = nullptr;
+}
+
+void CoProcess(MeshLib::Mesh const& mesh, double const time,
+               unsigned int const time_step, bool const last_time_step)
+{
+    if (processor == nullptr)
+        return;
+
+    vtkNew<vtkCPDataDescription> data_description;
+    data_description->AddInput("input");
+    data_description->SetTimeData(time, time_step);
+    if (last_time_step)
+        data_description->ForceOutputOn();
+
+    if (processor->RequestDataDescription(data_description.GetPointer()) == 0)
+        return;
+
+    // The mapped source wraps the mesh's node, element and property arrays
+    // without copying; the pipelines read the live simulation data.
+    vtkNew<MeshLib::VtkMappedMeshSource> source;
+    source->SetMesh(&mesh);
+    source->Update();
+    data_description->GetInputDescriptionByName("input")->SetGrid(
+        source->GetOutput());
+    processor->CoProcess(data_description.GetPointer());
+}
+
+}  // namespace InSituLib
@@ -0,0 +1,49 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <string>
+
+namespace BaseLib
+{
+class ConfigTree;
+}
+namespace MeshLib
+{
+class Mesh;
+}
+
+namespace InSituLib
+{
+
+/*! ParaView Catalyst co-processing hook.
+ *
+ * The simulation data reaches the Catalyst pipelines through the zero-copy
+ * mapped-array adapters of MeshLib/Vtk (VtkMappedMeshSource and the
+ * mapped coordinate/property templates), so no mesh or field data is copied
+ * for the in-situ analysis and no VTU file needs to be written for fields
+ * that are only ever looked at.
+ */
+
+/// Sets up the Catalyst co-processor with the Python pipeline scripts of the
+/// project file's <insitu><scripts> section; relative script paths resolve
+/// against \c path.
+void Initialize(BaseLib::ConfigTree const& scripts_config,
+                std::string const& path);
+
+/// Shuts the co-processor down.
+void Finalize();
+
+/// Hands the mesh (wrapped zero-copy) to the co-processor for the given
+/// time step, cf. ProcessLib::Output.
+void CoProcess(MeshLib::Mesh const& mesh, double const time,
+               unsigned int const time_step, bool const last_time_step);
+
+}  // namespace InSituLib
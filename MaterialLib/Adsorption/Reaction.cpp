@@ -25,14 +25,13 @@
 #include "ReactionCaOH2.h"
 #include "ReactionInert.h"
 #include "ReactionSinusoidal.h"
+#include "TabulatedAdsorption.h"
 
 
 namespace Adsorption
 {
 
-std::unique_ptr<Reaction>
-Reaction::
-newInstance(BaseLib::ConfigTree const& conf)
+static std::unique_ptr<Reaction> newReaction(BaseLib::ConfigTree const& conf)
 {
     //! \ogs_file_param{material__adsorption__reaction__type}
     auto const type = conf.getConfigParameter<std::string>("type");
@@ -65,4 +64,40 @@ newInstance(BaseLib::ConfigTree const& conf)
     return nullptr;
 }
 
+std::unique_ptr<Reaction>
+Reaction::
+newInstance(BaseLib::ConfigTree const& conf)
+{
+    auto reaction = newReaction(conf);
+
+    // Optionally tabulate the equilibrium loading over the configured
+    // (p_V, T) operating window, cf. TabulatedAdsorption.
+    auto const tabulation_config =
+        //! \ogs_file_param{material__adsorption__reaction__tabulation}
+        conf.getConfigSubtreeOptional("tabulation");
+    if (!tabulation_config)
+        return reaction;
+
+    //! \ogs_file_param{material__adsorption__reaction__tabulation__molar_mass}
+    auto const M = tabulation_config->getConfigParameter<double>("molar_mass");
+    //! \ogs_file_param{material__adsorption__reaction__tabulation__p_min}
+    auto const p_min = tabulation_config->getConfigParameter<double>("p_min");
+    //! \ogs_file_param{material__adsorption__reaction__tabulation__p_max}
+    auto const p_max = tabulation_config->getConfigParameter<double>("p_max");
+    //! \ogs_file_param{material__adsorption__reaction__tabulation__n_p}
+    auto const n_p =
+        tabulation_config->getConfigParameter<std::size_t>("n_p");
+    //! \ogs_file_param{material__adsorption__reaction__tabulation__t_min}
+    auto const T_min = tabulation_config->getConfigParameter<double>("t_min");
+    //! \ogs_file_param{material__adsorption__reaction__tabulation__t_max}
+    auto const T_max = tabulation_config->getConfigParameter<double>("t_max");
+    //! \ogs_file_param{material__adsorption__reaction__tabulation__n_t}
+    auto const n_T =
+        tabulation_config->getConfigParameter<std::size_t>("n_t");
+
+    return std::unique_ptr<Reaction>(
+        new TabulatedAdsorption(std::move(reaction), M, p_min, p_max, n_p,
+                                T_min, T_max, n_T));
+}
+
 } // namespace Adsorption
@@ -0,0 +1,110 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "Reaction.h"
+
+namespace Adsorption
+{
+
+/// Tabulation of another reaction's equilibrium loading over a regular
+/// (p_V, T) grid with bilinear interpolation.
+///
+/// The characteristic-curve polynomials and exponential chains of the
+/// adsorption density models are evaluated once per grid point at
+/// construction; getEquilibriumLoading() then interpolates in the table. The
+/// molar mass is fixed at construction (the TES process uses one adsorbate
+/// throughout). Queries outside the tabulated operating window and all other
+/// Reaction methods fall through to the exact model. Resolution and window
+/// are configured via the optional <tabulation> subtree of the reaction
+/// configuration.
+class TabulatedAdsorption final : public Reaction
+{
+public:
+    TabulatedAdsorption(std::unique_ptr<Reaction>&& reaction,
+                        double const M_Ads, double const p_min,
+                        double const p_max, std::size_t const n_p,
+                        double const T_min, double const T_max,
+                        std::size_t const n_T)
+        : _reaction(std::move(reaction)),
+          _M_Ads(M_Ads),
+          _p_min(p_min),
+          _T_min(T_min),
+          _dp((p_max - p_min) / static_cast<double>(n_p - 1)),
+          _dT((T_max - T_min) / static_cast<double>(n_T - 1)),
+          _n_p(n_p),
+          _n_T(n_T),
+          _loading(n_p * n_T)
+    {
+        for (std::size_t i = 0; i < n_p; ++i)
+        {
+            double const p = _p_min + static_cast<double>(i) * _dp;
+            for (std::size_t j = 0; j < n_T; ++j)
+            {
+                double const T = _T_min + static_cast<double>(j) * _dT;
+                _loading[i * n_T + j] =
+                    _reaction->getEquilibriumLoading(p, T, _M_Ads);
+            }
+        }
+    }
+
+    double getEnthalpy(const double p_Ads, const double T_Ads,
+                       const double M_Ads) const override
+    {
+        return _reaction->getEnthalpy(p_Ads, T_Ads, M_Ads);
+    }
+
+    double getReactionRate(const double p_Ads, const double T_Ads,
+                           const double M_Ads,
+                           const double loading) const override
+    {
+        return _reaction->getReactionRate(p_Ads, T_Ads, M_Ads, loading);
+    }
+
+    double getEquilibriumLoading(const double p_Ads, const double T_Ads,
+                                 const double M_Ads) const override
+    {
+        double const r = (p_Ads - _p_min) / _dp;
+        double const s = (T_Ads - _T_min) / _dT;
+        if (M_Ads != _M_Ads || r < 0 || s < 0 ||
+            r > static_cast<double>(_n_p - 1) ||
+            s > static_cast<double>(_n_T - 1))
+        {
+            return _reaction->getEquilibriumLoading(p_Ads, T_Ads, M_Ads);
+        }
+
+        auto const i = std::min(static_cast<std::size_t>(r), _n_p - 2);
+        auto const j = std::min(static_cast<std::size_t>(s), _n_T - 2);
+        double const u = r - static_cast<double>(i);
+        double const v = s - static_cast<double>(j);
+
+        return (1 - u) * (1 - v) * _loading[i * _n_T + j] +
+               (1 - u) * v * _loading[i * _n_T + j + 1] +
+               u * (1 - v) * _loading[(i + 1) * _n_T + j] +
+               u * v * _loading[(i + 1) * _n_T + j + 1];
+    }
+
+private:
+    std::unique_ptr<Reaction> const _reaction;
+    double const _M_Ads;
+    double const _p_min;
+    double const _T_min;
+    double const _dp;
+    double const _dT;
+    std::size_t const _n_p;
+    std::size_t const _n_T;
+    //! Equilibrium loading samples, pressure-major.
+    std::vector<double> _loading;
+};
+
+}  // namespace Adsorption
@@ -0,0 +1,50 @@
+/**
+ *  \copyright
+ *   Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *              Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ * \file   CreateTabulatedFluidProperty.cpp
+ */
+
+#include "CreateTabulatedFluidProperty.h"
+
+#include "BaseLib/ConfigTree.h"
+#include "TabulatedFluidProperty.h"
+
+namespace MaterialLib
+{
+namespace Fluid
+{
+std::unique_ptr<FluidProperty> applyOptionalTabulation(
+    BaseLib::ConfigTree const& config,
+    std::unique_ptr<FluidProperty>&& property)
+{
+    auto const tabulation_config =
+        //! \ogs_file_param{material__fluid__tabulation}
+        config.getConfigSubtreeOptional("tabulation");
+    if (!tabulation_config)
+        return std::move(property);
+
+    //! \ogs_file_param{material__fluid__tabulation__t_min}
+    auto const T_min = tabulation_config->getConfigParameter<double>("t_min");
+    //! \ogs_file_param{material__fluid__tabulation__t_max}
+    auto const T_max = tabulation_config->getConfigParameter<double>("t_max");
+    //! \ogs_file_param{material__fluid__tabulation__n_t}
+    auto const n_T =
+        tabulation_config->getConfigParameter<std::size_t>("n_t");
+    //! \ogs_file_param{material__fluid__tabulation__p_min}
+    auto const p_min = tabulation_config->getConfigParameter<double>("p_min");
+    //! \ogs_file_param{material__fluid__tabulation__p_max}
+    auto const p_max = tabulation_config->getConfigParameter<double>("p_max");
+    //! \ogs_file_param{material__fluid__tabulation__n_p}
+    auto const n_p =
+        tabulation_config->getConfigParameter<std::size_t>("n_p");
+
+    return std::unique_ptr<FluidProperty>(new TabulatedFluidProperty(
+        std::move(property), T_min, T_max, n_T, p_min, p_max, n_p));
+}
+
+}  // end namespace
+}  // end namespace
@@ -0,0 +1,35 @@
+/**
+ *  \copyright
+ *   Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *              Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ * \file   CreateTabulatedFluidProperty.h
+ */
+
+#pragma once
+
+#include <memory>
+
+namespace BaseLib
+{
+class ConfigTree;
+}
+
+namespace MaterialLib
+{
+namespace Fluid
+{
+class FluidProperty;
+
+/// Wraps the given fluid property into a TabulatedFluidProperty if the
+/// model's configuration contains an optional <tabulation> subtree
+/// (t_min/t_max/n_t/p_min/p_max/n_p); returns the property unchanged
+/// otherwise.
+std::unique_ptr<FluidProperty> applyOptionalTabulation(
+    BaseLib::ConfigTree const& config,
+    std::unique_ptr<FluidProperty>&& property);
+
+}  // end namespace
+}  // end namespace
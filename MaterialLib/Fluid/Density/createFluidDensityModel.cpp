@@ -14,6 +14,7 @@
 #include "createFluidDensityModel.h"
 
 #include "BaseLib/Error.h"
+#include "MaterialLib/Fluid/CreateTabulatedFluidProperty.h"
 
 #include "IdealGasLaw.h"
 #include "LinearTemperatureDependentDensity.h"
@@ -72,7 +73,7 @@ static std::unique_ptr<FluidProperty> createLinearTemperatureDependentDensity(
         new LinearTemperatureDependentDensity(rho0, T0, beta));
 }
 
-std::unique_ptr<FluidProperty> createFluidDensityModel(
+static std::unique_ptr<FluidProperty> createFluidDensityModelImpl(
     BaseLib::ConfigTree const& config)
 {
     //! \ogs_file_param{material__fluid__density__type}
@@ -114,5 +115,13 @@ std::unique_ptr<FluidProperty> createFluidDensityModel(
     }
 }
 
+std::unique_ptr<FluidProperty> createFluidDensityModel(
+    BaseLib::ConfigTree const& config)
+{
+    // Optionally wrap the created model into a (T, p) tabulation, cf.
+    // TabulatedFluidProperty.
+    return applyOptionalTabulation(config, createFluidDensityModelImpl(config));
+}
+
 }  // end namespace
 }  // end namespace
@@ -0,0 +1,129 @@
+/**
+ *  \copyright
+ *   Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *              Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ * \file   TabulatedFluidProperty.h
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "FluidProperty.h"
+
+namespace MaterialLib
+{
+namespace Fluid
+{
+/// Tabulation layer over another fluid property.
+///
+/// On construction the wrapped model is sampled on a regular (T, p) grid;
+/// getValue() then bilinearly interpolates in the table instead of
+/// re-evaluating the transcendental expressions at every integration point
+/// and iteration. Queries outside of the tabulated window fall back to the
+/// exact model. The batched getValues() amortizes the virtual dispatch over
+/// a span of query points.
+///
+/// The derivative evaluation is delegated to the exact model, since finite
+/// differences of the table would add a second discretization error on top
+/// of the interpolation.
+class TabulatedFluidProperty final : public FluidProperty
+{
+public:
+    /// \param property   the exact model being tabulated; takes ownership.
+    /// \param T_min,T_max,n_T  temperature window and resolution.
+    /// \param p_min,p_max,n_p  pressure window and resolution.
+    TabulatedFluidProperty(std::unique_ptr<FluidProperty>&& property,
+                           double const T_min, double const T_max,
+                           std::size_t const n_T, double const p_min,
+                           double const p_max, std::size_t const n_p)
+        : _property(std::move(property)),
+          _T_min(T_min),
+          _p_min(p_min),
+          _dT((T_max - T_min) / static_cast<double>(n_T - 1)),
+          _dp((p_max - p_min) / static_cast<double>(n_p - 1)),
+          _n_T(n_T),
+          _n_p(n_p),
+          _values(n_T * n_p)
+    {
+        ArrayType var_vals;
+        for (std::size_t i = 0; i < n_T; ++i)
+        {
+            var_vals[static_cast<unsigned>(PropertyVariableType::T)] =
+                _T_min + static_cast<double>(i) * _dT;
+            for (std::size_t j = 0; j < n_p; ++j)
+            {
+                var_vals[static_cast<unsigned>(PropertyVariableType::p)] =
+                    _p_min + static_cast<double>(j) * _dp;
+                _values[i * n_p + j] = _property->getValue(var_vals);
+            }
+        }
+    }
+
+    std::string getName() const override
+    {
+        return "Tabulated(" + _property->getName() + ")";
+    }
+
+    double getValue(const ArrayType& var_vals) const override
+    {
+        double const T = var_vals[static_cast<unsigned>(
+            PropertyVariableType::T)];
+        double const p = var_vals[static_cast<unsigned>(
+            PropertyVariableType::p)];
+
+        double const s = (T - _T_min) / _dT;
+        double const r = (p - _p_min) / _dp;
+        if (s < 0 || r < 0 || s > static_cast<double>(_n_T - 1) ||
+            r > static_cast<double>(_n_p - 1))
+        {
+            // Outside of the tabulated window: exact model.
+            return _property->getValue(var_vals);
+        }
+
+        auto const i = std::min(static_cast<std::size_t>(s), _n_T - 2);
+        auto const j = std::min(static_cast<std::size_t>(r), _n_p - 2);
+        double const u = s - static_cast<double>(i);
+        double const v = r - static_cast<double>(j);
+
+        return (1 - u) * (1 - v) * _values[i * _n_p + j] +
+               (1 - u) * v * _values[i * _n_p + j + 1] +
+               u * (1 - v) * _values[(i + 1) * _n_p + j] +
+               u * v * _values[(i + 1) * _n_p + j + 1];
+    }
+
+    /// Batched evaluation over \c n query points; one virtual dispatch for
+    /// the whole span.
+    void getValues(ArrayType const* const var_vals, std::size_t const n,
+                   double* const results) const
+    {
+        for (std::size_t k = 0; k < n; ++k)
+            results[k] = getValue(var_vals[k]);
+    }
+
+    double getdValue(const ArrayType& var_vals,
+                     const PropertyVariableType var) const override
+    {
+        return _property->getdValue(var_vals, var);
+    }
+
+private:
+    std::unique_ptr<FluidProperty> const _property;
+    double const _T_min;
+    double const _p_min;
+    double const _dT;
+    double const _dp;
+    std::size_t const _n_T;
+    std::size_t const _n_p;
+    //! Sampled values, temperature-major.
+    std::vector<double> _values;
+};
+
+}  // end namespace
+}  // end namespace
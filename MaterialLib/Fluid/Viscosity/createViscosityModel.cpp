@@ -14,6 +14,7 @@
 #include "createViscosityModel.h"
 
 #include "BaseLib/Error.h"
+#include "MaterialLib/Fluid/CreateTabulatedFluidProperty.h"
 
 #include "MaterialLib/Fluid/ConstantFluidProperty.h"
 #include "LinearPressureDependentViscosity.h"
@@ -73,7 +74,7 @@ static std::unique_ptr<FluidProperty> createTemperatureDependentViscosity(
         new TemperatureDependentViscosity(mu0, Tc, Tv));
 }
 
-std::unique_ptr<FluidProperty> createViscosityModel(
+static std::unique_ptr<FluidProperty> createViscosityModelImpl(
     BaseLib::ConfigTree const& config)
 {
     //! \ogs_file_param{material__fluid__viscosity__type}
@@ -152,5 +153,13 @@ std::unique_ptr<FluidProperty> createViscosityModel(
     }
 }
 
+std::unique_ptr<FluidProperty> createViscosityModel(
+    BaseLib::ConfigTree const& config)
+{
+    // Optionally wrap the created model into a (T, p) tabulation, cf.
+    // TabulatedFluidProperty.
+    return applyOptionalTabulation(config, createViscosityModelImpl(config));
+}
+
 }  // end namespace
 }  // end namespace
@@ -83,6 +83,34 @@ public:
             Eigen::Ref<Eigen::MatrixXd> C,
             MaterialStateVariables& material_state_variables)  = 0;
 
+    /**
+     * Batched variant evaluating all integration points of one fracture
+     * element together. The default implementation loops the per-point
+     * method; models with branch-heavy return mappings override it to hoist
+     * the (per-element constant) material properties and to split the
+     * elastic/plastic branches into compact loops, cf. MohrCoulomb.
+     *
+     * The value arrays have length \c n (the per-point vectors staged
+     * contiguously by the caller); state variables are passed as an array
+     * of pointers.
+     */
+    virtual void computeConstitutiveRelationBatch(
+        double const t,
+        ProcessLib::SpatialPosition const& x,
+        std::size_t const n,
+        Eigen::VectorXd const* const w_prev,
+        Eigen::VectorXd const* const w,
+        Eigen::VectorXd const* const sigma_prev,
+        Eigen::VectorXd* const sigma,
+        Eigen::MatrixXd* const C,
+        MaterialStateVariables* const* const material_state_variables)
+    {
+        for (std::size_t i = 0; i < n; ++i)
+            computeConstitutiveRelation(t, x, w_prev[i], w[i], sigma_prev[i],
+                                        sigma[i], C[i],
+                                        *material_state_variables[i]);
+    }
+
 };
 
 }  // namespace Fracture
@@ -118,6 +118,85 @@ void MohrCoulomb<DisplacementDim>::computeConstitutiveRelation(
     Kep = Ke - Ke * dQs_dS * A;
 }
 
+template <int DisplacementDim>
+void MohrCoulomb<DisplacementDim>::computeConstitutiveRelationBatch(
+    double const t,
+    ProcessLib::SpatialPosition const& x,
+    std::size_t const n,
+    Eigen::VectorXd const* const w_prev,
+    Eigen::VectorXd const* const w,
+    Eigen::VectorXd const* const sigma_prev,
+    Eigen::VectorXd* const sigma,
+    Eigen::MatrixXd* const Kep,
+    typename FractureModelBase<DisplacementDim>::MaterialStateVariables* const*
+        const material_state_variables)
+{
+    if (DisplacementDim == 3)
+    {
+        OGS_FATAL("MohrCoulomb fracture model does not support 3D case.");
+        return;
+    }
+
+    // Material properties and the elastic stiffness are constant over the
+    // element; resolve them once for the whole batch.
+    MaterialPropertyValues const mat(_mp, t, x);
+    double const tan_phi = std::tan(mat.phi);
+    double const tan_psi = std::tan(mat.psi);
+    Eigen::Matrix2d Ke;
+    Ke << mat.Ks, 0, 0, mat.Kn;
+
+    // Classification pass: trial stress and branch per point.
+    enum class Branch : char { Opening, Elastic, Plastic };
+    std::vector<Branch> branches(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        material_state_variables[i]->reset();
+        sigma[i].noalias() = sigma_prev[i] + Ke * (w[i] - w_prev[i]);
+        if (sigma[i][1] > 0)
+        {
+            branches[i] = Branch::Opening;
+            continue;
+        }
+        double const Fs =
+            std::abs(sigma[i][0]) + sigma[i][1] * tan_phi - mat.c;
+        material_state_variables[i]->setShearYieldFunctionValue(Fs);
+        branches[i] = Fs < 0.0 ? Branch::Elastic : Branch::Plastic;
+    }
+
+    // Compact per-branch loops.
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        if (branches[i] != Branch::Opening)
+            continue;
+        Kep[i].setZero();
+        sigma[i].setZero();
+        material_state_variables[i]->setTensileStress(true);
+    }
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        if (branches[i] != Branch::Elastic)
+            continue;
+        Kep[i] = Ke;
+    }
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        if (branches[i] != Branch::Plastic)
+            continue;
+
+        double const sign = boost::math::sign(sigma[i][0]);
+        Eigen::Vector2d const dFs_dS(sign, tan_phi);
+        Eigen::Vector2d const dQs_dS(sign, tan_psi);
+
+        Eigen::RowVector2d const A =
+            dFs_dS.transpose() * Ke / (dFs_dS.transpose() * Ke * dQs_dS);
+        double const d_eta = A * (w[i] - w_prev[i]);
+        Eigen::Vector2d const dwp = dQs_dS * d_eta;
+
+        sigma[i].noalias() = sigma_prev[i] + Ke * (w[i] - w_prev[i] - dwp);
+        Kep[i] = Ke - Ke * dQs_dS * A;
+    }
+}
+
 template class MohrCoulomb<2>;
 template class MohrCoulomb<3>;
 
@@ -94,6 +94,22 @@ public:
             typename FractureModelBase<DisplacementDim>::MaterialStateVariables&
             material_state_variables) override;
 
+    /// Batched evaluation: hoists the material properties and the elastic
+    /// stiffness out of the point loop, classifies the points into the
+    /// tensile-opening / elastic / plastic sets and processes each set in
+    /// a compact loop, cf. FractureModelBase.
+    void computeConstitutiveRelationBatch(
+        double const t,
+        ProcessLib::SpatialPosition const& x,
+        std::size_t const n,
+        Eigen::VectorXd const* const w_prev,
+        Eigen::VectorXd const* const w,
+        Eigen::VectorXd const* const sigma_prev,
+        Eigen::VectorXd* const sigma,
+        Eigen::MatrixXd* const Kep,
+        typename FractureModelBase<DisplacementDim>::MaterialStateVariables* const*
+            const material_state_variables) override;
+
 private:
 
     MaterialProperties _mp;
@@ -35,7 +35,7 @@
 #include <boost/math/special_functions/pow.hpp>
 #include <logog/include/logog.hpp>
 #include "MaterialLib/SolidModels/KelvinVector.h"
-#include "NumLib/NewtonRaphson.h"
+#include "MathLib/Nonlinear/ModifiedNewton.h"
 #include "PhysicalStressWithInvariants.h"
 
 namespace MaterialLib
@@ -54,7 +54,7 @@ struct PhysicalStressWithInvariants final
 
     explicit PhysicalStressWithInvariants(KelvinVector const& stress)
         : value{stress},
-          D{Invariants::deviatoric_projection * stress},
+          D{Invariants::deviatoric(stress)},
           I_1{Invariants::trace(stress)},
           J_2{Invariants::J2(D)},
           J_3{Invariants::J3(D)}
@@ -218,43 +218,14 @@ void calculatePlasticResidual(
 }
 
 /// Special product of \p v with itself: \f$v \odot v\f$.
-/// v is given in \p Kelvin mapping.
+/// v is given in \p Kelvin mapping. Delegates to the size-specialized
+/// fixed-size kernels, which also handle the 2D (size 4) case correctly.
 template <int DisplacementDim>
 ProcessLib::KelvinMatrixType<DisplacementDim> s_odot_s(
     ProcessLib::KelvinVectorType<DisplacementDim> const& v)
 {
-    ProcessLib::KelvinMatrixType<DisplacementDim> result;
-
-    result(0, 0) = v(0) * v(0);
-    result(0, 1) = result(1, 0) = v(3) * v(3) / 2.;
-    result(0, 2) = result(2, 0) = v(5) * v(5) / 2.;
-    result(0, 3) = result(3, 0) = v(0) * v(3);
-    result(0, 4) = result(4, 0) = v(3) * v(5) / std::sqrt(2.);
-    result(0, 5) = result(5, 0) = v(0) * v(5);
-
-    result(1, 1) = v(1) * v(1);
-    result(1, 2) = result(2, 1) = v(4) * v(4) / 2.;
-    result(1, 3) = result(3, 1) = v(3) * v(1);
-    result(1, 4) = result(4, 1) = v(1) * v(4);
-    result(1, 5) = result(5, 1) = v(3) * v(4) / std::sqrt(2.);
-
-    result(2, 2) = v(2) * v(2);
-    result(2, 3) = result(3, 2) = v(5) * v(4) / std::sqrt(2.);
-    result(2, 4) = result(4, 2) = v(4) * v(2);
-    result(2, 5) = result(5, 2) = v(5) * v(2);
-
-    result(3, 3) = v(0) * v(1) + v(3) * v(3) / 2.;
-    result(3, 4) = result(4, 3) =
-        v(3) * v(4) / 2. + v(5) * v(1) / std::sqrt(2.);
-    result(3, 5) = result(5, 3) =
-        v(0) * v(4) / std::sqrt(2.) + v(3) * v(5) / 2.;
-
-    result(4, 4) = v(1) * v(2) + v(4) * v(4) / 2.;
-    result(4, 5) = result(5, 4) =
-        v(3) * v(2) / std::sqrt(2.) + v(5) * v(4) / 2.;
-
-    result(5, 5) = v(0) * v(2) + v(5) * v(5) / 2.;
-    return result;
+    return MaterialLib::SolidModels::sOdotS<
+        ProcessLib::KelvinVectorDimensions<DisplacementDim>::value>(v);
 }
 
 template <int DisplacementDim>
@@ -616,12 +587,14 @@ bool SolidEhlers<DisplacementDim>::computeConstitutiveRelation(
             int const maximum_iterations(100);
             double const tolerance(1e-14);
 
-            auto newton_solver = NumLib::NewtonRaphson<
+            MathLib::Nonlinear::NewtonOptions const newton_options{
+                maximum_iterations, tolerance};
+            auto newton_solver = MathLib::Nonlinear::ModifiedNewton<
                 decltype(linear_solver), JacobianMatrix,
                 decltype(update_jacobian), ResidualVectorType,
                 decltype(update_residual), decltype(update_solution)>(
                 linear_solver, update_jacobian, update_residual,
-                update_solution, maximum_iterations, tolerance);
+                update_solution, newton_options);
 
             auto const success_iterations = newton_solver.solve(jacobian);
 
@@ -657,6 +630,64 @@ bool SolidEhlers<DisplacementDim>::computeConstitutiveRelation(
     return true;
 }
 
+template <int DisplacementDim>
+bool SolidEhlers<DisplacementDim>::computeConstitutiveRelationBatch(
+    double const t,
+    ProcessLib::SpatialPosition const& x,
+    double const dt,
+    std::size_t const n,
+    KelvinVector const* const eps_prev,
+    KelvinVector const* const eps,
+    KelvinVector const* const sigma_prev,
+    KelvinVector* const sigma,
+    KelvinMatrix* const C,
+    typename MechanicsBase<DisplacementDim>::MaterialStateVariables* const*
+        const material_state_variables)
+{
+    using Invariants = MaterialLib::SolidModels::Invariants<KelvinVectorSize>;
+
+    double const G = _mp.G(t, x)[0];
+    double const K = _mp.K(t, x)[0];
+
+    // The elastic tangent is identical for all elastic points of the batch.
+    KelvinMatrix C_elastic = KelvinMatrix::Zero();
+    C_elastic.template topLeftCorner<3, 3>().setConstant(K - 2. / 3 * G);
+    C_elastic.noalias() += 2 * G * KelvinMatrix::Identity();
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        assert(dynamic_cast<MaterialStateVariables*>(
+                   material_state_variables[i]) != nullptr);
+        auto& state =
+            *static_cast<MaterialStateVariables*>(material_state_variables[i]);
+
+        // Elastic early-out with the cheap prediction before any
+        // return-mapping scaffolding is touched.
+        double const eps_V = Invariants::trace(eps[i]);
+        KelvinVector const sigma_predicted = predict_sigma<DisplacementDim>(
+            G, K, sigma_prev[i], eps[i], eps_prev[i], eps_V);
+
+        _mp.calculateIsotropicHardening(t, x, state.eps_p_eff);
+        PhysicalStressWithInvariants<DisplacementDim> const s{
+            G * sigma_predicted};
+        if (sigma_predicted.squaredNorm() == 0 ||
+            yieldFunction<DisplacementDim>(s, _mp, t, x) < 0)
+        {
+            state.setInitialConditions();
+            sigma[i].noalias() = G * sigma_predicted;
+            C[i] = C_elastic;
+            continue;
+        }
+
+        // Plastifying point: full return mapping.
+        if (!computeConstitutiveRelation(t, x, dt, eps_prev[i], eps[i],
+                                         sigma_prev[i], sigma[i], C[i],
+                                         *material_state_variables[i]))
+            return false;
+    }
+    return true;
+}
+
 }  // namespace Ehlers
 }  // namespace Solids
 }  // namespace MaterialLib
@@ -205,6 +205,32 @@ public:
         typename MechanicsBase<DisplacementDim>::MaterialStateVariables&
             material_state_variables) override;
 
+    /// Batched driver over a block of integration points sharing the spatial
+    /// position \c x (e.g. all points of one element).
+    ///
+    /// Points are first classified with the cheap stress prediction plus
+    /// yield check; elastic points get the elastic tangent, which is
+    /// computed once per batch, without entering the return-mapping
+    /// machinery. Only the plastifying points run their local Newton.
+    /// Vectorizing the Newton iterations across points was rejected:
+    /// iteration counts differ per point, so lock-stepped batches would run
+    /// every point to the slowest one's count.
+    ///
+    /// All array parameters hold \c n entries; returns false on the first
+    /// non-converged point.
+    bool computeConstitutiveRelationBatch(
+        double const t,
+        ProcessLib::SpatialPosition const& x,
+        double const dt,
+        std::size_t const n,
+        KelvinVector const* const eps_prev,
+        KelvinVector const* const eps,
+        KelvinVector const* const sigma_prev,
+        KelvinVector* const sigma,
+        KelvinMatrix* const C,
+        typename MechanicsBase<DisplacementDim>::MaterialStateVariables* const*
+            const material_state_variables);
+
 private:
     MaterialProperties _mp;
 };
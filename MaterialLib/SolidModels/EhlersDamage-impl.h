@@ -37,7 +37,7 @@
 #include <boost/math/special_functions/pow.hpp>
 #include <logog/include/logog.hpp>
 #include "MaterialLib/SolidModels/KelvinVector.h"
-#include "NumLib/NewtonRaphson.h"
+#include "MathLib/Nonlinear/ModifiedNewton.h"
 #include "PhysicalStressWithInvariants.h"
 
 // just adding a comment
@@ -176,43 +176,14 @@ void calculatePlasticResidual(
 }
 
 /// Special product of \p v with itself: \f$v \odot v\f$.
-/// v is given in \p Kelvin mapping.
+/// v is given in \p Kelvin mapping. Delegates to the size-specialized
+/// fixed-size kernels, which also handle the 2D (size 4) case correctly.
 template <int DisplacementDim>
 ProcessLib::KelvinMatrixType<DisplacementDim> s_odot_s(
     ProcessLib::KelvinVectorType<DisplacementDim> const& v)
 {
-    ProcessLib::KelvinMatrixType<DisplacementDim> result;
-
-    result(0, 0) = v(0) * v(0);
-    result(0, 1) = result(1, 0) = v(3) * v(3) / 2.;
-    result(0, 2) = result(2, 0) = v(5) * v(5) / 2.;
-    result(0, 3) = result(3, 0) = v(0) * v(3);
-    result(0, 4) = result(4, 0) = v(3) * v(5) / std::sqrt(2.);
-    result(0, 5) = result(5, 0) = v(0) * v(5);
-
-    result(1, 1) = v(1) * v(1);
-    result(1, 2) = result(2, 1) = v(4) * v(4) / 2.;
-    result(1, 3) = result(3, 1) = v(3) * v(1);
-    result(1, 4) = result(4, 1) = v(1) * v(4);
-    result(1, 5) = result(5, 1) = v(3) * v(4) / std::sqrt(2.);
-
-    result(2, 2) = v(2) * v(2);
-    result(2, 3) = result(3, 2) = v(5) * v(4) / std::sqrt(2.);
-    result(2, 4) = result(4, 2) = v(4) * v(2);
-    result(2, 5) = result(5, 2) = v(5) * v(2);
-
-    result(3, 3) = v(0) * v(1) + v(3) * v(3) / 2.;
-    result(3, 4) = result(4, 3) =
-        v(3) * v(4) / 2. + v(5) * v(1) / std::sqrt(2.);
-    result(3, 5) = result(5, 3) =
-        v(0) * v(4) / std::sqrt(2.) + v(3) * v(5) / 2.;
-
-    result(4, 4) = v(1) * v(2) + v(4) * v(4) / 2.;
-    result(4, 5) = result(5, 4) =
-        v(3) * v(2) / std::sqrt(2.) + v(5) * v(4) / 2.;
-
-    result(5, 5) = v(0) * v(2) + v(5) * v(5) / 2.;
-    return result;
+    return MaterialLib::SolidModels::sOdotS<
+        ProcessLib::KelvinVectorDimensions<DisplacementDim>::value>(v);
 }
 
 template <int DisplacementDim>
@@ -552,7 +523,7 @@ typename SolidEhlersDamage<DisplacementDim>::KelvinVector predict_sigma(
     double const pressure = pressure_prev - K / G * (eps_V - e_prev);
     // dimensionless deviatoric initial stress
     typename SolidEhlersDamage<DisplacementDim>::KelvinVector const
-        sigma_D_prev = P_dev * sigma_prev / G;
+        sigma_D_prev = Invariants::deviatoric(sigma_prev) / G;
     // dimensionless deviatoric stress
     typename SolidEhlersDamage<DisplacementDim>::KelvinVector const sigma_D =
         sigma_D_prev + 2 * P_dev * (eps - eps_prev);
@@ -659,12 +630,14 @@ bool SolidEhlersDamage<DisplacementDim>::computeConstitutiveRelation(
             int const maximum_iterations(100);
             double const tolerance(1e-14);
 
-            auto newton_solver = NumLib::NewtonRaphson<
+            MathLib::Nonlinear::NewtonOptions const newton_options{
+                maximum_iterations, tolerance};
+            auto newton_solver = MathLib::Nonlinear::ModifiedNewton<
                 decltype(linear_solver), JacobianMatrix,
                 decltype(update_jacobian), ResidualVectorType,
                 decltype(update_residual), decltype(update_solution)>(
                 linear_solver, update_jacobian, update_residual,
-                update_solution, maximum_iterations, tolerance);
+                update_solution, newton_options);
 
             auto const success_iterations = newton_solver.solve(jacobian);
 
@@ -57,5 +57,63 @@ Eigen::Matrix<double, 6, 1, Eigen::ColMajor, 6, 1> inverse(
     return inv / Invariants<6>::determinant(v);
 }
 
+template <>
+Eigen::Matrix<double, 4, 4> sOdotS<4>(Eigen::Matrix<double, 4, 1> const& v)
+{
+    Eigen::Matrix<double, 4, 4> result;
+
+    result(0, 0) = v(0) * v(0);
+    result(0, 1) = result(1, 0) = v(3) * v(3) / 2.;
+    result(0, 2) = result(2, 0) = 0;
+    result(0, 3) = result(3, 0) = v(0) * v(3);
+
+    result(1, 1) = v(1) * v(1);
+    result(1, 2) = result(2, 1) = 0;
+    result(1, 3) = result(3, 1) = v(3) * v(1);
+
+    result(2, 2) = v(2) * v(2);
+    result(2, 3) = result(3, 2) = 0;
+
+    result(3, 3) = v(0) * v(1) + v(3) * v(3) / 2.;
+    return result;
+}
+
+template <>
+Eigen::Matrix<double, 6, 6> sOdotS<6>(Eigen::Matrix<double, 6, 1> const& v)
+{
+    Eigen::Matrix<double, 6, 6> result;
+
+    result(0, 0) = v(0) * v(0);
+    result(0, 1) = result(1, 0) = v(3) * v(3) / 2.;
+    result(0, 2) = result(2, 0) = v(5) * v(5) / 2.;
+    result(0, 3) = result(3, 0) = v(0) * v(3);
+    result(0, 4) = result(4, 0) = v(3) * v(5) / std::sqrt(2.);
+    result(0, 5) = result(5, 0) = v(0) * v(5);
+
+    result(1, 1) = v(1) * v(1);
+    result(1, 2) = result(2, 1) = v(4) * v(4) / 2.;
+    result(1, 3) = result(3, 1) = v(3) * v(1);
+    result(1, 4) = result(4, 1) = v(1) * v(4);
+    result(1, 5) = result(5, 1) = v(3) * v(4) / std::sqrt(2.);
+
+    result(2, 2) = v(2) * v(2);
+    result(2, 3) = result(3, 2) = v(5) * v(4) / std::sqrt(2.);
+    result(2, 4) = result(4, 2) = v(4) * v(2);
+    result(2, 5) = result(5, 2) = v(5) * v(2);
+
+    result(3, 3) = v(0) * v(1) + v(3) * v(3) / 2.;
+    result(3, 4) = result(4, 3) =
+        v(3) * v(4) / 2. + v(5) * v(1) / std::sqrt(2.);
+    result(3, 5) = result(5, 3) =
+        v(0) * v(4) / std::sqrt(2.) + v(3) * v(5) / 2.;
+
+    result(4, 4) = v(1) * v(2) + v(4) * v(4) / 2.;
+    result(4, 5) = result(5, 4) =
+        v(3) * v(2) / std::sqrt(2.) + v(5) * v(4) / 2.;
+
+    result(5, 5) = v(0) * v(2) + v(5) * v(5) / 2.;
+    return result;
+}
+
 }  // namespace SolidModels
 }  // namespace MaterialLib
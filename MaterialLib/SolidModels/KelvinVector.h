@@ -58,6 +58,22 @@ struct Invariants final
 
     /// Trace of the corresponding tensor.
     static double trace(Eigen::Matrix<double, KelvinVectorSize, 1> const& v);
+
+    /// Deviatoric part of the tensor; algebraically equal to
+    /// \c deviatoric_projection * v but evaluated as three fused
+    /// multiply-subtracts on the normal components instead of a full
+    /// matrix-vector product---this is the inner-inner kernel of the
+    /// mechanics return mappings.
+    static Eigen::Matrix<double, KelvinVectorSize, 1> deviatoric(
+        Eigen::Matrix<double, KelvinVectorSize, 1> const& v)
+    {
+        auto const mean = (v[0] + v[1] + v[2]) / 3.0;
+        Eigen::Matrix<double, KelvinVectorSize, 1> d = v;
+        d[0] -= mean;
+        d[1] -= mean;
+        d[2] -= mean;
+        return d;
+    }
 };
 
 //
@@ -75,6 +91,15 @@ inverse(Eigen::Matrix<double,
                       KelvinVectorSize,
                       1> const& v);
 
+/// Special product of a Kelvin vector with itself: \f$v \odot v\f$.
+///
+/// Hand-written fixed-size kernels; there are only specializations for the
+/// Kelvin vector sizes 4 (2D) and 6 (3D), so both displacement dimensions
+/// run fully compile-time sized code with no dynamic fallback.
+template <int KelvinVectorSize>
+Eigen::Matrix<double, KelvinVectorSize, KelvinVectorSize> sOdotS(
+    Eigen::Matrix<double, KelvinVectorSize, 1> const& v);
+
 }  // namespace SolidModels
 }  // namespace MaterialLib
 
@@ -9,7 +9,7 @@
 
 #pragma once
 
-#include "NumLib/NewtonRaphson.h"
+#include "MathLib/Nonlinear/ModifiedNewton.h"
 
 namespace MaterialLib
 {
@@ -41,7 +41,7 @@ bool Lubby2<DisplacementDim>::computeConstitutiveRelation(
 
     // calculation of deviatoric parts
     auto const& P_dev = Invariants::deviatoric_projection;
-    KelvinVector const epsd_i = P_dev * eps;
+    KelvinVector const epsd_i = Invariants::deviatoric(eps);
 
     // initial guess as elastic predictor
     KelvinVector sigd_j = 2.0 * (epsd_i - state.eps_M_t - state.eps_K_t);
@@ -109,12 +109,14 @@ bool Lubby2<DisplacementDim>::computeConstitutiveRelation(
         const int maximum_iterations(20);
         const double tolerance(1.e-10);
 
-        auto newton_solver = NumLib::NewtonRaphson<
+        MathLib::Nonlinear::NewtonOptions const newton_options{
+            maximum_iterations, tolerance};
+        auto newton_solver = MathLib::Nonlinear::ModifiedNewton<
             decltype(linear_solver), LocalJacobianMatrix,
             decltype(update_jacobian), LocalResidualVector,
             decltype(update_residual), decltype(update_solution)>(
             linear_solver, update_jacobian, update_residual, update_solution,
-            maximum_iterations, tolerance);
+            newton_options);
 
         auto const success_iterations = newton_solver.solve(K_loc);
 
@@ -0,0 +1,87 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace MaterialLib
+{
+namespace Solids
+{
+
+/// Process-owned contiguous store for the per-integration-point material
+/// state of one concrete solid model (e.g. Ehlers or Lubby2
+/// MaterialStateVariables).
+///
+/// Instead of one heap allocation per integration point, all states of a
+/// process live in chunked contiguous arrays indexed by global integration
+/// point id, so the state update streams through memory, the
+/// end-of-timestep pushBackStateAll() is one linear sweep instead of a
+/// pointer-chasing pass over the assemblers, and checkpointing can copy the
+/// chunks wholesale.
+///
+/// The store hands out non-owning pointers; it must outlive the assemblers
+/// using them. Chunking keeps the pointers stable while the store grows
+/// during assembler creation.
+template <typename StateVariables>
+class MaterialStateStore final
+{
+public:
+    explicit MaterialStateStore(std::size_t const chunk_size = 4096)
+        : _chunk_size(chunk_size)
+    {
+    }
+
+    /// Creates the state for the next integration point; returns a stable,
+    /// non-owning pointer.
+    StateVariables* create()
+    {
+        if (_chunks.empty() || _chunks.back()->size() == _chunk_size)
+        {
+            _chunks.emplace_back(new std::vector<StateVariables>);
+            _chunks.back()->reserve(_chunk_size);
+        }
+        _chunks.back()->emplace_back();
+        ++_size;
+        return &_chunks.back()->back();
+    }
+
+    /// Number of stored states.
+    std::size_t size() const { return _size; }
+
+    /// Pushes back all states in one linear sweep, cf.
+    /// MaterialStateVariables::pushBackState().
+    void pushBackStateAll()
+    {
+        for (auto& chunk : _chunks)
+            for (auto& state : *chunk)
+                state.pushBackState();
+    }
+
+    /// Applies \c function to every state in storage order; usable, e.g.,
+    /// for serializing the state into a checkpoint.
+    template <typename Function>
+    void forEach(Function&& function)
+    {
+        for (auto& chunk : _chunks)
+            for (auto& state : *chunk)
+                function(state);
+    }
+
+private:
+    std::size_t const _chunk_size;
+    std::size_t _size = 0;
+    std::vector<std::unique_ptr<std::vector<StateVariables>>> _chunks;
+};
+
+}  // namespace Solids
+}  // namespace MaterialLib
@@ -15,7 +15,7 @@ struct PhysicalStressWithInvariants final
 
     explicit PhysicalStressWithInvariants(KelvinVector const& stress)
         : value{stress},
-          D{Invariants::deviatoric_projection * stress},
+          D{Invariants::deviatoric(stress)},
           I_1{Invariants::trace(stress)},
           J_2{Invariants::J2(D)},
           J_3{Invariants::J3(D)}
@@ -169,6 +169,70 @@ bool barycentricPointInTriangle(MathLib::Point3d const& p,
     return true;
 }
 
+void arePointsInTriangle(
+    std::vector<MathLib::Point3d const*> const& points,
+    MathLib::Point3d const& a, MathLib::Point3d const& b,
+    MathLib::Point3d const& c, std::vector<char>& results,
+    double eps_pnt_out_of_plane, double eps_pnt_out_of_tri)
+{
+    results.resize(points.size());
+
+    // Barycentric setup, computed once per triangle.
+    MathLib::Vector3 const v(a, b);
+    MathLib::Vector3 const w(a, c);
+    double const vv = MathLib::scalarProduct(v, v);
+    double const ww = MathLib::scalarProduct(w, w);
+    double const vw = MathLib::scalarProduct(v, w);
+    double const denominator = vv * ww - vw * vw;
+    if (denominator == 0.0) {
+        std::fill(results.begin(), results.end(), 0);
+        return;
+    }
+    double const inverse_denominator = 1.0 / denominator;
+
+    double const lower = eps_pnt_out_of_tri;
+    double const upper = 1 + lower;
+
+    for (std::size_t i = 0; i < points.size(); ++i)
+    {
+        auto const& q = *points[i];
+        MathLib::Vector3 const u(a, q);
+
+        // Barycentric coordinates via the precomputed Gram system; the
+        // bounds and the projected-distance test replicate
+        // gaussPointInTriangle() exactly.
+        double const uv = MathLib::scalarProduct(u, v);
+        double const uw = MathLib::scalarProduct(u, w);
+        double const s = (ww * uv - vw * uw) * inverse_denominator;
+        double const t = (vv * uw - vw * uv) * inverse_denominator;
+
+        results[i] = 0;
+        if (-lower <= s && s <= upper && -lower <= t && t <= upper &&
+            s + t <= upper)
+        {
+            MathLib::Point3d const q_projected(std::array<double, 3>{
+                {a[0] + s * v[0] + t * w[0], a[1] + s * v[1] + t * w[1],
+                 a[2] + s * v[2] + t * w[2]}});
+            if (MathLib::sqrDist(q, q_projected) <= eps_pnt_out_of_plane)
+                results[i] = 1;
+        }
+    }
+}
+
+void isPointInTetrahedra(
+    MathLib::Point3d const& p,
+    std::vector<std::array<MathLib::Point3d const*, 4>> const& tetrahedra,
+    std::vector<char>& results, double eps)
+{
+    results.resize(tetrahedra.size());
+    for (std::size_t i = 0; i < tetrahedra.size(); ++i)
+    {
+        auto const& t = tetrahedra[i];
+        results[i] =
+            isPointInTetrahedron(p, *t[0], *t[1], *t[2], *t[3], eps) ? 1 : 0;
+    }
+}
+
 bool isPointInTriangleXY(MathLib::Point3d const& p,
                          MathLib::Point3d const& a,
                          MathLib::Point3d const& b,
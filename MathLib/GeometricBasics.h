@@ -10,6 +10,9 @@
 
 #pragma once
 
+#include <array>
+#include <vector>
+
 #include <cstddef>
 #include <limits>
 
@@ -123,6 +126,33 @@ bool isPointInTriangle(
  * @return true if the test point p is within the 'epsilon'-neighbourhood of the
  * triangle
  */
+/**
+ * Batched variant of isPointInTriangle(): tests many points against one
+ * triangle. The barycentric setup (edge vectors, normal, inverse
+ * Gram determinant) is computed once and the per-point work reduces to two
+ * dot products and comparisons, laid out for vectorization.
+ * \param points the test points.
+ * \param results one flag per test point (non-zero: inside).
+ */
+void arePointsInTriangle(
+    std::vector<MathLib::Point3d const*> const& points,
+    MathLib::Point3d const& a,
+    MathLib::Point3d const& b,
+    MathLib::Point3d const& c,
+    std::vector<char>& results,
+    double eps_pnt_out_of_plane = std::numeric_limits<float>::epsilon(),
+    double eps_pnt_out_of_tri = std::numeric_limits<float>::epsilon());
+
+/**
+ * Batched variant of isPointInTetrahedron(): tests one point against many
+ * tetrahedra given as four-point tuples; one flag per tetrahedron.
+ */
+void isPointInTetrahedra(
+    MathLib::Point3d const& p,
+    std::vector<std::array<MathLib::Point3d const*, 4>> const& tetrahedra,
+    std::vector<char>& results,
+    double eps = std::numeric_limits<double>::epsilon());
+
 bool gaussPointInTriangle(
     MathLib::Point3d const& p, MathLib::Point3d const& a,
     MathLib::Point3d const& b, MathLib::Point3d const& c,
@@ -30,4 +30,59 @@ template <> double const GaussLegendre<4>::X[4] =
 template <> double const GaussLegendre<4>::W[4] =
         { 0.347854845137454,  0.652145154862546, 0.652145154862546, 0.347854845137454};
 
+template <> double const GaussLegendre<5>::X[5] = {
+    -0.906179845938664, -0.538469310105683, 0.,
+     0.538469310105683,  0.906179845938664};
+template <> double const GaussLegendre<5>::W[5] = {
+     0.236926885056189,  0.478628670499366, 0.568888888888889,
+     0.478628670499366,  0.236926885056189};
+
+template <> double const GaussLegendre<6>::X[6] = {
+    -0.932469514203152, -0.661209386466265, -0.238619186083197,
+     0.238619186083197,  0.661209386466265,  0.932469514203152};
+template <> double const GaussLegendre<6>::W[6] = {
+     0.171324492379170,  0.360761573048139,  0.467913934572691,
+     0.467913934572691,  0.360761573048139,  0.171324492379170};
+
+template <> double const GaussLegendre<7>::X[7] = {
+    -0.949107912342759, -0.741531185599394, -0.405845151377397, 0.,
+     0.405845151377397,  0.741531185599394,  0.949107912342759};
+template <> double const GaussLegendre<7>::W[7] = {
+     0.129484966168870,  0.279705391489277,  0.381830050505119,
+     0.417959183673469,
+     0.381830050505119,  0.279705391489277,  0.129484966168870};
+
+template <> double const GaussLegendre<8>::X[8] = {
+    -0.960289856497536, -0.796666477413627, -0.525532409916329,
+    -0.183434642495650,
+     0.183434642495650,  0.525532409916329,  0.796666477413627,
+     0.960289856497536};
+template <> double const GaussLegendre<8>::W[8] = {
+     0.101228536290376,  0.222381034453374,  0.313706645877887,
+     0.362683783378362,
+     0.362683783378362,  0.313706645877887,  0.222381034453374,
+     0.101228536290376};
+
+template <> double const GaussLegendre<9>::X[9] = {
+    -0.968160239507626, -0.836031107326636, -0.613371432700590,
+    -0.324253423403809,  0.,
+     0.324253423403809,  0.613371432700590,  0.836031107326636,
+     0.968160239507626};
+template <> double const GaussLegendre<9>::W[9] = {
+     0.081274388361574,  0.180648160694857,  0.260610696402935,
+     0.312347077040003,  0.330239355001260,
+     0.312347077040003,  0.260610696402935,  0.180648160694857,
+     0.081274388361574};
+
+template <> double const GaussLegendre<10>::X[10] = {
+    -0.973906528517172, -0.865063366688985, -0.679409568299024,
+    -0.433395394129247, -0.148874338981631,
+     0.148874338981631,  0.433395394129247,  0.679409568299024,
+     0.865063366688985,  0.973906528517172};
+template <> double const GaussLegendre<10>::W[10] = {
+     0.066671344308688,  0.149451349150581,  0.219086362515982,
+     0.269266719309996,  0.295524224714753,
+     0.295524224714753,  0.269266719309996,  0.219086362515982,
+     0.149451349150581,  0.066671344308688};
+
 }   // namespace MathLib
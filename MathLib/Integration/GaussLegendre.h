@@ -45,6 +45,30 @@ template <>
 double const GaussLegendre<4>::X[4];
 template <>
 double const GaussLegendre<4>::W[4];
+template <>
+double const GaussLegendre<5>::X[5];
+template <>
+double const GaussLegendre<5>::W[5];
+template <>
+double const GaussLegendre<6>::X[6];
+template <>
+double const GaussLegendre<6>::W[6];
+template <>
+double const GaussLegendre<7>::X[7];
+template <>
+double const GaussLegendre<7>::W[7];
+template <>
+double const GaussLegendre<8>::X[8];
+template <>
+double const GaussLegendre<8>::W[8];
+template <>
+double const GaussLegendre<9>::X[9];
+template <>
+double const GaussLegendre<9>::W[9];
+template <>
+double const GaussLegendre<10>::X[10];
+template <>
+double const GaussLegendre<10>::W[10];
 #endif
 
 }  // namespace MathLib
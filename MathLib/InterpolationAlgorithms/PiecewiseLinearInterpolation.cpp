@@ -77,6 +77,66 @@ double PiecewiseLinearInterpolation::getValue(double pnt_to_interpolate) const
     return m * (pnt_to_interpolate - x) + f;
 }
 
+std::pair<double, double> PiecewiseLinearInterpolation::getSegmentCoefficients(
+    double pnt_to_interpolate) const
+{
+    // Constant extension outside the support, cf. getValue().
+    if (pnt_to_interpolate <= _supp_pnts.front())
+        return {0.0, _values_at_supp_pnts.front()};
+    if (_supp_pnts.back() <= pnt_to_interpolate)
+        return {0.0, _values_at_supp_pnts.back()};
+
+    auto const& it(std::lower_bound(_supp_pnts.begin(), _supp_pnts.end(),
+                                    pnt_to_interpolate));
+    std::size_t const interval_idx = std::distance(_supp_pnts.begin(), it) - 1;
+
+    double const x = _supp_pnts[interval_idx];
+    double const x_r = _supp_pnts[interval_idx + 1];
+    double const f = _values_at_supp_pnts[interval_idx];
+    double const f_r = _values_at_supp_pnts[interval_idx + 1];
+
+    double const m = (f_r - f) / (x_r - x);
+    return {m, f - m * x};
+}
+
+void PiecewiseLinearInterpolation::getValues(double const* points,
+                                             std::size_t n,
+                                             double* values) const
+{
+    std::size_t interval_idx = 0;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        double const pnt = points[i];
+        if (pnt <= _supp_pnts.front())
+        {
+            values[i] = _values_at_supp_pnts.front();
+            continue;
+        }
+        if (_supp_pnts.back() <= pnt)
+        {
+            values[i] = _values_at_supp_pnts.back();
+            continue;
+        }
+
+        if (!(_supp_pnts[interval_idx] < pnt &&
+              pnt <= _supp_pnts[interval_idx + 1]))
+        {
+            // Not in the previous point's segment; fall back to the search.
+            interval_idx = std::distance(
+                               _supp_pnts.begin(),
+                               std::lower_bound(_supp_pnts.begin(),
+                                                _supp_pnts.end(), pnt)) -
+                           1;
+        }
+
+        double const x = _supp_pnts[interval_idx];
+        double const m = (_values_at_supp_pnts[interval_idx + 1] -
+                          _values_at_supp_pnts[interval_idx]) /
+                         (_supp_pnts[interval_idx + 1] - x);
+        values[i] = m * (pnt - x) + _values_at_supp_pnts[interval_idx];
+    }
+}
+
 double PiecewiseLinearInterpolation::getDerivative(
     double const pnt_to_interpolate) const
 {
@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <cstddef>
+#include <utility>
 #include <vector>
 
 namespace MathLib
@@ -72,6 +74,27 @@ public:
      * using linear interpolation.
      */
     double getDerivative(double const pnt_to_interpolate) const;
+
+    /**
+     * \brief Resolves the point into a precompiled segment evaluation: the
+     * returned pair holds the slope \f$m\f$ and offset \f$b\f$ of the
+     * containing segment, so the value at the point (and at any other point
+     * in the same segment) is the fused multiply-add \f$m x + b\f$ without
+     * repeating the binary search. Callers evaluating the same coordinate
+     * many times per time step---e.g. the time scaling of
+     * CurveScaledParameter over all integration points---resolve once per
+     * step and reuse the coefficients.
+     */
+    std::pair<double, double> getSegmentCoefficients(
+        double pnt_to_interpolate) const;
+
+    /**
+     * \brief Batched interpolation over an array of points; walks the
+     * segment of the previous point first, so (nearly) sorted inputs cost
+     * one comparison per point instead of one binary search.
+     */
+    void getValues(double const* points, std::size_t n, double* values) const;
+
     double getSupportMax() const;
     double getSupportMin() const;
 
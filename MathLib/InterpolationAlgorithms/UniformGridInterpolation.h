@@ -0,0 +1,108 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include "PiecewiseLinearInterpolation.h"
+
+namespace MathLib
+{
+
+/// Uniform-grid resampling of a piecewise linear curve.
+///
+/// The supporting points of the source curve are resampled onto an
+/// equidistant grid once at construction; getValue() and getDerivative()
+/// then locate the interval by one multiply instead of a binary search, and
+/// both are served from the same lookup. Outside of the resampled range the
+/// boundary values/slopes are extrapolated constantly, matching the
+/// piecewise linear behavior.
+///
+/// Monotone cubic resampling was considered and dropped: the source curves
+/// are piecewise linear to begin with, so a cubic through the resampled
+/// values adds smoothness the data does not have.
+class UniformGridInterpolation final
+{
+public:
+    /// Resamples the given curve with the given number of intervals over its
+    /// supporting-point range.
+    UniformGridInterpolation(PiecewiseLinearInterpolation const& curve,
+                             double const x_min, double const x_max,
+                             std::size_t const n_intervals = 1024)
+        : _x_min(x_min),
+          _inverse_dx(n_intervals / (x_max - x_min)),
+          _values(n_intervals + 1)
+    {
+        for (std::size_t i = 0; i <= n_intervals; ++i)
+        {
+            double const x =
+                x_min + static_cast<double>(i) / n_intervals * (x_max - x_min);
+            _values[i] = curve.getValue(x);
+        }
+    }
+
+    double getValue(double const x) const
+    {
+        double const s = (x - _x_min) * _inverse_dx;
+        if (s <= 0.0)
+            return _values.front();
+        if (s >= static_cast<double>(_values.size() - 1))
+            return _values.back();
+
+        auto const i = static_cast<std::size_t>(s);
+        double const u = s - static_cast<double>(i);
+        return (1.0 - u) * _values[i] + u * _values[i + 1];
+    }
+
+    /// Derivative of the resampled curve; constant per grid interval, zero
+    /// outside the range.
+    double getDerivative(double const x) const
+    {
+        double const s = (x - _x_min) * _inverse_dx;
+        if (s <= 0.0 || s >= static_cast<double>(_values.size() - 1))
+            return 0.0;
+
+        auto const i = static_cast<std::size_t>(s);
+        return (_values[i + 1] - _values[i]) * _inverse_dx;
+    }
+
+    /// Value and derivative from one interval lookup.
+    void getValueAndDerivative(double const x, double& value,
+                               double& derivative) const
+    {
+        double const s = (x - _x_min) * _inverse_dx;
+        if (s <= 0.0)
+        {
+            value = _values.front();
+            derivative = 0.0;
+            return;
+        }
+        if (s >= static_cast<double>(_values.size() - 1))
+        {
+            value = _values.back();
+            derivative = 0.0;
+            return;
+        }
+
+        auto const i = static_cast<std::size_t>(s);
+        double const u = s - static_cast<double>(i);
+        value = (1.0 - u) * _values[i] + u * _values[i + 1];
+        derivative = (_values[i + 1] - _values[i]) * _inverse_dx;
+    }
+
+private:
+    double const _x_min;
+    double const _inverse_dx;
+    std::vector<double> _values;
+};
+
+}  // namespace MathLib
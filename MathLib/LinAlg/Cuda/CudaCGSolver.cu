@@ -0,0 +1,224 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "CudaCGSolver.h"
+
+#include <cuda_runtime.h>
+
+#include <cmath>
+#include <vector>
+
+namespace MathLib
+{
+namespace Cuda
+{
+
+namespace
+{
+
+int const threads_per_block = 256;
+
+__global__ void spmvCSR(int const n, int const* __restrict__ row_offsets,
+                        int const* __restrict__ col_indices,
+                        double const* __restrict__ values,
+                        double const* __restrict__ x, double* __restrict__ y)
+{
+    int const row = blockIdx.x * blockDim.x + threadIdx.x;
+    if (row >= n)
+        return;
+
+    double acc = 0.0;
+    for (int k = row_offsets[row]; k < row_offsets[row + 1]; ++k)
+        acc += values[k] * x[col_indices[k]];
+    y[row] = acc;
+}
+
+__global__ void extractInvDiag(int const n, int const* __restrict__ row_offsets,
+                               int const* __restrict__ col_indices,
+                               double const* __restrict__ values,
+                               double* __restrict__ inv_diag)
+{
+    int const row = blockIdx.x * blockDim.x + threadIdx.x;
+    if (row >= n)
+        return;
+
+    double d = 0.0;
+    for (int k = row_offsets[row]; k < row_offsets[row + 1]; ++k)
+        if (col_indices[k] == row)
+            d = values[k];
+    inv_diag[row] = (d != 0.0) ? 1.0 / d : 0.0;
+}
+
+// y += a * x
+__global__ void axpy(int const n, double const a, double const* __restrict__ x,
+                     double* __restrict__ y)
+{
+    int const i = blockIdx.x * blockDim.x + threadIdx.x;
+    if (i < n)
+        y[i] += a * x[i];
+}
+
+// p = z + beta * p
+__global__ void zpbp(int const n, double const* __restrict__ z,
+                     double const beta, double* __restrict__ p)
+{
+    int const i = blockIdx.x * blockDim.x + threadIdx.x;
+    if (i < n)
+        p[i] = z[i] + beta * p[i];
+}
+
+// z = d .* r
+__global__ void pointwiseMult(int const n, double const* __restrict__ d,
+                              double const* __restrict__ r,
+                              double* __restrict__ z)
+{
+    int const i = blockIdx.x * blockDim.x + threadIdx.x;
+    if (i < n)
+        z[i] = d[i] * r[i];
+}
+
+__global__ void dotKernel(int const n, double const* __restrict__ x,
+                          double const* __restrict__ y,
+                          double* __restrict__ result)
+{
+    __shared__ double cache[threads_per_block];
+    int const i = blockIdx.x * blockDim.x + threadIdx.x;
+
+    cache[threadIdx.x] = (i < n) ? x[i] * y[i] : 0.0;
+    __syncthreads();
+
+    for (int stride = blockDim.x / 2; stride > 0; stride /= 2) {
+        if (threadIdx.x < stride)
+            cache[threadIdx.x] += cache[threadIdx.x + stride];
+        __syncthreads();
+    }
+
+    if (threadIdx.x == 0)
+        atomicAdd(result, cache[0]);
+}
+
+struct DeviceBuffer
+{
+    explicit DeviceBuffer(std::size_t const bytes)
+    {
+        cudaMalloc(&ptr, bytes);
+    }
+    ~DeviceBuffer() { cudaFree(ptr); }
+    void* ptr = nullptr;
+};
+
+double deviceDot(int const n, int const blocks, double const* x,
+                 double const* y, double* scratch)
+{
+    cudaMemset(scratch, 0, sizeof(double));
+    dotKernel<<<blocks, threads_per_block>>>(n, x, y, scratch);
+    double result = 0.0;
+    cudaMemcpy(&result, scratch, sizeof(double), cudaMemcpyDeviceToHost);
+    return result;
+}
+
+}  // anonymous namespace
+
+CudaCGReport solveCG(std::size_t const n_, std::size_t const nnz_,
+                     int const* row_offsets, int const* col_indices,
+                     double const* values, double const* b, double* x,
+                     double const error_tolerance, int const max_iterations)
+{
+    CudaCGReport report;
+    int const n = static_cast<int>(n_);
+    int const nnz = static_cast<int>(nnz_);
+    int const blocks = (n + threads_per_block - 1) / threads_per_block;
+
+    // Mirror the CSR matrix and the vectors on the device.
+    DeviceBuffer d_row((n + 1) * sizeof(int));
+    DeviceBuffer d_col(nnz * sizeof(int));
+    DeviceBuffer d_val(nnz * sizeof(double));
+    DeviceBuffer d_b(n * sizeof(double));
+    DeviceBuffer d_x(n * sizeof(double));
+    DeviceBuffer d_r(n * sizeof(double));
+    DeviceBuffer d_z(n * sizeof(double));
+    DeviceBuffer d_p(n * sizeof(double));
+    DeviceBuffer d_Ap(n * sizeof(double));
+    DeviceBuffer d_inv_diag(n * sizeof(double));
+    DeviceBuffer d_scratch(sizeof(double));
+
+    cudaMemcpy(d_row.ptr, row_offsets, (n + 1) * sizeof(int),
+               cudaMemcpyHostToDevice);
+    cudaMemcpy(d_col.ptr, col_indices, nnz * sizeof(int),
+               cudaMemcpyHostToDevice);
+    cudaMemcpy(d_val.ptr, values, nnz * sizeof(double),
+               cudaMemcpyHostToDevice);
+    cudaMemcpy(d_b.ptr, b, n * sizeof(double), cudaMemcpyHostToDevice);
+    cudaMemcpy(d_x.ptr, x, n * sizeof(double), cudaMemcpyHostToDevice);
+
+    auto* const row_d = static_cast<int*>(d_row.ptr);
+    auto* const col_d = static_cast<int*>(d_col.ptr);
+    auto* const val_d = static_cast<double*>(d_val.ptr);
+    auto* const b_d = static_cast<double*>(d_b.ptr);
+    auto* const x_d = static_cast<double*>(d_x.ptr);
+    auto* const r_d = static_cast<double*>(d_r.ptr);
+    auto* const z_d = static_cast<double*>(d_z.ptr);
+    auto* const p_d = static_cast<double*>(d_p.ptr);
+    auto* const Ap_d = static_cast<double*>(d_Ap.ptr);
+    auto* const inv_diag_d = static_cast<double*>(d_inv_diag.ptr);
+    auto* const scratch_d = static_cast<double*>(d_scratch.ptr);
+
+    extractInvDiag<<<blocks, threads_per_block>>>(n, row_d, col_d, val_d,
+                                                  inv_diag_d);
+
+    double const b_norm =
+        std::sqrt(deviceDot(n, blocks, b_d, b_d, scratch_d));
+    if (b_norm == 0.0) {
+        cudaMemset(x_d, 0, n * sizeof(double));
+        cudaMemcpy(x, x_d, n * sizeof(double), cudaMemcpyDeviceToHost);
+        report.converged = true;
+        return report;
+    }
+
+    // r = b - A x; z = D^-1 r; p = z.
+    spmvCSR<<<blocks, threads_per_block>>>(n, row_d, col_d, val_d, x_d, r_d);
+    zpbp<<<blocks, threads_per_block>>>(n, b_d, -1.0, r_d);  // r = b - r
+    pointwiseMult<<<blocks, threads_per_block>>>(n, inv_diag_d, r_d, z_d);
+    cudaMemcpy(p_d, z_d, n * sizeof(double), cudaMemcpyDeviceToDevice);
+
+    double rz = deviceDot(n, blocks, r_d, z_d, scratch_d);
+
+    for (int it = 0; it < max_iterations; ++it) {
+        double const r_norm =
+            std::sqrt(deviceDot(n, blocks, r_d, r_d, scratch_d));
+        report.residual = r_norm / b_norm;
+        if (report.residual <= error_tolerance) {
+            report.converged = true;
+            report.iterations = it;
+            break;
+        }
+
+        spmvCSR<<<blocks, threads_per_block>>>(n, row_d, col_d, val_d, p_d,
+                                               Ap_d);
+        double const pAp = deviceDot(n, blocks, p_d, Ap_d, scratch_d);
+        double const alpha = rz / pAp;
+
+        axpy<<<blocks, threads_per_block>>>(n, alpha, p_d, x_d);
+        axpy<<<blocks, threads_per_block>>>(n, -alpha, Ap_d, r_d);
+
+        pointwiseMult<<<blocks, threads_per_block>>>(n, inv_diag_d, r_d, z_d);
+        double const rz_new = deviceDot(n, blocks, r_d, z_d, scratch_d);
+        zpbp<<<blocks, threads_per_block>>>(n, z_d, rz_new / rz, p_d);
+        rz = rz_new;
+
+        report.iterations = it + 1;
+    }
+
+    // Only the solution goes back to the host.
+    cudaMemcpy(x, x_d, n * sizeof(double), cudaMemcpyDeviceToHost);
+    return report;
+}
+
+}  // namespace Cuda
+}  // namespace MathLib
@@ -0,0 +1,49 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+
+namespace MathLib
+{
+namespace Cuda
+{
+
+/// Result of a device CG solve.
+struct CudaCGReport
+{
+    bool converged = false;
+    int iterations = 0;
+    double residual = 0.0;
+};
+
+/// Solves \f$ A x = b \f$ with Jacobi-preconditioned conjugate gradients on
+/// the GPU.
+///
+/// The CSR arrays are mirrored on the device once per call; only the solution
+/// vector is transferred back. Assembly stays on the host, cf. the PardisoLU
+/// integration in EigenLinearSolver for the analogous CPU offload pattern.
+///
+/// \param n           matrix dimension.
+/// \param nnz         number of nonzeros.
+/// \param row_offsets CSR row offsets (n+1 entries).
+/// \param col_indices CSR column indices (nnz entries).
+/// \param values      CSR values (nnz entries).
+/// \param b           right-hand side (n entries).
+/// \param x           solution; the initial content is the initial guess.
+/// \param error_tolerance relative residual reduction to reach.
+/// \param max_iterations  iteration limit.
+CudaCGReport solveCG(std::size_t const n, std::size_t const nnz,
+                     int const* row_offsets, int const* col_indices,
+                     double const* values, double const* b, double* x,
+                     double const error_tolerance, int const max_iterations);
+
+}  // namespace Cuda
+}  // namespace MathLib
@@ -0,0 +1,240 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <vector>
+
+#include <Eigen/Dense>
+#include <Eigen/Sparse>
+
+#include "BaseLib/Error.h"
+
+namespace MathLib
+{
+
+/// Block-CSR storage of a sparse matrix with a fixed block size, e.g., the
+/// number of components per node of a multi-component process.
+///
+/// Compared to scalar CSR the index arrays are a factor BlockSize^2 smaller,
+/// so SpMV spends the memory bandwidth on values instead of index traffic,
+/// and the per-block inner kernels run on fixed-size Eigen types.
+///
+/// The block layout requires the scalar matrix to be ordered such that the
+/// BlockSize components of one node occupy consecutive rows/columns (i.e.,
+/// location-major DOF ordering) and that the scalar dimension is divisible by
+/// BlockSize.
+template <int BlockSize>
+class EigenBlockCSRMatrix final
+{
+public:
+    using Block = Eigen::Matrix<double, BlockSize, BlockSize, Eigen::RowMajor>;
+    using ScalarMatrix = Eigen::SparseMatrix<double, Eigen::RowMajor>;
+    using IndexType = ScalarMatrix::Index;
+
+    /// Converts a compressed scalar CSR matrix into block-CSR form. A block
+    /// is stored if any of its scalar entries is structurally nonzero.
+    explicit EigenBlockCSRMatrix(ScalarMatrix const& A)
+    {
+        if (A.rows() != A.cols() || A.rows() % BlockSize != 0)
+            OGS_FATAL(
+                "The scalar matrix dimension is not divisible by the block "
+                "size %d.", BlockSize);
+        if (!A.isCompressed())
+            OGS_FATAL("The scalar matrix must be compressed.");
+
+        _n_block_rows = A.rows() / BlockSize;
+        _row_offsets.assign(_n_block_rows + 1, 0);
+
+        // Pass 1: column indices of the nonzero blocks per block row.
+        std::vector<IndexType> block_cols_of_row;
+        for (IndexType bi = 0; bi < _n_block_rows; ++bi) {
+            block_cols_of_row.clear();
+            for (int r = 0; r < BlockSize; ++r) {
+                for (ScalarMatrix::InnerIterator it(A, bi * BlockSize + r); it;
+                     ++it) {
+                    block_cols_of_row.push_back(it.col() / BlockSize);
+                }
+            }
+            std::sort(block_cols_of_row.begin(), block_cols_of_row.end());
+            block_cols_of_row.erase(std::unique(block_cols_of_row.begin(),
+                                                block_cols_of_row.end()),
+                                    block_cols_of_row.end());
+
+            _row_offsets[bi + 1] =
+                _row_offsets[bi] +
+                static_cast<IndexType>(block_cols_of_row.size());
+            _col_indices.insert(_col_indices.end(), block_cols_of_row.begin(),
+                                block_cols_of_row.end());
+        }
+
+        // Pass 2: fill the block values.
+        _blocks.assign(_col_indices.size(), Block::Zero());
+        for (IndexType bi = 0; bi < _n_block_rows; ++bi) {
+            for (int r = 0; r < BlockSize; ++r) {
+                for (ScalarMatrix::InnerIterator it(A, bi * BlockSize + r); it;
+                     ++it) {
+                    auto const bj = it.col() / BlockSize;
+                    auto const pos = findBlock(bi, bj);
+                    _blocks[pos](r, it.col() % BlockSize) = it.value();
+                }
+            }
+        }
+    }
+
+    IndexType getNumberOfBlockRows() const { return _n_block_rows; }
+    IndexType getNumberOfBlocks() const
+    {
+        return static_cast<IndexType>(_blocks.size());
+    }
+
+    /// Computes \f$ y = A x \f$ blockwise.
+    void multiply(Eigen::VectorXd const& x, Eigen::VectorXd& y) const
+    {
+        assert(x.size() == _n_block_rows * BlockSize);
+        y.resize(x.size());
+
+        for (IndexType bi = 0; bi < _n_block_rows; ++bi) {
+            Eigen::Matrix<double, BlockSize, 1> acc =
+                Eigen::Matrix<double, BlockSize, 1>::Zero();
+            for (IndexType k = _row_offsets[bi]; k < _row_offsets[bi + 1];
+                 ++k) {
+                acc.noalias() +=
+                    _blocks[k] *
+                    x.segment<BlockSize>(_col_indices[k] * BlockSize);
+            }
+            y.segment<BlockSize>(bi * BlockSize) = acc;
+        }
+    }
+
+private:
+    IndexType findBlock(IndexType const bi, IndexType const bj) const
+    {
+        auto const first = _col_indices.begin() + _row_offsets[bi];
+        auto const last = _col_indices.begin() + _row_offsets[bi + 1];
+        auto const it = std::lower_bound(first, last, bj);
+        assert(it != last && *it == bj);
+        return static_cast<IndexType>(it - _col_indices.begin());
+    }
+
+    template <int B> friend class EigenBlockILU0;
+
+    IndexType _n_block_rows = 0;
+    std::vector<IndexType> _row_offsets;
+    std::vector<IndexType> _col_indices;
+    std::vector<Block, Eigen::aligned_allocator<Block>> _blocks;
+};
+
+/// Block ILU(0) factorization of an EigenBlockCSRMatrix with forward/backward
+/// block-triangular solves, usable as a preconditioner for block systems.
+///
+/// The factorization keeps the block sparsity pattern of the matrix (no
+/// fill-in); diagonal blocks are inverted once during setup.
+template <int BlockSize>
+class EigenBlockILU0 final
+{
+public:
+    using BlockMatrix = EigenBlockCSRMatrix<BlockSize>;
+    using Block = typename BlockMatrix::Block;
+    using IndexType = typename BlockMatrix::IndexType;
+
+    explicit EigenBlockILU0(BlockMatrix const& A)
+        : _factors(A), _inv_diag(A.getNumberOfBlockRows())
+    {
+        auto const n = _factors._n_block_rows;
+        auto const& offsets = _factors._row_offsets;
+        auto const& cols = _factors._col_indices;
+        auto& blocks = _factors._blocks;
+
+        for (IndexType i = 0; i < n; ++i) {
+            // Eliminate blocks left of the diagonal, in column order (the
+            // column indices are sorted).
+            for (IndexType k_pos = offsets[i]; k_pos < offsets[i + 1];
+                 ++k_pos) {
+                auto const k = cols[k_pos];
+                if (k >= i)
+                    break;
+
+                // L_ik = A_ik * inv(U_kk)
+                blocks[k_pos] = blocks[k_pos] * _inv_diag[k];
+
+                // A_ij -= L_ik * U_kj for all j > k in row i's pattern.
+                for (IndexType j_pos = k_pos + 1; j_pos < offsets[i + 1];
+                     ++j_pos) {
+                    auto const j = cols[j_pos];
+                    auto const kj_pos = findBlockOrNpos(k, j);
+                    if (kj_pos >= 0)
+                        blocks[j_pos].noalias() -=
+                            blocks[k_pos] * blocks[kj_pos];
+                }
+            }
+
+            auto const ii_pos = findBlockOrNpos(i, i);
+            if (ii_pos < 0)
+                OGS_FATAL("Structurally zero diagonal block in block ILU(0).");
+            _inv_diag[i] = blocks[ii_pos].inverse();
+        }
+    }
+
+    /// Solves \f$ L U x = b \f$ with the computed incomplete factors.
+    void solve(Eigen::VectorXd const& b, Eigen::VectorXd& x) const
+    {
+        auto const n = _factors._n_block_rows;
+        auto const& offsets = _factors._row_offsets;
+        auto const& cols = _factors._col_indices;
+        auto const& blocks = _factors._blocks;
+
+        x.resize(b.size());
+
+        // Forward substitution: L y = b (unit block diagonal).
+        for (IndexType i = 0; i < n; ++i) {
+            Eigen::Matrix<double, BlockSize, 1> acc =
+                b.segment<BlockSize>(i * BlockSize);
+            for (IndexType k = offsets[i]; k < offsets[i + 1]; ++k) {
+                if (cols[k] >= i)
+                    break;
+                acc.noalias() -=
+                    blocks[k] * x.segment<BlockSize>(cols[k] * BlockSize);
+            }
+            x.segment<BlockSize>(i * BlockSize) = acc;
+        }
+
+        // Backward substitution: U x = y.
+        for (IndexType i = n - 1; i >= 0; --i) {
+            Eigen::Matrix<double, BlockSize, 1> acc =
+                x.segment<BlockSize>(i * BlockSize);
+            for (IndexType k = offsets[i + 1] - 1; k >= offsets[i]; --k) {
+                if (cols[k] <= i)
+                    break;
+                acc.noalias() -=
+                    blocks[k] * x.segment<BlockSize>(cols[k] * BlockSize);
+            }
+            x.segment<BlockSize>(i * BlockSize) = _inv_diag[i] * acc;
+        }
+    }
+
+private:
+    IndexType findBlockOrNpos(IndexType const bi, IndexType const bj) const
+    {
+        auto const& cols = _factors._col_indices;
+        auto const first = cols.begin() + _factors._row_offsets[bi];
+        auto const last = cols.begin() + _factors._row_offsets[bi + 1];
+        auto const it = std::lower_bound(first, last, bj);
+        if (it == last || *it != bj)
+            return -1;
+        return static_cast<IndexType>(it - cols.begin());
+    }
+
+    BlockMatrix _factors;
+    std::vector<Block, Eigen::aligned_allocator<Block>> _inv_diag;
+};
+
+}  // namespace MathLib
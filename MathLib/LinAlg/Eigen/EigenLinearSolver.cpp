@@ -11,10 +11,18 @@
 
 #include <logog/include/logog.hpp>
 
+#ifdef OGS_USE_OPENMP
+#include <omp.h>
+#endif
+
 #ifdef USE_MKL
 #include <Eigen/PardisoSupport>
 #endif
 
+#ifdef USE_CUDA
+#include "MathLib/LinAlg/Cuda/CudaCGSolver.h"
+#endif
+
 #ifdef USE_EIGEN_UNSUPPORTED
 #include <Eigen/Sparse>
 #include <unsupported/Eigen/src/IterativeSolvers/GMRES.h>
@@ -24,6 +32,8 @@
 #include "BaseLib/ConfigTree.h"
 #include "EigenVector.h"
 #include "EigenMatrix.h"
+#include "EigenSmoothedAggregationPrecon.h"
+#include "EigenStaggeredBlockSolver.h"
 #include "EigenTools.h"
 
 #include "MathLib/LinAlg/LinearSolverOptions.h"
@@ -58,11 +68,28 @@ public:
              EigenOption::getSolverName(opt.solver_type).c_str());
         if (!A.isCompressed()) A.makeCompressed();
 
-        _solver.compute(A);
-        if(_solver.info()!=Eigen::Success) {
-            ERR("Failed during Eigen linear solver initialization");
-            return false;
+        if (_solves_since_compute > opt.precon_reuse_steps ||
+            _solves_since_compute == 0)
+        {
+            // The symbolic analysis depends only on the sparsity structure,
+            // which the frozen-structure assembly keeps stable across
+            // Newton iterations and time steps; only the numeric
+            // refactorization runs then. A changed nonzero count redoes
+            // the analysis.
+            if (_analyzed_nonzeros !=
+                static_cast<std::ptrdiff_t>(A.nonZeros()))
+            {
+                _solver.analyzePattern(A);
+                _analyzed_nonzeros = A.nonZeros();
+            }
+            _solver.factorize(A);
+            _solves_since_compute = 0;
+            if(_solver.info()!=Eigen::Success) {
+                ERR("Failed during Eigen linear solver initialization");
+                return false;
+            }
         }
+        ++_solves_since_compute;
 
         x = _solver.solve(b);
         if(_solver.info()!=Eigen::Success) {
@@ -75,6 +102,14 @@ public:
 
 private:
     T_SOLVER _solver;
+
+    //! Number of solve() calls since the last factorization; zero means no
+    //! factorization has happened yet.
+    int _solves_since_compute = 0;
+
+    //! Nonzero count the symbolic analysis was run for; -1 before the
+    //! first factorization.
+    std::ptrdiff_t _analyzed_nonzeros = -1;
 };
 
 /// Template class for Eigen iterative linear solvers
@@ -93,16 +128,35 @@ public:
         if (!A.isCompressed())
             A.makeCompressed();
 
-        _solver.compute(A);
-        if(_solver.info()!=Eigen::Success) {
-            ERR("Failed during Eigen linear solver initialization");
-            return false;
+        // Setup/solve split with staleness policy: the preconditioner setup
+        // of a previous solve is reused for up to precon_reuse_steps solves,
+        // but is recomputed early when the iteration count regresses
+        // noticeably, i.e., the matrix has drifted too far away from the one
+        // the setup was computed for.
+        bool const iterations_regressed =
+            _iterations_after_compute > 0 &&
+            _last_iterations > 2 * _iterations_after_compute;
+        if (_solves_since_compute > opt.precon_reuse_steps ||
+            iterations_regressed || _solves_since_compute == 0)
+        {
+            _solver.compute(A);
+            _solves_since_compute = 0;
+            _iterations_after_compute = 0;
+            if(_solver.info()!=Eigen::Success) {
+                ERR("Failed during Eigen linear solver initialization");
+                return false;
+            }
         }
+        ++_solves_since_compute;
 
         x = _solver.solveWithGuess(b, x);
         INFO("\t iteration: %d/%ld", _solver.iterations(), opt.max_iterations);
         INFO("\t residual: %e\n", _solver.error());
 
+        _last_iterations = static_cast<int>(_solver.iterations());
+        if (_iterations_after_compute == 0)
+            _iterations_after_compute = _last_iterations;
+
         if(_solver.info()!=Eigen::Success) {
             ERR("Failed during Eigen linear solve");
             return false;
@@ -113,8 +167,110 @@ public:
 
 private:
     T_SOLVER _solver;
+
+    //! Number of solve() calls since the last preconditioner setup; zero
+    //! means no setup has happened yet.
+    int _solves_since_compute = 0;
+    //! Iteration count of the first solve after the last setup.
+    int _iterations_after_compute = 0;
+    //! Iteration count of the most recent solve.
+    int _last_iterations = 0;
+};
+
+/// Mixed-precision solver: the matrix and the inner Krylov iterations run in
+/// single precision, wrapped into a double-precision iterative refinement
+/// loop. The inner sweeps move half the memory traffic of a double-precision
+/// SpMV, while the outer residual keeps full accuracy.
+template <class T_SOLVER_SINGLE>
+class EigenMixedPrecisionSolver final : public EigenLinearSolverBase
+{
+public:
+    using SingleMatrix = Eigen::SparseMatrix<float, Eigen::RowMajor>;
+
+    bool solve(Matrix& A, Vector const& b, Vector& x,
+               EigenOption& opt) override
+    {
+        INFO("-> solve with %s (mixed precision, precon %s)",
+             EigenOption::getSolverName(opt.solver_type).c_str(),
+             EigenOption::getPreconName(opt.precon_type).c_str());
+
+        if (!A.isCompressed())
+            A.makeCompressed();
+
+        SingleMatrix const A_single = A.cast<float>();
+        _solver.setTolerance(
+            std::max(static_cast<float>(opt.error_tolerance), 1e-6f));
+        _solver.setMaxIterations(opt.max_iterations);
+        _solver.compute(A_single);
+        if (_solver.info() != Eigen::Success) {
+            ERR("Failed during Eigen linear solver initialization");
+            return false;
+        }
+
+        // Iterative refinement: the correction equation is solved in single
+        // precision, residual and update are computed in double precision.
+        int const max_refinement_steps = 50;
+        double const b_norm = b.norm();
+        if (b_norm == 0.0) {
+            x.setZero();
+            return true;
+        }
+
+        Vector residual = b - A * x;
+        for (int step = 0; step < max_refinement_steps; ++step) {
+            if (residual.norm() <= opt.error_tolerance * b_norm) {
+                INFO("\t refinement steps: %d", step);
+                return true;
+            }
+
+            Eigen::VectorXf const correction =
+                _solver.solve(residual.cast<float>());
+            if (_solver.info() == Eigen::NumericalIssue) {
+                ERR("Failed during Eigen mixed-precision inner solve");
+                return false;
+            }
+
+            x += correction.cast<double>();
+            residual.noalias() = b - A * x;
+        }
+
+        ERR("Eigen mixed-precision iterative refinement did not converge.");
+        return false;
+    }
+
+private:
+    T_SOLVER_SINGLE _solver;
 };
 
+template <template <typename, typename> class Solver, typename Precon>
+std::unique_ptr<EigenLinearSolverBase> createMixedPrecisionSolver()
+{
+    using Slv = EigenMixedPrecisionSolver<
+        Solver<Eigen::SparseMatrix<float, Eigen::RowMajor>, Precon>>;
+    return std::unique_ptr<Slv>(new Slv);
+}
+
+template <template <typename, typename> class Solver>
+std::unique_ptr<EigenLinearSolverBase> createMixedPrecisionSolver(
+    EigenOption::PreconType precon_type)
+{
+    switch (precon_type) {
+        case EigenOption::PreconType::NONE:
+            return createMixedPrecisionSolver<Solver,
+                                              Eigen::IdentityPreconditioner>();
+        case EigenOption::PreconType::DIAGONAL:
+            return createMixedPrecisionSolver<
+                Solver, Eigen::DiagonalPreconditioner<float>>();
+        case EigenOption::PreconType::ILUT:
+            return createMixedPrecisionSolver<Solver,
+                                              Eigen::IncompleteLUT<float>>();
+        default:
+            OGS_FATAL(
+                "The selected Eigen preconditioner type is not available in "
+                "mixed precision.");
+    }
+}
+
 template <template <typename, typename> class Solver, typename Precon>
 std::unique_ptr<EigenLinearSolverBase> createIterativeSolver()
 {
@@ -139,6 +295,9 @@ std::unique_ptr<EigenLinearSolverBase> createIterativeSolver(
             // see https://eigen.tuxfamily.org/dox/classEigen_1_1IncompleteLUT.html
             return createIterativeSolver<
                 Solver, Eigen::IncompleteLUT<double>>();
+        case EigenOption::PreconType::AMG:
+            return createIterativeSolver<
+                Solver, SmoothedAggregationPreconditioner>();
         default:
             OGS_FATAL("Invalid Eigen preconditioner type.");
     }
@@ -148,16 +307,26 @@ template <typename Mat, typename Precon>
 using EigenCGSolver = Eigen::ConjugateGradient<Mat, Eigen::Lower, Precon>;
 
 std::unique_ptr<EigenLinearSolverBase> createIterativeSolver(
-    EigenOption::SolverType solver_type, EigenOption::PreconType precon_type)
+    EigenOption::SolverType solver_type, EigenOption::PreconType precon_type,
+    bool const mixed_precision)
 {
     switch (solver_type) {
         case EigenOption::SolverType::BiCGSTAB: {
+            if (mixed_precision)
+                return createMixedPrecisionSolver<Eigen::BiCGSTAB>(
+                    precon_type);
             return createIterativeSolver<Eigen::BiCGSTAB>(precon_type);
         }
         case EigenOption::SolverType::CG: {
+            if (mixed_precision)
+                return createMixedPrecisionSolver<EigenCGSolver>(precon_type);
             return createIterativeSolver<EigenCGSolver>(precon_type);
         }
         case EigenOption::SolverType::GMRES: {
+            if (mixed_precision)
+                OGS_FATAL(
+                    "Mixed precision is not implemented for the GMRES "
+                    "solver.");
 #ifdef USE_EIGEN_UNSUPPORTED
             return createIterativeSolver<Eigen::GMRES>(precon_type);
 #else
@@ -171,6 +340,62 @@ std::unique_ptr<EigenLinearSolverBase> createIterativeSolver(
     }
 }
 
+/// Staggered (block Gauss-Seidel) solver for 2x2 block systems, cf.
+/// solveStaggeredBlockGaussSeidel(). The split index comes from the
+/// <staggered_split_index> option.
+class EigenStaggeredSolver final : public EigenLinearSolverBase
+{
+public:
+    bool solve(Matrix& A, Vector const& b, Vector& x,
+               EigenOption& opt) override
+    {
+        INFO("-> solve with StaggeredGaussSeidel (split at %d)",
+             opt.staggered_split_index);
+        if (!A.isCompressed())
+            A.makeCompressed();
+
+        auto const report = solveStaggeredBlockGaussSeidel(
+            A, b, x, opt.staggered_split_index, opt.error_tolerance,
+            static_cast<int>(opt.max_iterations));
+
+        INFO("\t coupling iteration: %d/%ld", report.iterations,
+             opt.max_iterations);
+        INFO("\t residual: %e\n", report.residual);
+
+        if (!report.converged)
+            ERR("StaggeredGaussSeidel did not converge.");
+        return report.converged;
+    }
+};
+
+#ifdef USE_CUDA
+/// Offloads Jacobi-preconditioned CG to the GPU; the CSR matrix is mirrored
+/// on the device, only the solution is transferred back.
+class EigenCudaCGSolver final : public EigenLinearSolverBase
+{
+public:
+    bool solve(Matrix& A, Vector const& b, Vector& x,
+               EigenOption& opt) override
+    {
+        INFO("-> solve with CudaCG");
+        if (!A.isCompressed())
+            A.makeCompressed();
+
+        auto const report = MathLib::Cuda::solveCG(
+            A.rows(), A.nonZeros(), A.outerIndexPtr(), A.innerIndexPtr(),
+            A.valuePtr(), b.data(), x.data(), opt.error_tolerance,
+            static_cast<int>(opt.max_iterations));
+
+        INFO("\t iteration: %d/%ld", report.iterations, opt.max_iterations);
+        INFO("\t residual: %e\n", report.residual);
+
+        if (!report.converged)
+            ERR("CudaCG did not converge.");
+        return report.converged;
+    }
+};
+#endif
+
 } // details
 
 EigenLinearSolver::EigenLinearSolver(
@@ -195,8 +420,23 @@ EigenLinearSolver::EigenLinearSolver(
         case EigenOption::SolverType::CG:
         case EigenOption::SolverType::GMRES:
             _solver = details::createIterativeSolver(_option.solver_type,
-                                                     _option.precon_type);
+                                                     _option.precon_type,
+                                                     _option.mixed_precision);
+            return;
+        case EigenOption::SolverType::StaggeredGaussSeidel: {
+            _solver.reset(new details::EigenStaggeredSolver);
             return;
+        }
+        case EigenOption::SolverType::CudaCG: {
+#ifdef USE_CUDA
+            _solver.reset(new details::EigenCudaCGSolver);
+            return;
+#else
+            OGS_FATAL(
+                "The code is not compiled with CUDA. Linear solver type "
+                "CudaCG is not available.");
+#endif
+        }
         case EigenOption::SolverType::PardisoLU: {
 #ifdef USE_MKL
             using SolverType = Eigen::PardisoLU<EigenMatrix::RawMatrixType>;
@@ -243,6 +483,41 @@ void EigenLinearSolver::setOption(BaseLib::ConfigTree const& option)
             ptSolver->getConfigParameterOptional<int>("max_iteration_step")) {
         _option.max_iterations = *max_iteration_step;
     }
+    if (auto precon_reuse_steps =
+            //! \ogs_file_param{prj__linear_solvers__linear_solver__eigen__precon_reuse_steps}
+            ptSolver->getConfigParameterOptional<int>("precon_reuse_steps")) {
+        _option.precon_reuse_steps = *precon_reuse_steps;
+    }
+    if (auto mixed_precision =
+            //! \ogs_file_param{prj__linear_solvers__linear_solver__eigen__mixed_precision}
+            ptSolver->getConfigParameterOptional<bool>("mixed_precision")) {
+        _option.mixed_precision = *mixed_precision;
+    }
+    if (auto staggered_split_index =
+            //! \ogs_file_param{prj__linear_solvers__linear_solver__eigen__staggered_split_index}
+            ptSolver->getConfigParameterOptional<int>(
+                "staggered_split_index")) {
+        _option.staggered_split_index = *staggered_split_index;
+    }
+    if (auto threads =
+            //! \ogs_file_param{prj__linear_solvers__linear_solver__eigen__threads}
+            ptSolver->getConfigParameterOptional<int>("threads")) {
+        _option.num_threads = *threads;
+#ifdef OGS_USE_OPENMP
+        // Applies to the backend's OpenMP kernels (row-parallel SpMV,
+        // reductions) and Eigen's internal parallelism alike. The global
+        // assembly creates the vectors thread-local, so under the
+        // first-touch policy the pages are already distributed over the
+        // NUMA domains the kernels run on.
+        omp_set_num_threads(_option.num_threads);
+        Eigen::setNbThreads(_option.num_threads);
+        INFO("Eigen backend uses %d threads.", _option.num_threads);
+#else
+        WARN(
+            "The code is compiled without OpenMP; the <threads> option of "
+            "the Eigen linear solver has no effect.");
+#endif
+    }
     if (auto scaling =
             //! \ogs_file_param{prj__linear_solvers__linear_solver__eigen__scaling}
             ptSolver->getConfigParameterOptional<bool>("scaling")) {
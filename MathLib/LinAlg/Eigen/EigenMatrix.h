@@ -9,8 +9,12 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
 #include <fstream>
 #include <string>
+#include <vector>
 
 #include <Eigen/Sparse>
 
@@ -75,10 +79,93 @@ public:
         return 0;
     }
 
+    /// Fixes the sparsity structure of the matrix. Subsequent add() calls
+    /// write directly into the CSR value array instead of going through
+    /// Eigen's insertion machinery. The matrix is compressed as a side
+    /// effect.
+    ///
+    /// Adding an entry that is not part of the frozen structure silently
+    /// thaws the matrix again; the structure is re-frozen on the next
+    /// finalizeAssembly() call.
+    void freezeStructure()
+    {
+        _mat.makeCompressed();
+        _structure_frozen = true;
+    }
+
+    bool isStructureFrozen() const { return _structure_frozen; }
+
+    /*! Builds the value-array offsets of the (rows x columns) block given
+     * by the index vectors, cf. addWithOffsets().
+     *
+     * Requires a frozen structure containing all block entries; returns an
+     * empty table otherwise (callers then stay on the searching add()
+     * path). Offsets are stored row by row.
+     */
+    std::vector<std::ptrdiff_t> buildAddOffsets(
+        std::vector<IndexType> const& row_pos,
+        std::vector<IndexType> const& col_pos) const
+    {
+        std::vector<std::ptrdiff_t> offsets;
+        if (!_structure_frozen)
+            return offsets;
+        offsets.reserve(row_pos.size() * col_pos.size());
+        auto const* const outer = _mat.outerIndexPtr();
+        auto const* const inner = _mat.innerIndexPtr();
+        for (auto const row : row_pos) {
+            auto const* const first = inner + outer[row];
+            auto const* const last = inner + outer[row + 1];
+            for (auto const col : col_pos) {
+                auto const* const it = std::lower_bound(first, last, col);
+                if (it == last || *it != col)
+                    return std::vector<std::ptrdiff_t>();  // not in structure
+                offsets.push_back(it - inner);
+            }
+        }
+        return offsets;
+    }
+
+    /*! Adds the dense block through a precomputed offset table: one
+     * indexed add per entry, no per-entry binary search. The table must
+     * stem from buildAddOffsets() on this matrix with unchanged (frozen)
+     * structure; repeated re-assembly of the same elements then skips the
+     * entire index resolution.
+     */
+    template <class T_DENSE_MATRIX>
+    void addWithOffsets(std::vector<std::ptrdiff_t> const& offsets,
+                        const T_DENSE_MATRIX& sub_matrix, double fkt = 1.0)
+    {
+        assert(_structure_frozen);
+        assert(offsets.size() ==
+               static_cast<std::size_t>(sub_matrix.rows() *
+                                        sub_matrix.cols()));
+        auto* const values = _mat.valuePtr();
+        std::size_t k = 0;
+        for (auto i = decltype(sub_matrix.rows()){0}; i < sub_matrix.rows();
+             i++)
+            for (auto j = decltype(sub_matrix.cols()){0};
+                 j < sub_matrix.cols(); j++)
+                values[offsets[k++]] += fkt * sub_matrix(i, j);
+    }
+
     /// add a value to the given entry. If the entry doesn't exist, the value is
     /// inserted.
     int add(IndexType row, IndexType col, double val)
     {
+        if (_structure_frozen) {
+            auto const* const outer = _mat.outerIndexPtr();
+            auto const* const inner = _mat.innerIndexPtr();
+            auto const* const first = inner + outer[row];
+            auto const* const last = inner + outer[row + 1];
+            auto const* const it = std::lower_bound(first, last, col);
+            if (it != last && *it == col) {
+                _mat.valuePtr()[it - inner] += val;
+                return 0;
+            }
+            // The entry is not part of the frozen structure, i.e., it has not
+            // been touched by the first assembly. Fall back to insertion.
+            _structure_frozen = false;
+        }
         if (val != 0.0) _mat.coeffRef(row, col) += val;
         return 0;
     }
@@ -164,6 +251,9 @@ public:
 
 protected:
     RawMatrixType _mat;
+
+    //! \see freezeStructure()
+    bool _structure_frozen = false;
 };
 
 template <class T_DENSE_MATRIX>
@@ -0,0 +1,95 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <functional>
+
+#include <Eigen/Dense>
+
+namespace MathLib
+{
+
+/// Result of a matrixFreeCG() solve.
+struct MatrixFreeCGReport
+{
+    bool converged = false;
+    int iterations = 0;
+    double residual = 0.0;
+};
+
+/// Preconditioned conjugate gradient solver working on an abstract operator
+/// application instead of an assembled matrix.
+///
+/// \param apply_operator computes \f$ y = A x \f$; for Laplacian-dominated
+///        processes this typically re-runs the element kernels on the fly,
+///        cf. ProcessLib::applyOperatorMatrixFree(), trading FLOPs for the
+///        memory footprint of the assembled CSR matrix.
+/// \param b right-hand side.
+/// \param x solution vector; the initial content is used as initial guess.
+/// \param inv_diag inverse diagonal of the operator for Jacobi
+///        preconditioning; pass an empty vector for no preconditioning.
+/// \param error_tolerance relative residual reduction to reach.
+/// \param max_iterations iteration limit.
+inline MatrixFreeCGReport matrixFreeCG(
+    std::function<void(Eigen::VectorXd const&, Eigen::VectorXd&)> const&
+        apply_operator,
+    Eigen::VectorXd const& b, Eigen::VectorXd& x,
+    Eigen::VectorXd const& inv_diag, double const error_tolerance,
+    int const max_iterations)
+{
+    MatrixFreeCGReport report;
+
+    auto const n = b.size();
+    bool const use_precon = inv_diag.size() == n;
+
+    double const b_norm = b.norm();
+    if (b_norm == 0.0) {
+        x.setZero();
+        report.converged = true;
+        return report;
+    }
+
+    Eigen::VectorXd Ax(n);
+    apply_operator(x, Ax);
+    Eigen::VectorXd r = b - Ax;
+    Eigen::VectorXd z = use_precon ? inv_diag.cwiseProduct(r).eval() : r;
+    Eigen::VectorXd p = z;
+    double rz = r.dot(z);
+
+    Eigen::VectorXd Ap(n);
+    for (int it = 0; it < max_iterations; ++it) {
+        report.residual = r.norm() / b_norm;
+        if (report.residual <= error_tolerance) {
+            report.converged = true;
+            report.iterations = it;
+            return report;
+        }
+
+        apply_operator(p, Ap);
+        double const alpha = rz / p.dot(Ap);
+        x += alpha * p;
+        r -= alpha * Ap;
+
+        if (use_precon)
+            z = inv_diag.cwiseProduct(r);
+        else
+            z = r;
+
+        double const rz_new = r.dot(z);
+        p = z + (rz_new / rz) * p;
+        rz = rz_new;
+    }
+
+    report.iterations = max_iterations;
+    report.residual = r.norm() / b_norm;
+    return report;
+}
+
+}  // namespace MathLib
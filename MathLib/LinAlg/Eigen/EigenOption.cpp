@@ -19,6 +19,10 @@ EigenOption::EigenOption()
     precon_type = PreconType::NONE;
     max_iterations = static_cast<int>(1e6);
     error_tolerance = 1.e-16;
+    precon_reuse_steps = 0;
+    staggered_split_index = 0;
+    num_threads = 0;
+    mixed_precision = false;
 #ifdef USE_EIGEN_UNSUPPORTED
     scaling = false;
 #endif
@@ -36,6 +40,10 @@ EigenOption::SolverType EigenOption::getSolverType(const std::string &solver_nam
         return SolverType::PardisoLU;
     if (solver_name == "GMRES")
         return SolverType::GMRES;
+    if (solver_name == "CudaCG")
+        return SolverType::CudaCG;
+    if (solver_name == "StaggeredGaussSeidel")
+        return SolverType::StaggeredGaussSeidel;
 
     OGS_FATAL("Unknown Eigen solver type `%s'", solver_name.c_str());
 }
@@ -48,6 +56,8 @@ EigenOption::PreconType EigenOption::getPreconType(const std::string &precon_nam
         return PreconType::DIAGONAL;
     if (precon_name == "ILUT")
         return PreconType::ILUT;
+    if (precon_name == "AMG")
+        return PreconType::AMG;
 
     OGS_FATAL("Unknown Eigen preconditioner type `%s'", precon_name.c_str());
 }
@@ -65,6 +75,10 @@ std::string EigenOption::getSolverName(SolverType const solver_type)
             return "PardisoLU";
         case SolverType::GMRES:
             return "GMRES";
+        case SolverType::CudaCG:
+            return "CudaCG";
+        case SolverType::StaggeredGaussSeidel:
+            return "StaggeredGaussSeidel";
     }
     return "Invalid";
 }
@@ -78,6 +92,8 @@ std::string EigenOption::getPreconName(PreconType const precon_type)
             return "DIAGONAL";
         case PreconType::ILUT:
             return "ILUT";
+        case PreconType::AMG:
+            return "AMG";
     }
     return "Invalid";
 }
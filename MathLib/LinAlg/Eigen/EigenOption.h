@@ -24,7 +24,9 @@ struct EigenOption final
         BiCGSTAB,
         SparseLU,
         PardisoLU,
-        GMRES
+        GMRES,
+        CudaCG,
+        StaggeredGaussSeidel
     };
 
     /// Preconditioner type
@@ -32,7 +34,8 @@ struct EigenOption final
     {
         NONE,
         DIAGONAL,
-        ILUT
+        ILUT,
+        AMG
     };
 
     /// Linear solver type
@@ -43,6 +46,24 @@ struct EigenOption final
     int max_iterations;
     /// Error tolerance
     double error_tolerance;
+    /// Number of subsequent solves reusing the preconditioner/factorization
+    /// setup of a previous solve. Zero (the default) recomputes the setup for
+    /// every solve. The setup is recomputed early when the iteration count
+    /// regresses, cf. EigenIterativeLinearSolver.
+    int precon_reuse_steps;
+    /// Row/column index splitting the two blocks of the
+    /// StaggeredGaussSeidel solver, cf. <staggered_split_index>.
+    int staggered_split_index;
+    /// Number of OpenMP threads for the backend's parallel kernels
+    /// (SpMV, reductions) and for Eigen's internal parallelism,
+    /// cf. <threads>. Zero (the default) leaves the ambient thread count
+    /// untouched.
+    int num_threads;
+    /// Run the inner Krylov iterations in single precision wrapped into
+    /// double-precision iterative refinement, cf.
+    /// EigenMixedPrecisionSolver. Only available for the iterative solver
+    /// types.
+    bool mixed_precision;
 #ifdef USE_EIGEN_UNSUPPORTED
     /// Scaling the coefficient matrix and the RHS bector
     bool scaling;
@@ -0,0 +1,100 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <Eigen/Sparse>
+#include <Eigen/SparseLU>
+
+namespace MathLib
+{
+
+/// Result of a staggered block solve.
+struct StaggeredBlockSolverReport
+{
+    bool converged = false;
+    int iterations = 0;
+    double residual = 0.0;
+};
+
+/// Solves the 2x2 block system
+/// \f[ \begin{pmatrix} A & B \\ C & D \end{pmatrix}
+///     \begin{pmatrix} x \\ y \end{pmatrix} =
+///     \begin{pmatrix} f \\ g \end{pmatrix} \f]
+/// by block Gauss-Seidel (staggered) iterations: each sweep solves the two
+/// diagonal blocks separately with sparse LU, so an indefinite coupled
+/// system (e.g. hydro-mechanics with component-ordered DOFs split at the
+/// displacement/pressure boundary) is replaced by two smaller,
+/// better-conditioned solves whose factorizations are computed once and
+/// reused over the coupling iterations.
+///
+/// \param K     the coupled matrix.
+/// \param rhs   the coupled right hand side.
+/// \param x     solution; the initial content is the initial guess.
+/// \param split row/column index separating the two blocks.
+/// \param error_tolerance relative residual to reach.
+/// \param max_iterations  coupling iteration limit.
+inline StaggeredBlockSolverReport solveStaggeredBlockGaussSeidel(
+    Eigen::SparseMatrix<double, Eigen::RowMajor> const& K,
+    Eigen::VectorXd const& rhs, Eigen::VectorXd& x,
+    Eigen::Index const split, double const error_tolerance,
+    int const max_iterations)
+{
+    StaggeredBlockSolverReport report;
+
+    auto const n = K.rows();
+    auto const m = n - split;
+
+    using ColMajor = Eigen::SparseMatrix<double>;
+    ColMajor const A = K.topLeftCorner(split, split);
+    ColMajor const B = K.topRightCorner(split, m);
+    ColMajor const C = K.bottomLeftCorner(m, split);
+    ColMajor const D = K.bottomRightCorner(m, m);
+
+    Eigen::SparseLU<ColMajor> solver_A, solver_D;
+    solver_A.compute(A);
+    solver_D.compute(D);
+    if (solver_A.info() != Eigen::Success ||
+        solver_D.info() != Eigen::Success)
+        return report;
+
+    auto const f = rhs.head(split);
+    auto const g = rhs.tail(m);
+    double const rhs_norm = rhs.norm();
+    if (rhs_norm == 0.0) {
+        x.setZero(n);
+        report.converged = true;
+        return report;
+    }
+
+    Eigen::VectorXd x1 = x.head(split);
+    Eigen::VectorXd x2 = x.tail(m);
+
+    for (int it = 0; it < max_iterations; ++it) {
+        x1 = solver_A.solve(f - B * x2);
+        x2 = solver_D.solve(g - C * x1);
+
+        double const residual =
+            std::sqrt((f - A * x1 - B * x2).squaredNorm() +
+                      (g - C * x1 - D * x2).squaredNorm()) /
+            rhs_norm;
+        report.iterations = it + 1;
+        report.residual = residual;
+        if (residual <= error_tolerance) {
+            report.converged = true;
+            break;
+        }
+    }
+
+    x.head(split) = x1;
+    x.tail(m) = x2;
+    return report;
+}
+
+}  // namespace MathLib
@@ -26,31 +26,49 @@ void applyKnownSolution(EigenMatrix &A_, EigenVector &b_, EigenVector &/*x*/,
     auto &A = A_.getRawMatrix();
     auto &b = b_.getRawVector();
 
-    // A(k, j) = 0.
-    // set row to zero
-    for (auto row_id : vec_knownX_id)
-        for (SpMat::InnerIterator it(A,row_id); it; ++it) {
-            if (it.col() != decltype(it.col())(row_id)) it.valueRef() = 0.0;
-        }
-
-    SpMat AT = A.transpose();
+    auto const n = A.rows();
 
-    for (std::size_t ix=0; ix<vec_knownX_id.size(); ix++)
+    // Membership mask and value lookup for the known entries; O(1) per
+    // matrix entry in the single elimination sweep below.
+    std::vector<char> is_known(n, 0);
+    std::vector<double> known_value(n, 0.0);
+    for (std::size_t ix = 0; ix < vec_knownX_id.size(); ++ix)
     {
-        SpMat::Index const row_id = vec_knownX_id[ix];
-        auto const x = vec_knownX_x[ix];
+        is_known[vec_knownX_id[ix]] = 1;
+        known_value[vec_knownX_id[ix]] = vec_knownX_x[ix];
+    }
 
-        // b_i -= A(i,k)*val, i!=k
-        // set column to zero, subtract from rhs
-        for (SpMat::InnerIterator it(AT, row_id); it; ++it)
+    // One streaming pass over the CSR values replaces the former pair of
+    // full matrix transposes: rows of known entries are zeroed (except for
+    // the diagonal), and in all other rows the columns of known entries are
+    // eliminated into the right hand side. Only values are written, so a
+    // frozen matrix structure stays intact.
+    for (SpMat::Index row = 0; row < n; ++row)
+    {
+        if (is_known[row])
         {
-            if (it.col() == row_id) continue;
+            for (SpMat::InnerIterator it(A, row); it; ++it)
+                if (it.col() != row)
+                    it.valueRef() = 0.0;
+            continue;
+        }
 
-            b[it.col()] -= it.value()*x;
+        for (SpMat::InnerIterator it(A, row); it; ++it)
+        {
+            if (!is_known[it.col()])
+                continue;
+            b[row] -= it.value() * known_value[it.col()];
             it.valueRef() = 0.0;
         }
+    }
 
-        auto& c = AT.coeffRef(row_id, row_id);
+    // Fix the diagonal entries and right hand sides of the known rows.
+    for (std::size_t ix = 0; ix < vec_knownX_id.size(); ++ix)
+    {
+        SpMat::Index const row_id = vec_knownX_id[ix];
+        auto const x = vec_knownX_x[ix];
+
+        auto& c = A.coeffRef(row_id, row_id);
         if (c != 0.0) {
             b[row_id] = x * c;
         } else {
@@ -58,8 +76,6 @@ void applyKnownSolution(EigenMatrix &A_, EigenVector &b_, EigenVector &/*x*/,
             c = 1.0;
         }
     }
-
-    A = AT.transpose();
 }
 
 } // MathLib
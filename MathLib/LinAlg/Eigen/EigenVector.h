@@ -77,6 +77,24 @@ public:
         return local_x;
     }
 
+    /// get entries into the given buffer, which is resized as needed. In
+    /// contrast to the value-returning overload this does not allocate once
+    /// the buffer has reached its final size, which makes it suitable for
+    /// per-element use in the assembly hot path.
+    void get(std::vector<IndexType> const& indices,
+             std::vector<double>& local_x) const
+    {
+        local_x.resize(indices.size());
+
+        for (std::size_t i = 0; i < indices.size(); ++i) {
+            local_x[i] = _vec[indices[i]];
+        }
+    }
+
+    /// Read-only raw access to the vector's contiguous storage, avoiding
+    /// per-entry get() calls.
+    double const* data() const { return _vec.data(); }
+
     /// set entry
     void set(IndexType rowId, double v)
     {
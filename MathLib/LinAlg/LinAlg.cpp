@@ -152,6 +152,16 @@ void matMultAdd(PETScMatrix const& A, PETScVector const& v1,
     MatMultAdd(A.getRawMatrix(), v1.getRawVector(), v2.getRawVector(), v3.getRawVector());
 }
 
+void matMultSub(PETScMatrix const& A, PETScVector const& x,
+                PETScVector const& b, PETScVector& r)
+{
+    // r = A*x; r -= b. PETSc has no fused kernel for this combination, but
+    // the two calls avoid the temporary of the generic implementation.
+    if (!r.getRawVector()) r.shallowCopy(x);
+    MatMult(A.getRawMatrix(), x.getRawVector(), r.getRawVector());
+    VecAXPY(r.getRawVector(), -1.0, b.getRawVector());
+}
+
 void finalizeAssembly(PETScMatrix& A)
 {
     A.finalizeAssembly(MAT_FINAL_ASSEMBLY);
@@ -169,6 +179,11 @@ void finalizeAssembly(PETScVector& x)
 // Sparse global EigenMatrix/EigenVector //////////////////////////////////////////
 #elif defined(OGS_USE_EIGEN)
 
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+
+#include "BaseLib/Deterministic.h"
 #include "MathLib/LinAlg/Eigen/EigenVector.h"
 #include "MathLib/LinAlg/Eigen/EigenMatrix.h"
 
@@ -236,6 +251,21 @@ double norm1(EigenVector const& x)
 template<>
 double norm2(EigenVector const& x)
 {
+#ifdef OGS_USE_OPENMP
+    // Parallel reduction; the summation order depends on the thread count,
+    // so the bitwise-reproducible deterministic mode keeps Eigen's
+    // sequential sum.
+    if (!BaseLib::deterministicParallelMode())
+    {
+        auto const& raw = x.getRawVector();
+        auto const n = static_cast<std::ptrdiff_t>(raw.size());
+        double sum = 0.0;
+#pragma omp parallel for schedule(static) reduction(+ : sum)
+        for (std::ptrdiff_t i = 0; i < n; ++i)
+            sum += raw[i] * raw[i];
+        return std::sqrt(sum);
+    }
+#endif
     return x.getRawVector().norm();
 }
 
@@ -280,23 +310,137 @@ void axpy(EigenMatrix& Y, double const a, EigenMatrix const& X)
 // Matrix and Vector
 
 // v3 = A*v1 + v2
+namespace
+{
+/*! Row-parallel sparse matrix-vector kernel: r[i] = (A x)[i] + beta*c[i].
+ *
+ * Eigen (3.2) evaluates sparse products single-threaded; this kernel
+ * distributes the CSR rows over the OpenMP threads. Every row is computed
+ * independently and summed in index order, so the result is bitwise
+ * identical for any thread count---no special-casing for the deterministic
+ * mode is needed. Requires a compressed matrix; the callers' matrices come
+ * from finalized assembly.
+ */
+void spmv(EigenMatrix::RawMatrixType const& A,
+          EigenVector::RawVectorType const& x, double const beta,
+          EigenVector::RawVectorType const* const c,
+          EigenVector::RawVectorType& r)
+{
+    if (!A.isCompressed())
+    {
+        // Uncompressed matrices (first assembly before finalize) take the
+        // Eigen path.
+        if (c != nullptr)
+            r = beta * (*c) + A * x;
+        else
+            r = A * x;
+        return;
+    }
+
+    r.resize(A.rows());
+    auto const* const outer = A.outerIndexPtr();
+    auto const* const inner = A.innerIndexPtr();
+    auto const* const values = A.valuePtr();
+    auto const n_rows = static_cast<std::ptrdiff_t>(A.rows());
+#pragma omp parallel for schedule(static)
+    for (std::ptrdiff_t i = 0; i < n_rows; ++i)
+    {
+        double sum = 0.0;
+        for (auto k = outer[i]; k < outer[i + 1]; ++k)
+            sum += values[k] * x[inner[k]];
+        r[i] = c != nullptr ? beta * (*c)[i] + sum : sum;
+    }
+}
+}  // anonymous namespace
+
 void matMult(EigenMatrix const& A, EigenVector const& x, EigenVector& y)
 {
     assert(&x != &y);
-    y.getRawVector() = A.getRawMatrix() * x.getRawVector();
+    spmv(A.getRawMatrix(), x.getRawVector(), 0.0, nullptr, y.getRawVector());
 }
 
 // v3 = A*v1 + v2
 void matMultAdd(EigenMatrix const& A, EigenVector const& v1, EigenVector const& v2, EigenVector& v3)
 {
     assert(&v1 != &v3);
-    // TODO: does that break anything?
-    v3.getRawVector() = v2.getRawVector() + A.getRawMatrix()*v1.getRawVector();
+    spmv(A.getRawMatrix(), v1.getRawVector(), 1.0, &v2.getRawVector(),
+         v3.getRawVector());
+}
+
+namespace
+{
+//! True if both matrices are compressed with identical index arrays.
+bool haveSameSparsity(EigenMatrix::RawMatrixType const& a,
+                      EigenMatrix::RawMatrixType const& b)
+{
+    if (a.rows() != b.rows() || a.nonZeros() != b.nonZeros() ||
+        !a.isCompressed() || !b.isCompressed())
+        return false;
+    return std::equal(a.outerIndexPtr(), a.outerIndexPtr() + a.rows() + 1,
+                      b.outerIndexPtr()) &&
+           std::equal(a.innerIndexPtr(), a.innerIndexPtr() + a.nonZeros(),
+                      b.innerIndexPtr());
+}
+}  // anonymous namespace
+
+void weightedMatrixSum(double const a, EigenMatrix const& M,
+                       EigenMatrix const& K, EigenMatrix& A)
+{
+    auto const& raw_M = M.getRawMatrix();
+    auto const& raw_K = K.getRawMatrix();
+    auto& raw_A = A.getRawMatrix();
+
+    // One sweep over the value arrays when all three matrices share their
+    // sparsity; the index comparison is integer work, cheap next to the
+    // two full double sweeps of the fallback.
+    if (haveSameSparsity(raw_M, raw_K) && haveSameSparsity(raw_M, raw_A))
+    {
+        auto const nnz = raw_M.nonZeros();
+        auto const* const m_values = raw_M.valuePtr();
+        auto const* const k_values = raw_K.valuePtr();
+        auto* const a_values = raw_A.valuePtr();
+        for (auto i = decltype(nnz){0}; i < nnz; ++i)
+            a_values[i] = a * m_values[i] + k_values[i];
+        return;
+    }
+
+    copy(M, A);
+    aypx(A, a, K);
+}
+
+void matMultSub(EigenMatrix const& A, EigenVector const& x,
+                EigenVector const& b, EigenVector& r)
+{
+    assert(&x != &r);
+    // Fused and row-parallel: the subtraction happens in the same sweep
+    // that writes the SpMV result.
+    spmv(A.getRawMatrix(), x.getRawVector(), -1.0, &b.getRawVector(),
+         r.getRawVector());
+}
+
+double axpyAndNorm2(EigenVector& y, double const a, EigenVector const& x)
+{
+    auto& y_raw = y.getRawVector();
+    auto const& x_raw = x.getRawVector();
+    assert(y_raw.size() == x_raw.size());
+
+    // Manual fusion: one pass updates and accumulates the squared norm.
+    double norm_squared = 0.0;
+    auto const n = y_raw.size();
+    for (std::remove_const<decltype(n)>::type i = 0; i < n; ++i) {
+        double const v = y_raw[i] + a * x_raw[i];
+        y_raw[i] = v;
+        norm_squared += v * v;
+    }
+    return std::sqrt(norm_squared);
 }
 
 void finalizeAssembly(EigenMatrix& x)
 {
-    x.getRawMatrix().makeCompressed();
+    // Freezing compresses the matrix and additionally fixes its sparsity
+    // structure, such that subsequent assemblies write directly into the CSR
+    // value array, cf. EigenMatrix::freezeStructure().
+    x.freezeStructure();
 }
 
 } // namespace LinAlg
@@ -132,6 +132,30 @@ void matMultAdd(Matrix const& A, Vector const& v1, Vector const& v2, Vector& v3)
     v3 = v2 + A*v1;
 }
 
+/*! Computes the residual $ r = A \cdot x - b $ in one fused pass where
+ * the backend supports it, instead of a matMult() followed by an axpy()
+ * sweeping the vector twice.
+ *
+ * 
+ote \c x must not be the same object as \c r.
+ */
+template<typename Matrix, typename Vector>
+void matMultSub(Matrix const& A, Vector const& x, Vector const& b, Vector& r)
+{
+    assert(&x != &r);
+    r = A*x - b;
+}
+
+/*! Computes $ y = y + a \cdot x $ and returns $ ||y||_2 $ of the
+ * updated vector, fused into a single sweep where the backend supports it.
+ */
+template<typename Vector>
+double axpyAndNorm2(Vector& y, double const a, Vector const& x)
+{
+    axpy(y, a, x);
+    return norm2(y);
+}
+
 }} // namespaces
 
 
@@ -245,6 +269,16 @@ void matMult(EigenMatrix const& A, EigenVector const& x, EigenVector& y);
 void matMultAdd(EigenMatrix const& A, EigenVector const& v1,
                 EigenVector const& v2, EigenVector& v3);
 
+// Fused kernels
+
+void matMultSub(EigenMatrix const& A, EigenVector const& x,
+                EigenVector const& b, EigenVector& r);
+
+double axpyAndNorm2(EigenVector& y, double const a, EigenVector const& x);
+
+void weightedMatrixSum(double const a, EigenMatrix const& M,
+                       EigenMatrix const& K, EigenMatrix& A);
+
 void finalizeAssembly(EigenMatrix& A);
 
 } // namespace LinAlg
@@ -20,8 +20,11 @@
 
 #include <logog/include/logog.hpp>
 
+#include "BaseLib/ConfigTree.h"
+
 #include "LisCheck.h"
 #include "LisMatrix.h"
+#include "LisTwoLevelSolver.h"
 #include "LisVector.h"
 
 namespace MathLib
@@ -32,10 +35,34 @@ LisLinearSolver::LisLinearSolver(
                     const BaseLib::ConfigTree* const option)
 : _lis_option(option)
 {
+    if (option == nullptr)
+        return;
+    //! \ogs_file_param{prj__linear_solvers__linear_solver__lis_two_level}
+    if (auto config = option->getConfigSubtreeOptional("lis_two_level"))
+    {
+        _use_two_level = true;
+        //! \ogs_file_param{prj__linear_solvers__linear_solver__lis_two_level__smoother}
+        if (auto s = config->getConfigParameterOptional<std::string>("smoother"))
+            _two_level_smoother_options = *s;
+        //! \ogs_file_param{prj__linear_solvers__linear_solver__lis_two_level__error_tolerance}
+        if (auto t = config->getConfigParameterOptional<double>("error_tolerance"))
+            _two_level_tolerance = *t;
+        //! \ogs_file_param{prj__linear_solvers__linear_solver__lis_two_level__max_cycles}
+        if (auto c = config->getConfigParameterOptional<unsigned>("max_cycles"))
+            _two_level_max_cycles = *c;
+    }
 }
 
 bool LisLinearSolver::solve(LisMatrix &A, LisVector &b, LisVector &x)
 {
+    if (_use_two_level)
+    {
+        LisTwoLevelSolver const two_level(_two_level_smoother_options,
+                                          _two_level_tolerance,
+                                          _two_level_max_cycles);
+        return two_level.solve(A, b, x);
+    }
+
     finalizeMatrixAssembly(A);
 
     INFO("------------------------------------------------------------------");
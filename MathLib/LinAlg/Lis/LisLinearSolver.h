@@ -57,6 +57,14 @@ public:
 
 private:
     LisOption _lis_option;
+
+    //! Two-level (coarse correction plus Lis smoother) mode,
+    //! cf. LisTwoLevelSolver and the <lis_two_level> configuration.
+    bool _use_two_level = false;
+    std::string _two_level_smoother_options =
+        "-i gs -maxiter 2 -p none -tol 1e-16";
+    double _two_level_tolerance = 1e-10;
+    unsigned _two_level_max_cycles = 200;
 };
 
 } // MathLib
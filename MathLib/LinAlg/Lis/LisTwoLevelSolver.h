@@ -0,0 +1,66 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <string>
+
+namespace MathLib
+{
+class LisMatrix;
+class LisVector;
+
+/*! Two-level solve for the Lis backend: an aggregation-based coarse-space
+ * correction wrapped around a Lis smoother.
+ *
+ * Lis's built-in preconditioners (ILU and friends) are one-level, so the
+ * iteration counts of Poisson-like systems grow with the resolution and the
+ * backend stops scaling beyond a few million unknowns. This solver runs a
+ * defect-correction iteration: each cycle applies one V-cycle of the
+ * smoothed-aggregation hierarchy (built once per matrix from the assembled
+ * CSR data---the same algebraic coarsening as the Eigen backend's AMG
+ * preconditioner, which keeps the coarse space mesh-independent) followed
+ * by a few Lis smoother sweeps, until the relative residual meets the
+ * tolerance. The coarse space is built algebraically from the matrix graph
+ * rather than from generated coarse meshes: the hierarchy then exists for
+ * every mesh the solver sees, not only for meshes with a generator-provided
+ * coarsening.
+ *
+ * Enabled through the <lis_two_level> tag of the linear solver
+ * configuration, cf. LisLinearSolver.
+ */
+class LisTwoLevelSolver final
+{
+public:
+    /*! \param smoother_options  Lis option string of the smoother solves
+     *                           (default: two Gauss-Seidel sweeps).
+     *  \param tolerance         relative residual tolerance of the outer
+     *                           defect correction.
+     *  \param max_cycles        outer iteration limit.
+     */
+    explicit LisTwoLevelSolver(
+        std::string smoother_options = "-i gs -maxiter 2 -p none -tol 1e-16",
+        double const tolerance = 1e-10,
+        unsigned const max_cycles = 200)
+        : _smoother_options(std::move(smoother_options)),
+          _tolerance(tolerance),
+          _max_cycles(max_cycles)
+    {
+    }
+
+    /// Solves A x = b; returns true if the tolerance was reached.
+    bool solve(LisMatrix& A, LisVector& b, LisVector& x) const;
+
+private:
+    std::string const _smoother_options;
+    double const _tolerance;
+    unsigned const _max_cycles;
+};
+
+}  // namespace MathLib
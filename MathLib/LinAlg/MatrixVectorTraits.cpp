@@ -7,6 +7,8 @@
  *
  */
 
+#include <vector>
+
 #include "MatrixVectorTraits.h"
 #include "MatrixSpecifications.h"
 
@@ -40,17 +42,34 @@ newInstance(MatrixSpecifications const& spec)
 
     if (spec.sparsity_pattern)
     {
-        // Assert that the misuse of the sparsity pattern is consistent.
-        assert(spec.sparsity_pattern->size() == 1);
-
-        auto const max_nonzeroes = spec.sparsity_pattern->front();
+        if (spec.sparsity_pattern->size() == 1)
+        {
+            // Scalar upper bound (legacy form of the pattern).
+            auto const max_nonzeroes = spec.sparsity_pattern->front();
+
+            PETScMatrixOption mat_opt;
+            mat_opt.d_nz = max_nonzeroes;
+            mat_opt.o_nz = max_nonzeroes;
+            mat_opt.is_global_size = false;
+            return std::unique_ptr<PETScMatrix>(
+                new PETScMatrix(nrows, ncols, mat_opt));
+        }
+
+        // Exact per-row counts: d_nnz of all local rows followed by o_nnz,
+        // cf. computeSparsityPatternPETSc().
+        assert(spec.sparsity_pattern->size() == 2 * nrows);
+        auto const& pattern = *spec.sparsity_pattern;
+        std::vector<PetscInt> d_nnz(nrows), o_nnz(nrows);
+        for (std::size_t i = 0; i < nrows; ++i)
+        {
+            d_nnz[i] = static_cast<PetscInt>(pattern[i]);
+            o_nnz[i] = static_cast<PetscInt>(pattern[nrows + i]);
+        }
 
         PETScMatrixOption mat_opt;
-        mat_opt.d_nz = max_nonzeroes;
-        mat_opt.o_nz = max_nonzeroes;
         mat_opt.is_global_size = false;
         return std::unique_ptr<PETScMatrix>(
-            new PETScMatrix(nrows, ncols, mat_opt));
+            new PETScMatrix(nrows, ncols, mat_opt, d_nnz, o_nnz));
     }
     else
         return std::unique_ptr<PETScMatrix>(
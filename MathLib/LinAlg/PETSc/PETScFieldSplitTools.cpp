@@ -0,0 +1,44 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "PETScFieldSplitTools.h"
+
+#include <cassert>
+
+namespace MathLib
+{
+
+void applyFieldSplit(
+    KSP solver,
+    std::vector<std::string> const& component_names,
+    std::vector<std::vector<PetscInt>> const& component_index_sets)
+{
+    assert(component_names.size() == component_index_sets.size());
+
+    PC pc;
+    KSPGetPC(solver, &pc);
+    PCSetType(pc, PCFIELDSPLIT);
+
+    for (std::size_t field = 0; field < component_index_sets.size(); ++field)
+    {
+        auto const& indices = component_index_sets[field];
+        IS index_set;
+        ISCreateGeneral(PETSC_COMM_WORLD,
+                        static_cast<PetscInt>(indices.size()),
+                        indices.data(), PETSC_COPY_VALUES, &index_set);
+        PCFieldSplitSetIS(pc, component_names[field].c_str(), index_set);
+        ISDestroy(&index_set);
+    }
+
+    // The split type and sub-solvers come from the options database
+    // (-pc_fieldsplit_*, -fieldsplit_<name>_*).
+    PCSetFromOptions(pc);
+}
+
+}  // namespace MathLib
@@ -0,0 +1,41 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include <petscksp.h>
+
+namespace MathLib
+{
+
+/*!
+  Configures PCFIELDSPLIT on the given KSP's preconditioner from
+  per-component global index sets.
+
+  \param solver           the KSP whose PC is turned into a field split.
+  \param component_names  one name per field (used for the -fieldsplit_<name>
+                          option namespaces).
+  \param component_index_sets one vector of global DOF indices per field,
+                          e.g. the per-component indices collected with
+                          NumLib::getComponentIndices() from the
+                          LocalToGlobalIndexMap.
+
+  The split type (additive, multiplicative, Schur) and the sub-solvers are
+  configured through the usual -pc_fieldsplit_* / -fieldsplit_<name>_*
+  options, i.e., via the solver's <parameters> or a profile.
+*/
+void applyFieldSplit(
+    KSP solver,
+    std::vector<std::string> const& component_names,
+    std::vector<std::vector<PetscInt>> const& component_index_sets);
+
+}  // namespace MathLib
@@ -47,8 +47,28 @@ PETScLinearSolver::PETScLinearSolver(const std::string /*prefix*/,
                 if (!pre->empty())
                     prefix = *pre + "_";
             }
+
+            //! \ogs_file_param{prj__linear_solvers__linear_solver__petsc__profiles}
+            if (auto const profiles =
+                    subtree->getConfigSubtreeOptional("profiles"))
+            {
+                //! \ogs_file_param{prj__linear_solvers__linear_solver__petsc__profiles__profile}
+                for (auto profile :
+                     profiles->getConfigSubtreeList("profile"))
+                {
+                    auto const name =
+                        //! \ogs_file_param{prj__linear_solvers__linear_solver__petsc__profiles__profile__name}
+                        profile.getConfigParameter<std::string>("name");
+                    auto const parameters =
+                        //! \ogs_file_param{prj__linear_solvers__linear_solver__petsc__profiles__profile__parameters}
+                        profile.getConfigParameter<std::string>(
+                            "parameters");
+                    _profiles[name] = parameters;
+                }
+            }
         }
     }
+    _prefix = prefix;
 #if PETSC_VERSION_LT(3,7,0)
     PetscOptionsInsertString(petsc_options.c_str());
 #else
@@ -66,6 +86,26 @@ PETScLinearSolver::PETScLinearSolver(const std::string /*prefix*/,
     KSPSetFromOptions(_solver); // set running time option
 }
 
+void PETScLinearSolver::setProfile(std::string const& name)
+{
+    auto const it = _profiles.find(name);
+    if (it == _profiles.end())
+    {
+        ERR("PETSc solver profile `%s' has not been configured.",
+            name.c_str());
+        return;
+    }
+
+#if PETSC_VERSION_LT(3,7,0)
+    PetscOptionsInsertString(it->second.c_str());
+#else
+    PetscOptionsInsertString(nullptr, it->second.c_str());
+#endif
+    if (!_prefix.empty())
+        KSPSetOptionsPrefix(_solver, _prefix.c_str());
+    KSPSetFromOptions(_solver);
+}
+
 bool PETScLinearSolver::solve(PETScMatrix& A, PETScVector &b, PETScVector &x)
 {
     BaseLib::RunTime wtimer;
@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <map>
+
 #include<string>
 
 #include <petscksp.h>
@@ -60,6 +62,21 @@ class PETScLinearSolver
         // TODO check if some args in LinearSolver interface can be made const&.
         bool solve(PETScMatrix& A, PETScVector &b, PETScVector &x);
 
+        /*!
+            Switches to the named solver profile (parsed from the optional
+            <profiles> subtree of the petsc configuration): the profile's
+            options are inserted into the options database and the KSP is
+            reconfigured. Use it, e.g., to run a cheap solver early in a
+            transient and a strong one near steady state. Unknown names are
+            reported and ignored.
+        */
+        void setProfile(std::string const& name);
+
+        /// The wrapped KSP; used, e.g., by
+        /// MathLib::applyFieldSplit() to register component index sets for
+        /// PCFIELDSPLIT preconditioning of coupled systems.
+        KSP getKSP() const { return _solver; }
+
         /// Get number of iterations.
         PetscInt getNumberOfIterations() const
         {
@@ -76,7 +93,12 @@ class PETScLinearSolver
 
     private:
         KSP _solver; ///< Solver type.
-        PC _pc;      ///< Preconditioner type.
+        PC _pc;
+
+        /// Named option profiles, cf. setProfile().
+        std::map<std::string, std::string> _profiles;
+        /// Options prefix of this solver instance.
+        std::string _prefix;      ///< Preconditioner type.
 
         double _elapsed_ctime = 0.0; ///< Clock time
 };
@@ -48,6 +48,24 @@ PETScMatrix::PETScMatrix (const PetscInt nrows, const PetscInt ncols, const PETS
     create(mat_opt.d_nz, mat_opt.o_nz);
 }
 
+PETScMatrix::PETScMatrix(const PetscInt nrows, const PetscInt ncols,
+                         const PETScMatrixOption &mat_opt,
+                         std::vector<PetscInt> const& d_nnz,
+                         std::vector<PetscInt> const& o_nnz)
+    :_nrows(nrows), _ncols(ncols), _n_loc_rows(PETSC_DECIDE),
+     _n_loc_cols(mat_opt.n_local_cols)
+{
+    if(!mat_opt.is_global_size)
+    {
+        _nrows = PETSC_DECIDE;
+        _ncols = PETSC_DECIDE;
+        _n_loc_rows = nrows;
+        _n_loc_cols = ncols;
+    }
+
+    create(d_nnz, o_nnz);
+}
+
 PETScMatrix::PETScMatrix(const PETScMatrix &A)
     : _nrows(A._nrows)
     , _ncols(A._ncols)
@@ -122,6 +140,26 @@ void PETScMatrix::viewer(const std::string &file_name, const PetscViewerFormat v
 
 }
 
+void PETScMatrix::create(std::vector<PetscInt> const& d_nnz,
+                         std::vector<PetscInt> const& o_nnz)
+{
+    MatCreate(PETSC_COMM_WORLD, &_A);
+    MatSetSizes(_A, _n_loc_rows, _n_loc_cols, _nrows, _ncols);
+
+    MatSetFromOptions(_A);
+
+    MatSetType(_A, MATMPIAIJ);
+    // Exact per-row preallocation derived from the computed sparsity
+    // pattern; no scalar fallback, so the guesswork (and the
+    // malloc-per-insert of wrong guesses) is gone.
+    MatSeqAIJSetPreallocation(_A, 0, d_nnz.data());
+    MatMPIAIJSetPreallocation(_A, 0, d_nnz.data(), 0, o_nnz.data());
+
+    MatGetOwnershipRange(_A, &_start_rank, &_end_rank);
+    MatGetSize(_A, &_nrows,  &_ncols);
+    MatGetLocalSize(_A, &_n_loc_rows, &_n_loc_cols);
+}
+
 void PETScMatrix::create(const PetscInt d_nz, const PetscInt o_nz)
 {
     MatCreate(PETSC_COMM_WORLD, &_A);
@@ -51,6 +51,23 @@ class PETScMatrix
           \param ncols  The number of global or local columns.
           \param mat_op The configuration information for creating a matrix.
         */
+        /*!
+          \brief Constructor with exact per-row preallocation.
+          \param nrows   number of local rows (is_global_size must be false).
+          \param ncols   number of local columns.
+          \param mat_opt basic options; d_nz/o_nz are ignored.
+          \param d_nnz   per-row nonzero counts of the diagonal block.
+          \param o_nnz   per-row nonzero counts of the off-diagonal block.
+
+          Exact counts derived from the computed sparsity pattern make the
+          first assembly as fast as the subsequent ones; wrong scalar
+          guesses previously caused malloc-per-insert storms.
+        */
+        PETScMatrix(const PetscInt nrows, const PetscInt ncols,
+                    const PETScMatrixOption &mat_opt,
+                    std::vector<PetscInt> const& d_nnz,
+                    std::vector<PetscInt> const& o_nnz);
+
         PETScMatrix(const PetscInt nrows, const PetscInt ncols,
                     const PETScMatrixOption &mat_op = PETScMatrixOption() );
 
@@ -257,6 +274,11 @@ class PETScMatrix
         */
         void create(const PetscInt d_nz, const PetscInt o_nz);
 
+        /// Creates the matrix with exact per-row preallocation,
+        /// cf. the array constructor.
+        void create(std::vector<PetscInt> const& d_nnz,
+                    std::vector<PetscInt> const& o_nnz);
+
         friend bool finalizeMatrixAssembly(PETScMatrix &mat, const MatAssemblyType asm_type);
 };
 
@@ -103,6 +103,18 @@ void PETScVector::finalizeAssembly()
     VecAssemblyEnd(_v);
 }
 
+void PETScVector::beginGhostUpdate()
+{
+    if (_has_ghost_id)
+        VecGhostUpdateBegin(_v, INSERT_VALUES, SCATTER_FORWARD);
+}
+
+void PETScVector::endGhostUpdate()
+{
+    if (_has_ghost_id)
+        VecGhostUpdateEnd(_v, INSERT_VALUES, SCATTER_FORWARD);
+}
+
 void PETScVector::gatherLocalVectors( PetscScalar local_array[],
                                       PetscScalar global_array[])
 {
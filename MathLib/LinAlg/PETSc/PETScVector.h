@@ -79,6 +79,17 @@ class PETScVector
         /// Perform MPI collection of assembled entries in buffer
         void finalizeAssembly();
 
+        /*!
+          Split-phase ghost update: beginGhostUpdate() posts the neighbor
+          exchange, endGhostUpdate() completes it. Callers overlap interior
+          work between the two calls---assemble interior elements while the
+          ghost data for the boundary elements is in flight---instead of
+          paying the synchronous update inside getLocalVector(). No-ops for
+          vectors without ghost entries.
+        */
+        void beginGhostUpdate();
+        void endGhostUpdate();
+
         /// Get the global size of the vector
         PetscInt size() const
         {
@@ -164,6 +175,17 @@ class PETScVector
             return local_x;
         }
 
+        //! Get several entries into the given buffer, which is resized as
+        //! needed. Does not allocate once the buffer has reached its final
+        //! size.
+        void get(std::vector<IndexType> const& indices,
+                 std::vector<double>& local_x) const
+        {
+            local_x.resize(indices.size());
+
+            VecGetValues(_v, indices.size(), indices.data(), local_x.data());
+        }
+
         // TODO preliminary
         double operator[] (PetscInt idx) const
         {
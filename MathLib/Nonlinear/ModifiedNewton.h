@@ -0,0 +1,179 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <boost/optional.hpp>
+#include <logog/include/logog.hpp>
+
+#include <Eigen/Dense>
+
+namespace MathLib
+{
+namespace Nonlinear
+{
+
+/// Options of the small-system Newton solver, cf. ModifiedNewton.
+struct NewtonOptions
+{
+    NewtonOptions(int const maximum_iterations_, double const tolerance_)
+        : maximum_iterations(maximum_iterations_), tolerance(tolerance_)
+    {
+    }
+
+    int maximum_iterations;
+    double tolerance;
+
+    /// Refresh (and refactorize) the Jacobian every n-th iteration only; 1
+    /// is full Newton, larger values reuse the frozen Jacobian and its
+    /// decomposition in between.
+    int jacobian_refresh_interval = 1;
+
+    /// Backtracking line search: halve the increment (up to 5 times) while
+    /// the residual norm grows. Off by default---the local problems of the
+    /// material models usually converge undamped, and damping changes
+    /// iteration counts.
+    bool line_search = false;
+
+    /// Row equilibration of the Jacobian before factorization; helps
+    /// decompositions without internal pivoting on badly scaled local
+    /// systems (e.g. mixed stress/strain unknowns).
+    bool scaling = false;
+};
+
+/*! Newton solver for small fixed-size Eigen systems with optional Jacobian
+ * reuse, scaling and line search.
+ *
+ * The callback interface is identical to NumLib::NewtonRaphson---jacobian,
+ * residual and solution are updated through the given functors, so the
+ * material models (Ehlers, Lubby2) share one implementation instead of
+ * re-implementing local Newton loops. With default options
+ * (jacobian_refresh_interval 1, no line search, no scaling) the iteration
+ * behaves exactly like NumLib::NewtonRaphson.
+ *
+ * \note With Jacobian reuse the jacobian left in place after solve() is the
+ * last refreshed one, which is also the consistent choice for a tangent
+ * only when the interval is 1.
+ */
+template <typename LinearSolver, typename JacobianMatrix,
+          typename JacobianMatrixUpdate, typename ResidualVector,
+          typename ResidualUpdate, typename SolutionUpdate>
+class ModifiedNewton final
+{
+public:
+    ModifiedNewton(LinearSolver& linear_solver,
+                   JacobianMatrixUpdate jacobian_update,
+                   ResidualUpdate residual_update,
+                   SolutionUpdate solution_update,
+                   NewtonOptions const& options)
+        : _linear_solver(linear_solver),
+          _jacobian_update(jacobian_update),
+          _residual_update(residual_update),
+          _solution_update(solution_update),
+          _options(options)
+    {
+    }
+
+    /// Returns true and the iteration number if succeeded, otherwise false
+    /// and an undefined value for the number of iterations.
+    boost::optional<int> solve(JacobianMatrix& jacobian) const
+    {
+        double const tolerance_squared =
+            _options.tolerance * _options.tolerance;
+        int iteration = 0;
+        int iterations_since_refresh = 0;
+        bool jacobian_is_fresh = false;
+        ResidualVector increment;
+        ResidualVector residual;
+        ResidualVector scaling_factors;
+        do
+        {
+            bool const refresh =
+                iteration == 0 ||
+                iterations_since_refresh >=
+                    _options.jacobian_refresh_interval;
+            if (refresh)
+            {
+                _jacobian_update(jacobian);
+                if (_options.scaling)
+                {
+                    // Row equilibration: D^{-1} J dx = D^{-1} (-r).
+                    scaling_factors =
+                        jacobian.cwiseAbs().rowwise().maxCoeff();
+                    for (int i = 0; i < scaling_factors.rows(); ++i)
+                        if (scaling_factors[i] == 0.0)
+                            scaling_factors[i] = 1.0;
+                    _linear_solver.compute(
+                        scaling_factors.asDiagonal().inverse() * jacobian);
+                }
+                else
+                    _linear_solver.compute(jacobian);
+                iterations_since_refresh = 0;
+                jacobian_is_fresh = true;
+            }
+            _residual_update(residual);
+
+            if (residual.squaredNorm() < tolerance_squared)
+                break;  // convergence criteria fulfilled.
+
+            if (_options.scaling)
+                increment.noalias() = _linear_solver.solve(
+                    -(scaling_factors.asDiagonal().inverse() * residual)
+                         .eval());
+            else
+                increment.noalias() = _linear_solver.solve(-residual);
+
+            _solution_update(increment);
+
+            if (_options.line_search)
+            {
+                double const residual_norm_before = residual.squaredNorm();
+                double step = 1.0;
+                for (int backtrack = 0; backtrack < 5; ++backtrack)
+                {
+                    _residual_update(residual);
+                    if (residual.squaredNorm() <= residual_norm_before)
+                        break;
+                    // Halve the applied increment: subtract step/2.
+                    step /= 2.0;
+                    _solution_update(-step * increment);
+                }
+            }
+
+            ++iterations_since_refresh;
+            jacobian_is_fresh = false;
+        } while (iteration++ < _options.maximum_iterations);
+
+        if (iteration > _options.maximum_iterations)
+        {
+            ERR("The local Newton method did not converge within the given "
+                "number of iterations. Iteration: %d, increment %g, residual: "
+                "%g",
+                iteration - 1, increment.norm(), residual.norm());
+            return {};
+        }
+
+        // Leave a consistent Jacobian behind for callers using it as the
+        // tangent, cf. the class documentation.
+        if (!jacobian_is_fresh && _options.jacobian_refresh_interval > 1)
+            _jacobian_update(jacobian);
+
+        return iteration;
+    };
+
+private:
+    LinearSolver& _linear_solver;
+    JacobianMatrixUpdate _jacobian_update;
+    ResidualUpdate _residual_update;
+    SolutionUpdate _solution_update;
+    NewtonOptions const _options;
+};
+
+}  // namespace Nonlinear
+}  // namespace MathLib
@@ -0,0 +1,263 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+namespace MathLib
+{
+namespace ODE
+{
+
+/*! Integrates a batch of independent small ODE systems with one solver
+ * object.
+ *
+ * TES-style usage needs an independent \c NumEquations -sized ODE at every
+ * integration point; instantiating one CVodeSolver per point is impossible
+ * at millions of points. This engine holds the states of all systems in SoA
+ * layout (component \c c of system \c i at index \c c*n+i), evaluates the
+ * right-hand side with one batched callback per Runge-Kutta stage---a plain
+ * loop over contiguous arrays the compiler can vectorize---and still adapts
+ * the step size per system with the embedded Cash-Karp 4(5) error estimate,
+ * so one stiff reaction point cannot throttle the whole batch (each system
+ * sub-steps at its own pace within solve()).
+ *
+ * Compared with the CVodeSolver this trades BDF stiffness robustness for
+ * batching; it fits the many-small-moderately-stiff regime of per-point
+ * reaction kinetics. It is self-contained (no external library), so it is
+ * always available from createBatchedODESolver().
+ */
+template <unsigned NumEquations>
+class BatchedODESolver final
+{
+public:
+    /*! Right-hand side of all systems.
+     *
+     * \param t  per-system times, length n.
+     * \param y  SoA state, component \c c of system \c i at \c y[c*n+i].
+     * \param ydot  SoA derivative to fill, same layout.
+     * \param n  number of systems.
+     */
+    using BatchedFunction = std::function<void(
+        double const* t, double const* y, double* ydot, std::size_t n)>;
+
+    explicit BatchedODESolver(std::size_t const n_systems)
+        : _n(n_systems),
+          _t(n_systems, 0.0),
+          _h(n_systems, 0.0),
+          _y(NumEquations * n_systems, 0.0)
+    {
+    }
+
+    void setFunction(BatchedFunction f) { _f = std::move(f); }
+
+    void setTolerance(double const abstol, double const reltol)
+    {
+        _abstol = abstol;
+        _reltol = reltol;
+    }
+
+    //! Sets the initial condition of all systems; \c y0 in SoA layout.
+    void setIC(double const t0, std::vector<double> const& y0)
+    {
+        assert(y0.size() == _y.size());
+        std::fill(_t.begin(), _t.end(), t0);
+        std::fill(_h.begin(), _h.end(), 0.0);  // chosen on first solve()
+        _y = y0;
+    }
+
+    std::size_t getNumberOfSystems() const { return _n; }
+    unsigned getNumberOfEquations() const { return NumEquations; }
+
+    //! SoA solution state, cf. BatchedFunction.
+    std::vector<double> const& getSolution() const { return _y; }
+
+    /*! Advances all systems to time \c t.
+     *
+     * Returns false if any system failed to reach \c t within the
+     * per-system step limit.
+     */
+    bool solve(double const t)
+    {
+        std::size_t const n = _n;
+        double const initial_h = [&]() {
+            double span = 0.0;
+            for (std::size_t i = 0; i < n; ++i)
+                span = std::max(span, t - _t[i]);
+            return span / 16.0;
+        }();
+
+        for (std::size_t i = 0; i < n; ++i)
+            if (_h[i] <= 0.0)
+                _h[i] = initial_h;
+
+        resizeWork();
+
+        unsigned const max_rounds = 10000;
+        for (unsigned round = 0; round < max_rounds; ++round)
+        {
+            bool any_active = false;
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                _active[i] = _t[i] < t;
+                any_active = any_active || _active[i] != 0;
+                // Do not step past the target.
+                if (_active[i])
+                    _h_round[i] = std::min(_h[i], t - _t[i]);
+                else
+                    _h_round[i] = 0.0;
+            }
+            if (!any_active)
+                return true;
+
+            // Six Cash-Karp stages, each one batched RHS evaluation. The
+            // finished systems ride along with h = 0 (their stage inputs
+            // equal their state; the result is discarded).
+            for (unsigned stage = 0; stage < 6; ++stage)
+            {
+                for (std::size_t i = 0; i < n; ++i)
+                    _t_stage[i] = _t[i] + a(stage) * _h_round[i];
+                for (unsigned c = 0; c < NumEquations; ++c)
+                {
+                    double* y_stage = &_y_stage[c * n];
+                    double const* y = &_y[c * n];
+                    for (std::size_t i = 0; i < n; ++i)
+                    {
+                        double increment = 0.0;
+                        for (unsigned prev = 0; prev < stage; ++prev)
+                            increment += b(stage, prev) * _k[prev][c * n + i];
+                        y_stage[i] = y[i] + _h_round[i] * increment;
+                    }
+                }
+                _f(_t_stage.data(), _y_stage.data(), _k[stage].data(), n);
+            }
+
+            // Fifth-order solution and embedded error, accept/reject and
+            // new step size per system.
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                if (!_active[i])
+                    continue;
+
+                double error = 0.0;
+                for (unsigned c = 0; c < NumEquations; ++c)
+                {
+                    double y5 = 0.0, y_err = 0.0;
+                    for (unsigned stage = 0; stage < 6; ++stage)
+                    {
+                        double const k = _k[stage][c * n + i];
+                        y5 += c5(stage) * k;
+                        y_err += (c5(stage) - c4(stage)) * k;
+                    }
+                    double const y_new =
+                        _y[c * n + i] + _h_round[i] * y5;
+                    _y_new[c * n + i] = y_new;
+                    double const tolerance =
+                        _abstol + _reltol * std::max(std::abs(_y[c * n + i]),
+                                                     std::abs(y_new));
+                    error = std::max(
+                        error, std::abs(_h_round[i] * y_err) / tolerance);
+                }
+
+                if (error <= 1.0)
+                {
+                    // accept
+                    _t[i] += _h_round[i];
+                    for (unsigned c = 0; c < NumEquations; ++c)
+                        _y[c * n + i] = _y_new[c * n + i];
+                    double const grow =
+                        error > 0.0
+                            ? 0.9 * std::pow(error, -0.2)
+                            : 5.0;
+                    _h[i] = _h_round[i] * std::min(5.0, std::max(1.0, grow));
+                }
+                else
+                {
+                    // reject, retry with a smaller step
+                    _h[i] =
+                        _h_round[i] * std::max(0.1, 0.9 * std::pow(error, -0.25));
+                }
+            }
+        }
+
+        return false;  // step limit exceeded
+    }
+
+private:
+    void resizeWork()
+    {
+        _active.resize(_n);
+        _h_round.resize(_n);
+        _t_stage.resize(_n);
+        _y_stage.resize(NumEquations * _n);
+        _y_new.resize(NumEquations * _n);
+        for (auto& k : _k)
+            k.resize(NumEquations * _n);
+    }
+
+    // Cash-Karp tableau.
+    static double a(unsigned const stage)
+    {
+        constexpr double values[6] = {0.0,       0.2, 0.3, 0.6, 1.0,
+                                      7.0 / 8.0};
+        return values[stage];
+    }
+    static double b(unsigned const stage, unsigned const prev)
+    {
+        static double const values[6][5] = {
+            {0, 0, 0, 0, 0},
+            {0.2, 0, 0, 0, 0},
+            {3.0 / 40.0, 9.0 / 40.0, 0, 0, 0},
+            {0.3, -0.9, 1.2, 0, 0},
+            {-11.0 / 54.0, 2.5, -70.0 / 27.0, 35.0 / 27.0, 0},
+            {1631.0 / 55296.0, 175.0 / 512.0, 575.0 / 13824.0,
+             44275.0 / 110592.0, 253.0 / 4096.0}};
+        return values[stage][prev];
+    }
+    static double c5(unsigned const stage)
+    {
+        static double const values[6] = {37.0 / 378.0,  0.0, 250.0 / 621.0,
+                                         125.0 / 594.0, 0.0, 512.0 / 1771.0};
+        return values[stage];
+    }
+    static double c4(unsigned const stage)
+    {
+        static double const values[6] = {
+            2825.0 / 27648.0, 0.0,           18575.0 / 48384.0,
+            13525.0 / 55296.0, 277.0 / 14336.0, 0.25};
+        return values[stage];
+    }
+
+    std::size_t const _n;
+    BatchedFunction _f;
+    double _abstol = 1e-8;
+    double _reltol = 1e-6;
+
+    std::vector<double> _t;  //!< per-system current time
+    std::vector<double> _h;  //!< per-system step size
+    std::vector<double> _y;  //!< SoA state
+
+    // Work arrays, allocated once.
+    std::vector<char> _active;
+    std::vector<double> _h_round;
+    std::vector<double> _t_stage;
+    std::vector<double> _y_stage;
+    std::vector<double> _y_new;
+    std::array<std::vector<double>, 6> _k;
+};
+
+}  // namespace ODE
+}  // namespace MathLib
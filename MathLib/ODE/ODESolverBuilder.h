@@ -11,7 +11,9 @@
 
 #include <logog/include/logog.hpp>
 
+#include "BaseLib/ConfigTree.h"
 #include "BaseLib/Error.h"
+#include "BatchedODESolver.h"
 #include "ODESolver.h"
 #include "ConcreteODESolver.h"
 
@@ -50,6 +52,26 @@ std::unique_ptr<ODESolver<NumEquations>> createODESolver(
         " OGS6 with support for any external ODE solver library.");
 }
 
+/*! Creates a batched ODE solver integrating \c n_systems independent
+ * systems of \c NumEquations equations each, cf. BatchedODESolver.
+ *
+ * Always available (no external library involved). Tolerances are read
+ * from the optional <abstol> and <reltol> tags of \c config.
+ */
+template <unsigned NumEquations>
+std::unique_ptr<BatchedODESolver<NumEquations>> createBatchedODESolver(
+    BaseLib::ConfigTree const& config, std::size_t const n_systems)
+{
+    std::unique_ptr<BatchedODESolver<NumEquations>> solver(
+        new BatchedODESolver<NumEquations>(n_systems));
+    //! \ogs_file_param{ode_solver__abstol}
+    auto const abstol = config.getConfigParameterOptional<double>("abstol");
+    //! \ogs_file_param{ode_solver__reltol}
+    auto const reltol = config.getConfigParameterOptional<double>("reltol");
+    solver->setTolerance(abstol ? *abstol : 1e-8, reltol ? *reltol : 1e-6);
+    return solver;
+}
+
 //! @}
 
 }  // namespace ODE
@@ -25,6 +25,23 @@
 
 namespace MeshGeoToolsLib
 {
+std::vector<std::unique_ptr<BoundaryElementsSearcher>>
+    BoundaryElementsSearcher::_boundary_elements_searchers;
+
+BoundaryElementsSearcher& BoundaryElementsSearcher::getBoundaryElementsSearcher(
+    MeshLib::Mesh const& mesh, MeshNodeSearcher& mshNodeSearcher)
+{
+    std::size_t const mesh_id = mesh.getID();
+    if (_boundary_elements_searchers.size() < mesh_id + 1)
+        _boundary_elements_searchers.resize(mesh_id + 1);
+
+    if (!_boundary_elements_searchers[mesh_id])
+        _boundary_elements_searchers[mesh_id].reset(
+            new BoundaryElementsSearcher(mesh, mshNodeSearcher));
+
+    return *_boundary_elements_searchers[mesh_id];
+}
+
 
 BoundaryElementsSearcher::BoundaryElementsSearcher(MeshLib::Mesh const& mesh, MeshNodeSearcher &mshNodeSearcher) : _mesh(mesh), _mshNodeSearcher(mshNodeSearcher)
 {}
@@ -7,6 +7,8 @@
  */
 #pragma once
 
+#include <memory>
+
 #include <vector>
 
 namespace GeoLib
@@ -47,6 +49,16 @@ public:
     /// destructor
     virtual ~BoundaryElementsSearcher();
 
+    /// Returns the shared searcher of the given mesh (constructed on first
+    /// use), mirroring MeshNodeSearcher::getMeshNodeSearcher().
+    ///
+    /// All boundary conditions of a mesh thereby share one searcher and its
+    /// per-geometry-object association caches, so the search cost scales
+    /// with the number of distinct geometries instead of the number of
+    /// boundary conditions.
+    static BoundaryElementsSearcher& getBoundaryElementsSearcher(
+        MeshLib::Mesh const& mesh, MeshNodeSearcher& mshNodeSearcher);
+
     /**
      * generate boundary elements on the given geometric object (point, polyline, surface).
      *
@@ -83,6 +95,10 @@ private:
     std::vector<BoundaryElementsAtPoint*> _boundary_elements_at_point;
     std::vector<BoundaryElementsAlongPolyline*> _boundary_elements_along_polylines;
     std::vector<BoundaryElementsOnSurface*> _boundary_elements_along_surfaces;
+
+    /// Mesh-id-indexed shared searchers, cf. getBoundaryElementsSearcher().
+    static std::vector<std::unique_ptr<BoundaryElementsSearcher>>
+        _boundary_elements_searchers;
 };
 
 } // end namespace MeshGeoToolsLib
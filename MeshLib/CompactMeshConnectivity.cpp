@@ -0,0 +1,55 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "CompactMeshConnectivity.h"
+
+#include "Elements/Element.h"
+#include "Mesh.h"
+#include "Node.h"
+
+namespace MeshLib
+{
+
+CompactMeshConnectivity::CompactMeshConnectivity(Mesh const& mesh)
+{
+    auto const& elements = mesh.getElements();
+    auto const& nodes = mesh.getNodes();
+
+    // element -> node CSR.
+    _element_offsets.resize(elements.size() + 1, 0);
+    for (std::size_t e = 0; e < elements.size(); ++e)
+        _element_offsets[e + 1] =
+            _element_offsets[e] + elements[e]->getNumberOfNodes();
+
+    _element_nodes.resize(_element_offsets.back());
+    for (std::size_t e = 0; e < elements.size(); ++e) {
+        auto const* element = elements[e];
+        auto* out = _element_nodes.data() + _element_offsets[e];
+        for (unsigned i = 0; i < element->getNumberOfNodes(); ++i)
+            out[i] = element->getNodeIndex(i);
+    }
+
+    // node -> element CSR; counting pass plus fill pass.
+    _node_offsets.resize(nodes.size() + 1, 0);
+    for (auto const& node_ids_begin : _element_nodes)
+        ++_node_offsets[node_ids_begin + 1];
+    for (std::size_t n = 0; n < nodes.size(); ++n)
+        _node_offsets[n + 1] += _node_offsets[n];
+
+    _node_elements.resize(_node_offsets.back());
+    std::vector<std::size_t> fill_position(_node_offsets.begin(),
+                                           _node_offsets.end() - 1);
+    for (std::size_t e = 0; e < elements.size(); ++e) {
+        for (auto const* it = getElementNodesBegin(e);
+             it != getElementNodesEnd(e); ++it)
+            _node_elements[fill_position[*it]++] = e;
+    }
+}
+
+}  // namespace MeshLib
@@ -0,0 +1,78 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace MeshLib
+{
+
+class Mesh;
+
+/// Index-based CSR storage of the element--node and node--element
+/// connectivity of a mesh.
+///
+/// The two offset/index array pairs replace the per-element Node* arrays and
+/// the per-node std::vector<Element*> for iteration-heavy consumers: a sweep
+/// over the connectivity reads two contiguous integer arrays instead of
+/// chasing one heap pointer per incidence. The Element/Node based API of
+/// MeshLib::Mesh remains the primary representation; this class is a derived
+/// view built once from it.
+class CompactMeshConnectivity final
+{
+public:
+    explicit CompactMeshConnectivity(Mesh const& mesh);
+
+    /// Range of node ids of the given element.
+    std::size_t const* getElementNodesBegin(std::size_t const element_id) const
+    {
+        return _element_nodes.data() + _element_offsets[element_id];
+    }
+    std::size_t const* getElementNodesEnd(std::size_t const element_id) const
+    {
+        return _element_nodes.data() + _element_offsets[element_id + 1];
+    }
+    std::size_t getNumberOfElementNodes(std::size_t const element_id) const
+    {
+        return _element_offsets[element_id + 1] -
+               _element_offsets[element_id];
+    }
+
+    /// Range of element ids incident to the given node.
+    std::size_t const* getNodeElementsBegin(std::size_t const node_id) const
+    {
+        return _node_elements.data() + _node_offsets[node_id];
+    }
+    std::size_t const* getNodeElementsEnd(std::size_t const node_id) const
+    {
+        return _node_elements.data() + _node_offsets[node_id + 1];
+    }
+    std::size_t getNumberOfNodeElements(std::size_t const node_id) const
+    {
+        return _node_offsets[node_id + 1] - _node_offsets[node_id];
+    }
+
+    std::size_t getNumberOfElements() const
+    {
+        return _element_offsets.size() - 1;
+    }
+    std::size_t getNumberOfNodes() const { return _node_offsets.size() - 1; }
+
+private:
+    // element -> node CSR
+    std::vector<std::size_t> _element_offsets;
+    std::vector<std::size_t> _element_nodes;
+    // node -> element CSR
+    std::vector<std::size_t> _node_offsets;
+    std::vector<std::size_t> _node_elements;
+};
+
+}  // namespace MeshLib
@@ -0,0 +1,680 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "BinaryMeshIO.h"
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <vector>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <logog/include/logog.hpp>
+
+#include "BaseLib/FileTools.h"
+#include "MeshLib/Elements/Elements.h"
+#include "MeshLib/IO/readMeshFromFile.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/Node.h"
+
+namespace MeshLib
+{
+namespace IO
+{
+
+namespace
+{
+
+char const magic[8] = {'O', 'G', 'S', 'B', 'M', 'S', '0', '1'};
+
+enum class PropertyDataType : std::uint8_t
+{
+    Double = 0,
+    Float = 1,
+    Int = 2,
+    Unsigned = 3,
+    Long = 4,
+    Char = 5
+};
+
+template <typename T> struct PropertyTypeCode;
+template <> struct PropertyTypeCode<double>
+{ static const PropertyDataType value = PropertyDataType::Double; };
+template <> struct PropertyTypeCode<float>
+{ static const PropertyDataType value = PropertyDataType::Float; };
+template <> struct PropertyTypeCode<int>
+{ static const PropertyDataType value = PropertyDataType::Int; };
+template <> struct PropertyTypeCode<unsigned>
+{ static const PropertyDataType value = PropertyDataType::Unsigned; };
+template <> struct PropertyTypeCode<long>
+{ static const PropertyDataType value = PropertyDataType::Long; };
+template <> struct PropertyTypeCode<char>
+{ static const PropertyDataType value = PropertyDataType::Char; };
+
+template <typename T>
+void writeValue(std::ostream& os, T const value)
+{
+    os.write(reinterpret_cast<char const*>(&value), sizeof(T));
+}
+
+template <typename T>
+void writeArray(std::ostream& os, T const* data, std::size_t const n)
+{
+    os.write(reinterpret_cast<char const*>(data), n * sizeof(T));
+}
+
+/// Writes one property vector if it is of type T; returns true then.
+template <typename T>
+bool writePropertyVectorAs(std::ostream& os, Properties const& properties,
+                           std::string const& name)
+{
+    auto const* const property = properties.getPropertyVector<T>(name);
+    if (property == nullptr)
+        return false;
+
+    writeValue(os, static_cast<std::uint8_t>(PropertyTypeCode<T>::value));
+    writeValue(os,
+               static_cast<std::uint8_t>(property->getMeshItemType()));
+    writeValue(os,
+               static_cast<std::uint64_t>(property->getNumberOfComponents()));
+    writeValue(os, static_cast<std::uint64_t>(name.size()));
+    os.write(name.data(), name.size());
+    writeValue(os, static_cast<std::uint64_t>(property->size()));
+    writeArray(os, property->data(), property->size());
+    return true;
+}
+
+/// Creates a mesh element of the given cell type from the node pointer array;
+/// takes ownership of \c nodes.
+Element* createElement(CellType const cell_type, Node** nodes)
+{
+    switch (cell_type) {
+        case CellType::POINT1: return new Point(nodes);
+        case CellType::LINE2: return new Line(nodes);
+        case CellType::LINE3: return new Line3(nodes);
+        case CellType::TRI3: return new Tri(nodes);
+        case CellType::TRI6: return new Tri6(nodes);
+        case CellType::QUAD4: return new Quad(nodes);
+        case CellType::QUAD8: return new Quad8(nodes);
+        case CellType::QUAD9: return new Quad9(nodes);
+        case CellType::TET4: return new Tet(nodes);
+        case CellType::TET10: return new Tet10(nodes);
+        case CellType::HEX8: return new Hex(nodes);
+        case CellType::HEX20: return new Hex20(nodes);
+        case CellType::PRISM6: return new Prism(nodes);
+        case CellType::PRISM15: return new Prism15(nodes);
+        case CellType::PYRAMID5: return new Pyramid(nodes);
+        case CellType::PYRAMID13: return new Pyramid13(nodes);
+        default:
+            delete [] nodes;
+            ERR("Unsupported cell type in binary mesh file.");
+            return nullptr;
+    }
+}
+
+/// Read-only view of the file content; memory-mapped where available.
+class MappedFile final
+{
+public:
+    explicit MappedFile(std::string const& file_name)
+    {
+#ifndef _WIN32
+        _fd = open(file_name.c_str(), O_RDONLY);
+        if (_fd < 0)
+            return;
+        struct stat file_status;
+        if (fstat(_fd, &file_status) != 0)
+            return;
+        _size = static_cast<std::size_t>(file_status.st_size);
+        _data = static_cast<char const*>(
+            mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, _fd, 0));
+        if (_data == MAP_FAILED)
+            _data = nullptr;
+#else
+        std::ifstream in(file_name, std::ios::binary | std::ios::ate);
+        if (!in)
+            return;
+        _size = static_cast<std::size_t>(in.tellg());
+        _buffer.resize(_size);
+        in.seekg(0);
+        in.read(_buffer.data(), _size);
+        _data = _buffer.data();
+#endif
+    }
+
+    ~MappedFile()
+    {
+#ifndef _WIN32
+        if (_data != nullptr)
+            munmap(const_cast<char*>(_data), _size);
+        if (_fd >= 0)
+            close(_fd);
+#endif
+    }
+
+    bool valid() const { return _data != nullptr; }
+    char const* data() const { return _data; }
+    std::size_t size() const { return _size; }
+
+private:
+    char const* _data = nullptr;
+    std::size_t _size = 0;
+#ifndef _WIN32
+    int _fd = -1;
+#else
+    std::vector<char> _buffer;
+#endif
+};
+
+/// Sequential reader over a mapped memory range.
+class MappedReader final
+{
+public:
+    MappedReader(char const* data, std::size_t const size)
+        : _begin(data), _position(data), _end(data + size)
+    {
+    }
+
+    /// Current byte offset from the begin of the mapped range.
+    std::size_t offset() const
+    {
+        return static_cast<std::size_t>(_position - _begin);
+    }
+
+    template <typename T>
+    bool read(T& value)
+    {
+        if (_position + sizeof(T) > _end)
+            return false;
+        std::memcpy(&value, _position, sizeof(T));
+        _position += sizeof(T);
+        return true;
+    }
+
+    /// Returns a pointer into the mapped range and advances over n values.
+    template <typename T>
+    T const* view(std::size_t const n)
+    {
+        if (_position + n * sizeof(T) > _end)
+            return nullptr;
+        auto const* const result = reinterpret_cast<T const*>(_position);
+        _position += n * sizeof(T);
+        return result;
+    }
+
+private:
+    char const* _begin;
+    char const* _position;
+    char const* _end;
+};
+
+template <typename T>
+bool readPropertyVector(MappedReader& reader, Properties& properties,
+                        MeshItemType const item_type,
+                        std::string const& name,
+                        std::size_t const n_components)
+{
+    std::uint64_t n_values;
+    if (!reader.read(n_values))
+        return false;
+    auto const* const values = reader.template view<T>(n_values);
+    if (values == nullptr)
+        return false;
+
+    auto* const property = properties.createNewPropertyVector<T>(
+        name, item_type, n_components);
+    if (property == nullptr)
+        return false;
+    property->insert(property->end(), values, values + n_values);
+    return true;
+}
+
+/// Registers a deferred loader reading the property values from the file on
+/// first access, instead of reading them now.
+template <typename T>
+bool deferPropertyVector(MappedReader& reader, Properties& properties,
+                         std::string const& file_name,
+                         MeshItemType const item_type,
+                         std::string const& name,
+                         std::size_t const n_components)
+{
+    std::uint64_t n_values;
+    if (!reader.read(n_values))
+        return false;
+    auto const values_offset = reader.offset();
+    if (reader.template view<T>(n_values) == nullptr)  // skip the values
+        return false;
+
+    properties.setPropertyVectorLoader(
+        name,
+        [file_name, item_type, name, n_components, values_offset,
+         n_values](Properties& props) {
+            auto* const property = props.createNewPropertyVector<T>(
+                name, item_type, n_components);
+            if (property == nullptr)
+                return;
+            property->resize(n_values);
+            std::ifstream in(file_name, std::ios::binary);
+            in.seekg(values_offset);
+            in.read(reinterpret_cast<char*>(property->data()),
+                    n_values * sizeof(T));
+            if (!in)
+                ERR("Error lazily reading property vector '%s' from '%s'.",
+                    name.c_str(), file_name.c_str());
+        });
+    return true;
+}
+
+}  // anonymous namespace
+
+bool writeMeshToBinaryFile(Mesh const& mesh, std::string const& file_name)
+{
+    std::ofstream os(file_name, std::ios::binary);
+    if (!os) {
+        ERR("Could not open file '%s' for writing.", file_name.c_str());
+        return false;
+    }
+
+    auto const& nodes = mesh.getNodes();
+    auto const& elements = mesh.getElements();
+
+    os.write(magic, sizeof(magic));
+    writeValue(os, static_cast<std::uint64_t>(nodes.size()));
+    writeValue(os, static_cast<std::uint64_t>(mesh.getNumberOfBaseNodes()));
+    writeValue(os, static_cast<std::uint64_t>(elements.size()));
+
+    // Coordinates, contiguously in node-id order.
+    for (auto const* node : nodes)
+        writeArray(os, node->getCoords(), 3);
+
+    // Cell types and CSR connectivity.
+    std::uint64_t connectivity_size = 0;
+    for (auto const* element : elements) {
+        writeValue(os, static_cast<std::uint8_t>(element->getCellType()));
+        connectivity_size += element->getNumberOfNodes();
+    }
+    writeValue(os, connectivity_size);
+    for (auto const* element : elements)
+        for (unsigned i = 0; i < element->getNumberOfNodes(); ++i)
+            writeValue(os,
+                       static_cast<std::uint64_t>(element->getNodeIndex(i)));
+
+    // Properties.
+    auto const& properties = mesh.getProperties();
+    auto const names = properties.getPropertyVectorNames();
+    auto const n_properties_position = os.tellp();
+    writeValue(os, static_cast<std::uint64_t>(0));
+    std::uint64_t n_written = 0;
+    for (auto const& name : names) {
+        if (writePropertyVectorAs<double>(os, properties, name) ||
+            writePropertyVectorAs<float>(os, properties, name) ||
+            writePropertyVectorAs<int>(os, properties, name) ||
+            writePropertyVectorAs<unsigned>(os, properties, name) ||
+            writePropertyVectorAs<long>(os, properties, name) ||
+            writePropertyVectorAs<char>(os, properties, name))
+        {
+            ++n_written;
+        }
+        else
+            WARN("Property vector '%s' has an unsupported type and was not "
+                 "written.", name.c_str());
+    }
+    auto const end_position = os.tellp();
+    os.seekp(n_properties_position);
+    writeValue(os, n_written);
+    os.seekp(end_position);
+
+    return static_cast<bool>(os);
+}
+
+namespace
+{
+Mesh* readMeshFromMemory(char const* data, std::size_t const size,
+                         std::string const& name,
+                         bool const defer_property_loading,
+                         std::string const& file_name_for_deferred_loading);
+}  // anonymous namespace
+
+Mesh* readMeshFromBinaryFile(std::string const& file_name,
+                             bool const defer_property_loading)
+{
+    MappedFile const file(file_name);
+    if (!file.valid()) {
+        ERR("Could not read file '%s'.", file_name.c_str());
+        return nullptr;
+    }
+
+    return readMeshFromMemory(
+        file.data(), file.size(),
+        BaseLib::extractBaseNameWithoutExtension(file_name),
+        defer_property_loading, file_name);
+}
+
+Mesh* readMeshFromBinaryData(char const* data, std::size_t const size,
+                             std::string const& name)
+{
+    return readMeshFromMemory(data, size, name, false, "");
+}
+
+namespace
+{
+Mesh* readMeshFromMemory(char const* data, std::size_t const size,
+                         std::string const& name,
+                         bool const defer_property_loading,
+                         std::string const& file_name)
+{
+    MappedReader reader(data, size);
+
+    char file_magic[sizeof(magic)];
+    for (auto& c : file_magic)
+        if (!reader.read(c))
+            return nullptr;
+    if (std::memcmp(file_magic, magic, sizeof(magic)) != 0) {
+        ERR("File '%s' is not an OGS binary mesh file.", file_name.c_str());
+        return nullptr;
+    }
+
+    std::uint64_t n_nodes, n_base_nodes, n_elements;
+    if (!reader.read(n_nodes) || !reader.read(n_base_nodes) ||
+        !reader.read(n_elements))
+        return nullptr;
+
+    auto const* const coordinates = reader.view<double>(3 * n_nodes);
+    auto const* const cell_types = reader.view<std::uint8_t>(n_elements);
+    std::uint64_t connectivity_size;
+    if (coordinates == nullptr || cell_types == nullptr ||
+        !reader.read(connectivity_size))
+        return nullptr;
+    auto const* const connectivity =
+        reader.view<std::uint64_t>(connectivity_size);
+    if (connectivity == nullptr)
+        return nullptr;
+
+    std::vector<Node*> nodes(n_nodes);
+    for (std::uint64_t i = 0; i < n_nodes; ++i)
+        nodes[i] = new Node(coordinates + 3 * i, i);
+
+    std::vector<Element*> elements(n_elements);
+    auto const* node_index = connectivity;
+    for (std::uint64_t e = 0; e < n_elements; ++e) {
+        auto const cell_type = static_cast<CellType>(cell_types[e]);
+
+        // A temporary element of the same type tells the node count; the
+        // factory owns the node array.
+        unsigned n_element_nodes = 0;
+        switch (cell_type) {
+            case CellType::POINT1: n_element_nodes = 1; break;
+            case CellType::LINE2: n_element_nodes = 2; break;
+            case CellType::LINE3: n_element_nodes = 3; break;
+            case CellType::TRI3: n_element_nodes = 3; break;
+            case CellType::TRI6: n_element_nodes = 6; break;
+            case CellType::QUAD4: n_element_nodes = 4; break;
+            case CellType::QUAD8: n_element_nodes = 8; break;
+            case CellType::QUAD9: n_element_nodes = 9; break;
+            case CellType::TET4: n_element_nodes = 4; break;
+            case CellType::TET10: n_element_nodes = 10; break;
+            case CellType::HEX8: n_element_nodes = 8; break;
+            case CellType::HEX20: n_element_nodes = 20; break;
+            case CellType::PRISM6: n_element_nodes = 6; break;
+            case CellType::PRISM15: n_element_nodes = 15; break;
+            case CellType::PYRAMID5: n_element_nodes = 5; break;
+            case CellType::PYRAMID13: n_element_nodes = 13; break;
+            default:
+                ERR("Unsupported cell type in binary mesh file.");
+                return nullptr;
+        }
+
+        auto** element_nodes = new Node*[n_element_nodes];
+        for (unsigned i = 0; i < n_element_nodes; ++i)
+            element_nodes[i] = nodes[node_index[i]];
+        node_index += n_element_nodes;
+
+        elements[e] = createElement(cell_type, element_nodes);
+        if (elements[e] == nullptr)
+            return nullptr;
+    }
+
+    // Properties.
+    Properties properties;
+    std::uint64_t n_properties;
+    if (!reader.read(n_properties))
+        return nullptr;
+    for (std::uint64_t p = 0; p < n_properties; ++p) {
+        std::uint8_t data_type_raw, item_type_raw;
+        std::uint64_t n_components, name_length;
+        if (!reader.read(data_type_raw) || !reader.read(item_type_raw) ||
+            !reader.read(n_components) || !reader.read(name_length))
+            return nullptr;
+        auto const* const name_data = reader.view<char>(name_length);
+        if (name_data == nullptr)
+            return nullptr;
+        std::string const name(name_data, name_length);
+        auto const item_type = static_cast<MeshItemType>(item_type_raw);
+
+        bool ok = false;
+        switch (static_cast<PropertyDataType>(data_type_raw)) {
+            case PropertyDataType::Double:
+                ok = defer_property_loading
+                         ? deferPropertyVector<double>(reader, properties,
+                                                       file_name, item_type,
+                                                       name, n_components)
+                         : readPropertyVector<double>(reader, properties,
+                                                      item_type, name,
+                                                      n_components);
+                break;
+            case PropertyDataType::Float:
+                ok = defer_property_loading
+                         ? deferPropertyVector<float>(reader, properties,
+                                                      file_name, item_type,
+                                                      name, n_components)
+                         : readPropertyVector<float>(reader, properties,
+                                                     item_type, name,
+                                                     n_components);
+                break;
+            case PropertyDataType::Int:
+                ok = defer_property_loading
+                         ? deferPropertyVector<int>(reader, properties,
+                                                    file_name, item_type,
+                                                    name, n_components)
+                         : readPropertyVector<int>(reader, properties,
+                                                   item_type, name,
+                                                   n_components);
+                break;
+            case PropertyDataType::Unsigned:
+                ok = defer_property_loading
+                         ? deferPropertyVector<unsigned>(reader, properties,
+                                                         file_name, item_type,
+                                                         name, n_components)
+                         : readPropertyVector<unsigned>(reader, properties,
+                                                        item_type, name,
+                                                        n_components);
+                break;
+            case PropertyDataType::Long:
+                ok = defer_property_loading
+                         ? deferPropertyVector<long>(reader, properties,
+                                                     file_name, item_type,
+                                                     name, n_components)
+                         : readPropertyVector<long>(reader, properties,
+                                                    item_type, name,
+                                                    n_components);
+                break;
+            case PropertyDataType::Char:
+                ok = defer_property_loading
+                         ? deferPropertyVector<char>(reader, properties,
+                                                     file_name, item_type,
+                                                     name, n_components)
+                         : readPropertyVector<char>(reader, properties,
+                                                    item_type, name,
+                                                    n_components);
+                break;
+        }
+        if (!ok) {
+            ERR("Error reading property vector '%s' from binary mesh file.",
+                name.c_str());
+            return nullptr;
+        }
+    }
+
+    return new Mesh(name, nodes, elements, properties, n_base_nodes);
+}
+}  // anonymous namespace
+
+namespace
+{
+char const overlay_magic[8] = {'O', 'G', 'S', 'B', 'M', 'O', '0', '1'};
+
+/// Replaces (or creates) the property vector from the reader's next record
+/// values, cf. readPropertyVector().
+template <typename T>
+bool applyPropertyVector(MappedReader& reader, Properties& properties,
+                         MeshItemType const item_type,
+                         std::string const& name,
+                         std::uint64_t const n_components)
+{
+    if (properties.hasPropertyVector(name))
+        properties.removePropertyVector(name);
+    return readPropertyVector<T>(reader, properties, item_type, name,
+                                 n_components);
+}
+}  // anonymous namespace
+
+bool writeMeshOverlayFile(Mesh const& mesh,
+                          std::string const& base_mesh_file_name,
+                          std::vector<std::string> const& property_names,
+                          std::string const& file_name)
+{
+    std::ofstream os(file_name, std::ios::binary);
+    if (!os) {
+        ERR("Could not open file '%s' for writing.", file_name.c_str());
+        return false;
+    }
+
+    os.write(overlay_magic, sizeof(overlay_magic));
+    writeValue(os, static_cast<std::uint64_t>(base_mesh_file_name.size()));
+    os.write(base_mesh_file_name.data(), base_mesh_file_name.size());
+
+    auto const& properties = mesh.getProperties();
+    writeValue(os, static_cast<std::uint64_t>(property_names.size()));
+    for (auto const& name : property_names) {
+        if (!(writePropertyVectorAs<double>(os, properties, name) ||
+              writePropertyVectorAs<float>(os, properties, name) ||
+              writePropertyVectorAs<int>(os, properties, name) ||
+              writePropertyVectorAs<unsigned>(os, properties, name) ||
+              writePropertyVectorAs<long>(os, properties, name) ||
+              writePropertyVectorAs<char>(os, properties, name)))
+        {
+            ERR("Property vector '%s' does not exist or has an unsupported "
+                "type; no overlay written.", name.c_str());
+            return false;
+        }
+    }
+
+    return static_cast<bool>(os);
+}
+
+Mesh* readMeshOverlayFile(std::string const& file_name)
+{
+    MappedFile const file(file_name);
+    if (!file.valid()) {
+        ERR("Could not read file '%s'.", file_name.c_str());
+        return nullptr;
+    }
+    MappedReader reader(file.data(), file.size());
+
+    char file_magic[sizeof(overlay_magic)];
+    for (auto& c : file_magic)
+        if (!reader.read(c))
+            return nullptr;
+    if (std::memcmp(file_magic, overlay_magic, sizeof(overlay_magic)) != 0) {
+        ERR("File '%s' is not an OGS mesh overlay file.", file_name.c_str());
+        return nullptr;
+    }
+
+    std::uint64_t base_path_length;
+    if (!reader.read(base_path_length))
+        return nullptr;
+    auto const* const base_path_data = reader.view<char>(base_path_length);
+    if (base_path_data == nullptr)
+        return nullptr;
+    // A relative base path is resolved against the overlay's directory.
+    std::string const base_path = BaseLib::copyPathToFileName(
+        std::string(base_path_data, base_path_length),
+        BaseLib::extractPath(file_name));
+
+    std::unique_ptr<Mesh> mesh(readMeshFromFile(base_path));
+    if (mesh == nullptr) {
+        ERR("Could not read the base mesh '%s' of the overlay '%s'.",
+            base_path.c_str(), file_name.c_str());
+        return nullptr;
+    }
+    auto& properties = mesh->getProperties();
+
+    std::uint64_t n_properties;
+    if (!reader.read(n_properties))
+        return nullptr;
+    for (std::uint64_t p = 0; p < n_properties; ++p) {
+        std::uint8_t data_type_raw, item_type_raw;
+        std::uint64_t n_components, name_length;
+        if (!reader.read(data_type_raw) || !reader.read(item_type_raw) ||
+            !reader.read(n_components) || !reader.read(name_length))
+            return nullptr;
+        auto const* const name_data = reader.view<char>(name_length);
+        if (name_data == nullptr)
+            return nullptr;
+        std::string const name(name_data, name_length);
+        auto const item_type = static_cast<MeshItemType>(item_type_raw);
+
+        bool ok = false;
+        switch (static_cast<PropertyDataType>(data_type_raw)) {
+            case PropertyDataType::Double:
+                ok = applyPropertyVector<double>(reader, properties,
+                                                 item_type, name,
+                                                 n_components);
+                break;
+            case PropertyDataType::Float:
+                ok = applyPropertyVector<float>(reader, properties, item_type,
+                                                name, n_components);
+                break;
+            case PropertyDataType::Int:
+                ok = applyPropertyVector<int>(reader, properties, item_type,
+                                              name, n_components);
+                break;
+            case PropertyDataType::Unsigned:
+                ok = applyPropertyVector<unsigned>(reader, properties,
+                                                   item_type, name,
+                                                   n_components);
+                break;
+            case PropertyDataType::Long:
+                ok = applyPropertyVector<long>(reader, properties, item_type,
+                                               name, n_components);
+                break;
+            case PropertyDataType::Char:
+                ok = applyPropertyVector<char>(reader, properties, item_type,
+                                               name, n_components);
+                break;
+        }
+        if (!ok) {
+            ERR("Error reading overlay property vector '%s' from '%s'.",
+                name.c_str(), file_name.c_str());
+            return nullptr;
+        }
+    }
+
+    return mesh.release();
+}
+
+}  // namespace IO
+}  // namespace MeshLib
@@ -0,0 +1,76 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace MeshLib
+{
+class Mesh;
+
+namespace IO
+{
+
+/// Native binary mesh format (file extension .bms).
+///
+/// The on-disk layout matches the bulk arrays of the in-memory mesh
+/// (coordinates, CSR connectivity, property values), so reading is a memory
+/// map plus a single streaming pass---no XML parsing and no per-item
+/// conversion as with the VTU route. Node/Element/PropertyVector objects are
+/// still instantiated on load, since the mesh stores objects, not raw
+/// arrays; the time and peak-memory win comes from eliminating the parse and
+/// conversion stages.
+///
+/// Property vectors of type double, float, int, unsigned, long and char are
+/// stored; other types are skipped with a warning.
+
+/// Writes the mesh to the given .bms file. Returns true on success.
+bool writeMeshToBinaryFile(Mesh const& mesh, std::string const& file_name);
+
+/// Reads a mesh from the given .bms file; returns nullptr on error.
+///
+/// With \c defer_property_loading set, the property values are not read;
+/// instead a deferred loader per property is registered with the mesh's
+/// Properties object, which reads the values from the file on first access
+/// (cf. Properties::setPropertyVectorLoader() and prefetchPropertyVector()).
+/// Startup memory then scales with the used fields, not the stored ones.
+Mesh* readMeshFromBinaryFile(std::string const& file_name,
+                             bool const defer_property_loading = false);
+
+/// Reads a mesh from an in-memory .bms image (e.g. a node-shared MPI-3
+/// window holding the file content, cf. readMeshSharedOnNode()); \c name
+/// becomes the mesh name. Deferred property loading is unavailable in this
+/// form. Returns nullptr on error.
+Mesh* readMeshFromBinaryData(char const* data, std::size_t const size,
+                             std::string const& name);
+
+/// Mesh overlay format (file extension .bmo): a reference to a base mesh
+/// file plus a set of property vectors replacing (or extending) the base
+/// mesh's properties. Parameter studies whose variants differ only in a
+/// property field (e.g. a permeability realization) store the base mesh once
+/// and one small overlay per variant instead of complete mesh copies.
+
+/// Writes the named property vectors of the mesh together with a reference
+/// to \c base_mesh_file_name into the given .bmo file. The base path is
+/// stored as given; a relative path is resolved against the overlay's
+/// directory on reading. Returns true on success.
+bool writeMeshOverlayFile(Mesh const& mesh,
+                          std::string const& base_mesh_file_name,
+                          std::vector<std::string> const& property_names,
+                          std::string const& file_name);
+
+/// Reads a mesh overlay: loads the base mesh via readMeshFromFile() and
+/// applies the overlay's property vectors on top. Returns nullptr on error.
+Mesh* readMeshOverlayFile(std::string const& file_name);
+
+}  // namespace IO
+}  // namespace MeshLib
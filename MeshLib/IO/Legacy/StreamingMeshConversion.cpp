@@ -0,0 +1,341 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "StreamingMeshConversion.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <vector>
+
+#include <logog/include/logog.hpp>
+
+#include "BaseLib/StringTools.h"
+#include "MeshLib/MeshEnums.h"
+
+namespace
+{
+
+//! Number of staged entities per flush; bounds the converter's memory.
+std::size_t const block_size = 1 << 16;
+
+//! Node count of the legacy element type; 0 if unsupported.
+unsigned nodeCount(MeshLib::MeshElemType const type)
+{
+    switch (type) {
+        case MeshLib::MeshElemType::LINE: return 2;
+        case MeshLib::MeshElemType::TRIANGLE: return 3;
+        case MeshLib::MeshElemType::QUAD: return 4;
+        case MeshLib::MeshElemType::TETRAHEDRON: return 4;
+        case MeshLib::MeshElemType::HEXAHEDRON: return 8;
+        case MeshLib::MeshElemType::PRISM: return 6;
+        case MeshLib::MeshElemType::PYRAMID: return 5;
+        default: return 0;
+    }
+}
+
+//! VTK cell type code of the legacy element type; 0 if unsupported.
+std::uint8_t vtkCellType(MeshLib::MeshElemType const type)
+{
+    switch (type) {
+        case MeshLib::MeshElemType::LINE: return 3;          // VTK_LINE
+        case MeshLib::MeshElemType::TRIANGLE: return 5;      // VTK_TRIANGLE
+        case MeshLib::MeshElemType::QUAD: return 9;          // VTK_QUAD
+        case MeshLib::MeshElemType::TETRAHEDRON: return 10;  // VTK_TETRA
+        case MeshLib::MeshElemType::HEXAHEDRON: return 12;   // VTK_HEXAHEDRON
+        case MeshLib::MeshElemType::PRISM: return 13;        // VTK_WEDGE
+        case MeshLib::MeshElemType::PYRAMID: return 14;      // VTK_PYRAMID
+        default: return 0;
+    }
+}
+
+//! Bytes of one appended raw block: size header plus payload.
+std::size_t blockBytes(std::size_t const n, std::size_t const size)
+{
+    return sizeof(std::uint64_t) + n * size;
+}
+
+template <typename T>
+void writeBlockHeader(std::ostream& os, std::size_t const n)
+{
+    std::uint64_t const n_bytes = n * sizeof(T);
+    os.write(reinterpret_cast<char const*>(&n_bytes), sizeof n_bytes);
+}
+
+template <typename T>
+void flush(std::ostream& os, std::vector<T>& values)
+{
+    os.write(reinterpret_cast<char const*>(values.data()),
+             values.size() * sizeof(T));
+    values.clear();
+}
+
+//! Appends the contents of the (closed) side file to the output in chunks.
+bool appendFile(std::ostream& os, std::string const& filename)
+{
+    std::ifstream in(filename, std::ios::binary);
+    if (!in)
+        return false;
+    std::vector<char> chunk(1 << 20);
+    while (in) {
+        in.read(chunk.data(), chunk.size());
+        os.write(chunk.data(), in.gcount());
+    }
+    return static_cast<bool>(os);
+}
+
+//! Reads the element type and node indices of one element line whose index
+//! and material id have already been consumed, mirroring the tolerant
+//! parsing of MeshIO::readElement. Returns INVALID on failure.
+MeshLib::MeshElemType readElementHeader(std::istringstream& iss)
+{
+    std::string type_token;
+    auto type = MeshLib::MeshElemType::INVALID;
+    do {
+        if (!(iss >> type_token))
+            return MeshLib::MeshElemType::INVALID;
+        type = MeshLib::String2MeshElemType(type_token);
+    } while (type == MeshLib::MeshElemType::INVALID);
+    return type;
+}
+
+}  // anonymous namespace
+
+namespace MeshLib
+{
+namespace IO
+{
+namespace Legacy
+{
+
+bool convertMeshToVtuStreaming(std::string const& input_file_name,
+                               std::string const& output_file_name)
+{
+    INFO("Converting OGS legacy mesh '%s' to VTU (streaming) ...",
+         input_file_name.c_str());
+
+    std::ifstream in(input_file_name);
+    if (!in) {
+        ERR("Could not open file '%s'.", input_file_name.c_str());
+        return false;
+    }
+
+    std::string line;
+    getline(in, line);
+    if (line.find("#FEM_MSH") == std::string::npos) {
+        ERR("File '%s' is not an OGS legacy mesh file.",
+            input_file_name.c_str());
+        return false;
+    }
+
+    // Scan pass: find the node and element sections, count entities and the
+    // connectivity size. Only line buffers are held in memory.
+    std::size_t n_nodes = 0;
+    std::size_t n_elements = 0;
+    std::size_t connectivity_size = 0;
+    std::streampos nodes_begin(-1);
+    std::streampos elements_begin(-1);
+
+    while (getline(in, line)) {
+        if (line.find("#STOP") != std::string::npos)
+            break;
+        if (line.find("$NODES") != std::string::npos) {
+            getline(in, line);
+            BaseLib::trim(line);
+            n_nodes = std::strtoul(line.c_str(), nullptr, 10);
+            nodes_begin = in.tellg();
+            for (std::size_t i = 0; i < n_nodes; ++i)
+                getline(in, line);
+        }
+        else if (line.find("$ELEMENTS") != std::string::npos) {
+            getline(in, line);
+            BaseLib::trim(line);
+            n_elements = std::strtoul(line.c_str(), nullptr, 10);
+            elements_begin = in.tellg();
+            for (std::size_t i = 0; i < n_elements; ++i) {
+                getline(in, line);
+                std::istringstream iss(line);
+                std::size_t index, material_id;
+                iss >> index >> material_id;
+                auto const type = readElementHeader(iss);
+                unsigned const element_nodes = nodeCount(type);
+                if (element_nodes == 0) {
+                    ERR("Unsupported element type in element %zu of '%s'.",
+                        i, input_file_name.c_str());
+                    return false;
+                }
+                connectivity_size += element_nodes;
+            }
+        }
+    }
+    if (n_nodes == 0 || n_elements == 0) {
+        ERR("File '%s' did not contain node and element information.",
+            input_file_name.c_str());
+        return false;
+    }
+
+    std::ofstream os(output_file_name, std::ios::binary);
+    if (!os) {
+        ERR("Could not open file '%s' for writing.",
+            output_file_name.c_str());
+        return false;
+    }
+
+    // Appended block offsets, cf. writeStreamingVtu: points, connectivity,
+    // offsets, types, MaterialIDs.
+    std::size_t offset = 0;
+    auto const points_offset = offset;
+    offset += blockBytes(3 * n_nodes, sizeof(double));
+    auto const connectivity_offset = offset;
+    offset += blockBytes(connectivity_size, sizeof(std::int64_t));
+    auto const offsets_offset = offset;
+    offset += blockBytes(n_elements, sizeof(std::int64_t));
+    auto const types_offset = offset;
+    offset += blockBytes(n_elements, sizeof(std::uint8_t));
+    auto const materials_offset = offset;
+
+    os << "<?xml version=\"1.0\"?>\n"
+       << "<VTKFile type=\"UnstructuredGrid\" version=\"1.0\" "
+          "byte_order=\"LittleEndian\" header_type=\"UInt64\">\n"
+       << "  <UnstructuredGrid>\n"
+       << "    <Piece NumberOfPoints=\"" << n_nodes << "\" NumberOfCells=\""
+       << n_elements << "\">\n"
+       << "      <Points>\n"
+       << "        <DataArray type=\"Float64\" NumberOfComponents=\"3\" "
+          "format=\"appended\" offset=\"" << points_offset << "\"/>\n"
+       << "      </Points>\n"
+       << "      <Cells>\n"
+       << "        <DataArray type=\"Int64\" Name=\"connectivity\" "
+          "format=\"appended\" offset=\"" << connectivity_offset << "\"/>\n"
+       << "        <DataArray type=\"Int64\" Name=\"offsets\" "
+          "format=\"appended\" offset=\"" << offsets_offset << "\"/>\n"
+       << "        <DataArray type=\"UInt8\" Name=\"types\" "
+          "format=\"appended\" offset=\"" << types_offset << "\"/>\n"
+       << "      </Cells>\n"
+       << "      <PointData>\n"
+       << "      </PointData>\n"
+       << "      <CellData>\n"
+       << "        <DataArray type=\"Int32\" Name=\"MaterialIDs\" "
+          "NumberOfComponents=\"1\" format=\"appended\" offset=\""
+       << materials_offset << "\"/>\n"
+       << "      </CellData>\n"
+       << "    </Piece>\n"
+       << "  </UnstructuredGrid>\n"
+       << "  <AppendedData encoding=\"raw\">\n_";
+
+    // Points block, streamed from the node section.
+    in.clear();
+    in.seekg(nodes_begin);
+    writeBlockHeader<double>(os, 3 * n_nodes);
+    {
+        std::vector<double> coordinates;
+        coordinates.reserve(3 * block_size);
+        for (std::size_t i = 0; i < n_nodes; ++i) {
+            getline(in, line);
+            char const* cursor = line.c_str();
+            char* cursor_end = nullptr;
+            std::strtoul(cursor, &cursor_end, 10);  // node index (by line)
+            for (unsigned d = 0; d < 3; ++d) {
+                cursor = cursor_end;
+                coordinates.push_back(std::strtod(cursor, &cursor_end));
+            }
+            if (coordinates.size() == 3 * block_size)
+                flush(os, coordinates);
+        }
+        flush(os, coordinates);
+    }
+
+    // Connectivity block, streamed from the element section; offsets, types
+    // and material ids are spilled to side files on the way and appended
+    // below, so the element section is parsed only twice in total.
+    std::string const side_basename = output_file_name + ".side";
+    {
+        std::ofstream offsets_file(side_basename + "_offsets",
+                                   std::ios::binary);
+        std::ofstream types_file(side_basename + "_types", std::ios::binary);
+        std::ofstream materials_file(side_basename + "_materials",
+                                     std::ios::binary);
+        if (!offsets_file || !types_file || !materials_file) {
+            ERR("Could not open the side files next to '%s'.",
+                output_file_name.c_str());
+            return false;
+        }
+
+        in.clear();
+        in.seekg(elements_begin);
+        writeBlockHeader<std::int64_t>(os, connectivity_size);
+
+        std::vector<std::int64_t> connectivity, offsets;
+        std::vector<std::uint8_t> types;
+        std::vector<std::int32_t> materials;
+        std::int64_t running_offset = 0;
+
+        for (std::size_t i = 0; i < n_elements; ++i) {
+            getline(in, line);
+            std::istringstream iss(line);
+            std::size_t index, material_id;
+            iss >> index >> material_id;
+            auto const type = readElementHeader(iss);
+            unsigned const element_nodes = nodeCount(type);
+            for (unsigned k = 0; k < element_nodes; ++k) {
+                std::int64_t node_index;
+                if (!(iss >> node_index)) {
+                    ERR("Reading mesh element %zu from file '%s' failed.", i,
+                        input_file_name.c_str());
+                    return false;
+                }
+                connectivity.push_back(node_index);
+            }
+            running_offset += element_nodes;
+            offsets.push_back(running_offset);
+            types.push_back(vtkCellType(type));
+            materials.push_back(static_cast<std::int32_t>(material_id));
+
+            if (offsets.size() == block_size) {
+                flush(os, connectivity);
+                flush(offsets_file, offsets);
+                flush(types_file, types);
+                flush(materials_file, materials);
+            }
+        }
+        flush(os, connectivity);
+        flush(offsets_file, offsets);
+        flush(types_file, types);
+        flush(materials_file, materials);
+    }
+
+    writeBlockHeader<std::int64_t>(os, n_elements);
+    bool ok = appendFile(os, side_basename + "_offsets");
+    writeBlockHeader<std::uint8_t>(os, n_elements);
+    ok = ok && appendFile(os, side_basename + "_types");
+    writeBlockHeader<std::int32_t>(os, n_elements);
+    ok = ok && appendFile(os, side_basename + "_materials");
+
+    std::remove((side_basename + "_offsets").c_str());
+    std::remove((side_basename + "_types").c_str());
+    std::remove((side_basename + "_materials").c_str());
+
+    os << "\n  </AppendedData>\n</VTKFile>\n";
+
+    if (!ok || !os) {
+        ERR("Writing '%s' failed.", output_file_name.c_str());
+        return false;
+    }
+
+    INFO("\t... finished.");
+    INFO("Nr. Nodes: %zu.", n_nodes);
+    INFO("Nr. Elements: %zu.", n_elements);
+    return true;
+}
+
+}  // namespace Legacy
+}  // namespace IO
+}  // namespace MeshLib
@@ -0,0 +1,43 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <string>
+
+namespace MeshLib
+{
+namespace IO
+{
+namespace Legacy
+{
+
+/*! Converts an OGS legacy mesh file (.msh) to appended-binary VTU without
+ * building the mesh in memory.
+ *
+ * The converter scans the element section once for the block sizes, writes
+ * the VTU header with precomputed appended-data offsets, then streams the
+ * node and element sections block-wise into the points and connectivity
+ * arrays; cell offsets, types and MaterialIDs are spilled to small side
+ * files during the element pass and copied into the output afterwards. Peak
+ * memory is one staging block, independent of the mesh size, so converting
+ * a 60 GB legacy mesh no longer needs a bigmem node. The output matches the
+ * layout of writeStreamingVtu byte for byte.
+ *
+ * The reverse direction stays with VtuInterface: reading arbitrary VTU
+ * (ASCII, base64, compressed) requires the VTK reader.
+ *
+ * Returns true on success.
+ */
+bool convertMeshToVtuStreaming(std::string const& input_file_name,
+                               std::string const& output_file_name);
+
+}  // namespace Legacy
+}  // namespace IO
+}  // namespace MeshLib
@@ -0,0 +1,143 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "CollectiveNodeDataWriter.h"
+
+#include <cstdint>
+
+#include <logog/include/logog.hpp>
+
+#include "MeshLib/NodePartitionedMesh.h"
+#include "MeshLib/Node.h"
+
+namespace MeshLib
+{
+namespace IO
+{
+
+namespace
+{
+char const magic[8] = {'O', 'G', 'S', 'O', 'N', 'D', '0', '1'};
+
+/// Number of owned (non-ghost) nodes of the rank.
+std::size_t countOwnedNodes(NodePartitionedMesh const& mesh)
+{
+    return mesh.getNumberOfActiveNodes();
+}
+}  // anonymous namespace
+
+bool writeNodeDataCollective(std::string const& file_name,
+                             NodePartitionedMesh const& mesh,
+                             std::vector<CollectiveNodeData> const& data,
+                             MPI_Comm const comm)
+{
+    int rank, comm_size;
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &comm_size);
+
+    std::size_t const n_owned = countOwnedNodes(mesh);
+
+    // Exclusive prefix sum of the owned node counts yields each rank's tuple
+    // offset; the total count goes to the header.
+    unsigned long long local_count = n_owned;
+    unsigned long long offset_count = 0;
+    MPI_Exscan(&local_count, &offset_count, 1, MPI_UNSIGNED_LONG_LONG,
+               MPI_SUM, comm);
+    unsigned long long total_count = 0;
+    MPI_Allreduce(&local_count, &total_count, 1, MPI_UNSIGNED_LONG_LONG,
+                  MPI_SUM, comm);
+
+    MPI_File file;
+    if (MPI_File_open(comm, const_cast<char*>(file_name.c_str()),
+                      MPI_MODE_CREATE | MPI_MODE_WRONLY, MPI_INFO_NULL,
+                      &file) != MPI_SUCCESS)
+    {
+        ERR("Could not open file '%s' for collective writing.",
+            file_name.c_str());
+        return false;
+    }
+
+    // Header (rank 0 only): magic, total node count, number of arrays, per
+    // array: name length + name + component count.
+    std::uint64_t header_size = sizeof(magic) + 2 * sizeof(std::uint64_t);
+    for (auto const& array : data)
+        header_size += sizeof(std::uint64_t) + array.name.size() +
+                       sizeof(std::uint64_t);
+
+    if (rank == 0)
+    {
+        std::vector<char> header;
+        header.reserve(header_size);
+        auto const append = [&header](void const* bytes, std::size_t n) {
+            auto const* const begin = static_cast<char const*>(bytes);
+            header.insert(header.end(), begin, begin + n);
+        };
+        append(magic, sizeof(magic));
+        std::uint64_t const total64 = total_count;
+        append(&total64, sizeof(total64));
+        std::uint64_t const n_arrays = data.size();
+        append(&n_arrays, sizeof(n_arrays));
+        for (auto const& array : data)
+        {
+            std::uint64_t const name_length = array.name.size();
+            append(&name_length, sizeof(name_length));
+            append(array.name.data(), array.name.size());
+            std::uint64_t const n_components = array.n_components;
+            append(&n_components, sizeof(n_components));
+        }
+        MPI_File_write_at(file, 0, header.data(),
+                          static_cast<int>(header.size()), MPI_BYTE,
+                          MPI_STATUS_IGNORE);
+    }
+
+    // One collective write per data array. A tuple is the global node id
+    // (uint64) followed by the component values (double); only owned nodes
+    // are written, each exactly once across all ranks.
+    MPI_Offset array_begin = static_cast<MPI_Offset>(header_size);
+    bool success = true;
+    for (auto const& array : data)
+    {
+        std::size_t const tuple_bytes =
+            sizeof(std::uint64_t) + array.n_components * sizeof(double);
+
+        std::vector<char> buffer;
+        buffer.reserve(n_owned * tuple_bytes);
+        auto const append = [&buffer](void const* bytes, std::size_t n) {
+            auto const* const begin = static_cast<char const*>(bytes);
+            buffer.insert(buffer.end(), begin, begin + n);
+        };
+
+        std::size_t owned_index = 0;
+        for (std::size_t n = 0; n < mesh.getNumberOfNodes(); ++n)
+        {
+            if (mesh.isGhostNode(n))
+                continue;
+            std::uint64_t const global_id = mesh.getGlobalNodeID(n);
+            append(&global_id, sizeof(global_id));
+            append(array.values->data() + owned_index * array.n_components,
+                   array.n_components * sizeof(double));
+            ++owned_index;
+        }
+
+        auto const write_offset =
+            array_begin + static_cast<MPI_Offset>(offset_count * tuple_bytes);
+        if (MPI_File_write_at_all(file, write_offset, buffer.data(),
+                                  static_cast<int>(buffer.size()), MPI_BYTE,
+                                  MPI_STATUS_IGNORE) != MPI_SUCCESS)
+            success = false;
+
+        array_begin += static_cast<MPI_Offset>(total_count * tuple_bytes);
+    }
+
+    MPI_File_close(&file);
+    return success;
+}
+
+}  // namespace IO
+}  // namespace MeshLib
@@ -0,0 +1,50 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include <mpi.h>
+
+namespace MeshLib
+{
+class NodePartitionedMesh;
+
+namespace IO
+{
+
+/// One named nodal data array to be written collectively; \c values holds
+/// n_components values per owned node in node order.
+struct CollectiveNodeData
+{
+    std::string name;
+    unsigned n_components;
+    std::vector<double> const* values;
+};
+
+/// Writes the owned nodal data of all ranks into one shared binary file
+/// (extension .ond, "OGS node data") using collective MPI-IO.
+///
+/// Every rank writes (global node id, values...) tuples of its owned nodes
+/// at rank-exclusive offsets with a single MPI_File_write_at_all per data
+/// array, so the filesystem sees one file and a handful of collective
+/// operations per step instead of thousands of per-rank .vtu pieces. The
+/// offline NodeData2Vtu converter maps the file back onto the bulk mesh and
+/// emits a single .vtu for ParaView.
+///
+/// Returns true on success (collectively).
+bool writeNodeDataCollective(std::string const& file_name,
+                             NodePartitionedMesh const& mesh,
+                             std::vector<CollectiveNodeData> const& data,
+                             MPI_Comm const comm);
+
+}  // namespace IO
+}  // namespace MeshLib
@@ -14,6 +14,8 @@
 
 #include "NodePartitionedMeshReader.h"
 
+#include <cstring>
+
 #include <logog/include/logog.hpp>
 
 #include "BaseLib/FileTools.h"
@@ -122,12 +124,15 @@ NodePartitionedMeshReader::readBinaryDataFromFile(std::string const& filename,
         return false;
     }
 
-    // Read data
+    // Read data collectively: every rank participates in each of these
+    // reads (they are issued from the same call sites on all ranks), so the
+    // MPI-IO layer can aggregate the per-rank contiguous blocks into few
+    // large file accesses instead of one independent seek+read per rank.
     char file_mode[] = "native";
     MPI_File_set_view(file, offset, type, type, file_mode, MPI_INFO_NULL);
     // The static cast is checked above.
-    MPI_File_read(file, data.data(), static_cast<int>(data.size()), type,
-        MPI_STATUS_IGNORE);
+    MPI_File_read_all(file, data.data(), static_cast<int>(data.size()), type,
+                      MPI_STATUS_IGNORE);
     MPI_File_close(&file);
 
     return true;
@@ -188,6 +193,31 @@ MeshLib::NodePartitionedMesh* NodePartitionedMeshReader::readBinary(
                mesh_nodes, glb_node_ids, mesh_elems);
 }
 
+MeshLib::NodePartitionedMesh* NodePartitionedMeshReader::readFromBinaryData(
+    std::vector<long> const& config,
+    std::vector<char> const& node_data,
+    std::vector<unsigned long> const& regular_element_data,
+    std::vector<unsigned long> const& ghost_element_data,
+    std::string const& mesh_name)
+{
+    std::copy(config.begin(), config.end(), _mesh_info.data());
+
+    std::vector<NodeData> nodes(_mesh_info.nodes);
+    std::memcpy(nodes.data(), node_data.data(), node_data.size());
+
+    std::vector<MeshLib::Node*> mesh_nodes;
+    std::vector<unsigned long> glb_node_ids;
+    setNodes(nodes, mesh_nodes, glb_node_ids);
+
+    std::vector<MeshLib::Element*> mesh_elems(
+        _mesh_info.regular_elements + _mesh_info.ghost_elements);
+    setElements(mesh_nodes, regular_element_data, mesh_elems);
+    const bool process_ghost = true;
+    setElements(mesh_nodes, ghost_element_data, mesh_elems, process_ghost);
+
+    return newMesh(mesh_name, mesh_nodes, glb_node_ids, mesh_elems);
+}
+
 bool NodePartitionedMeshReader::openASCIIFiles(std::string const& file_name_base,
     std::ifstream& is_cfg, std::ifstream& is_node, std::ifstream& is_elem) const
 {
@@ -420,7 +450,8 @@ NodePartitionedMeshReader::newMesh(
         _mesh_info.global_nodes,
         _mesh_info.base_nodes,
         _mesh_info.active_base_nodes,
-        _mesh_info.active_nodes);
+        _mesh_info.active_nodes,
+        _mesh_info.regular_elements);
 }
 
 void NodePartitionedMeshReader::readElementASCII(std::ifstream &ins,
@@ -48,6 +48,23 @@ public:
      */
     MeshLib::NodePartitionedMesh* read(const std::string &file_name_base);
 
+    /*!
+         \brief Builds this rank's NodePartitionedMesh from in-memory blocks
+                in the layout of the binary partitioned-mesh files: the
+                14-entry configuration header, the node array bytes (id plus
+                three coordinates per node) and the element integer
+                variables of the regular and ghost elements. Used by the
+                in-memory partitioning at simulation start, which hands each
+                rank its blocks without the intermediate files.
+         \return Pointer to the Mesh object.
+     */
+    MeshLib::NodePartitionedMesh* readFromBinaryData(
+        std::vector<long> const& config,
+        std::vector<char> const& node_data,
+        std::vector<unsigned long> const& regular_element_data,
+        std::vector<unsigned long> const& ghost_element_data,
+        std::string const& mesh_name);
+
 private:
     /// Pointer to MPI communicator.
     MPI_Comm _mpi_comm;
@@ -0,0 +1,87 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "SharedNodeMemoryMesh.h"
+
+#include <fstream>
+#include <vector>
+
+#include <logog/include/logog.hpp>
+
+#include "BaseLib/FileTools.h"
+#include "MeshLib/IO/BinaryMeshIO.h"
+#include "MeshLib/Mesh.h"
+
+namespace MeshLib
+{
+namespace IO
+{
+
+Mesh* readMeshSharedOnNode(std::string const& file_name, MPI_Comm const comm)
+{
+    // One communicator per shared-memory domain (compute node).
+    MPI_Comm node_comm;
+    MPI_Comm_split_type(comm, MPI_COMM_TYPE_SHARED, 0, MPI_INFO_NULL,
+                        &node_comm);
+    int node_rank;
+    MPI_Comm_rank(node_comm, &node_rank);
+
+    // The node leader determines the file size and fills the shared window.
+    MPI_Offset file_size = 0;
+    if (node_rank == 0)
+    {
+        std::ifstream in(file_name, std::ios::binary | std::ios::ate);
+        if (in)
+            file_size = static_cast<MPI_Offset>(in.tellg());
+    }
+    MPI_Bcast(&file_size, 1, MPI_OFFSET, 0, node_comm);
+    if (file_size == 0)
+    {
+        ERR("Could not read file '%s'.", file_name.c_str());
+        MPI_Comm_free(&node_comm);
+        return nullptr;
+    }
+
+    MPI_Win window;
+    char* window_base = nullptr;
+    MPI_Aint const local_size = (node_rank == 0) ? file_size : 0;
+    MPI_Win_allocate_shared(local_size, 1, MPI_INFO_NULL, node_comm,
+                            &window_base, &window);
+
+    // All ranks address the leader's segment.
+    MPI_Aint segment_size;
+    int displacement_unit;
+    char* shared_data = nullptr;
+    MPI_Win_shared_query(window, 0, &segment_size, &displacement_unit,
+                         &shared_data);
+
+    if (node_rank == 0)
+    {
+        std::ifstream in(file_name, std::ios::binary);
+        in.read(shared_data, file_size);
+        if (!in)
+        {
+            ERR("Error reading file '%s' into the shared window.",
+                file_name.c_str());
+        }
+    }
+    MPI_Barrier(node_comm);
+
+    auto* const mesh = readMeshFromBinaryData(
+        shared_data, static_cast<std::size_t>(file_size),
+        BaseLib::extractBaseNameWithoutExtension(file_name));
+
+    MPI_Barrier(node_comm);
+    MPI_Win_free(&window);
+    MPI_Comm_free(&node_comm);
+    return mesh;
+}
+
+}  // namespace IO
+}  // namespace MeshLib
@@ -0,0 +1,42 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <string>
+
+#include <mpi.h>
+
+namespace MeshLib
+{
+class Mesh;
+
+namespace IO
+{
+
+/*!
+  Reads a binary mesh (.bms) with one copy of the file image per compute
+  node.
+
+  The communicator is split by shared-memory domain; the first rank of each
+  node reads the file into an MPI-3 shared window, and all ranks of the node
+  construct their mesh from the shared bytes. The raw mesh arrays
+  (coordinates, connectivity, property values) thereby exist once per node
+  instead of once per rank during construction, and the file is read once
+  per node instead of once per rank.
+
+  The returned mesh (per rank) still materializes its Node/Element objects;
+  eliminating those per-rank copies as well requires the object-free SoA
+  mesh representation. Returns nullptr on error (collectively consistent
+  within a node).
+*/
+Mesh* readMeshSharedOnNode(std::string const& file_name, MPI_Comm const comm);
+
+}  // namespace IO
+}  // namespace MeshLib
@@ -22,24 +22,44 @@ namespace IO
 
 void PVDFile::addVTUFile(const std::string &vtu_fname, double timestep)
 {
-    _datasets.push_back(std::make_pair(timestep, vtu_fname));
+    char const footer[] = "  </Collection>\n</VTKFile>\n";
 
-    std::ofstream fh(_pvd_filename.c_str());
+    if (_footer_position < 0)
+    {
+        // First data set: write the whole document.
+        std::ofstream fh(_pvd_filename.c_str());
+        if (!fh) {
+            OGS_FATAL("could not open file `%s'", _pvd_filename.c_str());
+        }
+
+        fh << std::setprecision(std::numeric_limits<double>::digits10);
+
+        fh << "<?xml version=\"1.0\"?>\n"
+               "<VTKFile type=\"Collection\" version=\"0.1\" byte_order=\"LittleEndian\""
+               " compressor=\"vtkZLibDataCompressor\">\n"
+               "  <Collection>\n";
+
+        fh << "    <DataSet timestep=\"" << timestep
+           << "\" group=\"\" part=\"0\" file=\"" << vtu_fname << "\"/>\n";
+
+        _footer_position = static_cast<long long>(fh.tellp());
+        fh << footer;
+        return;
+    }
+
+    // Append mode: overwrite the footer with the new data set plus footer.
+    std::fstream fh(_pvd_filename.c_str(),
+                    std::ios::in | std::ios::out | std::ios::binary);
     if (!fh) {
         OGS_FATAL("could not open file `%s'", _pvd_filename.c_str());
     }
-
     fh << std::setprecision(std::numeric_limits<double>::digits10);
 
-    fh << "<?xml version=\"1.0\"?>\n"
-           "<VTKFile type=\"Collection\" version=\"0.1\" byte_order=\"LittleEndian\""
-           " compressor=\"vtkZLibDataCompressor\">\n"
-           "  <Collection>\n";
-
-    for (auto const& pair : _datasets)
-        fh << "    <DataSet timestep=\"" << pair.first << "\" group=\"\" part=\"0\" file=\"" << pair.second << "\"/>\n";
-
-    fh << "  </Collection>\n</VTKFile>\n";
+    fh.seekp(_footer_position);
+    fh << "    <DataSet timestep=\"" << timestep
+       << "\" group=\"\" part=\"0\" file=\"" << vtu_fname << "\"/>\n";
+    _footer_position = static_cast<long long>(fh.tellp());
+    fh << footer;
 }
 
 } // IO
@@ -27,11 +27,16 @@ public:
     explicit PVDFile(std::string const& pvd_fname) : _pvd_filename(pvd_fname) {}
 
     //! Add a VTU file to this PVD file.
+    //!
+    //! The first call writes the full document; subsequent calls append the
+    //! new data set in place by overwriting the fixed-size footer, i.e. the
+    //! cost per step is O(1) instead of rewriting the O(steps) XML.
     void addVTUFile(std::string const& vtu_fname, double timestep);
 
 private:
     std::string const _pvd_filename;
-    std::vector<std::pair<double, std::string>> _datasets; // a vector of (time, VTU file name)
+    //! Stream position of the footer, where the next data set is inserted.
+    long long _footer_position = -1;
 };
 
 } // namespace IO
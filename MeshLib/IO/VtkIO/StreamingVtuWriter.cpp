@@ -0,0 +1,283 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "StreamingVtuWriter.h"
+
+#include <cstdint>
+#include <fstream>
+#include <vector>
+
+#include <logog/include/logog.hpp>
+
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/Node.h"
+
+namespace MeshLib
+{
+namespace IO
+{
+
+namespace
+{
+
+/// VTK cell type code of the given cell type; 0 if unsupported.
+std::uint8_t vtkCellType(CellType const cell_type)
+{
+    switch (cell_type) {
+        case CellType::POINT1: return 1;     // VTK_VERTEX
+        case CellType::LINE2: return 3;      // VTK_LINE
+        case CellType::LINE3: return 21;     // VTK_QUADRATIC_EDGE
+        case CellType::TRI3: return 5;       // VTK_TRIANGLE
+        case CellType::TRI6: return 22;      // VTK_QUADRATIC_TRIANGLE
+        case CellType::QUAD4: return 9;      // VTK_QUAD
+        case CellType::QUAD8: return 23;     // VTK_QUADRATIC_QUAD
+        case CellType::QUAD9: return 28;     // VTK_BIQUADRATIC_QUAD
+        case CellType::TET4: return 10;      // VTK_TETRA
+        case CellType::TET10: return 24;     // VTK_QUADRATIC_TETRA
+        case CellType::HEX8: return 12;      // VTK_HEXAHEDRON
+        case CellType::HEX20: return 25;     // VTK_QUADRATIC_HEXAHEDRON
+        case CellType::PRISM6: return 13;    // VTK_WEDGE
+        case CellType::PRISM15: return 26;   // VTK_QUADRATIC_WEDGE
+        case CellType::PYRAMID5: return 14;  // VTK_PYRAMID
+        case CellType::PYRAMID13: return 27; // VTK_QUADRATIC_PYRAMID
+        default: return 0;
+    }
+}
+
+template <typename T> struct VtkTypeName;
+template <> struct VtkTypeName<double> { static const char* name() { return "Float64"; } };
+template <> struct VtkTypeName<float> { static const char* name() { return "Float32"; } };
+template <> struct VtkTypeName<int> { static const char* name() { return "Int32"; } };
+template <> struct VtkTypeName<unsigned> { static const char* name() { return "UInt32"; } };
+template <> struct VtkTypeName<long> { static const char* name() { return "Int64"; } };
+template <> struct VtkTypeName<char> { static const char* name() { return "Int8"; } };
+
+/// Collects the XML declarations and the raw blocks of the appended data
+/// section; blocks are staged one at a time by the caller.
+class AppendedData final
+{
+public:
+    /// Returns the appended-data offset to declare for the next block.
+    std::size_t currentOffset() const { return _offset; }
+
+    /// Appends one raw block (size header plus payload) to the stream.
+    template <typename T>
+    void writeBlock(std::ostream& os, std::vector<T> const& values)
+    {
+        std::uint64_t const n_bytes = values.size() * sizeof(T);
+        os.write(reinterpret_cast<char const*>(&n_bytes), sizeof(n_bytes));
+        os.write(reinterpret_cast<char const*>(values.data()), n_bytes);
+        _offset += sizeof(n_bytes) + n_bytes;
+    }
+
+private:
+    std::size_t _offset = 0;
+};
+
+/// Declaration data of one property's DataArray.
+struct PropertyDeclaration
+{
+    std::string name;
+    std::string type_name;
+    std::size_t n_components;
+    std::size_t offset;
+    MeshItemType item_type;
+};
+
+std::size_t blockBytes(std::size_t const n, std::size_t const size)
+{
+    return sizeof(std::uint64_t) + n * size;
+}
+
+/// Records the declaration of the property if it is of type T; returns false
+/// otherwise.
+template <typename T>
+bool declarePropertyAs(Properties const& properties, std::string const& name,
+                       std::size_t& offset,
+                       std::vector<PropertyDeclaration>& declarations)
+{
+    auto const* const property = properties.getPropertyVector<T>(name);
+    if (property == nullptr)
+        return false;
+
+    declarations.push_back({name, VtkTypeName<T>::name(),
+                            property->getNumberOfComponents(), offset,
+                            property->getMeshItemType()});
+    offset += blockBytes(property->size(), sizeof(T));
+    return true;
+}
+
+/// Stages the property's values into the appended data if it is of type T;
+/// returns false otherwise.
+template <typename T>
+bool writePropertyAs(std::ostream& os, Properties const& properties,
+                     std::string const& name, AppendedData& appended)
+{
+    auto const* const property = properties.getPropertyVector<T>(name);
+    if (property == nullptr)
+        return false;
+
+    std::vector<T> const values(property->begin(), property->end());
+    appended.writeBlock(os, values);
+    return true;
+}
+
+}  // anonymous namespace
+
+bool writeStreamingVtu(Mesh const& mesh, std::string const& file_name)
+{
+    std::ofstream os(file_name, std::ios::binary);
+    if (!os) {
+        ERR("Could not open file '%s' for writing.", file_name.c_str());
+        return false;
+    }
+
+    auto const& nodes = mesh.getNodes();
+    auto const& elements = mesh.getElements();
+    auto const& properties = mesh.getProperties();
+
+    // Precompute connectivity metadata.
+    std::size_t connectivity_size = 0;
+    for (auto const* element : elements) {
+        if (vtkCellType(element->getCellType()) == 0) {
+            ERR("Unsupported cell type for the VTU writer.");
+            return false;
+        }
+        connectivity_size += element->getNumberOfNodes();
+    }
+
+    // The appended blocks are written in declaration order; their offsets
+    // are computed up front from the block sizes.
+    std::size_t offset = 0;
+    auto const points_offset = offset;
+    offset += blockBytes(3 * nodes.size(), sizeof(double));
+    auto const connectivity_offset = offset;
+    offset += blockBytes(connectivity_size, sizeof(std::int64_t));
+    auto const offsets_offset = offset;
+    offset += blockBytes(elements.size(), sizeof(std::int64_t));
+    auto const types_offset = offset;
+    offset += blockBytes(elements.size(), sizeof(std::uint8_t));
+
+    std::vector<PropertyDeclaration> declarations;
+    for (auto const& name : properties.getPropertyVectorNames()) {
+        if (!(declarePropertyAs<double>(properties, name, offset,
+                                        declarations) ||
+              declarePropertyAs<float>(properties, name, offset,
+                                       declarations) ||
+              declarePropertyAs<int>(properties, name, offset,
+                                     declarations) ||
+              declarePropertyAs<unsigned>(properties, name, offset,
+                                          declarations) ||
+              declarePropertyAs<long>(properties, name, offset,
+                                      declarations) ||
+              declarePropertyAs<char>(properties, name, offset,
+                                      declarations)))
+        {
+            WARN("Property vector '%s' has an unsupported type and was not "
+                 "written.", name.c_str());
+        }
+    }
+
+    // XML header.
+    os << "<?xml version=\"1.0\"?>\n"
+       << "<VTKFile type=\"UnstructuredGrid\" version=\"1.0\" "
+          "byte_order=\"LittleEndian\" header_type=\"UInt64\">\n"
+       << "  <UnstructuredGrid>\n"
+       << "    <Piece NumberOfPoints=\"" << nodes.size()
+       << "\" NumberOfCells=\"" << elements.size() << "\">\n";
+
+    os << "      <Points>\n"
+       << "        <DataArray type=\"Float64\" NumberOfComponents=\"3\" "
+          "format=\"appended\" offset=\"" << points_offset << "\"/>\n"
+       << "      </Points>\n";
+
+    os << "      <Cells>\n"
+       << "        <DataArray type=\"Int64\" Name=\"connectivity\" "
+          "format=\"appended\" offset=\"" << connectivity_offset << "\"/>\n"
+       << "        <DataArray type=\"Int64\" Name=\"offsets\" "
+          "format=\"appended\" offset=\"" << offsets_offset << "\"/>\n"
+       << "        <DataArray type=\"UInt8\" Name=\"types\" "
+          "format=\"appended\" offset=\"" << types_offset << "\"/>\n"
+       << "      </Cells>\n";
+
+    for (auto const item_type : {MeshItemType::Node, MeshItemType::Cell}) {
+        os << (item_type == MeshItemType::Node ? "      <PointData>\n"
+                                               : "      <CellData>\n");
+        for (auto const& declaration : declarations) {
+            if (declaration.item_type != item_type)
+                continue;
+            os << "        <DataArray type=\"" << declaration.type_name
+               << "\" Name=\"" << declaration.name
+               << "\" NumberOfComponents=\"" << declaration.n_components
+               << "\" format=\"appended\" offset=\"" << declaration.offset
+               << "\"/>\n";
+        }
+        os << (item_type == MeshItemType::Node ? "      </PointData>\n"
+                                               : "      </CellData>\n");
+    }
+
+    os << "    </Piece>\n"
+       << "  </UnstructuredGrid>\n"
+       << "  <AppendedData encoding=\"raw\">\n_";
+
+    // Appended blocks, staged one array at a time.
+    AppendedData appended;
+    {
+        std::vector<double> coordinates;
+        coordinates.reserve(3 * nodes.size());
+        for (auto const* node : nodes)
+            for (unsigned d = 0; d < 3; ++d)
+                coordinates.push_back((*node)[d]);
+        appended.writeBlock(os, coordinates);
+    }
+    {
+        std::vector<std::int64_t> connectivity;
+        connectivity.reserve(connectivity_size);
+        for (auto const* element : elements)
+            for (unsigned i = 0; i < element->getNumberOfNodes(); ++i)
+                connectivity.push_back(
+                    static_cast<std::int64_t>(element->getNodeIndex(i)));
+        appended.writeBlock(os, connectivity);
+    }
+    {
+        std::vector<std::int64_t> offsets;
+        offsets.reserve(elements.size());
+        std::int64_t running_offset = 0;
+        for (auto const* element : elements) {
+            running_offset += element->getNumberOfNodes();
+            offsets.push_back(running_offset);
+        }
+        appended.writeBlock(os, offsets);
+    }
+    {
+        std::vector<std::uint8_t> types;
+        types.reserve(elements.size());
+        for (auto const* element : elements)
+            types.push_back(vtkCellType(element->getCellType()));
+        appended.writeBlock(os, types);
+    }
+
+    for (auto const& declaration : declarations) {
+        auto const& name = declaration.name;
+        writePropertyAs<double>(os, properties, name, appended) ||
+            writePropertyAs<float>(os, properties, name, appended) ||
+            writePropertyAs<int>(os, properties, name, appended) ||
+            writePropertyAs<unsigned>(os, properties, name, appended) ||
+            writePropertyAs<long>(os, properties, name, appended) ||
+            writePropertyAs<char>(os, properties, name, appended);
+    }
+
+    os << "\n  </AppendedData>\n</VTKFile>\n";
+
+    return static_cast<bool>(os);
+}
+
+}  // namespace IO
+}  // namespace MeshLib
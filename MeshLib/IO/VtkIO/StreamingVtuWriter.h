@@ -0,0 +1,34 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <string>
+
+namespace MeshLib
+{
+class Mesh;
+
+namespace IO
+{
+
+/// Writes the mesh as appended-binary VTU directly from the mesh arrays,
+/// without the vtkUnstructuredGrid intermediate of VtuInterface.
+///
+/// The writer streams the XML header followed by one raw appended block per
+/// data array (points, connectivity, offsets, types, and the node/cell
+/// property vectors of the common scalar types), so peak memory stays at one
+/// array's staging buffer instead of a full mesh copy. Data produced is
+/// readable by ParaView and the existing VTU reader.
+///
+/// Returns true on success.
+bool writeStreamingVtu(Mesh const& mesh, std::string const& file_name);
+
+}  // namespace IO
+}  // namespace MeshLib
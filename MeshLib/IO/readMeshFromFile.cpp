@@ -30,6 +30,7 @@
 
 #include "MeshLib/Mesh.h"
 
+#include "MeshLib/IO/BinaryMeshIO.h"
 #include "MeshLib/IO/Legacy/MeshIO.h"
 #include "MeshLib/IO/VtkIO/VtuInterface.h"
 
@@ -42,6 +43,19 @@ namespace MeshLib
 {
 namespace IO
 {
+#ifdef USE_PETSC
+namespace
+{
+std::function<MeshLib::Mesh*(std::string const&)> partitioned_mesh_fallback;
+}
+
+void setPartitionedMeshReadFallback(
+    std::function<MeshLib::Mesh*(std::string const&)> fallback)
+{
+    partitioned_mesh_fallback = std::move(fallback);
+}
+#endif
+
 MeshLib::Mesh* readMeshFromFile(const std::string &file_name)
 {
 #ifdef USE_PETSC
@@ -49,8 +63,27 @@ MeshLib::Mesh* readMeshFromFile(const std::string &file_name)
     MPI_Comm_size(MPI_COMM_WORLD, &world_size);
     if (world_size > 1)
     {
-        MeshLib::IO::NodePartitionedMeshReader read_pmesh(PETSC_COMM_WORLD);
         const std::string file_name_base = BaseLib::dropFileExtension(file_name);
+
+        // Without partitioned mesh files for this rank count, hand the
+        // unpartitioned mesh to the registered fallback (in-memory
+        // partitioning at simulation start) instead of failing.
+        std::string const rank_count = std::to_string(world_size);
+        if (partitioned_mesh_fallback &&
+            !BaseLib::IsFileExisting(file_name_base +
+                                     "_partitioned_msh_cfg" + rank_count +
+                                     ".bin") &&
+            !BaseLib::IsFileExisting(file_name_base + "_partitioned_cfg" +
+                                     rank_count + ".msh"))
+        {
+            INFO(
+                "No partitioned mesh files found; partitioning '%s' in "
+                "memory.",
+                file_name.c_str());
+            return partitioned_mesh_fallback(file_name);
+        }
+
+        MeshLib::IO::NodePartitionedMeshReader read_pmesh(PETSC_COMM_WORLD);
         return read_pmesh.read(file_name_base);
     }
     else if (world_size == 1)
@@ -69,6 +102,23 @@ MeshLib::Mesh* readMeshFromFile(const std::string &file_name)
 
 MeshLib::Mesh* readMeshFromFileSerial(const std::string &file_name)
 {
+    // A compiled binary sibling (ogs --compile, Mesh2Binary) that is at
+    // least as new as the source loads in a fraction of the parse time;
+    // prefer it transparently.
+    if (!BaseLib::hasFileExtension("bms", file_name) &&
+        !BaseLib::hasFileExtension("bmo", file_name))
+    {
+        std::string const binary_sibling =
+            BaseLib::dropFileExtension(file_name) + ".bms";
+        if (BaseLib::IsFileExisting(binary_sibling) &&
+            BaseLib::getFileModificationTime(binary_sibling) >=
+                BaseLib::getFileModificationTime(file_name))
+        {
+            INFO("Using the compiled mesh '%s'.", binary_sibling.c_str());
+            return MeshLib::IO::readMeshFromBinaryFile(binary_sibling);
+        }
+    }
+
     if (BaseLib::hasFileExtension("msh", file_name))
     {
         MeshLib::IO::Legacy::MeshIO meshIO;
@@ -78,6 +128,12 @@ MeshLib::Mesh* readMeshFromFileSerial(const std::string &file_name)
     if (BaseLib::hasFileExtension("vtu", file_name))
         return MeshLib::IO::VtuInterface::readVTUFile(file_name);
 
+    if (BaseLib::hasFileExtension("bms", file_name))
+        return MeshLib::IO::readMeshFromBinaryFile(file_name);
+
+    if (BaseLib::hasFileExtension("bmo", file_name))
+        return MeshLib::IO::readMeshOverlayFile(file_name);
+
     ERR("readMeshFromFile(): Unknown mesh file format in file %s.", file_name.c_str());
     return nullptr;
 }
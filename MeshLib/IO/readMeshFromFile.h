@@ -18,6 +18,7 @@
 
 #pragma once
 
+#include <functional>
 #include <string>
 
 namespace MeshLib
@@ -28,5 +29,15 @@ namespace IO
 {
 MeshLib::Mesh* readMeshFromFileSerial(const std::string &file_name);
 MeshLib::Mesh* readMeshFromFile(const std::string &file_name);
+
+#ifdef USE_PETSC
+/// Registers a fallback used by readMeshFromFile() in parallel runs when no
+/// partitioned mesh files exist for the current rank count, e.g. the
+/// in-memory partitioning at simulation start registered by ogs
+/// (cf. ApplicationUtils::enableInMemoryPartitioning()). The fallback gets
+/// the unpartitioned mesh file name and returns the local subdomain mesh.
+void setPartitionedMeshReadFallback(
+    std::function<MeshLib::Mesh*(std::string const&)> fallback);
+#endif
 }
 }
@@ -14,11 +14,14 @@
 
 #include "Mesh.h"
 
+#include <atomic>
+#include <functional>
 #include <memory>
 
 #include "BaseLib/RunTime.h"
 
 #include "Elements/Element.h"
+#include "MeshSearch/MeshElementGrid.h"
 #include "Elements/Tri.h"
 #include "Elements/Quad.h"
 #include "Elements/Tet.h"
@@ -33,7 +36,8 @@ Mesh::Mesh(const std::string &name,
            const std::vector<Node*> &nodes,
            const std::vector<Element*> &elements,
            Properties const& properties,
-           const std::size_t n_base_nodes)
+           const std::size_t n_base_nodes,
+           bool const compute_element_neighbors)
     : _id(_counter_value-1), _mesh_dimension(0),
       _edge_length(std::numeric_limits<double>::max(), 0),
       _node_distance(std::numeric_limits<double>::max(), 0),
@@ -44,13 +48,15 @@ Mesh::Mesh(const std::string &name,
     assert(n_base_nodes <= nodes.size());
     this->resetNodeIDs();
     this->resetElementIDs();
+    this->compactNodeStorage();
     if ((n_base_nodes==0 && hasNonlinearElement()) || isNonlinear())
         this->checkNonlinearNodeIDs();
     this->setDimension();
     this->setElementsConnectedToNodes();
     //this->setNodesConnectedByEdges();
     this->setNodesConnectedByElements();
-    this->setElementNeighbors();
+    if (compute_element_neighbors)
+        this->computeElementNeighbors();
 
     this->calcEdgeLengthRange();
 }
@@ -78,11 +84,13 @@ Mesh::Mesh(const Mesh &mesh)
             _elements[i]->_nodes[j] = _nodes[elements[i]->getNode(j)->getID()];
     }
 
+    this->compactNodeStorage();
+
     if (_mesh_dimension==0) this->setDimension();
     this->setElementsConnectedToNodes();
     //this->setNodesConnectedByEdges();
     //this->setNodesConnectedByElements();
-    this->setElementNeighbors();
+    this->computeElementNeighbors();
 }
 
 Mesh::~Mesh()
@@ -91,19 +99,63 @@ Mesh::~Mesh()
     for (std::size_t i=0; i<nElements; ++i)
         delete _elements[i];
 
+    // Nodes in the compact storage are owned by _compact_nodes; only nodes
+    // added after construction live on the heap.
+    Node const* const compact_begin = _compact_nodes.data();
+    Node const* const compact_end = compact_begin + _compact_nodes.size();
     const std::size_t nNodes (_nodes.size());
     for (std::size_t i=0; i<nNodes; ++i)
+        if (std::less<Node const*>()(_nodes[i], compact_begin) ||
+            !std::less<Node const*>()(_nodes[i], compact_end))
+            delete _nodes[i];
+}
+
+void Mesh::compactNodeStorage()
+{
+    assert(_compact_nodes.empty());
+
+    _compact_nodes.reserve(_nodes.size());
+    for (Node const* node : _nodes)
+        _compact_nodes.emplace_back(*node);
+
+    // Repoint the elements' node arrays into the compact storage. The node
+    // ids have been reset before, i.e., they equal the position in _nodes.
+    for (Element* element : _elements)
+    {
+        const std::size_t n_nodes = element->getNumberOfNodes();
+        for (unsigned i = 0; i < n_nodes; ++i)
+            element->_nodes[i] = &_compact_nodes[element->_nodes[i]->getID()];
+    }
+
+    for (std::size_t i = 0; i < _nodes.size(); ++i)
+    {
         delete _nodes[i];
+        _nodes[i] = &_compact_nodes[i];
+    }
+}
+
+MeshElementGrid const& Mesh::getElementGrid() const
+{
+    if (!_element_grid)
+        _element_grid.reset(new MeshElementGrid(*this));
+    return *_element_grid;
+}
+
+void Mesh::invalidateElementGrid() const
+{
+    _element_grid.reset();
 }
 
 void Mesh::addNode(Node* node)
 {
     _nodes.push_back(node);
+    invalidateElementGrid();
 }
 
 void Mesh::addElement(Element* elem)
 {
     _elements.push_back(elem);
+    invalidateElementGrid();
 
     // add element information to nodes
     unsigned nNodes (elem->getNumberOfNodes());
@@ -127,6 +179,138 @@ void Mesh::resetNodeIDs()
     }
 }
 
+namespace
+{
+/// Compacts the property vector in place with the keep mask matching its
+/// item type; returns true if the vector is of type T and was handled.
+template <typename T>
+bool compactPropertyVectorAs(Properties& properties, std::string const& name,
+                             std::vector<char> const& element_keep,
+                             std::vector<char> const& node_keep)
+{
+    auto* const values = properties.getPropertyVector<T>(name);
+    if (values == nullptr)
+        return false;
+
+    std::vector<char> const* keep = nullptr;
+    if (values->getMeshItemType() == MeshItemType::Cell)
+        keep = &element_keep;
+    else if (values->getMeshItemType() == MeshItemType::Node)
+        keep = &node_keep;
+    if (keep == nullptr ||
+        values->size() != keep->size() * values->getNumberOfComponents())
+    {
+        WARN("Property vector '%s' could not be compacted and was removed.",
+             name.c_str());
+        properties.removePropertyVector(name);
+        return true;
+    }
+
+    auto const n_components = values->getNumberOfComponents();
+    std::size_t out = 0;
+    for (std::size_t i = 0; i < keep->size(); ++i) {
+        if (!(*keep)[i])
+            continue;
+        for (std::size_t c = 0; c < n_components; ++c)
+            (*values)[out++] = (*values)[i * n_components + c];
+    }
+    values->resize(out);
+    return true;
+}
+}  // anonymous namespace
+
+void Mesh::removeElements(std::vector<std::size_t> const& removed_element_ids)
+{
+    if (removed_element_ids.empty())
+        return;
+
+    std::vector<char> element_keep(_elements.size(), 1);
+    for (auto const id : removed_element_ids)
+        element_keep[id] = 0;
+
+    for (auto const id : removed_element_ids)
+    {
+        Element* const element = _elements[id];
+
+        // Only neighbor slots pointing to a removed element become invalid:
+        // removal cannot create new adjacencies.
+        for (unsigned i = 0; i < element->getNumberOfNeighbors(); ++i)
+        {
+            auto* const neighbor =
+                const_cast<Element*>(element->getNeighbor(i));
+            if (neighbor == nullptr || !element_keep[neighbor->getID()])
+                continue;
+            for (unsigned k = 0; k < neighbor->getNumberOfNeighbors(); ++k)
+                if (neighbor->getNeighbor(k) == element)
+                    neighbor->setNeighbor(nullptr, k);
+        }
+
+        // Detach from the elements-connected-to-nodes lists.
+        for (unsigned i = 0; i < element->getNumberOfNodes(); ++i)
+        {
+            auto& node_elements = const_cast<Node*>(element->getNode(i))->_elements;
+            node_elements.erase(std::remove(node_elements.begin(),
+                                            node_elements.end(), element),
+                                node_elements.end());
+        }
+    }
+
+    // Compact the element vector, keeping the order.
+    std::size_t element_out = 0;
+    for (std::size_t i = 0; i < _elements.size(); ++i) {
+        if (element_keep[i])
+            _elements[element_out++] = _elements[i];
+        else
+            delete _elements[i];
+    }
+    _elements.resize(element_out);
+    resetElementIDs();
+
+    // Nodes whose element list became empty are unused now; compact with
+    // the same stable sweep. Nodes owned by the compact storage are only
+    // dropped, cf. the destructor.
+    std::vector<char> node_keep(_nodes.size());
+    Node const* const compact_begin = _compact_nodes.data();
+    Node const* const compact_end = compact_begin + _compact_nodes.size();
+    std::size_t node_out = 0;
+    for (std::size_t i = 0; i < _nodes.size(); ++i) {
+        node_keep[i] = !_nodes[i]->getElements().empty();
+        if (node_keep[i])
+            _nodes[node_out++] = _nodes[i];
+        else if (std::less<Node const*>()(_nodes[i], compact_begin) ||
+                 !std::less<Node const*>()(_nodes[i], compact_end))
+            delete _nodes[i];
+    }
+    _nodes.resize(node_out);
+    if (_n_base_nodes != 0)
+        _n_base_nodes =
+            std::count_if(node_keep.begin(),
+                          node_keep.begin() + _n_base_nodes,
+                          [](char const k) { return k != 0; });
+    resetNodeIDs();
+
+    // Compact the property vectors with the same permutations.
+    auto const names = _properties.getPropertyVectorNames();
+    for (auto const& name : names) {
+        compactPropertyVectorAs<double>(_properties, name, element_keep,
+                                        node_keep) ||
+            compactPropertyVectorAs<float>(_properties, name, element_keep,
+                                           node_keep) ||
+            compactPropertyVectorAs<int>(_properties, name, element_keep,
+                                         node_keep) ||
+            compactPropertyVectorAs<unsigned>(_properties, name, element_keep,
+                                              node_keep) ||
+            compactPropertyVectorAs<long>(_properties, name, element_keep,
+                                          node_keep) ||
+            compactPropertyVectorAs<char>(_properties, name, element_keep,
+                                          node_keep);
+    }
+
+    setDimension();
+    calcEdgeLengthRange();
+    invalidateElementGrid();
+}
+
 void Mesh::resetElementIDs()
 {
     const std::size_t nElements (this->_elements.size());
@@ -144,12 +328,56 @@ void Mesh::setDimension()
 
 void Mesh::setElementsConnectedToNodes()
 {
-    for (auto e = _elements.begin(); e != _elements.end(); ++e)
+    // Counting pass, sizing pass, filling pass; each embarrassingly parallel
+    // with atomic per-node counters. Without OpenMP the sequential execution
+    // reproduces the former element-ordered fill exactly.
+    auto const n_nodes = _nodes.size();
+    std::unique_ptr<std::atomic<unsigned>[]> counts(
+        new std::atomic<unsigned>[n_nodes]);
+    std::ptrdiff_t const n_elements =
+        static_cast<std::ptrdiff_t>(_elements.size());
+
+#pragma omp parallel for schedule(static)
+    for (std::ptrdiff_t i = 0; i < static_cast<std::ptrdiff_t>(n_nodes); ++i)
+        counts[i].store(0, std::memory_order_relaxed);
+
+#pragma omp parallel for schedule(static)
+    for (std::ptrdiff_t e = 0; e < n_elements; ++e)
     {
-        const unsigned nNodes ((*e)->getNumberOfNodes());
+        const unsigned nNodes (_elements[e]->getNumberOfNodes());
         for (unsigned j=0; j<nNodes; ++j)
-            (*e)->_nodes[j]->addElement(*e);
+            counts[_elements[e]->_nodes[j]->getID()].fetch_add(
+                1, std::memory_order_relaxed);
     }
+
+#pragma omp parallel for schedule(static)
+    for (std::ptrdiff_t i = 0; i < static_cast<std::ptrdiff_t>(n_nodes); ++i)
+    {
+        _nodes[i]->_elements.resize(
+            counts[i].load(std::memory_order_relaxed));
+        counts[i].store(0, std::memory_order_relaxed);
+    }
+
+#pragma omp parallel for schedule(static)
+    for (std::ptrdiff_t e = 0; e < n_elements; ++e)
+    {
+        const unsigned nNodes (_elements[e]->getNumberOfNodes());
+        for (unsigned j=0; j<nNodes; ++j)
+        {
+            auto& node = *_elements[e]->_nodes[j];
+            auto const slot = counts[node.getID()].fetch_add(
+                1, std::memory_order_relaxed);
+            node._elements[slot] = _elements[e];
+        }
+    }
+
+    // Restore the deterministic element-id order of the serial fill, which
+    // concurrent filling interleaves arbitrarily.
+#pragma omp parallel for schedule(static)
+    for (std::ptrdiff_t i = 0; i < static_cast<std::ptrdiff_t>(n_nodes); ++i)
+        std::sort(_nodes[i]->_elements.begin(), _nodes[i]->_elements.end(),
+                  [](Element const* const a, Element const* const b)
+                  { return a->getID() < b->getID(); });
 }
 
 void Mesh::resetElementsConnectedToNodes()
@@ -162,23 +390,59 @@ void Mesh::resetElementsConnectedToNodes()
 
 void Mesh::calcEdgeLengthRange()
 {
-    this->_edge_length.first  = std::numeric_limits<double>::max();
-    this->_edge_length.second = 0;
-    double min_length(0);
-    double max_length(0);
-    const std::size_t nElems (this->getNumberOfElements());
-    for (std::size_t i=0; i<nElems; ++i)
+    double edge_length_min = std::numeric_limits<double>::max();
+    double edge_length_max = 0;
+    const std::ptrdiff_t nElems (this->getNumberOfElements());
+#pragma omp parallel for schedule(static)     reduction(min : edge_length_min) reduction(max : edge_length_max)
+    for (std::ptrdiff_t i=0; i<nElems; ++i)
     {
+        double min_length(0);
+        double max_length(0);
         _elements[i]->computeSqrEdgeLengthRange(min_length, max_length);
-        this->_edge_length.first  = std::min(this->_edge_length.first,  min_length);
-        this->_edge_length.second = std::max(this->_edge_length.second, max_length);
+        edge_length_min = std::min(edge_length_min, min_length);
+        edge_length_max = std::max(edge_length_max, max_length);
     }
-    this->_edge_length.first  = sqrt(this->_edge_length.first);
-    this->_edge_length.second = sqrt(this->_edge_length.second);
+    this->_edge_length.first  = sqrt(edge_length_min);
+    this->_edge_length.second = sqrt(edge_length_max);
+}
+
+void Mesh::computeElementNeighbors()
+{
+    if (_element_neighbors_computed)
+        return;
+    _element_neighbors_computed = true;
+    this->setElementNeighbors();
 }
 
 void Mesh::setElementNeighbors()
 {
+#ifdef OGS_USE_OPENMP
+    // Parallel variant: every element sets only its own neighbor slots, the
+    // reciprocal entry is written by the neighbor's own iteration; thereby no
+    // element mutates another one and the loop parallelizes without locks.
+    std::ptrdiff_t const n_elements =
+        static_cast<std::ptrdiff_t>(_elements.size());
+#pragma omp parallel for schedule(static)
+    for (std::ptrdiff_t i = 0; i < n_elements; ++i)
+    {
+        Element *const element = _elements[i];
+        std::vector<Element*> neighbors;
+
+        const std::size_t nNodes (element->getNumberOfBaseNodes());
+        for (unsigned n(0); n<nNodes; ++n)
+        {
+            std::vector<Element*> const& conn_elems ((element->getNode(n)->getElements()));
+            neighbors.insert(neighbors.end(), conn_elems.begin(), conn_elems.end());
+        }
+        std::sort(neighbors.begin(), neighbors.end());
+        auto const neighbors_new_end = std::unique(neighbors.begin(), neighbors.end());
+
+        for (auto neighbor = neighbors.begin(); neighbor != neighbors_new_end; ++neighbor)
+        {
+            element->addNeighbor(*neighbor);
+        }
+    }
+#else
     std::vector<Element*> neighbors;
     for (auto it = _elements.begin(); it != _elements.end(); ++it)
     {
@@ -204,6 +468,7 @@ void Mesh::setElementNeighbors()
         }
         neighbors.clear();
     }
+#endif
 }
 
 void Mesh::setNodesConnectedByEdges()
@@ -15,6 +15,7 @@
 #pragma once
 
 #include <cstdlib>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -33,6 +34,7 @@ namespace MeshLib
 {
     class Node;
     class Element;
+    class MeshElementGrid;
 
 /**
  * A basic mesh.
@@ -56,11 +58,17 @@ public:
     ///                      parameter for nonlinear case.  If the parameter is
     ///                      set to zero, we consider there are no nonlinear
     ///                      nodes.
+    /// @param compute_element_neighbors  Whether the element neighbor
+    ///                      information is computed during construction.
+    ///                      Processes that never call Element::getNeighbor()
+    ///                      can skip this pass and trigger it later via
+    ///                      computeElementNeighbors() if needed.
     Mesh(const std::string &name,
          const std::vector<Node*> &nodes,
          const std::vector<Element*> &elements,
          Properties const& properties = Properties(),
-         const std::size_t n_base_nodes = 0);
+         const std::size_t n_base_nodes = 0,
+         bool const compute_element_neighbors = true);
 
     /// Copy constructor
     Mesh(const Mesh &mesh);
@@ -68,6 +76,24 @@ public:
     /// Destructor
     virtual ~Mesh();
 
+    /// Computes the element neighbor information if it has not been computed
+    /// yet, cf. the constructor's compute_element_neighbors parameter.
+    void computeElementNeighbors();
+
+    /// Returns a persistent element search grid of this mesh.
+    ///
+    /// The grid is built lazily on first access and then reused by all
+    /// consumers, so repeated spatial queries (e.g. the boundary-condition
+    /// node searches in MeshGeoToolsLib) stop paying the construction cost
+    /// per call site. It is invalidated when the mesh is modified via
+    /// addNode()/addElement(); in-place node movements require an explicit
+    /// invalidateElementGrid() call.
+    MeshElementGrid const& getElementGrid() const;
+
+    /// Drops the cached element search grid; it is rebuilt on the next
+    /// getElementGrid() call.
+    void invalidateElementGrid() const;
+
     /// Add a node to the mesh.
     void addNode(Node* node);
 
@@ -104,6 +130,27 @@ public:
     /// Get the element-vector for the mesh.
     std::vector<Element*> const& getElements() const { return _elements; }
 
+    /**
+     * Removes the given elements (and any nodes that become unused) from the
+     * mesh in place.
+     *
+     * Unlike MeshLib::removeElements(), which builds a completely new Mesh
+     * and re-runs the full constructor, this updates the existing topology
+     * incrementally: the element and node vectors are compacted keeping
+     * their order, ids are reset to the new positions, the property vectors
+     * are compacted with the same permutations, the elements-connected-to-
+     * nodes lists lose only the removed entries, and only the neighbor
+     * slots that pointed to a removed element are invalidated (removal
+     * cannot create new adjacencies, so the remaining entries stay valid).
+     * Repeatedly clipping a large mesh thus costs per-clip work
+     * proportional to the touched region plus one compaction sweep, not a
+     * full neighbor search.
+     *
+     * ttention Raw node/element pointers and ids held by callers are
+     * invalidated, as is the element search grid.
+     */
+    void removeElements(std::vector<std::size_t> const& removed_element_ids);
+
     /// Resets the IDs of all mesh-elements to their position in the element vector
     void resetElementIDs();
 
@@ -171,6 +218,15 @@ protected:
     /// Check if the mesh contains any nonlinear element
     bool hasNonlinearElement() const;
 
+    /// Moves the nodes into one contiguous block of storage owned by the
+    /// mesh and repoints the node and element arrays into it.
+    ///
+    /// With the nodes laid out in id order, coordinate access during
+    /// shape-matrix setup is a dense streaming read instead of one pointer
+    /// chase per node. Nodes added after construction via addNode() live on
+    /// the heap as before.
+    void compactNodeStorage();
+
     std::size_t const _id;
     unsigned _mesh_dimension;
     /// The minimal and maximal edge length over all elements in the mesh
@@ -179,11 +235,21 @@ protected:
     std::pair<double, double> _node_distance;
     std::string _name;
     std::vector<Node*> _nodes;
+    /// Contiguous storage of the mesh's nodes, cf. compactNodeStorage(); the
+    /// pointers in _nodes point into this buffer.
+    std::vector<Node> _compact_nodes;
     std::vector<Element*> _elements;
     std::size_t _n_base_nodes;
     Properties _properties;
 
     bool _is_axially_symmetric = false;
+
+    /// Whether computeElementNeighbors() has run, cf. the ctor's
+    /// compute_element_neighbors parameter.
+    bool _element_neighbors_computed = false;
+
+    /// Lazily built element search grid, cf. getElementGrid().
+    mutable std::unique_ptr<MeshElementGrid> _element_grid;
 }; /* class */
 
 
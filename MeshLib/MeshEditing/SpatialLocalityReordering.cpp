@@ -0,0 +1,236 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "SpatialLocalityReordering.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+
+#include <logog/include/logog.hpp>
+
+#include "GeoLib/AABB.h"
+#include "MeshLib/Elements/Elements.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/Node.h"
+
+namespace MeshLib
+{
+
+namespace
+{
+
+/// Spreads the lower 21 bits of the value over every third bit.
+std::uint64_t spreadBits(std::uint64_t value)
+{
+    value &= 0x1fffff;
+    value = (value | value << 32) & 0x1f00000000ffff;
+    value = (value | value << 16) & 0x1f0000ff0000ff;
+    value = (value | value << 8) & 0x100f00f00f00f00f;
+    value = (value | value << 4) & 0x10c30c30c30c30c3;
+    value = (value | value << 2) & 0x1249249249249249;
+    return value;
+}
+
+/// 63-bit Morton code of a point inside the given bounding box; each
+/// coordinate is quantized to 21 bits.
+std::uint64_t mortonCode(double const* const coords,
+                         MathLib::Point3d const& min_point,
+                         double const inverse_extent[3])
+{
+    std::uint64_t code = 0;
+    for (unsigned d = 0; d < 3; ++d) {
+        auto const normalized =
+            (coords[d] - min_point[d]) * inverse_extent[d];
+        auto const quantized = static_cast<std::uint64_t>(
+            std::min(std::max(normalized, 0.0), 1.0) * 0x1fffff);
+        code |= spreadBits(quantized) << d;
+    }
+    return code;
+}
+
+/// Permutes a property vector of type T such that the value of the item that
+/// moves to position i comes from old position permutation[i]. Returns false
+/// if the property is not of type T.
+template <typename T>
+bool permutePropertyVectorAs(Properties const& properties,
+                             Properties& new_properties,
+                             std::string const& name,
+                             std::vector<std::size_t> const& node_permutation,
+                             std::vector<std::size_t> const& cell_permutation)
+{
+    auto const* const property = properties.getPropertyVector<T>(name);
+    if (property == nullptr)
+        return false;
+
+    auto const item_type = property->getMeshItemType();
+    std::vector<std::size_t> const* permutation = nullptr;
+    if (item_type == MeshItemType::Node)
+        permutation = &node_permutation;
+    else if (item_type == MeshItemType::Cell)
+        permutation = &cell_permutation;
+
+    auto* const new_property = new_properties.createNewPropertyVector<T>(
+        name, item_type, property->getNumberOfComponents());
+    if (new_property == nullptr)
+        return true;
+
+    if (permutation == nullptr) {
+        // Integration point or other unhandled item types: copy unchanged.
+        new_property->assign(property->begin(), property->end());
+        return true;
+    }
+
+    auto const n_components = property->getNumberOfComponents();
+    new_property->resize(property->size());
+    for (std::size_t i = 0; i < permutation->size(); ++i)
+        for (std::size_t c = 0; c < n_components; ++c)
+            (*new_property)[i * n_components + c] =
+                (*property)[(*permutation)[i] * n_components + c];
+    return true;
+}
+
+/// Clones the element (including quadratic types) with the node array
+/// translated through new_node_of_old_id.
+Element* cloneElementWithNewNodes(
+    Element const* const element,
+    std::vector<Node*> const& new_node_of_old_id)
+{
+    auto const n_nodes = element->getNumberOfNodes();
+    auto** nodes = new Node*[n_nodes];
+    for (unsigned i = 0; i < n_nodes; ++i)
+        nodes[i] = new_node_of_old_id[element->getNodeIndex(i)];
+
+    switch (element->getCellType()) {
+        case CellType::POINT1: return new Point(nodes);
+        case CellType::LINE2: return new Line(nodes);
+        case CellType::LINE3: return new Line3(nodes);
+        case CellType::TRI3: return new Tri(nodes);
+        case CellType::TRI6: return new Tri6(nodes);
+        case CellType::QUAD4: return new Quad(nodes);
+        case CellType::QUAD8: return new Quad8(nodes);
+        case CellType::QUAD9: return new Quad9(nodes);
+        case CellType::TET4: return new Tet(nodes);
+        case CellType::TET10: return new Tet10(nodes);
+        case CellType::HEX8: return new Hex(nodes);
+        case CellType::HEX20: return new Hex20(nodes);
+        case CellType::PRISM6: return new Prism(nodes);
+        case CellType::PRISM15: return new Prism15(nodes);
+        case CellType::PYRAMID5: return new Pyramid(nodes);
+        case CellType::PYRAMID13: return new Pyramid13(nodes);
+        default:
+            delete [] nodes;
+            ERR("Unsupported cell type during spatial reordering.");
+            return nullptr;
+    }
+}
+
+}  // anonymous namespace
+
+std::unique_ptr<Mesh> createSpatiallyReorderedMesh(Mesh const& mesh)
+{
+    auto const& nodes = mesh.getNodes();
+    auto const& elements = mesh.getElements();
+
+    GeoLib::AABB const aabb(nodes.begin(), nodes.end());
+    auto const& min_point = aabb.getMinPoint();
+    auto const& max_point = aabb.getMaxPoint();
+    double inverse_extent[3];
+    for (unsigned d = 0; d < 3; ++d) {
+        auto const extent = max_point[d] - min_point[d];
+        inverse_extent[d] = (extent > 0.0) ? 1.0 / extent : 0.0;
+    }
+
+    // Node permutation: position i holds the old id of the node that becomes
+    // node i.
+    std::vector<std::size_t> node_permutation(nodes.size());
+    std::iota(node_permutation.begin(), node_permutation.end(), 0);
+    std::stable_sort(
+        node_permutation.begin(), node_permutation.end(),
+        [&](std::size_t const a, std::size_t const b) {
+            return mortonCode(nodes[a]->getCoords(), min_point,
+                              inverse_extent) <
+                   mortonCode(nodes[b]->getCoords(), min_point,
+                              inverse_extent);
+        });
+
+    std::vector<std::size_t> cell_permutation(elements.size());
+    std::iota(cell_permutation.begin(), cell_permutation.end(), 0);
+    {
+        std::vector<std::uint64_t> element_codes(elements.size());
+        for (std::size_t e = 0; e < elements.size(); ++e) {
+            auto const center = elements[e]->getCenterOfGravity();
+            element_codes[e] =
+                mortonCode(center.getCoords(), min_point, inverse_extent);
+        }
+        std::stable_sort(cell_permutation.begin(), cell_permutation.end(),
+                         [&element_codes](std::size_t const a,
+                                          std::size_t const b) {
+                             return element_codes[a] < element_codes[b];
+                         });
+    }
+
+    // New nodes in Morton order; lookup from old node id to new node for the
+    // element copy.
+    std::vector<Node*> new_nodes;
+    new_nodes.reserve(nodes.size());
+    std::vector<Node*> new_node_of_old_id(nodes.size());
+    for (std::size_t i = 0; i < node_permutation.size(); ++i) {
+        auto* const node = new Node(*nodes[node_permutation[i]]);
+        new_nodes.push_back(node);
+        new_node_of_old_id[node_permutation[i]] = node;
+    }
+
+    std::vector<Element*> new_elements;
+    new_elements.reserve(elements.size());
+    for (auto const old_element_id : cell_permutation) {
+        auto* const element = cloneElementWithNewNodes(
+            elements[old_element_id], new_node_of_old_id);
+        new_elements.push_back(element);
+    }
+
+    // Permute the properties accordingly.
+    Properties new_properties;
+    for (auto const& name : mesh.getProperties().getPropertyVectorNames()) {
+        if (!(permutePropertyVectorAs<double>(mesh.getProperties(),
+                                              new_properties, name,
+                                              node_permutation,
+                                              cell_permutation) ||
+              permutePropertyVectorAs<float>(mesh.getProperties(),
+                                             new_properties, name,
+                                             node_permutation,
+                                             cell_permutation) ||
+              permutePropertyVectorAs<int>(mesh.getProperties(),
+                                           new_properties, name,
+                                           node_permutation,
+                                           cell_permutation) ||
+              permutePropertyVectorAs<unsigned>(mesh.getProperties(),
+                                                new_properties, name,
+                                                node_permutation,
+                                                cell_permutation) ||
+              permutePropertyVectorAs<long>(mesh.getProperties(),
+                                            new_properties, name,
+                                            node_permutation,
+                                            cell_permutation) ||
+              permutePropertyVectorAs<char>(mesh.getProperties(),
+                                            new_properties, name,
+                                            node_permutation,
+                                            cell_permutation)))
+        {
+            WARN("Property vector '%s' has an unsupported type and was "
+                 "dropped during reordering.", name.c_str());
+        }
+    }
+
+    return std::unique_ptr<Mesh>(new Mesh(mesh.getName() + "_reordered",
+                                          new_nodes, new_elements,
+                                          new_properties));
+}
+
+}  // namespace MeshLib
@@ -0,0 +1,29 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <memory>
+
+namespace MeshLib
+{
+
+class Mesh;
+
+/// Creates a copy of the mesh with nodes and elements renumbered along a
+/// Morton (Z-order) space-filling curve over the mesh's bounding box.
+///
+/// Nodes are ordered by the Morton code of their coordinates, elements by the
+/// code of their center of gravity; the property vectors are permuted
+/// accordingly. Spatially close entities thereby get close ids, which
+/// improves cache locality of assembly and SpMV on unstructured meshes, in
+/// particular combined with the location-based DOF ordering.
+std::unique_ptr<Mesh> createSpatiallyReorderedMesh(Mesh const& mesh);
+
+}  // namespace MeshLib
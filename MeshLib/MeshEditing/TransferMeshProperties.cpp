@@ -0,0 +1,221 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "TransferMeshProperties.h"
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include <logog/include/logog.hpp>
+
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshSearch/MeshElementGrid.h"
+#include "MeshLib/Node.h"
+#include "MeshLib/Properties.h"
+#include "MeshLib/PropertyVector.h"
+
+namespace
+{
+
+//! Cached location of one target point in the source mesh.
+struct PointLocation
+{
+    //! Containing (or closest) source element id.
+    std::size_t element_id = 0;
+    //! Source node ids and interpolation weights for nodal fields.
+    std::vector<std::size_t> node_ids;
+    std::vector<double> weights;
+    bool found = false;
+};
+
+PointLocation locatePoint(MeshLib::Mesh const& source,
+                     MathLib::Point3d const& point)
+{
+    PointLocation location;
+
+    auto const candidates =
+        source.getElementGrid().getCandidateElementsForPoint(point);
+    MeshLib::Element const* element = nullptr;
+    for (auto const* const candidate : candidates)
+    {
+        if (candidate->isPntInElement(point, 1e-9))
+        {
+            element = candidate;
+            break;
+        }
+    }
+    if (element == nullptr && !candidates.empty())
+    {
+        // Outside the source mesh (e.g. non-matching boundaries after
+        // refinement): fall back to the candidate with the nearest node.
+        double best_distance = std::numeric_limits<double>::max();
+        for (auto const* const candidate : candidates)
+        {
+            for (unsigned i = 0; i < candidate->getNumberOfBaseNodes(); ++i)
+            {
+                double const d =
+                    MathLib::sqrDist(*candidate->getNode(i), point);
+                if (d < best_distance)
+                {
+                    best_distance = d;
+                    element = candidate;
+                }
+            }
+        }
+    }
+    if (element == nullptr)
+        return location;
+
+    location.found = true;
+    location.element_id = element->getID();
+
+    double weight_sum = 0.0;
+    for (unsigned i = 0; i < element->getNumberOfBaseNodes(); ++i)
+    {
+        auto const* const node = element->getNode(i);
+        location.node_ids.push_back(node->getID());
+        double const distance = std::sqrt(MathLib::sqrDist(*node, point));
+        if (distance < std::numeric_limits<double>::epsilon())
+        {
+            location.weights.assign(location.node_ids.size() - 1, 0.0);
+            location.weights.push_back(1.0);
+            for (unsigned j = i + 1; j < element->getNumberOfBaseNodes(); ++j)
+            {
+                location.node_ids.push_back(element->getNode(j)->getID());
+                location.weights.push_back(0.0);
+            }
+            return location;
+        }
+        location.weights.push_back(1.0 / distance);
+        weight_sum += location.weights.back();
+    }
+    for (auto& weight : location.weights)
+        weight /= weight_sum;
+    return location;
+}
+
+MathLib::Point3d elementCentroid(MeshLib::Element const& element)
+{
+    MathLib::Point3d centroid(std::array<double, 3>{{0, 0, 0}});
+    auto const n_nodes = element.getNumberOfBaseNodes();
+    for (unsigned k = 0; k < n_nodes; ++k)
+        for (unsigned d = 0; d < 3; ++d)
+            centroid[d] += (*element.getNode(k))[d] / n_nodes;
+    return centroid;
+}
+
+}  // anonymous namespace
+
+namespace MeshLib
+{
+
+bool transferMeshProperties(Mesh const& source, Mesh& target)
+{
+    // Locate all target nodes and cell centroids; independent queries, run
+    // in parallel.
+    auto const n_nodes = target.getNumberOfNodes();
+    auto const n_elements = target.getNumberOfElements();
+    std::vector<PointLocation> node_locations(n_nodes);
+    std::vector<PointLocation> cell_locations(n_elements);
+
+    source.getElementGrid();  // build once before the parallel region
+
+#pragma omp parallel for schedule(static)
+    for (std::ptrdiff_t i = 0; i < static_cast<std::ptrdiff_t>(n_nodes); ++i)
+        node_locations[i] = locatePoint(source, *target.getNode(i));
+#pragma omp parallel for schedule(static)
+    for (std::ptrdiff_t e = 0; e < static_cast<std::ptrdiff_t>(n_elements);
+         ++e)
+        cell_locations[e] =
+            locatePoint(source, elementCentroid(*target.getElement(e)));
+
+    for (auto const& location : node_locations)
+        if (!location.found)
+        {
+            ERR("A target node could not be located in the source mesh.");
+            return false;
+        }
+    for (auto const& location : cell_locations)
+        if (!location.found)
+        {
+            ERR("A target cell could not be located in the source mesh.");
+            return false;
+        }
+
+    // Transfer every double-typed property vector.
+    auto const& source_properties = source.getProperties();
+    for (auto const& name : source_properties.getPropertyVectorNames())
+    {
+        auto const* const values =
+            source_properties.getPropertyVector<double>(name);
+        if (values == nullptr)
+        {
+            WARN("Property vector '%s' is not of double type and was not "
+                 "transferred.", name.c_str());
+            continue;
+        }
+        auto const n_components = values->getNumberOfComponents();
+
+        if (values->getMeshItemType() == MeshItemType::Node)
+        {
+            auto* const transferred =
+                target.getProperties().createNewPropertyVector<double>(
+                    name, MeshItemType::Node, n_components);
+            if (transferred == nullptr)
+                return false;
+            transferred->resize(n_nodes * n_components);
+#pragma omp parallel for schedule(static)
+            for (std::ptrdiff_t i = 0;
+                 i < static_cast<std::ptrdiff_t>(n_nodes); ++i)
+            {
+                auto const& location = node_locations[i];
+                for (std::size_t c = 0; c < n_components; ++c)
+                {
+                    double value = 0.0;
+                    for (std::size_t k = 0; k < location.node_ids.size();
+                         ++k)
+                        value += location.weights[k] *
+                                 (*values)[location.node_ids[k] *
+                                               n_components +
+                                           c];
+                    (*transferred)[i * n_components + c] = value;
+                }
+            }
+        }
+        else if (values->getMeshItemType() == MeshItemType::Cell)
+        {
+            auto* const transferred =
+                target.getProperties().createNewPropertyVector<double>(
+                    name, MeshItemType::Cell, n_components);
+            if (transferred == nullptr)
+                return false;
+            transferred->resize(n_elements * n_components);
+#pragma omp parallel for schedule(static)
+            for (std::ptrdiff_t e = 0;
+                 e < static_cast<std::ptrdiff_t>(n_elements); ++e)
+            {
+                auto const source_element = cell_locations[e].element_id;
+                for (std::size_t c = 0; c < n_components; ++c)
+                    (*transferred)[e * n_components + c] =
+                        (*values)[source_element * n_components + c];
+            }
+        }
+        else
+            WARN("Property vector '%s' lives on unsupported mesh items and "
+                 "was not transferred.", name.c_str());
+
+        INFO("Transferred property vector '%s'.", name.c_str());
+    }
+
+    return true;
+}
+
+}  // namespace MeshLib
@@ -0,0 +1,38 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+namespace MeshLib
+{
+class Mesh;
+
+/*! Transfers all double-typed node and cell property vectors from the
+ * source mesh onto the target mesh.
+ *
+ * Every target node (and cell centroid) is located in the source mesh
+ * through the persistent element search grid---the per-point queries are
+ * independent and run in parallel---and nodal fields are interpolated with
+ * cached inverse-distance weights over the containing element's corner
+ * nodes (exact at the nodes, a close surrogate of the shape functions
+ * inside, covering all element types without per-type inverse mappings);
+ * cell fields take the containing element's value. Target points outside
+ * the source mesh fall back to the nearest source node of the closest
+ * candidate cell; if no candidate exists at all, the transfer fails.
+ *
+ * A refined-study stage transfers its predecessor's fields this way and
+ * starts warm: the written target mesh serves as the initial-condition
+ * source through the regular MeshNode/MeshElement parameters in the
+ * project file.
+ *
+ * Returns false on failure.
+ */
+bool transferMeshProperties(Mesh const& source, Mesh& target);
+
+}  // namespace MeshLib
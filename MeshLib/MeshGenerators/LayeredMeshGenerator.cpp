@@ -91,14 +91,36 @@ MeshLib::Node* LayeredMeshGenerator::getNewLayerNode(MeshLib::Node const& dem_no
                                                      std::size_t new_node_id) const
 {
     double const elevation = std::min(raster.interpolateValueAtPoint(dem_node), dem_node[2]);
+    return getNewLayerNode(dem_node, last_layer_node, elevation,
+                           raster.getHeader().no_data, new_node_id);
+}
 
-    if ((std::abs(elevation - raster.getHeader().no_data) < std::numeric_limits<double>::epsilon()) ||
+MeshLib::Node* LayeredMeshGenerator::getNewLayerNode(MeshLib::Node const& dem_node,
+                                                     MeshLib::Node const& last_layer_node,
+                                                     double const elevation,
+                                                     double const no_data,
+                                                     std::size_t new_node_id) const
+{
+    if ((std::abs(elevation - no_data) < std::numeric_limits<double>::epsilon()) ||
         (elevation - last_layer_node[2] < _minimum_thickness))
         return new MeshLib::Node(last_layer_node);
     else
         return new MeshLib::Node(dem_node[0], dem_node[1], elevation, new_node_id);
 }
 
+std::vector<double> LayeredMeshGenerator::sampleLayerElevations(
+    std::vector<MeshLib::Node*> const& nodes,
+    GeoLib::Raster const& raster) const
+{
+    std::vector<double> elevations(nodes.size());
+    std::ptrdiff_t const n_nodes = static_cast<std::ptrdiff_t>(nodes.size());
+#pragma omp parallel for schedule(static)
+    for (std::ptrdiff_t i = 0; i < n_nodes; ++i)
+        elevations[i] = std::min(raster.interpolateValueAtPoint(*nodes[i]),
+                                 (*nodes[i])[2]);
+    return elevations;
+}
+
 void LayeredMeshGenerator::cleanUpOnError()
 {
     std::for_each(_nodes.begin(), _nodes.end(), [](MeshLib::Node *node) { delete node; });
@@ -86,6 +86,27 @@ protected:
                                    GeoLib::Raster const& raster,
                                    std::size_t new_node_id) const;
 
+    /**
+    * Variant of getNewLayerNode() for a presampled elevation, cf.
+    * sampleLayerElevations(): the raster access is hoisted out so the
+    * sampling can run in parallel (or through a windowed raster) while the
+    * node construction stays sequential.
+    */
+    MeshLib::Node* getNewLayerNode(MeshLib::Node const& dem_node,
+                                   MeshLib::Node const& last_layer_node,
+                                   double elevation,
+                                   double no_data,
+                                   std::size_t new_node_id) const;
+
+    /**
+    * Samples the raster at all given dem-mesh nodes, constrained by the DEM
+    * as an upper bound. The per-node interpolations are independent and run
+    * in parallel when OpenMP is enabled.
+    */
+    std::vector<double> sampleLayerElevations(
+        std::vector<MeshLib::Node*> const& nodes,
+        GeoLib::Raster const& raster) const;
+
     /// Calculates a data-dependent epsilon value
     double calcEpsilon(GeoLib::Raster const& low, GeoLib::Raster const& high);
 
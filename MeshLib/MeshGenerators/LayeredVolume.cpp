@@ -84,8 +84,14 @@ void LayeredVolume::addLayerToMesh(const MeshLib::Mesh &dem_mesh, unsigned layer
     const std::size_t node_id_offset (_nodes.size());
     const std::size_t last_layer_node_offset (node_id_offset-nNodes);
 
+    // sample in parallel, construct sequentially (deterministic node ids)
+    std::vector<double> const elevations = sampleLayerElevations(nodes, raster);
+    double const no_data = raster.getHeader().no_data;
     for (std::size_t i=0; i<nNodes; ++i)
-        _nodes.push_back(getNewLayerNode(*nodes[i], *_nodes[last_layer_node_offset + i], raster, _nodes.size()));
+        _nodes.push_back(getNewLayerNode(*nodes[i],
+                                         *_nodes[last_layer_node_offset + i],
+                                         elevations[i], no_data,
+                                         _nodes.size()));
 
     const std::vector<MeshLib::Element*> &layer_elements (dem_mesh.getElements());
     for (MeshLib::Element* elem : layer_elements)
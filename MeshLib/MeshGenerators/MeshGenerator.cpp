@@ -28,18 +28,26 @@ std::vector<MeshLib::Node*> MeshGenerator::generateRegularNodes(
     const std::vector<const std::vector<double>*> &vec_xyz_coords,
     const MathLib::Point3d& origin)
 {
-    std::vector<Node*> nodes;
-    nodes.reserve(vec_xyz_coords[0]->size()*vec_xyz_coords[1]->size()*vec_xyz_coords[2]->size());
-
-    for (std::size_t i = 0; i < vec_xyz_coords[2]->size(); i++)
+    auto const n_x = vec_xyz_coords[0]->size();
+    auto const n_y = vec_xyz_coords[1]->size();
+    auto const n_z = vec_xyz_coords[2]->size();
+    std::vector<Node*> nodes(n_x * n_y * n_z);
+
+    // Every iteration writes its own slot, so the numbering is identical
+    // to the former serial append loop for any thread count, and the
+    // threads first-touch the node layers they create.
+    auto const n_layers = static_cast<std::ptrdiff_t>(n_z);
+#pragma omp parallel for schedule(static)
+    for (std::ptrdiff_t i = 0; i < n_layers; i++)
     {
         const double z ((*vec_xyz_coords[2])[i]+origin[2]);
-        for (std::size_t j = 0; j < vec_xyz_coords[1]->size(); j++)
+        std::size_t index = static_cast<std::size_t>(i) * n_x * n_y;
+        for (std::size_t j = 0; j < n_y; j++)
         {
             const double y ((*vec_xyz_coords[1])[j]+origin[1]);
             for (double const x : *vec_xyz_coords[0])
             {
-                nodes.push_back (new Node(x+origin[0], y, z));
+                nodes[index++] = new Node(x+origin[0], y, z);
             }
         }
     }
@@ -300,14 +308,19 @@ Mesh* MeshGenerator::generateRegularHexMesh(
     const unsigned n_y_cells (vec_y.size()-1);
     const unsigned n_z_cells (vec_z.size()-1);
 
-    //elements
-    std::vector<Element*> elements;
-    elements.reserve(n_x_cells * n_y_cells * n_z_cells);
+    //elements; index-addressed parallel construction with the same
+    //numbering as the former serial append loop.
+    std::vector<Element*> elements(n_x_cells * n_y_cells *
+                                   static_cast<std::size_t>(n_z_cells));
 
-    for (std::size_t i = 0; i < n_z_cells; i++)
+    auto const n_layers = static_cast<std::ptrdiff_t>(n_z_cells);
+#pragma omp parallel for schedule(static)
+    for (std::ptrdiff_t i = 0; i < n_layers; i++)
     {
         const std::size_t offset_z1 = i * n_x_nodes * n_y_nodes; // bottom
         const std::size_t offset_z2 = (i + 1) * n_x_nodes * n_y_nodes; // top
+        std::size_t element_index =
+            static_cast<std::size_t>(i) * n_x_cells * n_y_cells;
         for (std::size_t j = 0; j < n_y_cells; j++)
         {
             const std::size_t offset_y1 = j * n_x_nodes;
@@ -325,7 +338,7 @@ Mesh* MeshGenerator::generateRegularHexMesh(
                 element_nodes[5] = nodes[offset_z2 + offset_y1 + k + 1];
                 element_nodes[6] = nodes[offset_z2 + offset_y2 + k + 1];
                 element_nodes[7] = nodes[offset_z2 + offset_y2 + k];
-                elements.push_back (new Hex(element_nodes));
+                elements[element_index++] = new Hex(element_nodes);
             }
         }
     }
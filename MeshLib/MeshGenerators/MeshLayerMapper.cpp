@@ -19,6 +19,7 @@
 #include <logog/include/logog.hpp>
 
 #include "GeoLib/Raster.h"
+#include "GeoLib/WindowedRaster.h"
 
 #include "MathLib/MathTools.h"
 
@@ -164,6 +165,16 @@ bool MeshLayerMapper::createRasterLayers(
 }
 
 void MeshLayerMapper::addLayerToMesh(const MeshLib::Mesh &dem_mesh, unsigned layer_id, GeoLib::Raster const& raster)
+{
+    addLayerToMesh(dem_mesh, layer_id,
+                   sampleLayerElevations(dem_mesh.getNodes(), raster),
+                   raster.getHeader().no_data);
+}
+
+void MeshLayerMapper::addLayerToMesh(const MeshLib::Mesh& dem_mesh,
+                                     unsigned layer_id,
+                                     std::vector<double> const& elevations,
+                                     double no_data)
 {
     const unsigned pyramid_base[3][4] =
     {
@@ -176,9 +187,14 @@ void MeshLayerMapper::addLayerToMesh(const MeshLib::Mesh &dem_mesh, unsigned lay
     std::vector<MeshLib::Node*> const& nodes = dem_mesh.getNodes();
     int const last_layer_node_offset = layer_id * nNodes;
 
-    // add nodes for new layer
+    // add nodes for new layer (the raster sampling already happened in
+    // parallel, cf. sampleLayerElevations(); the sequential loop keeps the
+    // node ids deterministic)
     for (std::size_t i=0; i<nNodes; ++i)
-        _nodes.push_back(getNewLayerNode(*nodes[i], *_nodes[last_layer_node_offset + i], raster, _nodes.size()));
+        _nodes.push_back(getNewLayerNode(*nodes[i],
+                                         *_nodes[last_layer_node_offset + i],
+                                         elevations[i], no_data,
+                                         _nodes.size()));
 
     std::vector<MeshLib::Element*> const& elems = dem_mesh.getElements();
     std::size_t const nElems (dem_mesh.getNumberOfElements());
@@ -228,6 +244,97 @@ void MeshLayerMapper::addLayerToMesh(const MeshLib::Mesh &dem_mesh, unsigned lay
     }
 }
 
+bool MeshLayerMapper::createLayersFromRasterFiles(
+    MeshLib::Mesh const& mesh,
+    std::vector<std::string> const& raster_paths,
+    double minimum_thickness,
+    double noDataReplacementValue)
+{
+    const std::size_t nLayers(raster_paths.size());
+    if (nLayers < 2 || mesh.getDimension() != 2)
+    {
+        ERR("MeshLayerMapper::createLayersFromRasterFiles(): A 2D mesh and "
+            "at least two rasters required as input.");
+        return false;
+    }
+
+    this->_minimum_thickness = minimum_thickness;
+    std::size_t const nNodes = mesh.getNumberOfNodes();
+    _nodes.reserve(nLayers * nNodes);
+
+    std::unique_ptr<MeshLib::Mesh> top(new MeshLib::Mesh(mesh));
+    std::unique_ptr<MeshLib::Mesh> bottom(new MeshLib::Mesh(mesh));
+
+    std::vector<MathLib::Point3d const*> sample_points;
+    sample_points.reserve(nNodes);
+    for (MeshLib::Node const* node : mesh.getNodes())
+        sample_points.push_back(node);
+
+    // Only one raster is open at a time; the windowed reader decodes only
+    // the row tiles the mesh nodes touch.
+    std::vector<double> elevations;
+    double dem_no_data;
+    {
+        GeoLib::WindowedRaster dem_raster(raster_paths.back());
+        dem_no_data = dem_raster.getHeader().no_data;
+        dem_raster.interpolateValuesAtPoints(sample_points, elevations);
+        applyNodeElevations(*top, elevations, dem_no_data,
+                            noDataReplacementValue);
+    }
+    {
+        GeoLib::WindowedRaster bottom_raster(raster_paths.front());
+        bottom_raster.interpolateValuesAtPoints(sample_points, elevations);
+        applyNodeElevations(*bottom, elevations, 
+                            bottom_raster.getHeader().no_data, 0);
+    }
+
+    // add bottom layer
+    for (MeshLib::Node* node : bottom->getNodes())
+        _nodes.push_back(new MeshLib::Node(*node));
+    bottom.reset();
+
+    // number of triangles in the original mesh
+    std::size_t const nElems (std::count_if(mesh.getElements().begin(), mesh.getElements().end(),
+        [](MeshLib::Element const* elem)
+            { return (elem->getGeomType() == MeshLib::MeshElemType::TRIANGLE);}));
+    _elements.reserve(nElems * (nLayers-1));
+    _materials.reserve(nElems *  (nLayers-1));
+
+    // add the other layers; the sample points follow the (constant) xy
+    // positions of the dem mesh, its z only bounds the elevations.
+    for (std::size_t i = 0; i < nLayers - 1; ++i)
+    {
+        GeoLib::WindowedRaster raster(raster_paths[i + 1]);
+        raster.interpolateValuesAtPoints(sample_points, elevations);
+        // Constrain by the DEM as upper bound, cf. sampleLayerElevations().
+        auto const& dem_nodes = top->getNodes();
+        for (std::size_t k = 0; k < nNodes; ++k)
+            if (std::abs(elevations[k] - raster.getHeader().no_data) >=
+                std::numeric_limits<double>::epsilon())
+                elevations[k] = std::min(elevations[k], (*dem_nodes[k])[2]);
+        addLayerToMesh(*top, i, elevations, raster.getHeader().no_data);
+    }
+
+    return true;
+}
+
+void MeshLayerMapper::applyNodeElevations(MeshLib::Mesh& mesh,
+                                          std::vector<double> const& elevations,
+                                          double no_data,
+                                          double noDataReplacementValue)
+{
+    auto const& nodes = mesh.getNodes();
+    for (std::size_t i = 0; i < nodes.size(); ++i)
+    {
+        double elevation = elevations[i];
+        if (std::abs(elevation - no_data) <
+            std::numeric_limits<double>::epsilon())
+            elevation = noDataReplacementValue;
+        nodes[i]->updateCoordinates((*nodes[i])[0], (*nodes[i])[1],
+                                    elevation);
+    }
+}
+
 bool MeshLayerMapper::layerMapping(MeshLib::Mesh &new_mesh, GeoLib::Raster const& raster, double noDataReplacementValue = 0.0)
 {
     if (new_mesh.getDimension() != 2)
@@ -244,9 +351,12 @@ bool MeshLayerMapper::layerMapping(MeshLib::Mesh &new_mesh, GeoLib::Raster const
     const std::pair<double, double> xDim(x0, x0 + header.n_cols * delta); // extension in x-dimension
     const std::pair<double, double> yDim(y0, y0 + header.n_rows * delta); // extension in y-dimension
 
-    const std::size_t nNodes (new_mesh.getNumberOfNodes());
     const std::vector<MeshLib::Node*> &nodes = new_mesh.getNodes();
-    for (unsigned i = 0; i < nNodes; ++i)
+    std::ptrdiff_t const nNodes = static_cast<std::ptrdiff_t>(nodes.size());
+    // The per-node samplings are independent and each iteration only touches
+    // its own node, so the loop runs in parallel when OpenMP is enabled.
+#pragma omp parallel for schedule(static)
+    for (std::ptrdiff_t i = 0; i < nNodes; ++i)
     {
         if (!raster.isPntOnRaster(*nodes[i]))
         {
@@ -54,6 +54,23 @@ public:
                             double minimum_thickness,
                             double noDataReplacementValue = 0.0);
 
+    /**
+    * Variant of createRasterLayers() reading the rasters through
+    * GeoLib::WindowedRaster: only one raster is open at a time and only the
+    * row tiles touched by the mesh nodes are decoded, so a stack of very
+    * large rasters streams through bounded memory instead of being
+    * materialized completely. Only ArcGIS ascii rasters (*.asc) are
+    * supported.
+    * \param mesh                    The 2D triangle mesh the layers are extruded from
+    * \param raster_paths            Raster files from bottom to top (ending with the DEM)
+    * \param minimum_thickness       Minimum thickness of each of the newly created layers
+    * \param noDataReplacementValue  Default z-coordinate for mesh nodes not located on the DEM
+    */
+    bool createLayersFromRasterFiles(MeshLib::Mesh const& mesh,
+                                     std::vector<std::string> const& raster_paths,
+                                     double minimum_thickness,
+                                     double noDataReplacementValue = 0.0);
+
     /**
     * Maps the elevation of nodes of a given 2D mesh according to the raster. At
     * locations where no information is given, node elevation is set to
@@ -67,6 +84,18 @@ public:
 private:
     /// Adds another layer to a subsurface mesh
     void addLayerToMesh(const MeshLib::Mesh &mesh_layer, unsigned layer_id, GeoLib::Raster const& raster);
+
+    /// Variant of addLayerToMesh() for presampled layer elevations, cf.
+    /// LayeredMeshGenerator::sampleLayerElevations().
+    void addLayerToMesh(const MeshLib::Mesh& mesh_layer, unsigned layer_id,
+                        std::vector<double> const& elevations, double no_data);
+
+    /// Sets the node elevations of the 2D mesh from the presampled values,
+    /// using the replacement value where the raster has no data.
+    static void applyNodeElevations(MeshLib::Mesh& mesh,
+                                    std::vector<double> const& elevations,
+                                    double no_data,
+                                    double noDataReplacementValue);
 };
 
 } // end namespace MeshLib
@@ -0,0 +1,80 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+#include "BaseLib/Error.h"
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/Node.h"
+#include "MeshLib/PropertyVector.h"
+
+namespace MeshLib
+{
+
+/*! Seeds a nodal property vector from the analytic field \c f, evaluated in
+ * parallel at the node coordinates.
+ *
+ * \c f is any callable double(MathLib::Point3d const&); raster seeding wraps a
+ * raster query into such a callable (e.g. GeoLib::Raster's interpolation),
+ * so one code path serves analytic fields and rasters alike. Weak-scaling
+ * ladders generate their meshes and initial fields this way per rung
+ * instead of storing one input file per resolution.
+ */
+template <typename Field>
+PropertyVector<double>* seedNodeProperty(Mesh& mesh, std::string const& name,
+                                         Field const& f)
+{
+    auto* const values = mesh.getProperties().createNewPropertyVector<double>(
+        name, MeshItemType::Node, 1);
+    if (values == nullptr)
+        OGS_FATAL("Could not create the node property '%s'.", name.c_str());
+    values->resize(mesh.getNumberOfNodes());
+
+    auto const& nodes = mesh.getNodes();
+    auto const n = static_cast<std::ptrdiff_t>(nodes.size());
+#pragma omp parallel for schedule(static)
+    for (std::ptrdiff_t i = 0; i < n; ++i)
+        (*values)[i] = f(*nodes[i]);
+    return values;
+}
+
+/*! Seeds a cell property vector from the analytic field \c f, evaluated in
+ * parallel at the element node-centroids, cf. seedNodeProperty().
+ */
+template <typename Field>
+PropertyVector<double>* seedCellProperty(Mesh& mesh, std::string const& name,
+                                         Field const& f)
+{
+    auto* const values = mesh.getProperties().createNewPropertyVector<double>(
+        name, MeshItemType::Cell, 1);
+    if (values == nullptr)
+        OGS_FATAL("Could not create the cell property '%s'.", name.c_str());
+    values->resize(mesh.getNumberOfElements());
+
+    auto const& elements = mesh.getElements();
+    auto const n = static_cast<std::ptrdiff_t>(elements.size());
+#pragma omp parallel for schedule(static)
+    for (std::ptrdiff_t i = 0; i < n; ++i)
+    {
+        auto const* const element = elements[i];
+        MathLib::Point3d centroid(std::array<double, 3>{{0, 0, 0}});
+        auto const n_nodes = element->getNumberOfBaseNodes();
+        for (unsigned k = 0; k < n_nodes; ++k)
+            for (unsigned d = 0; d < 3; ++d)
+                centroid[d] += (*element->getNode(k))[d] / n_nodes;
+        (*values)[i] = f(centroid);
+    }
+    return values;
+}
+
+}  // namespace MeshLib
@@ -0,0 +1,139 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <cmath>
+#include <list>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "GeoLib/QuadTree.h"
+#include "MeshLib/Elements/Tri.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/Node.h"
+
+namespace MeshLib
+{
+
+/*! Generates a graded, conforming triangle mesh from a quadtree.
+ *
+ * The quadtree is balanced (2:1 level difference between neighbors) and
+ * every leaf square is fan-triangulated from its center point to its
+ * boundary vertices---the four corners plus the hanging midpoints where a
+ * finer neighbor touches---which resolves all hanging nodes without special
+ * cases. Refining the tree by geometry proximity (addPoint with the
+ * features of interest) thereby yields meshes whose element sizes grade
+ * away from the features, with orders of magnitude fewer elements than a
+ * uniform grid at the finest resolution.
+ *
+ * \param quad_tree the refinement source; balanced by this function.
+ * \param name      the name of the created mesh.
+ */
+template <typename POINT>
+std::unique_ptr<MeshLib::Mesh> generateQuadTreeMesh(
+    GeoLib::QuadTree<POINT>& quad_tree, std::string const& name)
+{
+    quad_tree.balance();
+
+    std::list<GeoLib::QuadTree<POINT>*> leafs;
+    quad_tree.getLeafs(leafs);
+
+    POINT root_ll, root_ur;
+    quad_tree.getSquarePoints(root_ll, root_ur);
+
+    // Quantized coordinate key for node deduplication between leafs.
+    double min_cell_size = root_ur[0] - root_ll[0];
+    for (auto* leaf : leafs)
+    {
+        POINT ll, ur;
+        leaf->getSquarePoints(ll, ur);
+        min_cell_size = std::min(min_cell_size, ur[0] - ll[0]);
+    }
+    double const quantum = min_cell_size / 4;
+
+    std::vector<MeshLib::Node*> nodes;
+    std::map<std::pair<long long, long long>, std::size_t> node_ids;
+    auto const getNode = [&](double const x, double const y) {
+        auto const key = std::make_pair(
+            static_cast<long long>(std::llround(x / quantum)),
+            static_cast<long long>(std::llround(y / quantum)));
+        auto const it = node_ids.find(key);
+        if (it != node_ids.end())
+            return nodes[it->second];
+        auto* const node = new MeshLib::Node(x, y, 0.0, nodes.size());
+        node_ids[key] = nodes.size();
+        nodes.push_back(node);
+        return node;
+    };
+
+    // A neighbor across an edge is finer iff the leaf containing a probe
+    // point just beyond the edge midpoint is smaller than this leaf.
+    auto const hasFinerNeighbor = [&](double const mid_x, double const mid_y,
+                                      double const offset_x,
+                                      double const offset_y,
+                                      double const cell_size) {
+        double const px = mid_x + offset_x;
+        double const py = mid_y + offset_y;
+        if (px <= root_ll[0] || px >= root_ur[0] || py <= root_ll[1] ||
+            py >= root_ur[1])
+            return false;  // domain boundary
+
+        POINT probe;
+        probe[0] = px;
+        probe[1] = py;
+        POINT neighbor_ll, neighbor_ur;
+        quad_tree.getLeaf(probe, neighbor_ll, neighbor_ur);
+        return (neighbor_ur[0] - neighbor_ll[0]) < cell_size * (1 - 1e-9);
+    };
+
+    std::vector<MeshLib::Element*> elements;
+    for (auto* leaf : leafs)
+    {
+        POINT ll, ur;
+        leaf->getSquarePoints(ll, ur);
+        double const s = ur[0] - ll[0];
+        double const probe_offset = s / 8;
+
+        // Boundary vertices in counter-clockwise order, starting at ll.
+        std::vector<MeshLib::Node*> ring;
+        auto const addEdge = [&](double const x0, double const y0,
+                                 double const x1, double const y1,
+                                 double const out_x, double const out_y) {
+            ring.push_back(getNode(x0, y0));
+            double const mx = (x0 + x1) / 2;
+            double const my = (y0 + y1) / 2;
+            if (hasFinerNeighbor(mx, my, out_x * probe_offset,
+                                 out_y * probe_offset, s))
+                ring.push_back(getNode(mx, my));
+        };
+        addEdge(ll[0], ll[1], ur[0], ll[1], 0, -1);  // south
+        addEdge(ur[0], ll[1], ur[0], ur[1], 1, 0);   // east
+        addEdge(ur[0], ur[1], ll[0], ur[1], 0, 1);   // north
+        addEdge(ll[0], ur[1], ll[0], ll[1], -1, 0);  // west
+
+        auto* const center = getNode((ll[0] + ur[0]) / 2, (ll[1] + ur[1]) / 2);
+        for (std::size_t k = 0; k < ring.size(); ++k)
+        {
+            auto** tri_nodes = new MeshLib::Node*[3];
+            tri_nodes[0] = center;
+            tri_nodes[1] = ring[k];
+            tri_nodes[2] = ring[(k + 1) % ring.size()];
+            elements.push_back(new MeshLib::Tri(tri_nodes));
+        }
+    }
+
+    return std::unique_ptr<MeshLib::Mesh>(
+        new MeshLib::Mesh(name, nodes, elements));
+}
+
+}  // namespace MeshLib
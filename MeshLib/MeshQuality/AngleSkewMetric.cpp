@@ -32,9 +32,12 @@ AngleSkewMetric::AngleSkewMetric(Mesh const& mesh) :
 void AngleSkewMetric::calculateQuality ()
 {
     const std::vector<MeshLib::Element*>& elements(_mesh.getElements());
-    const std::size_t nElements (_mesh.getNumberOfElements());
+    const std::ptrdiff_t nElements (_mesh.getNumberOfElements());
 
-    for (std::size_t k(0); k < nElements; k++)
+    // The elements are evaluated independently; parallelized when OpenMP is
+    // enabled.
+#pragma omp parallel for schedule(static)
+    for (std::ptrdiff_t k = 0; k < nElements; k++)
     {
         Element const& elem (*elements[k]);
         switch (elem.getGeomType())
@@ -28,8 +28,11 @@ void EdgeRatioMetric::calculateQuality()
 {
     // get all elements of mesh
     const std::vector<MeshLib::Element*>& elements(_mesh.getElements());
-    const std::size_t nElements (_mesh.getNumberOfElements());
-    for (std::size_t k(0); k < nElements; k++)
+    const std::ptrdiff_t nElements (_mesh.getNumberOfElements());
+    // The elements are evaluated independently; parallelized when OpenMP is
+    // enabled.
+#pragma omp parallel for schedule(static)
+    for (std::ptrdiff_t k = 0; k < nElements; k++)
     {
         Element const& elem (*elements[k]);
         switch (elem.getGeomType())
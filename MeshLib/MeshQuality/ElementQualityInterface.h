@@ -69,6 +69,15 @@ public:
         return empty_quality_vec;
     }
 
+    /// Returns the ids of the n worst elements, sorted worst first; a cheap
+    /// check usable at simulation startup.
+    std::vector<std::size_t> getWorstElementIds(std::size_t n) const
+    {
+        if (_quality_tester)
+            return _quality_tester->getWorstElementIds(n);
+        return std::vector<std::size_t>();
+    }
+
     /// Writes a histogram of the quality vector to a specified file.
     int writeHistogram(std::string const& file_name, std::size_t n_bins = 0) const
     {
@@ -14,7 +14,9 @@
 
 #include "ElementQualityMetric.h"
 
+#include <algorithm>
 #include <cmath>
+#include <numeric>
 
 #include "MeshLib/Node.h"
 
@@ -34,6 +36,23 @@ BaseLib::Histogram<double> ElementQualityMetric::getHistogram (std::size_t n_bin
     return BaseLib::Histogram<double>(getElementQuality(), n_bins, true);
 }
 
+std::vector<std::size_t> ElementQualityMetric::getWorstElementIds(
+    std::size_t n) const
+{
+    n = std::min(n, _element_quality_metric.size());
+
+    std::vector<std::size_t> ids(_element_quality_metric.size());
+    std::iota(ids.begin(), ids.end(), 0);
+    std::partial_sort(ids.begin(), ids.begin() + n, ids.end(),
+                      [this](std::size_t const a, std::size_t const b)
+                      {
+                          return _element_quality_metric[a] <
+                                 _element_quality_metric[b];
+                      });
+    ids.resize(n);
+    return ids;
+}
+
 void ElementQualityMetric::errorMsg (Element const& elem, std::size_t idx) const
 {
     ERR ("Error in MeshQualityChecker::check() - Calculated value of element is below double precision minimum.");
@@ -52,6 +52,11 @@ public:
     /// If no number of bins is specified, one will be calculated based on the Sturges criterium.
     virtual BaseLib::Histogram<double> getHistogram (std::size_t n_bins = 0) const;
 
+    /// Returns the ids of the n elements with the worst (smallest) quality
+    /// values, sorted worst first. A cheap startup check for bad elements
+    /// that avoids writing or inspecting the whole quality vector.
+    std::vector<std::size_t> getWorstElementIds(std::size_t n) const;
+
 protected:
     void errorMsg (Element const& elem, std::size_t idx) const;
 
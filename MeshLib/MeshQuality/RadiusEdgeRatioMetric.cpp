@@ -27,8 +27,11 @@ RadiusEdgeRatioMetric::RadiusEdgeRatioMetric(Mesh const& mesh)
 void RadiusEdgeRatioMetric::calculateQuality ()
 {
     std::vector<MeshLib::Element*> const& elements(_mesh.getElements());
-    std::size_t const nElements (_mesh.getNumberOfElements());
-    for (std::size_t k(0); k < nElements; k++)
+    std::ptrdiff_t const nElements (_mesh.getNumberOfElements());
+    // The elements are evaluated independently; parallelized when OpenMP is
+    // enabled.
+#pragma omp parallel for schedule(static)
+    for (std::ptrdiff_t k = 0; k < nElements; k++)
     {
         Element const& elem (*elements[k]);
         std::size_t const n_nodes (elem.getNumberOfBaseNodes());
@@ -26,10 +26,13 @@ ElementQualityMetric(mesh)
 void SizeDifferenceMetric::calculateQuality()
 {
     std::vector<MeshLib::Element*> const& elements(_mesh.getElements());
-    std::size_t const nElements (_mesh.getNumberOfElements());
+    std::ptrdiff_t const nElements (_mesh.getNumberOfElements());
     std::size_t const mesh_dim (_mesh.getDimension());
 
-    for (std::size_t k=0; k < nElements; ++k)
+    // Neighbor lookups are read-only; the elements are evaluated
+    // independently and the loop parallelizes when OpenMP is enabled.
+#pragma omp parallel for schedule(static)
+    for (std::ptrdiff_t k=0; k < nElements; ++k)
     {
         Element const& elem (*elements[k]);
         if (elem.getDimension() < mesh_dim)
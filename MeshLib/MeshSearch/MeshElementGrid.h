@@ -71,6 +71,30 @@ public:
         return elements_vec;
     }
 
+    /// Returns the candidate elements whose grid cell contains the given
+    /// point; the candidates still have to be tested with an exact
+    /// point-in-element predicate.
+    template <typename POINT>
+    std::vector<MeshLib::Element const*> getCandidateElementsForPoint(
+        POINT const& p) const
+    {
+        return getElementsInVolume(p, p);
+    }
+
+    /// Batched variant of getCandidateElementsForPoint(): one candidate list
+    /// per query point. Amortizes the per-query overhead for the repeated
+    /// point-in-element lookups of, e.g., boundary condition setup.
+    template <typename POINT>
+    std::vector<std::vector<MeshLib::Element const*>>
+    getCandidateElementsForPoints(std::vector<POINT*> const& points) const
+    {
+        std::vector<std::vector<MeshLib::Element const*>> candidates;
+        candidates.reserve(points.size());
+        for (auto const* point : points)
+            candidates.push_back(getCandidateElementsForPoint(*point));
+        return candidates;
+    }
+
     /// Returns the min point of the internal AABB. The method is a wrapper for
     /// GeoLib::AABB::getMinPoint().
     MathLib::Point3d const& getMinPoint() const;
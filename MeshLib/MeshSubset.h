@@ -99,6 +99,21 @@ public:
         return (*_nodes)[i]->getID();
     }
 
+    /// Flattened ids of all registered nodes, built once on first use and
+    /// cached. Consumers iterating whole subsets (DOF construction, BC
+    /// builders) sweep this contiguous array instead of chasing one node
+    /// pointer per item.
+    std::vector<std::size_t> const& getNodeIDs() const
+    {
+        if (_node_ids.empty() && _nodes != nullptr && !_nodes->empty())
+        {
+            _node_ids.reserve(_nodes->size());
+            for (auto const* node : *_nodes)
+                _node_ids.push_back(node->getID());
+        }
+        return _node_ids;
+    }
+
     /// return the number of registered elements
     std::size_t getNumberOfElements() const
     {
@@ -114,6 +129,18 @@ public:
         return (*_eles)[i]->getID();
     }
 
+    /// Flattened ids of all registered elements, cf. getNodeIDs().
+    std::vector<std::size_t> const& getElementIDs() const
+    {
+        if (_element_ids.empty() && _eles != nullptr && !_eles->empty())
+        {
+            _element_ids.reserve(_eles->size());
+            for (auto const* element : *_eles)
+                _element_ids.push_back(element->getID());
+        }
+        return _element_ids;
+    }
+
     std::vector<Element*>::const_iterator elementsBegin() const
     {
         return _msh.getElements().cbegin();
@@ -166,6 +193,10 @@ private:
     std::vector<Element*> const* _eles;
     bool const _delete_ptr = false;
 
+    //! Cached flattened ids, cf. getNodeIDs()/getElementIDs().
+    mutable std::vector<std::size_t> _node_ids;
+    mutable std::vector<std::size_t> _element_ids;
+
 };
 
 }   // namespace MeshLib
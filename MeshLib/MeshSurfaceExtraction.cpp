@@ -205,57 +205,98 @@ void MeshSurfaceExtraction::get2DSurfaceElements(
     double const cos_theta(std::cos(angle * pi / 180.0));
     MathLib::Vector3 const norm_dir(dir.getNormalizedVector());
 
-    for (auto const* elem : all_elements)
+    // Two parallel passes over the elements: count the surface faces each
+    // element contributes, prefix-sum into per-element output offsets, then
+    // emit the face clones into the preallocated vectors. The result is
+    // identical to the old serial append loop---including the (element,
+    // face) output ordering---while both passes run concurrently and the
+    // output vectors are allocated exactly once. The element neighbor
+    // information already identifies boundary faces uniquely, so no face
+    // dedup hashing is needed.
+    auto const n_all_elements =
+        static_cast<std::ptrdiff_t>(all_elements.size());
+
+    auto const surfaceFaceAccepted = [&](MeshLib::Element const* const elem,
+                                         unsigned const j) -> bool {
+        if (elem->getDimension() == 2)
+        {
+            if (complete_surface)
+                return true;
+            return MathLib::scalarProduct(
+                       FaceRule::getSurfaceNormal(elem).getNormalizedVector(),
+                       norm_dir) <= cos_theta;
+        }
+        if (elem->getNeighbor(j) != nullptr)
+            return false;
+        if (complete_surface)
+            return true;
+        auto const face =
+            std::unique_ptr<MeshLib::Element const>{elem->getFace(j)};
+        return MathLib::scalarProduct(FaceRule::getSurfaceNormal(face.get())
+                                          .getNormalizedVector(),
+                                      norm_dir) >= cos_theta;
+    };
+
+    std::vector<std::size_t> offsets(all_elements.size() + 1, 0);
+#pragma omp parallel for schedule(static)
+    for (std::ptrdiff_t i = 0; i < n_all_elements; ++i)
     {
-        const unsigned element_dimension(elem->getDimension());
-        if (element_dimension < mesh_dimension)
+        auto const* const elem = all_elements[i];
+        if (elem->getDimension() < mesh_dimension)
             continue;
+        std::size_t count = 0;
+        if (elem->getDimension() == 2)
+            count = surfaceFaceAccepted(elem, 0) ? 1 : 0;
+        else if (elem->isBoundaryElement())
+        {
+            unsigned const nFaces(elem->getNumberOfFaces());
+            for (unsigned j = 0; j < nFaces; ++j)
+                if (surfaceFaceAccepted(elem, j))
+                    ++count;
+        }
+        offsets[i + 1] = count;
+    }
+    for (std::size_t i = 1; i < offsets.size(); ++i)
+        offsets[i] += offsets[i - 1];
+
+    auto const n_surface_elements = offsets.back();
+    sfc_elements.resize(n_surface_elements);
+    element_to_bulk_element_id_map.resize(n_surface_elements);
+    element_to_bulk_face_id_map.resize(n_surface_elements);
 
-        if (element_dimension == 2)
+#pragma omp parallel for schedule(static)
+    for (std::ptrdiff_t i = 0; i < n_all_elements; ++i)
+    {
+        auto const* const elem = all_elements[i];
+        if (elem->getDimension() < mesh_dimension ||
+            offsets[i] == offsets[i + 1])
+            continue;
+        std::size_t out = offsets[i];
+
+        if (elem->getDimension() == 2)
         {
-            if (!complete_surface)
-            {
-                auto const* face = elem;
-                if (MathLib::scalarProduct(
-                        FaceRule::getSurfaceNormal(face).getNormalizedVector(),
-                        norm_dir) > cos_theta)
-                    continue;
-            }
-            sfc_elements.push_back(elem->clone());
-            element_to_bulk_element_id_map.push_back(elem->getID());
-            element_to_bulk_face_id_map.push_back(0);
+            sfc_elements[out] = elem->clone();
+            element_to_bulk_element_id_map[out] = elem->getID();
+            element_to_bulk_face_id_map[out] = 0;
+            continue;
         }
-        else
+
+        unsigned const nFaces(elem->getNumberOfFaces());
+        for (unsigned j = 0; j < nFaces; ++j)
         {
-            if (!elem->isBoundaryElement())
+            if (!surfaceFaceAccepted(elem, j))
                 continue;
-            const unsigned nFaces(elem->getNumberOfFaces());
-            for (unsigned j = 0; j < nFaces; ++j)
-            {
-                if (elem->getNeighbor(j) != nullptr)
-                    continue;
-
-                auto const face =
-                    std::unique_ptr<MeshLib::Element const>{elem->getFace(j)};
-                if (!complete_surface)
-                {
-                    if (MathLib::scalarProduct(
-                            FaceRule::getSurfaceNormal(face.get())
-                                .getNormalizedVector(),
-                            norm_dir) < cos_theta)
-                    {
-                        continue;
-                    }
-                }
-                if (face->getGeomType() == MeshElemType::TRIANGLE)
-                    sfc_elements.push_back(new MeshLib::Tri(
-                        *static_cast<const MeshLib::Tri*>(face.get())));
-                else
-                    sfc_elements.push_back(new MeshLib::Quad(
-                        *static_cast<const MeshLib::Quad*>(face.get())));
-                element_to_bulk_element_id_map.push_back(elem->getID());
-                element_to_bulk_face_id_map.push_back(j);
-            }
+            auto const face =
+                std::unique_ptr<MeshLib::Element const>{elem->getFace(j)};
+            if (face->getGeomType() == MeshElemType::TRIANGLE)
+                sfc_elements[out] = new MeshLib::Tri(
+                    *static_cast<const MeshLib::Tri*>(face.get()));
+            else
+                sfc_elements[out] = new MeshLib::Quad(
+                    *static_cast<const MeshLib::Quad*>(face.get()));
+            element_to_bulk_element_id_map[out] = elem->getID();
+            element_to_bulk_face_id_map[out] = j;
+            ++out;
         }
     }
 }
@@ -9,7 +9,7 @@
 
 #pragma once
 
-#include <algorithm>
+#include <cstddef>
 #include <vector>
 
 #include "Node.h"
@@ -28,54 +28,88 @@ namespace MeshLib
 /// The topological adjacency of nodes is created by
 /// Mesh::setNodesConnectedByElements() which is usually called upon mesh
 /// construction.
+///
+/// The adjacency lists are stored in CSR layout---one contiguous id array
+/// plus row offsets---instead of one std::vector per node, which removes
+/// millions of small allocations and their per-vector capacity overhead on
+/// large meshes. The table is built in two passes (count, fill) that run in
+/// parallel when OpenMP is enabled.
 class
 NodeAdjacencyTable
 {
 
 public:
+    //! Contiguous view of one node's adjacency list, cf. getAdjacentNodes().
+    class Range
+    {
+    public:
+        Range(std::size_t const* const begin, std::size_t const* const end)
+            : _begin(begin), _end(end)
+        {
+        }
+        std::size_t const* begin() const { return _begin; }
+        std::size_t const* end() const { return _end; }
+        std::size_t size() const { return _end - _begin; }
+        std::size_t operator[](std::size_t const i) const { return _begin[i]; }
+
+    private:
+        std::size_t const* _begin;
+        std::size_t const* _end;
+    };
+
     NodeAdjacencyTable() = default;
 
     explicit
     NodeAdjacencyTable(std::vector<Node*> const& nodes)
     {
-        _data.resize(nodes.size());
-
         createTable(nodes);
     }
 
     std::size_t size() const
     {
-        return _data.size();
+        return _row_offsets.empty() ? 0 : _row_offsets.size() - 1;
     }
 
     std::size_t getNodeDegree(std::size_t const node_id) const
     {
-        return _data[node_id].size();
+        return _row_offsets[node_id + 1] - _row_offsets[node_id];
     }
 
-    std::vector<std::size_t> const& getAdjacentNodes(std::size_t const node_id) const
+    Range getAdjacentNodes(std::size_t const node_id) const
     {
-        return _data[node_id];
+        return Range(_adjacent_ids.data() + _row_offsets[node_id],
+                     _adjacent_ids.data() + _row_offsets[node_id + 1]);
     }
 
     void createTable(std::vector<Node*> const& nodes)
     {
-        if (_data.size() != nodes.size())
-            _data.resize(nodes.size());
-
-        for (auto n_ptr : nodes)
+        auto const n_nodes = static_cast<std::ptrdiff_t>(nodes.size());
+        _row_offsets.assign(nodes.size() + 1, 0);
+
+        // Count pass; every iteration writes only its own entry.
+#pragma omp parallel for schedule(static)
+        for (std::ptrdiff_t i = 0; i < n_nodes; ++i)
+            _row_offsets[nodes[i]->getID() + 1] =
+                nodes[i]->getConnectedNodes().size();
+
+        for (std::size_t i = 1; i < _row_offsets.size(); ++i)
+            _row_offsets[i] += _row_offsets[i - 1];
+
+        // Fill pass into the single contiguous id array.
+        _adjacent_ids.resize(_row_offsets.back());
+#pragma omp parallel for schedule(static)
+        for (std::ptrdiff_t i = 0; i < n_nodes; ++i)
         {
-            std::vector<Node*> const& connected_nodes = n_ptr->getConnectedNodes();
-            std::vector<std::size_t>& row = _data[n_ptr->getID()];
-            row.reserve(connected_nodes.size());
-            std::transform(connected_nodes.cbegin(), connected_nodes.cend(),
-                std::back_inserter(row),
-                [](Node const* const n) { return n->getID(); });
+            auto const& connected_nodes = nodes[i]->getConnectedNodes();
+            std::size_t out = _row_offsets[nodes[i]->getID()];
+            for (Node const* const node : connected_nodes)
+                _adjacent_ids[out++] = node->getID();
         }
     }
 
 private:
-    std::vector<std::vector<std::size_t>> _data;
+    std::vector<std::size_t> _row_offsets;
+    std::vector<std::size_t> _adjacent_ids;
 
 };
 
@@ -24,6 +24,20 @@
 
 namespace MeshLib
 {
+
+/// Contiguous read-only view over a slice of a pointer array, cf. the
+/// owned/ghost range accessors of NodePartitionedMesh.
+template <typename T>
+struct EntityRange
+{
+    T* const* first;
+    T* const* last;
+
+    T* const* begin() const { return first; }
+    T* const* end() const { return last; }
+    std::size_t size() const { return static_cast<std::size_t>(last - first); }
+};
+
 /// A subdomain mesh.
 class NodePartitionedMesh : public Mesh
 {
@@ -36,7 +50,8 @@ class NodePartitionedMesh : public Mesh
               _n_global_base_nodes(mesh.getNumberOfBaseNodes()),
               _n_global_nodes(mesh.getNumberOfNodes()),
               _n_active_base_nodes(mesh.getNumberOfBaseNodes()),
-              _n_active_nodes(mesh.getNumberOfNodes())
+              _n_active_nodes(mesh.getNumberOfNodes()),
+              _n_regular_elements(mesh.getNumberOfElements())
         {
             const auto& mesh_nodes = mesh.getNodes();
             for (std::size_t i = 0; i < _nodes.size(); i++)
@@ -74,6 +89,8 @@ class NodePartitionedMesh : public Mesh
             \param n_base_nodes        Number of the base nodes.
             \param n_active_base_nodes Number of the active base nodes.
             \param n_active_nodes      Number of all active nodes.
+            \param n_regular_elements  Number of regular (non-ghost) elements;
+                                       zero means all elements are regular.
         */
         NodePartitionedMesh(const std::string &name,
                             const std::vector<Node*> &nodes,
@@ -84,13 +101,16 @@ class NodePartitionedMesh : public Mesh
                             const std::size_t n_global_nodes,
                             const std::size_t n_base_nodes,
                             const std::size_t n_active_base_nodes,
-                            const std::size_t n_active_nodes)
+                            const std::size_t n_active_nodes,
+                            const std::size_t n_regular_elements = 0)
             : Mesh(name, nodes, elements, properties, n_base_nodes),
               _global_node_ids(glb_node_ids),
               _n_global_base_nodes(n_global_base_nodes),
               _n_global_nodes(n_global_nodes),
               _n_active_base_nodes(n_active_base_nodes),
-              _n_active_nodes(n_active_nodes)
+              _n_active_nodes(n_active_nodes),
+              _n_regular_elements(n_regular_elements == 0 ? elements.size()
+                                                          : n_regular_elements)
         {
         }
 
@@ -141,6 +161,55 @@ class NodePartitionedMesh : public Mesh
             return _n_base_nodes + _n_active_nodes - _n_active_base_nodes;
         }
 
+        // Owned-first range accessors.
+        //
+        // The node vector is stored as
+        // || active base | ghost base | active higher order | ghost higher
+        // order ||, the element vector as || regular | ghost ||. The
+        // following spans expose these precomputed contiguous partitions, so
+        // hot loops can iterate owned entities without calling isGhostNode()
+        // per item.
+
+        /// Active (owned) base nodes.
+        EntityRange<Node> getActiveBaseNodesRange() const
+        {
+            return {_nodes.data(), _nodes.data() + _n_active_base_nodes};
+        }
+
+        /// Ghost base nodes.
+        EntityRange<Node> getGhostBaseNodesRange() const
+        {
+            return {_nodes.data() + _n_active_base_nodes,
+                    _nodes.data() + _n_base_nodes};
+        }
+
+        /// Active (owned) higher order nodes.
+        EntityRange<Node> getActiveHigherOrderNodesRange() const
+        {
+            return {_nodes.data() + _n_base_nodes,
+                    _nodes.data() + getLargestActiveNodeID()};
+        }
+
+        /// Ghost higher order nodes.
+        EntityRange<Node> getGhostHigherOrderNodesRange() const
+        {
+            return {_nodes.data() + getLargestActiveNodeID(),
+                    _nodes.data() + _nodes.size()};
+        }
+
+        /// Regular (non-ghost) elements.
+        EntityRange<Element> getRegularElementsRange() const
+        {
+            return {_elements.data(), _elements.data() + _n_regular_elements};
+        }
+
+        /// Ghost elements.
+        EntityRange<Element> getGhostElementsRange() const
+        {
+            return {_elements.data() + _n_regular_elements,
+                    _elements.data() + _elements.size()};
+        }
+
         // TODO I guess that is a simplified version of computeSparsityPattern()
         /// Get the maximum number of connected nodes to node.
         std::size_t getMaximumNConnectedNodesToNode() const
@@ -171,6 +240,10 @@ class NodePartitionedMesh : public Mesh
 
         /// Number of the all active nodes.
         std::size_t _n_active_nodes;
+
+        /// Number of regular (non-ghost) elements; the ghost elements are
+        /// stored behind them.
+        std::size_t _n_regular_elements;
 };
 
 }   // namespace MeshLib
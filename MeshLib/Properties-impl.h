@@ -78,6 +78,7 @@ template <typename T>
 PropertyVector<T> const* Properties::getPropertyVector(
     std::string const& name) const
 {
+    materializeIfDeferred(name);
     std::map<std::string, PropertyVectorBase*>::const_iterator it(
         _properties.find(name));
     if (it == _properties.end())
@@ -93,6 +94,7 @@ PropertyVector<T> const* Properties::getPropertyVector(
 template <typename T>
 PropertyVector<T>* Properties::getPropertyVector(std::string const& name)
 {
+    materializeIfDeferred(name);
     std::map<std::string, PropertyVectorBase*>::iterator it(
         _properties.find(name));
     if (it == _properties.end())
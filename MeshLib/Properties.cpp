@@ -32,6 +32,9 @@ void Properties::removePropertyVector(std::string const& name)
 
 bool Properties::hasPropertyVector(std::string const& name) const
 {
+    if (_loaders.find(name) != _loaders.end())
+        return true;
+
     std::map<std::string, PropertyVectorBase*>::const_iterator it(
         _properties.find(name)
     );
@@ -41,11 +44,37 @@ bool Properties::hasPropertyVector(std::string const& name) const
     return true;
 }
 
+void Properties::setPropertyVectorLoader(
+    std::string const& name, std::function<void(Properties&)> loader)
+{
+    if (_properties.find(name) != _properties.end()) {
+        WARN("A property of the name \"%s\" already exists; the deferred "
+             "loader is ignored.", name.c_str());
+        return;
+    }
+    _loaders[name] = std::move(loader);
+}
+
+void Properties::materializeIfDeferred(std::string const& name) const
+{
+    auto const it = _loaders.find(name);
+    if (it == _loaders.end())
+        return;
+
+    // Remove the loader before running it, such that the loader's
+    // createNewPropertyVector() call does not recurse into materialization.
+    auto const loader = std::move(it->second);
+    _loaders.erase(it);
+    loader(const_cast<Properties&>(*this));
+}
+
 std::vector<std::string> Properties::getPropertyVectorNames() const
 {
     std::vector<std::string> names;
     for (auto p : _properties)
         names.push_back(p.first);
+    for (auto const& l : _loaders)
+        names.push_back(l.first);
     return names;
 }
 
@@ -53,6 +82,9 @@ Properties Properties::excludeCopyProperties(
     std::vector<std::size_t> const& exclude_elem_ids,
     std::vector<std::size_t> const& exclude_node_ids) const
 {
+    for (auto const& name : getPropertyVectorNames())
+        materializeIfDeferred(name);
+
     Properties exclude_copy;
     for (auto property_vector : _properties) {
         if (property_vector.second->getMeshItemType() == MeshItemType::Cell) {
@@ -75,6 +107,9 @@ Properties Properties::excludeCopyProperties(
 Properties Properties::excludeCopyProperties(
     std::vector<MeshItemType> const& exclude_mesh_item_types) const
 {
+    for (auto const& name : getPropertyVectorNames())
+        materializeIfDeferred(name);
+
     Properties new_properties;
     for (auto property_vector : _properties) {
         if (std::find(exclude_mesh_item_types.begin(),
@@ -93,8 +128,10 @@ Properties Properties::excludeCopyProperties(
 }
 
 Properties::Properties(Properties const& properties)
-    : _properties(properties._properties)
 {
+    properties.materializeAllDeferred();
+    _properties = properties._properties;
+
     std::vector<std::size_t> exclude_positions;
     for (auto it(_properties.begin()); it != _properties.end(); ++it) {
         PropertyVectorBase *t(it->second->clone(exclude_positions));
@@ -102,6 +139,12 @@ Properties::Properties(Properties const& properties)
     }
 }
 
+void Properties::materializeAllDeferred() const
+{
+    for (auto const& name : getPropertyVectorNames())
+        materializeIfDeferred(name);
+}
+
 Properties::~Properties()
 {
     for (auto property_vector : _properties) {
@@ -14,6 +14,7 @@
 #pragma once
 
 #include <cstdlib>
+#include <functional>
 #include <string>
 #include <map>
 
@@ -91,6 +92,24 @@ public:
 
     void removePropertyVector(std::string const& name);
 
+    /// Registers a deferred loader for a property vector of the given name.
+    ///
+    /// The loader is invoked---and then discarded---on the first access to
+    /// the property via getPropertyVector(), hasPropertyVector() or
+    /// prefetchPropertyVector(); it must create the property vector in the
+    /// passed Properties object. Used, e.g., by the binary mesh format to
+    /// load large cell-data fields lazily, so startup memory scales with the
+    /// used fields instead of the stored ones.
+    void setPropertyVectorLoader(std::string const& name,
+                                 std::function<void(Properties&)> loader);
+
+    /// Materializes the property vector with the given name now if a
+    /// deferred loader was registered for it; no-op otherwise.
+    void prefetchPropertyVector(std::string const& name) const
+    {
+        materializeIfDeferred(name);
+    }
+
     /// Check if a PropertyVector accessible by the name is already
     /// stored within the Properties object.
     /// @param name the name of the property (for instance porosity)
@@ -119,9 +138,21 @@ public:
     ~Properties();
 
 private:
+    /// Runs and removes a registered deferred loader for the given name.
+    void materializeIfDeferred(std::string const& name) const;
+
+    /// Materializes all deferred property vectors; used before whole-object
+    /// copies.
+    void materializeAllDeferred() const;
+
     /// A mapping from property's name to the stored object of any type.
     /// See addProperty() and getProperty() documentation.
-    std::map<std::string, PropertyVectorBase*> _properties;
+    /// Mutable such that deferred property vectors can be materialized on
+    /// first (also const) access.
+    mutable std::map<std::string, PropertyVectorBase*> _properties;
+
+    /// Deferred loaders by property name, cf. setPropertyVectorLoader().
+    mutable std::map<std::string, std::function<void(Properties&)>> _loaders;
 }; // end class
 
 #include "Properties-impl.h"
@@ -0,0 +1,127 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "BaseLib/Error.h"
+#include "Properties.h"
+#include "PropertyVector.h"
+
+namespace MeshLib
+{
+
+/*! Run-length encoded storage for piecewise-constant per-item data.
+ *
+ * MaterialIDs and other segment-wise constant fields hold a handful of
+ * distinct values over millions of items; the encoding stores one (start,
+ * value) pair per run, cutting hundreds of MB of full-width storage and
+ * the bandwidth of sweeping it. Sequential consumers iterate the runs
+ * directly (forEachRun()) or query single items through at() (binary
+ * search over the run starts).
+ */
+template <typename T>
+class RunLengthEncoded final
+{
+public:
+    static RunLengthEncoded encode(std::vector<T> const& values)
+    {
+        RunLengthEncoded encoded;
+        encoded._size = values.size();
+        for (std::size_t i = 0; i < values.size();)
+        {
+            encoded._run_starts.push_back(i);
+            encoded._run_values.push_back(values[i]);
+            while (i < values.size() && values[i] == encoded._run_values.back())
+                ++i;
+        }
+        return encoded;
+    }
+
+    std::size_t size() const { return _size; }
+    std::size_t numberOfRuns() const { return _run_values.size(); }
+
+    //! Compressed footprint in bytes.
+    std::size_t storageBytes() const
+    {
+        return _run_starts.size() * sizeof(std::size_t) +
+               _run_values.size() * sizeof(T);
+    }
+
+    //! Value of the given item; a binary search over the run starts.
+    T at(std::size_t const i) const
+    {
+        assert(i < _size);
+        auto const it = std::upper_bound(_run_starts.begin(),
+                                         _run_starts.end(), i);
+        return _run_values[(it - _run_starts.begin()) - 1];
+    }
+
+    //! Invokes f(first_item, n_items, value) for every run in order; the
+    //! sequential access path that never materializes the full array.
+    template <typename F>
+    void forEachRun(F const& f) const
+    {
+        for (std::size_t r = 0; r < _run_values.size(); ++r)
+        {
+            auto const begin = _run_starts[r];
+            auto const end =
+                r + 1 < _run_starts.size() ? _run_starts[r + 1] : _size;
+            f(begin, end - begin, _run_values[r]);
+        }
+    }
+
+    void decode(std::vector<T>& values) const
+    {
+        values.resize(_size);
+        forEachRun([&values](std::size_t const begin, std::size_t const n,
+                             T const value) {
+            std::fill_n(values.begin() + begin, n, value);
+        });
+    }
+
+private:
+    std::size_t _size = 0;
+    std::vector<std::size_t> _run_starts;
+    std::vector<T> _run_values;
+};
+
+/*! Stores the values run-length encoded in the mesh's properties: only the
+ * compressed form is kept, and the full-width PropertyVector is
+ * materialized through the deferred-loader hook on the first random-access
+ * consumer (getPropertyVector()). Code that never takes a full view---
+ * e.g. writers iterating runs---keeps the memory and bandwidth win.
+ */
+template <typename T>
+void storeCompressedProperty(Properties& properties, std::string const& name,
+                             MeshItemType const item_type,
+                             std::size_t const n_components,
+                             std::vector<T> const& values)
+{
+    // The encoded data lives in the loader closure until (and unless)
+    // someone materializes the vector.
+    auto const encoded = RunLengthEncoded<T>::encode(values);
+    properties.setPropertyVectorLoader(
+        name,
+        [name, item_type, n_components, encoded](Properties& target) {
+            auto* const property = target.createNewPropertyVector<T>(
+                name, item_type, n_components);
+            if (property == nullptr)
+                OGS_FATAL("Could not materialize the compressed property "
+                          "'%s'.", name.c_str());
+            encoded.decode(*property);
+        });
+}
+
+}  // namespace MeshLib
@@ -0,0 +1,155 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <string>
+
+#include "MathLib/Point3d.h"
+
+namespace MeshLib
+{
+
+/*! Implicit regular-grid mesh: nothing but (nx, ny, nz, spacing, origin) is
+ * stored; node coordinates and element-node incidence are computed on the
+ * fly with the exact numbering of MeshGenerator::generateRegularHexMesh
+ * (and the quad generator for nz = 0), so results carry over between the
+ * two representations one to one.
+ *
+ * The general MeshLib::Mesh cannot be specialized this way: Node is a
+ * concrete value type and the whole library passes node/element pointer
+ * arrays,
+ * so an implicit mesh behind those interfaces would have to materialize the
+ * objects anyway. This class therefore targets the code that can be written
+ * against arithmetic accessors directly---structured-grid benchmarks,
+ * ensemble kernels, generators---where it replaces gigabytes of stored
+ * connectivity with index arithmetic and gains the memory bandwidth the
+ * stored representation burns on pointer chasing. toUnstructuredMesh-style
+ * materialization stays with MeshGenerator.
+ */
+class StructuredGridMesh final
+{
+public:
+    /// A 2D grid (quads) results from nz = 0.
+    StructuredGridMesh(std::size_t const nx, std::size_t const ny,
+                       std::size_t const nz, double const dx, double const dy,
+                       double const dz,
+                       MathLib::Point3d const& origin = MathLib::Point3d{
+                           std::array<double, 3>{{0, 0, 0}}})
+        : _nx(nx), _ny(ny), _nz(nz), _dx(dx), _dy(dy), _dz(dz),
+          _origin(origin)
+    {
+    }
+
+    std::size_t getNumberOfNodes() const
+    {
+        return (_nx + 1) * (_ny + 1) * (_nz + 1);
+    }
+
+    std::size_t getNumberOfElements() const
+    {
+        return _nx * _ny * (_nz == 0 ? 1 : _nz);
+    }
+
+    unsigned getDimension() const { return _nz == 0 ? 2 : 3; }
+
+    //! Nodes per element: 4 (quad) or 8 (hex).
+    unsigned getNumberOfElementNodes() const { return _nz == 0 ? 4 : 8; }
+
+    //! Coordinates of the given node, computed from its grid position.
+    MathLib::Point3d getNode(std::size_t const node_id) const
+    {
+        auto const nodes_per_layer = (_nx + 1) * (_ny + 1);
+        auto const k = node_id / nodes_per_layer;
+        auto const j = (node_id % nodes_per_layer) / (_nx + 1);
+        auto const i = node_id % (_nx + 1);
+        return MathLib::Point3d{std::array<double, 3>{
+            {_origin[0] + i * _dx, _origin[1] + j * _dy,
+             _origin[2] + k * _dz}}};
+    }
+
+    //! Node ids of the given element in the generator's node order
+    //! (Quad4/Hex8); for quads only the first four entries are valid.
+    std::array<std::size_t, 8> getElementNodeIDs(
+        std::size_t const element_id) const
+    {
+        auto const elements_per_layer = _nx * _ny;
+        auto const k = _nz == 0 ? 0 : element_id / elements_per_layer;
+        auto const j = (element_id % elements_per_layer) / _nx;
+        auto const i = element_id % _nx;
+
+        auto const n_x_nodes = _nx + 1;
+        auto const nodes_per_layer = n_x_nodes * (_ny + 1);
+        auto const offset_z1 = k * nodes_per_layer;
+        auto const offset_y1 = j * n_x_nodes;
+        auto const offset_y2 = (j + 1) * n_x_nodes;
+
+        std::array<std::size_t, 8> ids;
+        if (_nz == 0)
+        {
+            // Quad numbering of generateRegularQuadMesh.
+            ids[0] = offset_y1 + i;
+            ids[1] = offset_y1 + i + 1;
+            ids[2] = offset_y2 + i + 1;
+            ids[3] = offset_y2 + i;
+            ids[4] = ids[5] = ids[6] = ids[7] = 0;
+            return ids;
+        }
+
+        auto const offset_z2 = (k + 1) * nodes_per_layer;
+        ids[0] = offset_z1 + offset_y1 + i;
+        ids[1] = offset_z1 + offset_y1 + i + 1;
+        ids[2] = offset_z1 + offset_y2 + i + 1;
+        ids[3] = offset_z1 + offset_y2 + i;
+        ids[4] = offset_z2 + offset_y1 + i;
+        ids[5] = offset_z2 + offset_y1 + i + 1;
+        ids[6] = offset_z2 + offset_y2 + i + 1;
+        ids[7] = offset_z2 + offset_y2 + i;
+        return ids;
+    }
+
+    /*! Id of the face-neighboring element along axis \c axis (0..2) in the
+     * negative (\c direction -1) or positive (+1) direction, or npos for a
+     * boundary face---implicit neighbor information without any stored
+     * adjacency.
+     */
+    static const std::size_t npos = static_cast<std::size_t>(-1);
+    std::size_t getElementNeighbor(std::size_t const element_id,
+                                   unsigned const axis,
+                                   int const direction) const
+    {
+        assert(axis < 3 && (direction == 1 || direction == -1));
+        auto const elements_per_layer = _nx * _ny;
+        std::size_t ijk[3] = {
+            element_id % _nx, (element_id % elements_per_layer) / _nx,
+            _nz == 0 ? 0 : element_id / elements_per_layer};
+        std::size_t const extents[3] = {_nx, _ny, _nz == 0 ? 1 : _nz};
+
+        if (direction == -1 && ijk[axis] == 0)
+            return npos;
+        if (direction == 1 && ijk[axis] + 1 == extents[axis])
+            return npos;
+        ijk[axis] += direction;
+        return (ijk[2] * _ny + ijk[1]) * _nx + ijk[0];
+    }
+
+    std::size_t nx() const { return _nx; }
+    std::size_t ny() const { return _ny; }
+    std::size_t nz() const { return _nz; }
+
+private:
+    std::size_t const _nx, _ny, _nz;
+    double const _dx, _dy, _dz;
+    MathLib::Point3d const _origin;
+};
+
+}  // namespace MeshLib
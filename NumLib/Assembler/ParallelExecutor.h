@@ -0,0 +1,141 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace NumLib
+{
+
+/// Executes the passed callable objects in parallel over the elements of a
+/// container using OpenMP worksharing.
+///
+/// The interface is identical to the one of SerialExecutor, such that the
+/// global executor type can be switched between the two implementations
+/// without touching any call site, cf. NumericsConfig.h.
+///
+/// \attention
+/// The callable object is invoked concurrently from several threads. It is the
+/// caller's responsibility that either the invocations do not share mutable
+/// state, or that shared state is protected appropriately, e.g., by splitting
+/// the work into a reentrant compute stage and a serialized scatter stage as
+/// done in ProcessLib::VectorMatrixAssembler.
+///
+/// All loops use static scheduling with contiguous chunks. Thereby every
+/// thread is handed the same element range in every sweep. Since the local
+/// assemblers are also created through this executor (via
+/// transformDereferenced() in createLocalAssemblers()), each thread
+/// constructs---and thereby first-touches---exactly the objects it will
+/// assemble later: under the default first-touch page placement policy of
+/// Linux the per-element data ends up in the memory domain of the socket
+/// that works on it, which avoids cross-socket traffic on NUMA machines.
+struct ParallelExecutor
+{
+    /// Executes \c f for each element from the input container.
+    ///
+    /// The elements of \c c are dereferenced before being passed to \c f.
+    /// Return values of the function call are ignored.
+    ///
+    /// \see SerialExecutor::executeDereferenced()
+    template <typename F, typename C, typename... Args_>
+    static void
+#if defined(_MSC_VER) && (_MSC_VER >= 1700)
+    executeDereferenced(F& f, C const& c, Args_&&... args)
+#else
+    executeDereferenced(F const& f, C const& c, Args_&&... args)
+#endif
+    {
+        std::ptrdiff_t const size = static_cast<std::ptrdiff_t>(c.size());
+#pragma omp parallel for schedule(static)
+        for (std::ptrdiff_t i = 0; i < size; i++)
+            f(i, *c[i], std::forward<Args_>(args)...);
+    }
+
+    /// Executes the given \c method of the given \c object for each element
+    /// from the input \c container.
+    ///
+    /// \see SerialExecutor::executeMemberDereferenced()
+    template <typename Container, typename Object, typename Method,
+              typename... Args>
+    static void executeMemberDereferenced(Object& object, Method method,
+                                          Container const& container,
+                                          Args&&... args)
+    {
+        std::ptrdiff_t const size =
+            static_cast<std::ptrdiff_t>(container.size());
+#pragma omp parallel for schedule(static)
+        for (std::ptrdiff_t i = 0; i < size; i++) {
+            (object.*method)(i, *container[i], std::forward<Args>(args)...);
+        }
+    }
+
+    /// Executes the given \c method of the given \c object for each element
+    /// from the input \c container in the order given by \c execution_order.
+    ///
+    /// \see SerialExecutor::executeMemberDereferencedInOrder()
+    template <typename Container, typename Object, typename Method,
+              typename... Args>
+    static void executeMemberDereferencedInOrder(
+        Object& object, Method method, Container const& container,
+        std::vector<std::size_t> const& execution_order, Args&&... args)
+    {
+        assert(execution_order.size() == container.size());
+
+        std::ptrdiff_t const size =
+            static_cast<std::ptrdiff_t>(execution_order.size());
+#pragma omp parallel for schedule(static)
+        for (std::ptrdiff_t i = 0; i < size; i++) {
+            auto const element_id = execution_order[i];
+            (object.*method)(element_id, *container[element_id],
+                             std::forward<Args>(args)...);
+        }
+    }
+
+    /// Executes the given \c method on each element of the input \c container.
+    ///
+    /// \see SerialExecutor::executeMemberOnDereferenced()
+    template <typename Container, typename Method, typename... Args>
+    static void executeMemberOnDereferenced(Method method,
+                                            Container const& container,
+                                            Args&&... args)
+    {
+        std::ptrdiff_t const size =
+            static_cast<std::ptrdiff_t>(container.size());
+#pragma omp parallel for schedule(static)
+        for (std::ptrdiff_t i = 0; i < size; i++) {
+            ((*container[i]).*method)(i, std::forward<Args>(args)...);
+        }
+    }
+
+    /// Same as executeDereferenced(f, c), but with two containers, where the
+    /// second one is modified.
+    ///
+    /// \see SerialExecutor::transformDereferenced()
+    template <typename F, typename C, typename Data, typename... Args_>
+    static void
+#if defined(_MSC_VER) && (_MSC_VER >= 1700)
+    transformDereferenced(F& f, C const& c, Data& data, Args_&&... args)
+#else
+    transformDereferenced(F const& f, C const& c, Data& data, Args_&&... args)
+#endif
+    {
+        assert(c.size() == data.size());
+
+        std::ptrdiff_t const size = static_cast<std::ptrdiff_t>(c.size());
+#pragma omp parallel for schedule(static)
+        for (std::ptrdiff_t i = 0; i < size; i++)
+            f(i, *c[i], data[i], std::forward<Args_>(args)...);
+    }
+};
+
+}  // namespace NumLib
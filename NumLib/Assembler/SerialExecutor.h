@@ -12,6 +12,11 @@
 
 #pragma once
 
+#include <cassert>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
 namespace NumLib
 {
 
@@ -75,6 +80,34 @@ struct SerialExecutor
         }
     }
 
+    /// Executes the given \c method of the given \c object for each element
+    /// from the input \c container in the order given by \c execution_order.
+    ///
+    /// The index passed on to \c method is the container index, not the
+    /// position in \c execution_order, i.e., only the iteration order differs
+    /// from executeMemberDereferenced(). This is used, e.g., to iterate local
+    /// assemblers bucketed by concrete type, turning megamorphic virtual
+    /// dispatch in the element loop into monomorphic runs.
+    ///
+    /// \pre \c execution_order must be a permutation of
+    ///      [0, \c container.size()).
+    ///
+    /// \see executeMemberDereferenced()
+    template <typename Container, typename Object, typename Method,
+              typename... Args>
+    static void executeMemberDereferencedInOrder(
+        Object& object, Method method, Container const& container,
+        std::vector<std::size_t> const& execution_order, Args&&... args)
+    {
+        assert(execution_order.size() == container.size());
+
+        for (std::size_t i = 0; i < execution_order.size(); i++) {
+            auto const element_id = execution_order[i];
+            (object.*method)(element_id, *container[element_id],
+                             std::forward<Args>(args)...);
+        }
+    }
+
     /// Executes the given \c method on each element of the input \c container.
     ///
     /// This method is very similar to executeMemberDereferenced().
@@ -12,12 +12,9 @@
 
 #pragma once
 
+#include <algorithm>
 #include <limits>
-
-#include <boost/multi_index/composite_key.hpp>
-#include <boost/multi_index/member.hpp>
-#include <boost/multi_index/ordered_index.hpp>
-#include <boost/multi_index_container.hpp>
+#include <vector>
 
 #include "MeshLib/Location.h"
 #include "NumLib/NumericsConfig.h"
@@ -84,37 +81,95 @@ struct LineByLocationAndComponentComparator
 
 struct ByLocation {};
 struct ByLocationAndComponent {};
-struct ByComponent {};
-struct ByGlobalIndex {};
-
-typedef boost::multi_index::multi_index_container<
-        Line,
-        boost::multi_index::indexed_by
-        <
-            boost::multi_index::ordered_unique
-            <
-                boost::multi_index::tag<ByLocationAndComponent>,
-                boost::multi_index::identity<Line>,
-                LineByLocationAndComponentComparator
-            >,
-            boost::multi_index::ordered_non_unique
-            <
-                boost::multi_index::tag<ByLocation>,
-                boost::multi_index::identity<Line>,
-                LineByLocationComparator
-            >,
-            boost::multi_index::ordered_non_unique
-            <
-                boost::multi_index::tag<ByComponent>,
-                boost::multi_index::member<Line, std::size_t, &Line::comp_id>
-            >,
-            boost::multi_index::ordered_non_unique
-            <
-                boost::multi_index::tag<ByGlobalIndex>,
-                boost::multi_index::member<Line, GlobalIndexType, &Line::global_index>
-            >
-        >
-    > ComponentGlobalIndexDict;
+
+/// Flat, cache-friendly dictionary of the (location, component) to global
+/// index lines, replacing the former boost::multi_index container.
+///
+/// The lines are kept in one contiguous vector sorted by (location,
+/// component); lookups are binary searches over that array. Insertion only
+/// appends and marks the array unsorted; the sort happens once on the first
+/// lookup after a bulk of insertions, which makes construction linear-ish
+/// instead of one tree insert per line. The get<Tag>() accessors are
+/// interface shims for the former multi_index views---both views correspond
+/// to the single sort order.
+class ComponentGlobalIndexDict
+{
+public:
+    using const_iterator = std::vector<Line>::const_iterator;
+
+    void insert(Line const& line)
+    {
+        _lines.push_back(line);
+        _sorted = false;
+    }
+
+    std::size_t size() const { return _lines.size(); }
+
+    template <typename Tag>
+    ComponentGlobalIndexDict& get()
+    {
+        ensureSorted();
+        return *this;
+    }
+
+    template <typename Tag>
+    ComponentGlobalIndexDict const& get() const
+    {
+        ensureSorted();
+        return *this;
+    }
+
+    const_iterator begin() const
+    {
+        ensureSorted();
+        return _lines.begin();
+    }
+    const_iterator end() const { return _lines.end(); }
+
+    /// All lines of the given line's location, any component.
+    std::pair<const_iterator, const_iterator> equal_range(Line const& line)
+        const
+    {
+        ensureSorted();
+        return std::equal_range(_lines.begin(), _lines.end(), line,
+                                LineByLocationComparator());
+    }
+
+    /// The line with the given line's location and component; end() if there
+    /// is none.
+    const_iterator find(Line const& line) const
+    {
+        ensureSorted();
+        auto const it =
+            std::lower_bound(_lines.begin(), _lines.end(), line,
+                             LineByLocationAndComponentComparator());
+        if (it == _lines.end() || it->location < line.location ||
+            line.location < it->location || it->comp_id != line.comp_id)
+            return _lines.end();
+        return it;
+    }
+
+    /// Replaces the pointed-to line. The caller must not change the location
+    /// or component (all in-tree users only renumber the global index), so
+    /// the sort order is preserved.
+    void replace(const_iterator position, Line const& line)
+    {
+        _lines[position - _lines.cbegin()] = line;
+    }
+
+private:
+    void ensureSorted() const
+    {
+        if (_sorted)
+            return;
+        std::sort(_lines.begin(), _lines.end(),
+                  LineByLocationAndComponentComparator());
+        _sorted = true;
+    }
+
+    mutable std::vector<Line> _lines;
+    mutable bool _sorted = true;
+};
 
 }    // namespace detail
 }    // namespace NumLib
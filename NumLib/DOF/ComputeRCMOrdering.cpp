@@ -0,0 +1,87 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "ComputeRCMOrdering.h"
+
+#include <algorithm>
+#include <limits>
+#include <queue>
+
+#include "MeshLib/Mesh.h"
+#include "MeshLib/Node.h"
+
+namespace NumLib
+{
+
+std::vector<std::size_t> computeRCMOrdering(MeshLib::Mesh const& mesh)
+{
+    auto const n_nodes = mesh.getNumberOfNodes();
+    auto const& nodes = mesh.getNodes();
+
+    auto const degree = [&nodes](std::size_t const node_id) {
+        return nodes[node_id]->getConnectedNodes().size();
+    };
+
+    std::size_t const unvisited = std::numeric_limits<std::size_t>::max();
+    // Cuthill-McKee numbering; reversed at the end.
+    std::vector<std::size_t> cm_number(n_nodes, unvisited);
+    std::size_t next_number = 0;
+
+    std::vector<std::size_t> neighbors;
+    std::queue<std::size_t> bfs_queue;
+
+    // One BFS per connected component, each started at a node of minimum
+    // degree.
+    for (;;) {
+        std::size_t start = unvisited;
+        std::size_t min_degree = std::numeric_limits<std::size_t>::max();
+        for (std::size_t i = 0; i < n_nodes; ++i) {
+            if (cm_number[i] == unvisited && degree(i) < min_degree) {
+                min_degree = degree(i);
+                start = i;
+            }
+        }
+        if (start == unvisited)
+            break;  // all nodes numbered
+
+        cm_number[start] = next_number++;
+        bfs_queue.push(start);
+
+        while (!bfs_queue.empty()) {
+            auto const current = bfs_queue.front();
+            bfs_queue.pop();
+
+            neighbors.clear();
+            for (auto const* neighbor :
+                 nodes[current]->getConnectedNodes()) {
+                if (cm_number[neighbor->getID()] == unvisited)
+                    neighbors.push_back(neighbor->getID());
+            }
+            std::sort(neighbors.begin(), neighbors.end(),
+                      [&degree](std::size_t const a, std::size_t const b) {
+                          return degree(a) < degree(b);
+                      });
+
+            for (auto const neighbor : neighbors) {
+                if (cm_number[neighbor] != unvisited)
+                    continue;  // may have been numbered via a sibling
+                cm_number[neighbor] = next_number++;
+                bfs_queue.push(neighbor);
+            }
+        }
+    }
+
+    // Reverse the Cuthill-McKee numbering.
+    for (auto& number : cm_number)
+        number = n_nodes - 1 - number;
+
+    return cm_number;
+}
+
+}  // namespace NumLib
@@ -0,0 +1,31 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace MeshLib
+{
+class Mesh;
+}
+
+namespace NumLib
+{
+
+/// Computes a reverse Cuthill-McKee node numbering of the given mesh.
+///
+/// The returned vector maps each old node id to its new number. The numbering
+/// reduces the bandwidth of matrices assembled on the mesh's node
+/// connectivity, which improves ILU fill-in and SpMV locality on unstructured
+/// meshes; cf. the optional DOF renumbering in LocalToGlobalIndexMap.
+std::vector<std::size_t> computeRCMOrdering(MeshLib::Mesh const& mesh);
+
+}  // namespace NumLib
@@ -9,10 +9,27 @@
 
 #include "ComputeSparsityPattern.h"
 
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <tuple>
+
+#include <logog/include/logog.hpp>
+
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/Mesh.h"
+
 #include "LocalToGlobalIndexMap.h"
 #include "MeshLib/NodeAdjacencyTable.h"
 
 #ifdef USE_PETSC
+#include <algorithm>
+#include <limits>
+
+#include "MeshLib/Node.h"
 #include "MeshLib/NodePartitionedMesh.h"
 
 GlobalSparsityPattern computeSparsityPatternPETSc(
@@ -23,12 +40,70 @@ GlobalSparsityPattern computeSparsityPatternPETSc(
     auto const& npmesh =
         *static_cast<MeshLib::NodePartitionedMesh const*>(&mesh);
 
-    auto const max_nonzeroes =   dof_table.getNumberOfComponents()
-                               * npmesh.getMaximumNConnectedNodesToNode();
+    // Exact per-row nonzero counts for this rank's rows, split into the
+    // diagonal (columns owned by this rank) and off-diagonal blocks. The
+    // pattern vector holds the d_nnz counts of all local rows followed by
+    // the o_nnz counts---consumed by the per-row preallocating PETScMatrix
+    // construction, cf. MatrixVectorTraits<PETScMatrix>::newInstance().
+    //
+    // Ghost entries carry non-positive global indices in the DOF tables,
+    // which directly provides the ownership test for the columns; rows are
+    // owned iff their node is not a ghost node.
+    auto const n_local_rows = dof_table.dofSizeWithoutGhosts();
+    GlobalSparsityPattern pattern(2 * n_local_rows, 0);
+
+    // This rank's contiguous row range starts at the minimum owned global
+    // index.
+    GlobalIndexType range_begin = std::numeric_limits<GlobalIndexType>::max();
+    auto const n_nodes = mesh.getNumberOfNodes();
+    for (std::size_t n = 0; n < n_nodes; ++n)
+    {
+        if (npmesh.isGhostNode(mesh.getNode(n)->getID()))
+            continue;
+        MeshLib::Location const l(mesh.getID(), MeshLib::MeshItemType::Node,
+                                  n);
+        for (auto const global_index : dof_table.getGlobalIndices(l))
+            range_begin = std::min(range_begin, global_index);
+    }
 
-    // The sparsity pattern is misused here in the sense that it will only
-    // contain a single value.
-    return GlobalSparsityPattern(1, max_nonzeroes);
+    for (std::size_t n = 0; n < n_nodes; ++n)
+    {
+        auto const* const node = mesh.getNode(n);
+        if (npmesh.isGhostNode(node->getID()))
+            continue;
+
+        // Count the connected dofs, split by column ownership. The node
+        // itself is part of its connected-nodes list.
+        GlobalIndexType n_diagonal = 0;
+        GlobalIndexType n_off_diagonal = 0;
+        for (auto const* const connected_node : node->getConnectedNodes())
+        {
+            MeshLib::Location const lc(mesh.getID(),
+                                       MeshLib::MeshItemType::Node,
+                                       connected_node->getID());
+            for (auto const global_index : dof_table.getGlobalIndices(lc))
+            {
+                if (global_index > 0 || (global_index == 0 &&
+                                         !npmesh.isGhostNode(
+                                             connected_node->getID())))
+                    ++n_diagonal;
+                else
+                    ++n_off_diagonal;
+            }
+        }
+
+        MeshLib::Location const l(mesh.getID(), MeshLib::MeshItemType::Node,
+                                  n);
+        for (auto const global_index : dof_table.getGlobalIndices(l))
+        {
+            auto const row = global_index - range_begin;
+            assert(row >= 0 && row < static_cast<GlobalIndexType>(n_local_rows));
+            pattern[row] = n_diagonal;
+            pattern[n_local_rows + row] = n_off_diagonal;
+        }
+    }
+
+    return pattern;
 }
 #else
 GlobalSparsityPattern computeSparsityPatternNonPETSc(
@@ -37,21 +112,27 @@ GlobalSparsityPattern computeSparsityPatternNonPETSc(
     MeshLib::NodeAdjacencyTable node_adjacency_table;
     node_adjacency_table.createTable(mesh.getNodes());
 
+    auto const n_nodes =
+        static_cast<std::ptrdiff_t>(mesh.getNumberOfNodes());
+
     // A mapping   mesh node id -> global indices
-    // It acts as a cache for dof table queries.
-    std::vector<std::vector<GlobalIndexType>> global_idcs;
+    // It acts as a cache for dof table queries. The per-node queries are
+    // independent, so the loop parallelizes when OpenMP is enabled.
+    std::vector<std::vector<GlobalIndexType>> global_idcs(n_nodes);
 
-    global_idcs.reserve(mesh.getNumberOfNodes());
-    for (std::size_t n = 0; n < mesh.getNumberOfNodes(); ++n)
+#pragma omp parallel for schedule(static)
+    for (std::ptrdiff_t n = 0; n < n_nodes; ++n)
     {
         MeshLib::Location l(mesh.getID(), MeshLib::MeshItemType::Node, n);
-        global_idcs.push_back(dof_table.getGlobalIndices(l));
+        global_idcs[n] = dof_table.getGlobalIndices(l);
     }
 
     GlobalSparsityPattern sparsity_pattern(dof_table.dofSizeWithGhosts());
 
-    // Map adjacent mesh nodes to "adjacent global indices".
-    for (std::size_t n = 0; n < mesh.getNumberOfNodes(); ++n)
+    // Map adjacent mesh nodes to "adjacent global indices". Every node
+    // writes only its own global indices' rows, so this is race-free.
+#pragma omp parallel for schedule(static)
+    for (std::ptrdiff_t n = 0; n < n_nodes; ++n)
     {
         unsigned n_connected_dof = 0;
         for (auto an : node_adjacency_table.getAdjacentNodes(n))
@@ -66,14 +147,146 @@ GlobalSparsityPattern computeSparsityPatternNonPETSc(
 
 namespace NumLib
 {
+
+namespace
+{
+std::string sparsity_pattern_cache_directory;
+
+/// FNV-1a hash of the mesh connectivity (cell types and node ids). One
+/// integer sweep; it makes the cache key content-based, so a mesh file
+/// edited in place under the same name and counts cannot replay a stale
+/// pattern.
+std::uint64_t connectivityHash(MeshLib::Mesh const& mesh)
+{
+    std::uint64_t hash = 14695981039346656037ull;
+    auto const mix = [&hash](std::uint64_t const value) {
+        hash ^= value;
+        hash *= 1099511628211ull;
+    };
+    for (auto const* const element : mesh.getElements())
+    {
+        mix(static_cast<std::uint64_t>(element->getCellType()));
+        for (unsigned i = 0; i < element->getNumberOfNodes(); ++i)
+            mix(element->getNodeIndex(i));
+    }
+    return hash;
+}
+
+/// File name of the cached pattern for the given key data; empty if the disk
+/// cache is disabled.
+std::string cacheFileName(MeshLib::Mesh const& mesh,
+                          unsigned const n_components,
+                          std::size_t const n_dof,
+                          GlobalIndexType const ordering_sample)
+{
+    if (sparsity_pattern_cache_directory.empty())
+        return "";
+
+    std::ostringstream key;
+    key << mesh.getName() << '_' << mesh.getNumberOfNodes() << '_'
+        << mesh.getNumberOfElements() << '_' << n_components << '_' << n_dof
+        << '_' << ordering_sample << '_' << connectivityHash(mesh);
+    auto const hash = std::hash<std::string>()(key.str());
+
+    std::ostringstream file_name;
+    file_name << sparsity_pattern_cache_directory << '/' << mesh.getName()
+              << '_' << std::hex << hash << ".sparsity";
+    return file_name.str();
+}
+
+bool readPatternFromFile(std::string const& file_name,
+                         GlobalSparsityPattern& pattern)
+{
+    std::ifstream in(file_name, std::ios::binary);
+    if (!in)
+        return false;
+
+    std::uint64_t size;
+    in.read(reinterpret_cast<char*>(&size), sizeof(size));
+    if (!in)
+        return false;
+    pattern.resize(size);
+    in.read(reinterpret_cast<char*>(pattern.data()),
+            size * sizeof(pattern[0]));
+    return static_cast<bool>(in);
+}
+
+void writePatternToFile(std::string const& file_name,
+                        GlobalSparsityPattern const& pattern)
+{
+    std::ofstream out(file_name, std::ios::binary);
+    if (!out) {
+        WARN("Could not write the sparsity pattern cache file '%s'.",
+             file_name.c_str());
+        return;
+    }
+    std::uint64_t const size = pattern.size();
+    out.write(reinterpret_cast<char const*>(&size), sizeof(size));
+    out.write(reinterpret_cast<char const*>(pattern.data()),
+              size * sizeof(pattern[0]));
+}
+}  // anonymous namespace
+
+void enableSparsityPatternDiskCache(std::string const& directory)
+{
+    sparsity_pattern_cache_directory = directory;
+}
+
 GlobalSparsityPattern computeSparsityPattern(
     LocalToGlobalIndexMap const& dof_table, MeshLib::Mesh const& mesh)
 {
+    // Processes sharing the same mesh and DOF layout (same number of
+    // components and DOFs, e.g. flow plus transport in coupled runs)
+    // construct identical patterns; cache and reuse them.
+    using CacheKey =
+        std::tuple<std::size_t, unsigned, std::size_t, GlobalIndexType>;
+    static std::map<CacheKey, GlobalSparsityPattern> cache;
+    static std::mutex cache_mutex;
+
+    // The sampled global index of the second node distinguishes
+    // by-location from by-component ordered tables of the same size.
+    GlobalIndexType ordering_sample = 0;
+    if (mesh.getNumberOfNodes() > 1)
+    {
+        auto const sample_indices = dof_table.getGlobalIndices(
+            MeshLib::Location(mesh.getID(), MeshLib::MeshItemType::Node, 1));
+        if (!sample_indices.empty())
+            ordering_sample = sample_indices.front();
+    }
+
+    CacheKey const key{mesh.getID(), dof_table.getNumberOfComponents(),
+                       dof_table.dofSizeWithGhosts(), ordering_sample};
+
+    {
+        std::lock_guard<std::mutex> const lock(cache_mutex);
+        auto const it = cache.find(key);
+        if (it != cache.end())
+            return it->second;
+    }
+
+    auto const cache_file = cacheFileName(
+        mesh, dof_table.getNumberOfComponents(), dof_table.dofSizeWithGhosts(),
+        ordering_sample);
+
+    GlobalSparsityPattern pattern;
+    if (!cache_file.empty() && readPatternFromFile(cache_file, pattern))
+    {
+        DBUG("Sparsity pattern loaded from '%s'.", cache_file.c_str());
+    }
+    else
+    {
 #ifdef USE_PETSC
-    return computeSparsityPatternPETSc(dof_table, mesh);
+        pattern = computeSparsityPatternPETSc(dof_table, mesh);
 #else
-    return computeSparsityPatternNonPETSc(dof_table, mesh);
+        pattern = computeSparsityPatternNonPETSc(dof_table, mesh);
 #endif
+        if (!cache_file.empty())
+            writePatternToFile(cache_file, pattern);
+    }
+
+    std::lock_guard<std::mutex> const lock(cache_mutex);
+    cache[key] = pattern;
+    return pattern;
 }
 
 }
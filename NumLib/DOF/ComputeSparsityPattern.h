@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include <string>
 #include <vector>
 
 #include "NumLib/NumericsConfig.h"
@@ -32,4 +33,13 @@ class LocalToGlobalIndexMap;
  */
 GlobalSparsityPattern computeSparsityPattern(
     LocalToGlobalIndexMap const& dof_table, MeshLib::Mesh const& mesh);
+
+/// Enables the on-disk cache for computed sparsity patterns in the given
+/// directory, cf. the --cache-directory command line option.
+///
+/// Patterns are stored keyed by a hash of the mesh (name, node and element
+/// counts) and the DOF layout (component count, DOF count, ordering), so
+/// repeated runs of the same mesh/process combination---parameter
+/// studies---load the pattern instead of rebuilding it.
+void enableSparsityPatternDiskCache(std::string const& directory);
 }
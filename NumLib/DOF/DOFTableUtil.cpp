@@ -75,6 +75,32 @@ std::vector<GlobalIndexType> getIndices(
     return indices;
 }
 
+void getIndices(std::size_t const mesh_item_id,
+                NumLib::LocalToGlobalIndexMap const& dof_table,
+                std::vector<GlobalIndexType>& indices)
+{
+    assert(dof_table.size() > mesh_item_id);
+
+    // Fast path: fetch the baked, contiguous per-element span.
+    if (dof_table.hasBakedElementIndices()) {
+        auto const* const baked =
+            dof_table.getBakedElementIndices(mesh_item_id);
+        indices.assign(baked,
+                       baked + dof_table.getNumberOfElementDOF(mesh_item_id));
+        return;
+    }
+
+    indices.clear();
+
+    // Local matrices and vectors will always be ordered by component
+    // no matter what the order of the global matrix is.
+    for (unsigned c = 0; c < dof_table.getNumberOfComponents(); ++c) {
+        auto const& idcs = dof_table(mesh_item_id, c).rows;
+        indices.reserve(indices.size() + idcs.size());
+        indices.insert(indices.end(), idcs.begin(), idcs.end());
+    }
+}
+
 NumLib::LocalToGlobalIndexMap::RowColumnIndices getRowColumnIndices(
     std::size_t const id,
     NumLib::LocalToGlobalIndexMap const& dof_table,
@@ -96,6 +122,66 @@ NumLib::LocalToGlobalIndexMap::RowColumnIndices getRowColumnIndices(
 }
 
 
+std::vector<GlobalIndexType> getComponentIndices(
+    unsigned const global_component, LocalToGlobalIndexMap const& dof_table,
+    MeshLib::Mesh const& mesh)
+{
+    std::vector<GlobalIndexType> indices;
+
+    MeshLib::MeshSubsets const& mss =
+        dof_table.getMeshSubsets(global_component);
+    for (unsigned i = 0; i < mss.size(); i++)
+    {
+        MeshLib::MeshSubset const& ms = mss.getMeshSubset(i);
+        if (ms.getMeshID() != mesh.getID())
+            continue;
+        for (MeshLib::Node const* node : ms.getNodes())
+        {
+            MeshLib::Location const l{mesh.getID(),
+                                      MeshLib::MeshItemType::Node,
+                                      node->getID()};
+            indices.push_back(
+                dof_table.getGlobalIndex(l, global_component));
+        }
+    }
+    return indices;
+}
+
+double norm(GlobalVector const& x,
+            std::vector<GlobalIndexType> const& component_indices,
+            MathLib::VecNormType norm_type)
+{
+    switch (norm_type)
+    {
+        case MathLib::VecNormType::NORM1:
+        {
+            double result = 0.0;
+            for (auto const index : component_indices)
+                result += std::abs(x.get(index));
+            return result;
+        }
+        case MathLib::VecNormType::NORM2:
+        {
+            double result = 0.0;
+            for (auto const index : component_indices)
+            {
+                auto const value = x.get(index);
+                result += value * value;
+            }
+            return std::sqrt(result);
+        }
+        case MathLib::VecNormType::INFINITY_N:
+        {
+            double result = 0.0;
+            for (auto const index : component_indices)
+                result = std::max(result, std::abs(x.get(index)));
+            return result;
+        }
+        default:
+            OGS_FATAL("An invalid norm type has been passed.");
+    }
+}
+
 double norm(GlobalVector const& x, unsigned const global_component,
             MathLib::VecNormType norm_type,
             LocalToGlobalIndexMap const& dof_table, MeshLib::Mesh const& mesh)
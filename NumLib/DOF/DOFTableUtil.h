@@ -27,6 +27,14 @@ std::vector<GlobalIndexType> getIndices(
     std::size_t const mesh_item_id,
     NumLib::LocalToGlobalIndexMap const& dof_table);
 
+//! Fills \c indices with the nodal indices for the item identified by
+//! \c mesh_item_id from the given \c dof_table. In contrast to the
+//! value-returning overload this does not allocate once the buffer has
+//! reached its final capacity.
+void getIndices(std::size_t const mesh_item_id,
+                NumLib::LocalToGlobalIndexMap const& dof_table,
+                std::vector<GlobalIndexType>& indices);
+
 //! Returns row/column indices for the item identified by \c id from the
 //! given \c dof_table.
 LocalToGlobalIndexMap::RowColumnIndices getRowColumnIndices(
@@ -42,4 +50,18 @@ double norm(GlobalVector const& x, unsigned const global_component,
             MathLib::VecNormType norm_type,
             LocalToGlobalIndexMap const& dof_table, MeshLib::Mesh const& mesh);
 
+//! Collects the global indices of the given component's DOFs once, for use
+//! with the index-based norm() overload. Caching the returned index mask
+//! turns repeated per-component norms (convergence checking every nonlinear
+//! iteration) into plain strided sweeps without any DOF-table lookups.
+std::vector<GlobalIndexType> getComponentIndices(
+    unsigned const global_component, LocalToGlobalIndexMap const& dof_table,
+    MeshLib::Mesh const& mesh);
+
+//! Computes the specified norm over the given precollected component
+//! indices of the vector x, cf. getComponentIndices().
+double norm(GlobalVector const& x,
+            std::vector<GlobalIndexType> const& component_indices,
+            MathLib::VecNormType norm_type);
+
 }  // namespace NumLib
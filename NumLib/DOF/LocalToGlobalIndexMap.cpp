@@ -12,9 +12,56 @@
 #include <algorithm>
 #include <unordered_set>
 
+#include <logog/include/logog.hpp>
+
+#ifdef OGS_DOF_ORDER_RCM
+#include "NumLib/DOF/ComputeRCMOrdering.h"
+#endif
+
 namespace NumLib
 {
 
+#ifdef OGS_DOF_ORDER_RCM
+namespace
+{
+//! Applies the bandwidth-reducing reverse Cuthill-McKee renumbering to the
+//! mesh component map, if the components form the common single-mesh,
+//! nodes-only layout; cf. computeRCMOrdering(). The permutation is
+//! transparent for everything accessing the DOFs through the table.
+void renumberByRCM(
+    std::vector<std::unique_ptr<MeshLib::MeshSubsets>> const& mesh_subsets,
+    MeshComponentMap& mesh_component_map)
+{
+    MeshLib::Mesh const* common_mesh = nullptr;
+    for (auto const& mss : mesh_subsets)
+    {
+        for (std::size_t i = 0; i < mss->size(); ++i)
+        {
+            auto const& ms = mss->getMeshSubset(i);
+            if (common_mesh == nullptr)
+                common_mesh = &ms.getMesh();
+            if (ms.getMeshID() != common_mesh->getID() ||
+                ms.getNumberOfNodes() != common_mesh->getNumberOfNodes() ||
+                ms.getNumberOfElements() != 0)
+            {
+                WARN(
+                    "RCM DOF renumbering is only implemented for components "
+                    "spanning all nodes of one common mesh; keeping the "
+                    "original DOF order.");
+                return;
+            }
+        }
+    }
+    if (common_mesh == nullptr)
+        return;
+
+    DBUG("Applying RCM DOF renumbering.");
+    mesh_component_map.renumberByNodeOrder(
+        computeRCMOrdering(*common_mesh));
+}
+}  // anonymous namespace
+#endif  // OGS_DOF_ORDER_RCM
+
 namespace
 {
 
@@ -113,6 +160,10 @@ LocalToGlobalIndexMap::LocalToGlobalIndexMap(
       _mesh_component_map(_mesh_subsets, order),
       _variable_component_offsets(to_cumulative(vec_var_n_components))
 {
+#ifdef OGS_DOF_ORDER_RCM
+    renumberByRCM(_mesh_subsets, _mesh_component_map);
+#endif
+
     // For all MeshSubsets and each of their MeshSubset's and each element
     // of that MeshSubset save a line of global indices.
 
@@ -141,6 +192,8 @@ LocalToGlobalIndexMap::LocalToGlobalIndexMap(
             offset += mss.size();
         }
     }
+
+    bakeElementIndices();
 }
 
 
@@ -192,6 +245,8 @@ LocalToGlobalIndexMap::LocalToGlobalIndexMap(
             offset += mss.size();
         }
     }
+
+    bakeElementIndices();
 }
 
 
@@ -219,6 +274,8 @@ LocalToGlobalIndexMap::LocalToGlobalIndexMap(
                                              // write out, therefore the zero
                                              // parameter.
     }
+
+    bakeElementIndices();
 }
 
 LocalToGlobalIndexMap* LocalToGlobalIndexMap::deriveBoundaryConstrainedMap(
@@ -254,6 +311,26 @@ LocalToGlobalIndexMap::size() const
     return _rows.rows();
 }
 
+void LocalToGlobalIndexMap::bakeElementIndices()
+{
+    auto const n_elements = _rows.rows();
+    _baked_offsets.clear();
+    _baked_offsets.reserve(n_elements + 1);
+    _baked_offsets.push_back(0);
+    _baked_indices.clear();
+
+    for (std::size_t e = 0; e < n_elements; ++e)
+    {
+        for (unsigned c = 0; c < _rows.cols(); ++c)
+        {
+            auto const& line = _rows(e, c);
+            _baked_indices.insert(_baked_indices.end(), line.begin(),
+                                  line.end());
+        }
+        _baked_offsets.push_back(_baked_indices.size());
+    }
+}
+
 LocalToGlobalIndexMap::RowColumnIndices
 LocalToGlobalIndexMap::operator()(std::size_t const mesh_item_id, const unsigned component_id) const
 {
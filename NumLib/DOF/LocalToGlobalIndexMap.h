@@ -115,6 +115,21 @@ public:
 
     RowColumnIndices operator()(std::size_t const mesh_item_id, const unsigned component_id) const;
 
+    /// Contiguous, baked per-element global indices (all components,
+    /// component-ordered), cf. bakeElementIndices().
+    ///
+    /// Together with getNumberOfElementDOF() this is the zero-lookup span
+    /// that the assembly hot loop fetches instead of recomputing the
+    /// indices per element and iteration.
+    GlobalIndexType const* getBakedElementIndices(
+        std::size_t const mesh_item_id) const
+    {
+        return _baked_indices.data() + _baked_offsets[mesh_item_id];
+    }
+
+    /// Whether bakeElementIndices() has run.
+    bool hasBakedElementIndices() const { return !_baked_offsets.empty(); }
+
     std::size_t getNumberOfElementDOF(std::size_t const mesh_item_id) const;
 
     std::size_t getNumberOfElementComponents(std::size_t const mesh_item_id) const;
@@ -129,6 +144,13 @@ public:
         return _mesh_component_map.getGlobalIndex(l, c);
     }
 
+    /// Forwards the respective method from MeshComponentMap.
+    GlobalIndexType getGlobalIndex(MeshLib::Location const& l,
+                                   int const global_component) const
+    {
+        return _mesh_component_map.getGlobalIndex(l, global_component);
+    }
+
     /// Forwards the respective method from MeshComponentMap.
     std::vector<GlobalIndexType> getGlobalIndices(const MeshLib::Location &l) const
     {
@@ -205,8 +227,19 @@ private:
 
     /// Table contains for each element (first index) and each component (second index)
     /// a vector (\c LineIndex) of indices in the global stiffness matrix or vector
+    /// Flattens the per-element, per-component index lines of _rows into one
+    /// CSR layout (_baked_offsets/_baked_indices); called at the end of
+    /// construction.
+    void bakeElementIndices();
+
     Table _rows;
 
+    /// CSR offsets into _baked_indices, one entry per element plus sentinel.
+    std::vector<std::size_t> _baked_offsets;
+    /// All elements' global indices contiguously, component-ordered per
+    /// element.
+    std::vector<GlobalIndexType> _baked_indices;
+
     /// \see _rows
     Table const& _columns = _rows;
 
@@ -77,6 +77,14 @@ public:
     //! method twice in a row in the same \c x!
     virtual void releaseVector(GlobalVector const& x) = 0;
 
+    //! Preallocates \c count vectors of the given specifications into the
+    //! provider's pool, so the first nonlinear iterations do not pay the
+    //! allocations (and page faults) one by one. No-op by default.
+    virtual void warmUpVectors(MathLib::MatrixSpecifications const& /*ms*/,
+                               unsigned const /*count*/)
+    {
+    }
+
     virtual ~VectorProvider() = default;
 };
 
@@ -112,6 +120,14 @@ public:
     //! method twice in a row in the same \c A!
     virtual void releaseMatrix(GlobalMatrix const& A) = 0;
 
+    //! Preallocates \c count matrices of the given specifications into the
+    //! provider's pool, cf. VectorProvider::warmUpVectors(). No-op by
+    //! default.
+    virtual void warmUpMatrices(MathLib::MatrixSpecifications const& /*ms*/,
+                                unsigned const /*count*/)
+    {
+    }
+
     virtual ~MatrixProvider() = default;
 };
 
@@ -12,6 +12,8 @@
 
 #include "MeshComponentMap.h"
 
+#include <algorithm>
+
 #include "MeshLib/MeshSubsets.h"
 
 #ifdef USE_PETSC
@@ -116,6 +118,13 @@ MeshComponentMap::MeshComponentMap(
         }
         comp_id++;
     }
+
+    // Group the ghost DOFs by owning rank: the global indices of one rank
+    // form a contiguous range, so sorting the ghost list makes every
+    // neighbor's contribution to a ghost update one dense segment instead
+    // of strided fragments, and enables the binary search in
+    // getLocalIndex().
+    std::sort(_ghosts_indices.begin(), _ghosts_indices.end());
 }
 #else
 MeshComponentMap::MeshComponentMap(
@@ -134,10 +143,12 @@ MeshComponentMap::MeshComponentMap(
             MeshLib::MeshSubset const& mesh_subset = c->getMeshSubset(mesh_subset_index);
             std::size_t const mesh_id = mesh_subset.getMeshID();
             // mesh items are ordered first by node, cell, ....
-            for (std::size_t j=0; j<mesh_subset.getNumberOfNodes(); j++)
-                _dict.insert(Line(Location(mesh_id, MeshLib::MeshItemType::Node, mesh_subset.getNodeID(j)), comp_id, global_index++));
-            for (std::size_t j=0; j<mesh_subset.getNumberOfElements(); j++)
-                _dict.insert(Line(Location(mesh_id, MeshLib::MeshItemType::Cell, mesh_subset.getElementID(j)), comp_id, global_index++));
+            // One sweep over the flattened id arrays instead of one node /
+            // element pointer chase per item.
+            for (auto const node_id : mesh_subset.getNodeIDs())
+                _dict.insert(Line(Location(mesh_id, MeshLib::MeshItemType::Node, node_id), comp_id, global_index++));
+            for (auto const element_id : mesh_subset.getElementIDs())
+                _dict.insert(Line(Location(mesh_id, MeshLib::MeshItemType::Cell, element_id), comp_id, global_index++));
         }
         comp_id++;
     }
@@ -160,17 +171,16 @@ MeshComponentMap MeshComponentMap::getSubset(
     {
         std::size_t const mesh_id = mesh_subset->getMeshID();
         // Lookup the locations in the current mesh component map and
-        // insert the full lines into the subset dictionary.
-        for (std::size_t j = 0; j < mesh_subset->getNumberOfNodes(); j++)
-            subset_dict.insert(
-                getLine(Location(mesh_id, MeshLib::MeshItemType::Node,
-                                 mesh_subset->getNodeID(j)),
-                        component_id));
-        for (std::size_t j = 0; j < mesh_subset->getNumberOfElements(); j++)
-            subset_dict.insert(
-                getLine(Location(mesh_id, MeshLib::MeshItemType::Cell,
-                                 mesh_subset->getElementID(j)),
-                        component_id));
+        // insert the full lines into the subset dictionary; sweeps the
+        // flattened id arrays, cf. MeshSubset::getNodeIDs().
+        for (auto const node_id : mesh_subset->getNodeIDs())
+            subset_dict.insert(getLine(
+                Location(mesh_id, MeshLib::MeshItemType::Node, node_id),
+                component_id));
+        for (auto const element_id : mesh_subset->getElementIDs())
+            subset_dict.insert(getLine(
+                Location(mesh_id, MeshLib::MeshItemType::Cell, element_id),
+                component_id));
     }
 
     return MeshComponentMap(subset_dict, 1);
@@ -189,6 +199,35 @@ void MeshComponentMap::renumberByLocation(GlobalIndexType offset)
     }
 }
 
+void MeshComponentMap::renumberByNodeOrder(
+    std::vector<std::size_t> const& new_node_numbers)
+{
+    auto& m = _dict.get<ByLocation>();  // view as sorted by mesh item
+
+    std::size_t comp_position = 0;
+    auto itr_prev = m.end();
+    for (auto itr_mesh_item = m.begin(); itr_mesh_item != m.end();
+         ++itr_mesh_item)
+    {
+        assert(itr_mesh_item->location.item_type ==
+               MeshLib::MeshItemType::Node);
+
+        // Components of one location are adjacent in this view.
+        if (itr_prev != m.end() &&
+            itr_prev->location.item_id == itr_mesh_item->location.item_id)
+            ++comp_position;
+        else
+            comp_position = 0;
+        itr_prev = itr_mesh_item;
+
+        Line pos = *itr_mesh_item;
+        pos.global_index = static_cast<GlobalIndexType>(
+            _num_components * new_node_numbers[pos.location.item_id] +
+            comp_position);
+        m.replace(itr_mesh_item, pos);
+    }
+}
+
 std::vector<std::size_t> MeshComponentMap::getComponentIDs(const Location &l) const
 {
     auto const &m = _dict.get<ByLocation>();
@@ -304,11 +343,12 @@ GlobalIndexType MeshComponentMap::getLocalIndex(
     if (-global_index == static_cast<GlobalIndexType>(_num_global_dof))
         return 0;
 
-    // TODO Find in ghost indices is O(n^2/2) for n being the length of
-    // _ghosts_indices. Providing an inverted table would be faster.
-    auto const ghost_index_it = std::find(_ghosts_indices.begin(),
-                                          _ghosts_indices.end(), -global_index);
-    if (ghost_index_it == _ghosts_indices.end())
+    // The ghost indices are sorted (see the constructor); binary search.
+    auto const ghost_index_it =
+        std::lower_bound(_ghosts_indices.begin(), _ghosts_indices.end(),
+                         -global_index);
+    if (ghost_index_it == _ghosts_indices.end() ||
+        *ghost_index_it != -global_index)
     {
         OGS_FATAL("index %d not found in ghost_indices", -global_index);
     }
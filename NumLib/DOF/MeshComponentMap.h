@@ -41,6 +41,20 @@ public:
         std::vector<std::unique_ptr<MeshLib::MeshSubsets>> const& components,
         ComponentOrder order);
 
+    /// Renumbers the global indices of the node items of the given mesh
+    /// according to the given node numbering, e.g., a bandwidth-reducing
+    /// reverse Cuthill-McKee order, cf. NumLib::computeRCMOrdering().
+    ///
+    /// The new global index of a node's component is
+    /// n_components * new_node_number + component position, i.e., the result
+    /// corresponds to ComponentOrder::BY_LOCATION with permuted node order.
+    /// The permutation is transparent for all accesses going through this
+    /// map.
+    ///
+    /// \pre All components span the same node set of one mesh (the common
+    /// single-mesh case); cell items must not be present.
+    void renumberByNodeOrder(std::vector<std::size_t> const& new_node_numbers);
+
     /// Creates a single-component subset of the current mesh component map.
     /// The order (BY_LOCATION/BY_COMPONENT) of components is the same as of the
     /// current map.
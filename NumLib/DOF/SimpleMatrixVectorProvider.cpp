@@ -54,6 +54,28 @@ transfer(std::map<MatVec*, std::size_t>& from_used,
 } // detail
 
 
+namespace
+{
+// Size hints for the size-bucketed reuse of pooled objects; zero means no
+// hint (no size-based pooling possible for that acquisition).
+inline std::size_t sizeHint() { return 0; }
+inline std::size_t sizeHint(MathLib::MatrixSpecifications const& ms)
+{
+    return ms.nrows;
+}
+inline std::size_t sizeHint(GlobalVector const& x) { return x.size(); }
+inline std::size_t sizeHint(GlobalMatrix const& A)
+{
+    return A.getNumberOfRows();
+}
+
+inline std::size_t sizeOf(GlobalVector const& x) { return x.size(); }
+inline std::size_t sizeOf(GlobalMatrix const& A)
+{
+    return A.getNumberOfRows();
+}
+}  // anonymous namespace
+
 namespace NumLib
 {
 
@@ -65,6 +87,8 @@ get_(std::size_t& id,
      std::map<MatVec*, std::size_t>& used_map,
      Args&&... args)
 {
+    std::lock_guard<std::mutex> const lock(_mutex);
+
     if (id >= _next_id) {
         OGS_FATAL("An obviously uninitialized id argument has been passed."
             " This might not be a serious error for the current implementation,"
@@ -75,11 +99,30 @@ get_(std::size_t& id,
     if (do_search)
     {
         auto it = unused_map.find(id);
-        if (it != unused_map.end()) // unused matrix/vector found
+        if (it != unused_map.end()) { // unused matrix/vector found
+            ++_pool_hits;
+            return { ::detail::transfer(unused_map, used_map, it), false };
+        }
+    }
+
+    // Size-bucketed reuse: an unused object of the requested size serves
+    // the acquisition instead of a fresh allocation. This is what breaks
+    // the allocate/free cycles of id-less acquisitions across nonlinear
+    // iterations.
+    std::size_t const wanted_size = sizeHint(args...);
+    if (wanted_size != 0)
+    {
+        for (auto it = unused_map.begin(); it != unused_map.end(); ++it)
+        {
+            if (sizeOf(*it->second) != wanted_size)
+                continue;
+            ++_pool_hits;
             return { ::detail::transfer(unused_map, used_map, it), false };
+        }
     }
 
     // not searched or not found, so create a new one
+    ++_pool_misses;
     id = _next_id++;
     auto res = used_map.emplace(
         MathLib::MatrixVectorTraits<MatVec>::newInstance(std::forward<Args>(args)...).release(),
@@ -150,10 +193,27 @@ getMatrix(GlobalMatrix const& A, std::size_t& id)
     return *res.first;
 }
 
+void
+SimpleMatrixVectorProvider::
+warmUpMatrices(MathLib::MatrixSpecifications const& ms, unsigned const count)
+{
+    std::lock_guard<std::mutex> const lock(_mutex);
+    for (unsigned i = 0; i < count; ++i)
+    {
+        auto const id = _next_id++;
+        _unused_matrices.emplace(
+            id,
+            MathLib::MatrixVectorTraits<GlobalMatrix>::newInstance(ms)
+                .release());
+    }
+}
+
 void
 SimpleMatrixVectorProvider::
 releaseMatrix(GlobalMatrix const& A)
 {
+    std::lock_guard<std::mutex> const lock(_mutex);
+
     auto it = _used_matrices.find(const_cast<GlobalMatrix*>(&A));
     if (it == _used_matrices.end()) {
         OGS_FATAL("The given matrix has not been found. Cannot release it. Aborting.");
@@ -224,10 +284,27 @@ getVector(GlobalVector const& x, std::size_t& id)
     return *res.first;
 }
 
+void
+SimpleMatrixVectorProvider::
+warmUpVectors(MathLib::MatrixSpecifications const& ms, unsigned const count)
+{
+    std::lock_guard<std::mutex> const lock(_mutex);
+    for (unsigned i = 0; i < count; ++i)
+    {
+        auto const id = _next_id++;
+        _unused_vectors.emplace(
+            id,
+            MathLib::MatrixVectorTraits<GlobalVector>::newInstance(ms)
+                .release());
+    }
+}
+
 void
 SimpleMatrixVectorProvider::
 releaseVector(GlobalVector const& x)
 {
+    std::lock_guard<std::mutex> const lock(_mutex);
+
     auto it = _used_vectors.find(const_cast<GlobalVector*>(&x));
     if (it == _used_vectors.end()) {
         OGS_FATAL("The given vector has not been found. Cannot release it. Aborting.");
@@ -239,6 +316,11 @@ releaseVector(GlobalVector const& x)
 SimpleMatrixVectorProvider::
 ~SimpleMatrixVectorProvider()
 {
+    DBUG(
+        "Matrix/vector pool: %d acquisitions served from the pool, %d fresh "
+        "allocations.",
+        static_cast<int>(_pool_hits), static_cast<int>(_pool_misses));
+
     if ((!_used_matrices.empty()) || (!_used_vectors.empty())) {
         WARN("There are still some matrices and vectors in use."
              " This might be an indicator of a possible waste of memory.");
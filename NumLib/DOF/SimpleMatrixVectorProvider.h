@@ -9,6 +9,8 @@
 
 #pragma once
 
+#include <mutex>
+
 #include <map>
 #include <memory>
 
@@ -46,6 +48,9 @@ public:
 
     void releaseVector(GlobalVector const& x) override;
 
+    void warmUpVectors(MathLib::MatrixSpecifications const& ms,
+                       unsigned const count) override;
+
     GlobalMatrix& getMatrix() override;
     GlobalMatrix& getMatrix(std::size_t& id) override;
 
@@ -57,9 +62,17 @@ public:
 
     void releaseMatrix(GlobalMatrix const& A) override;
 
+    void warmUpMatrices(MathLib::MatrixSpecifications const& ms,
+                        unsigned const count) override;
+
     ~SimpleMatrixVectorProvider();
 
 private:
+    //! Serializes all map manipulations; the provider is shared by
+    //! concurrently solving processes, cf. the <parallel_processes> time
+    //! loop option.
+    std::mutex _mutex;
+
     template<bool do_search, typename... Args>
     std::pair<GlobalMatrix*, bool> getMatrix_(std::size_t& id, Args&&... args);
 
@@ -77,6 +90,11 @@ private:
 
     std::size_t _next_id = 1;
 
+    //! Pool telemetry, logged on destruction: how many acquisitions were
+    //! served from the pool (by id or by size) versus fresh allocations.
+    std::size_t _pool_hits = 0;
+    std::size_t _pool_misses = 0;
+
     std::map<std::size_t, GlobalMatrix*> _unused_matrices;
     std::map<GlobalMatrix*, std::size_t> _used_matrices;
 
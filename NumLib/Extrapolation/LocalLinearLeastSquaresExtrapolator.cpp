@@ -9,6 +9,8 @@
 
 #include "LocalLinearLeastSquaresExtrapolator.h"
 
+#include "BaseLib/Deterministic.h"
+
 #include <Eigen/SVD>
 #include <logog/include/logog.hpp>
 
@@ -58,12 +60,32 @@ void LocalLinearLeastSquaresExtrapolator::extrapolate(
         MathLib::MatrixVectorTraits<GlobalVector>::newInstance(_nodal_values);
     counts->setZero();  // TODO BLAS?
 
-    auto const size = extrapolatables.size();
-    for (std::size_t i=0; i<size; ++i) {
-        extrapolateElement(i, extrapolatables, *counts);
+    auto const size = static_cast<std::ptrdiff_t>(extrapolatables.size());
+    // The per-element computation is independent (the pseudo-inverse cache
+    // and the scatter into the global vectors are serialized inside); runs
+    // in parallel when OpenMP is enabled. In deterministic mode the loop
+    // runs serially so the scatter order is fixed,
+    // cf. BaseLib::setDeterministicParallelMode().
+#pragma omp parallel if (!BaseLib::deterministicParallelMode())
+    {
+        std::vector<double> integration_point_values_cache;
+#pragma omp for schedule(static)
+        for (std::ptrdiff_t i = 0; i < size; ++i) {
+            extrapolateElement(i, extrapolatables, *counts,
+                               integration_point_values_cache);
+        }
     }
 
     MathLib::LinAlg::componentwiseDivide(_nodal_values, _nodal_values, *counts);
+
+#ifndef USE_PETSC
+    // Gather the averaged nodal values once into a plain array; the residual
+    // loop then reads it directly instead of one vector lookup per node and
+    // element. (In the PETSc case local/global index translation applies and
+    // the per-entry path below is kept.)
+    _nodal_values_cache.resize(_nodal_values.size());
+    _nodal_values.copyValues(_nodal_values_cache);
+#endif
 }
 
 void LocalLinearLeastSquaresExtrapolator::calculateResiduals(
@@ -72,20 +94,27 @@ void LocalLinearLeastSquaresExtrapolator::calculateResiduals(
     assert(static_cast<std::size_t>(_residuals.size()) ==
            extrapolatables.size());
 
-    auto const size = extrapolatables.size();
-    for (std::size_t i=0; i<size; ++i) {
-        calculateResidualElement(i, extrapolatables);
+    auto const size = static_cast<std::ptrdiff_t>(extrapolatables.size());
+#pragma omp parallel if (!BaseLib::deterministicParallelMode())
+    {
+        std::vector<double> integration_point_values_cache;
+#pragma omp for schedule(static)
+        for (std::ptrdiff_t i = 0; i < size; ++i) {
+            calculateResidualElement(i, extrapolatables,
+                                     integration_point_values_cache);
+        }
     }
 }
 
 void LocalLinearLeastSquaresExtrapolator::extrapolateElement(
     std::size_t const element_index,
     ExtrapolatableElementCollection const& extrapolatables,
-    GlobalVector& counts)
+    GlobalVector& counts,
+    std::vector<double>& integration_point_values_cache)
 {
     auto const& integration_point_values =
         extrapolatables.getIntegrationPointValues(
-            element_index, _integration_point_values_cache);
+            element_index, integration_point_values_cache);
 
     auto const& N_0 = extrapolatables.getShapeMatrix(element_index, 0);
     const unsigned num_nodes = static_cast<unsigned>(N_0.cols());
@@ -95,11 +124,18 @@ void LocalLinearLeastSquaresExtrapolator::extrapolateElement(
            "Least squares is not possible if there are more nodes than"
            "integration points.");
 
-    auto const pair_it_inserted = _qr_decomposition_cache.emplace(
-        std::make_pair(num_nodes, num_int_pts), CachedData{});
+    CachedData* cached_data_ptr;
+    bool inserted;
+#pragma omp critical(ogs_llsq_extrapolator_cache)
+    {
+        auto const pair_it_inserted = _qr_decomposition_cache.emplace(
+            std::make_pair(num_nodes, num_int_pts), CachedData{});
+        cached_data_ptr = &pair_it_inserted.first->second;
+        inserted = pair_it_inserted.second;
+    }
 
-    auto& cached_data = pair_it_inserted.first->second;
-    if (pair_it_inserted.second)
+    auto& cached_data = *cached_data_ptr;
+    if (inserted)
     {
         DBUG("Computing new singular value decomposition");
 
@@ -157,17 +193,23 @@ void LocalLinearLeastSquaresExtrapolator::extrapolateElement(
     // multi-component properties shall be extrapolated
     auto const& global_indices = _local_to_global(element_index, 0).rows;
 
-    // TODO does that give rise to PETSc problems?
-    _nodal_values.add(global_indices, nodal_values);
-    counts.add(global_indices, std::vector<double>(global_indices.size(), 1.0));
+    // Serialized scatter stage.
+#pragma omp critical(ogs_llsq_extrapolator_scatter)
+    {
+        // TODO does that give rise to PETSc problems?
+        _nodal_values.add(global_indices, nodal_values);
+        counts.add(global_indices,
+                   std::vector<double>(global_indices.size(), 1.0));
+    }
 }
 
 void LocalLinearLeastSquaresExtrapolator::calculateResidualElement(
     std::size_t const element_index,
-    ExtrapolatableElementCollection const& extrapolatables)
+    ExtrapolatableElementCollection const& extrapolatables,
+    std::vector<double>& integration_point_values_cache)
 {
     auto const& int_pt_vals = extrapolatables.getIntegrationPointValues(
-        element_index, _integration_point_values_cache);
+        element_index, integration_point_values_cache);
 
     // TODO: for now always zeroth component is used
     const auto& global_indices = _local_to_global(element_index, 0).rows;
@@ -178,8 +220,12 @@ void LocalLinearLeastSquaresExtrapolator::calculateResidualElement(
     // filter nodal values of the current element
     Eigen::VectorXd nodal_vals_element(num_nodes);
     for (unsigned i = 0; i < num_nodes; ++i) {
+#ifndef USE_PETSC
+        nodal_vals_element[i] = _nodal_values_cache[global_indices[i]];
+#else
         // TODO PETSc negative indices?
         nodal_vals_element[i] = _nodal_values[global_indices[i]];
+#endif
     }
 
     auto const& interpolation_matrix =
@@ -78,25 +78,33 @@ public:
     }
 
 private:
-    //! Extrapolate one element.
+    //! Extrapolate one element. Reentrant up to the serialized scatter into
+    //! the global vectors; \c integration_point_values_cache must be
+    //! thread-private.
     void extrapolateElement(
         std::size_t const element_index,
         ExtrapolatableElementCollection const& extrapolatables,
-        GlobalVector& counts);
+        GlobalVector& counts,
+        std::vector<double>& integration_point_values_cache);
 
-    //! Compute the residuals for one element
+    //! Compute the residuals for one element. Reentrant; \c
+    //! integration_point_values_cache must be thread-private.
     void calculateResidualElement(
         std::size_t const element_index,
-        ExtrapolatableElementCollection const& extrapolatables);
+        ExtrapolatableElementCollection const& extrapolatables,
+        std::vector<double>& integration_point_values_cache);
 
     GlobalVector& _nodal_values;  //!< extrapolated nodal values
+
+    //! Plain-array gather of _nodal_values for the residual loop, cf.
+    //! extrapolate().
+    std::vector<double> _nodal_values_cache;
     GlobalVector _residuals;      //!< extrapolation residuals
 
     //! DOF table used for writing to global vectors.
     NumLib::LocalToGlobalIndexMap const& _local_to_global;
 
-    //! Avoids frequent reallocations.
-    std::vector<double> _integration_point_values_cache;
+
 
     //! Stores a matrix and its Moore-Penrose pseudo-inverse.
     struct CachedData
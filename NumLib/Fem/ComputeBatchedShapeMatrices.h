@@ -0,0 +1,63 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include "MeshLib/Elements/Element.h"
+#include "NumLib/Fem/FiniteElement/TemplateIsoparametric.h"
+#include "NumLib/Fem/ShapeMatrixPolicy.h"
+
+namespace NumLib
+{
+
+/// Computes the shape matrices of all integration points of the given element
+/// in one sweep into the stacked storage of
+/// EigenBatchedShapeMatrixPolicy::BatchedShapeMatrices.
+///
+/// The per-point computation runs on fixed-size Eigen types (independent of
+/// the globally selected shape matrix policy), the results are placed
+/// contiguously in integration point order.
+template <typename ShapeFunction, unsigned GlobalDim,
+          typename IntegrationMethod>
+typename EigenBatchedShapeMatrixPolicy<ShapeFunction,
+                                       GlobalDim>::BatchedShapeMatrices
+computeBatchedShapeMatrices(MeshLib::Element const& e,
+                            bool const is_axially_symmetric,
+                            IntegrationMethod const& integration_method)
+{
+    using BatchedPolicy = EigenBatchedShapeMatrixPolicy<ShapeFunction,
+                                                        GlobalDim>;
+    using FixedPolicy = EigenFixedShapeMatrixPolicy<ShapeFunction, GlobalDim>;
+    using FemType = TemplateIsoparametric<ShapeFunction, FixedPolicy>;
+
+    FemType fe(*static_cast<const typename ShapeFunction::MeshElement*>(&e));
+
+    unsigned const n_integration_points =
+        integration_method.getNumberOfPoints();
+
+    typename BatchedPolicy::BatchedShapeMatrices batch(n_integration_points);
+
+    typename FixedPolicy::ShapeMatrices sm(ShapeFunction::DIM, GlobalDim,
+                                           ShapeFunction::NPOINTS);
+    for (unsigned ip = 0; ip < n_integration_points; ++ip) {
+        sm.setZero();
+        fe.computeShapeFunctions(
+            integration_method.getWeightedPoint(ip).getCoords(), sm, GlobalDim,
+            is_axially_symmetric);
+
+        batch.N.row(ip) = sm.N;
+        batch.dNdxBlock(ip) = sm.dNdx;
+        batch.detJ[ip] = sm.detJ;
+        batch.integralMeasure[ip] = sm.integralMeasure;
+    }
+
+    return batch;
+}
+
+}  // namespace NumLib
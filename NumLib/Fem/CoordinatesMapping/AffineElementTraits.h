@@ -0,0 +1,48 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <type_traits>
+
+namespace NumLib
+{
+class ShapeLine2;
+class ShapeTri3;
+class ShapeTet4;
+
+/*! Marks shape functions whose isoparametric mapping is affine.
+ *
+ * For the linear simplex elements (and the two-node line) the shape
+ * function gradients in natural coordinates are constant, hence the
+ * Jacobian---and with it detJ, invJ and dNdx---is the same at every point
+ * of the element. Shape-matrix setup exploits this by computing the mapping
+ * once per element and reusing it across the integration points,
+ * cf. ProcessLib::initShapeMatrices(). Bilinear/trilinear tensor-product
+ * elements are not affine in general and keep the per-point mapping.
+ */
+template <typename ShapeFunction>
+struct IsAffineElement : std::false_type
+{
+};
+
+template <>
+struct IsAffineElement<ShapeLine2> : std::true_type
+{
+};
+template <>
+struct IsAffineElement<ShapeTri3> : std::true_type
+{
+};
+template <>
+struct IsAffineElement<ShapeTet4> : std::true_type
+{
+};
+
+}  // namespace NumLib
@@ -63,6 +63,12 @@ IntegrationGaussRegular<N_DIM>::getWeightedPoint(unsigned order,
         case 2: return getWeightedPoint<MathLib::GaussLegendre<2>>(pos);
         case 3: return getWeightedPoint<MathLib::GaussLegendre<3>>(pos);
         case 4: return getWeightedPoint<MathLib::GaussLegendre<4>>(pos);
+        case 5: return getWeightedPoint<MathLib::GaussLegendre<5>>(pos);
+        case 6: return getWeightedPoint<MathLib::GaussLegendre<6>>(pos);
+        case 7: return getWeightedPoint<MathLib::GaussLegendre<7>>(pos);
+        case 8: return getWeightedPoint<MathLib::GaussLegendre<8>>(pos);
+        case 9: return getWeightedPoint<MathLib::GaussLegendre<9>>(pos);
+        case 10: return getWeightedPoint<MathLib::GaussLegendre<10>>(pos);
     }
 
     return MathLib::TemplateWeightedPoint<double, double, N_DIM>(std::array<double, N_DIM>(), 0);
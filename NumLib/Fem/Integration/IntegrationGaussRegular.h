@@ -71,6 +71,18 @@ public:
     /// @return  a tuple of position indexes
     static std::array<unsigned, N_DIM> getPositionIndices(unsigned order, unsigned igp);
 
+    /// Compile-time-order variant of getWeightedPoint(): with the order a
+    /// template argument the table lookup and the position decomposition
+    /// inline, so a surrounding integration point loop with constant trip
+    /// count unrolls fully for the common orders.
+    template <unsigned ORDER>
+    static MathLib::TemplateWeightedPoint<double, double, N_DIM>
+    getWeightedPointFixedOrder(unsigned igp)
+    {
+        return getWeightedPoint<MathLib::GaussLegendre<ORDER>>(
+            getPositionIndices(ORDER, igp));
+    }
+
     /// Get coordinates of the integration point.
     ///
     /// @param order     The number of integration points
@@ -0,0 +1,129 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <array>
+
+namespace NumLib
+{
+
+/*! Compile-time shape function tables for the low-order tensor-product
+ * elements at the default (second) integration order.
+ *
+ * The Gauss abscissa and the shape function values/natural-coordinate
+ * gradients at the integration points are compile-time constants, so the
+ * setup and the reassembly of geometry-constant nonlinear problems can read
+ * N and dNdr from static tables and spend the per-element work on the
+ * Jacobian only. The tables follow the repository's integration point
+ * ordering (IntegrationGaussRegular: the last coordinate varies fastest)
+ * and node ordering of ShapeLine2/ShapeQuad4/ShapeHex8.
+ *
+ * The simplex elements keep their runtime evaluation: their quadrature data
+ * lives in non-constexpr tables and the per-point polynomial cost is already
+ * a few flops.
+ */
+namespace ShapeTables
+{
+
+//! Gauss-Legendre abscissa for two-point integration.
+constexpr double g = 0.577350269189625764509148780502;
+
+// -- Line2, 2 integration points (r = +g, -g per GaussLegendre data) -------
+
+//! N of ShapeLine2 at the k-th integration point.
+constexpr std::array<std::array<double, 2>, 2> line2_N = {{
+    {{(1.0 - g) / 2.0, (1.0 + g) / 2.0}},
+    {{(1.0 + g) / 2.0, (1.0 - g) / 2.0}},
+}};
+
+//! dN/dr of ShapeLine2 (independent of the integration point).
+constexpr std::array<double, 2> line2_dNdr = {{-0.5, 0.5}};
+
+// -- Quad4, 2x2 integration points ----------------------------------------
+
+//! Natural coordinates (r, s) of the k-th integration point
+//! (IntegrationGaussRegular: the last coordinate varies fastest).
+constexpr double quad4_r(unsigned const k) { return (k & 2) ? -g : g; }
+constexpr double quad4_s(unsigned const k) { return (k & 1) ? -g : g; }
+
+constexpr double quad4_N_entry(double const r, double const s,
+                               unsigned const node)
+{
+    return node == 0 ? (1 + r) * (1 + s) / 4
+           : node == 1 ? (1 - r) * (1 + s) / 4
+           : node == 2 ? (1 - r) * (1 - s) / 4
+                       : (1 + r) * (1 - s) / 4;
+}
+
+constexpr double quad4_N(unsigned const k, unsigned const node)
+{
+    return quad4_N_entry(quad4_r(k), quad4_s(k), node);
+}
+
+//! dN/dr (component 0) and dN/ds (component 1) of ShapeQuad4.
+constexpr double quad4_dNdr(unsigned const k, unsigned const component,
+                            unsigned const node)
+{
+    return component == 0
+               ? (node == 0 ? (1 + quad4_s(k)) / 4
+                  : node == 1 ? -(1 + quad4_s(k)) / 4
+                  : node == 2 ? -(1 - quad4_s(k)) / 4
+                              : (1 - quad4_s(k)) / 4)
+               : (node == 0 ? (1 + quad4_r(k)) / 4
+                  : node == 1 ? (1 - quad4_r(k)) / 4
+                  : node == 2 ? -(1 - quad4_r(k)) / 4
+                              : -(1 + quad4_r(k)) / 4);
+}
+
+// -- Hex8, 2x2x2 integration points ---------------------------------------
+
+constexpr double hex8_r(unsigned const k) { return (k & 4) ? -g : g; }
+constexpr double hex8_s(unsigned const k) { return (k & 2) ? -g : g; }
+constexpr double hex8_t(unsigned const k) { return (k & 1) ? -g : g; }
+
+//! Node sign pattern of ShapeHex8 (natural coordinates of node corners).
+constexpr double hex8_sign_r(unsigned const node)
+{
+    return (node == 0 || node == 3 || node == 4 || node == 7) ? -1.0 : 1.0;
+}
+constexpr double hex8_sign_s(unsigned const node)
+{
+    return (node == 0 || node == 1 || node == 4 || node == 5) ? -1.0 : 1.0;
+}
+constexpr double hex8_sign_t(unsigned const node)
+{
+    return (node < 4) ? -1.0 : 1.0;
+}
+
+constexpr double hex8_N(unsigned const k, unsigned const node)
+{
+    return (1 + hex8_sign_r(node) * hex8_r(k)) *
+           (1 + hex8_sign_s(node) * hex8_s(k)) *
+           (1 + hex8_sign_t(node) * hex8_t(k)) / 8;
+}
+
+constexpr double hex8_dNdr(unsigned const k, unsigned const component,
+                           unsigned const node)
+{
+    return component == 0
+               ? hex8_sign_r(node) *
+                     (1 + hex8_sign_s(node) * hex8_s(k)) *
+                     (1 + hex8_sign_t(node) * hex8_t(k)) / 8
+           : component == 1
+               ? hex8_sign_s(node) *
+                     (1 + hex8_sign_r(node) * hex8_r(k)) *
+                     (1 + hex8_sign_t(node) * hex8_t(k)) / 8
+               : hex8_sign_t(node) *
+                     (1 + hex8_sign_r(node) * hex8_r(k)) *
+                     (1 + hex8_sign_s(node) * hex8_s(k)) / 8;
+}
+
+}  // namespace ShapeTables
+}  // namespace NumLib
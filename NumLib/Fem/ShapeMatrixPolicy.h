@@ -131,3 +131,83 @@ const unsigned OGS_EIGEN_DYNAMIC_SHAPE_MATRICES_FLAG = 0;
 
 //static_assert(std::is_class<ShapeMatrixPolicyType<>::value,
         //"ShapeMatrixPolicyType was not defined.");
+
+/// An implementation of ShapeMatrixPolicy that complements the fixed size
+/// policy with contiguous, batched storage for the shape matrices of all
+/// integration points of one element.
+///
+/// The shape function values and gradients of all integration points are
+/// stacked into single fixed-width Eigen matrices, such that the integration
+/// point loop of an assembler streams through memory linearly and the
+/// per-point expressions vectorize over the compile-time number of element
+/// nodes. See NumLib::computeBatchedShapeMatrices() for filling the batched
+/// storage.
+template <typename ShapeFunction, unsigned GlobalDim>
+struct EigenBatchedShapeMatrixPolicy
+    : EigenFixedShapeMatrixPolicy<ShapeFunction, GlobalDim>
+{
+    /// Shape function values of all integration points; one row per
+    /// integration point.
+    using BatchedNType =
+        Eigen::Matrix<double, Eigen::Dynamic, ShapeFunction::NPOINTS,
+                      Eigen::RowMajor>;
+
+    /// Shape function gradients (physical coordinates) of all integration
+    /// points; GlobalDim consecutive rows per integration point.
+    using BatchedDNdxType =
+        Eigen::Matrix<double, Eigen::Dynamic, ShapeFunction::NPOINTS,
+                      Eigen::RowMajor>;
+
+    /// Shape matrices of all integration points of one element in stacked
+    /// storage.
+    struct BatchedShapeMatrices
+    {
+        explicit BatchedShapeMatrices(unsigned const n_integration_points)
+            : N(n_integration_points, ShapeFunction::NPOINTS),
+              dNdx(n_integration_points * GlobalDim, ShapeFunction::NPOINTS),
+              detJ(n_integration_points),
+              integralMeasure(n_integration_points)
+        {
+        }
+
+        /// Shape function gradients of the given integration point.
+        Eigen::Block<BatchedDNdxType, GlobalDim, ShapeFunction::NPOINTS>
+        dNdxBlock(unsigned const integration_point)
+        {
+            return dNdx.template block<GlobalDim, ShapeFunction::NPOINTS>(
+                integration_point * GlobalDim, 0);
+        }
+
+        Eigen::Block<BatchedDNdxType const, GlobalDim, ShapeFunction::NPOINTS>
+        dNdxBlock(unsigned const integration_point) const
+        {
+            return dNdx.template block<GlobalDim, ShapeFunction::NPOINTS>(
+                integration_point * GlobalDim, 0);
+        }
+
+        /// Interpolates the nodal values of one scalar d.o.f. to all
+        /// integration points in a single matrix-vector product over the
+        /// stacked N block---one contiguous streaming kernel across the
+        /// points instead of one dot product per point.
+        template <typename NodalValues>
+        Eigen::VectorXd interpolateValues(NodalValues const& nodal_values) const
+        {
+            return N * nodal_values;
+        }
+
+        /// Gradients of one scalar d.o.f. at all integration points, as
+        /// GlobalDim consecutive entries per point; the same single-sweep
+        /// evaluation over the stacked dNdx block.
+        template <typename NodalValues>
+        Eigen::VectorXd interpolateGradients(
+            NodalValues const& nodal_values) const
+        {
+            return dNdx * nodal_values;
+        }
+
+        BatchedNType N;
+        BatchedDNdxType dNdx;
+        Eigen::VectorXd detJ;
+        Eigen::VectorXd integralMeasure;
+    };
+};
@@ -84,4 +84,45 @@ void shapeFunctionInterpolate(
                                         interpolated_values...);
 }
 
+/*!
+ * Fused interpolation of a scalar d.o.f.'s value and gradient at one
+ * integration point.
+ *
+ * Computes \f$ N x \f$ and \f$ \nabla N\, x \f$ in a single pass over the
+ * nodal values, so both results come from one load of the shape data and
+ * one load of \c nodal_values instead of two separate products---halving
+ * the memory traffic of assemblers that need the interpolated value and
+ * the gradient of the same variable (e.g. pressure in HT).
+ *
+ * \param nodal_values        nodal values of the scalar d.o.f. (the
+ *                            \c DOFOffset -th component block, as in
+ *                            shapeFunctionInterpolate()).
+ * \param shape_matrix_N      shape functions at the integration point.
+ * \param dNdx                shape function gradients (global coordinates).
+ * \param interpolated_value  value at the integration point (output).
+ * \param gradient            gradient at the integration point (output).
+ */
+template <unsigned DOFOffset = 0, typename NodalValues, typename ShapeMatrix,
+          typename DNDXMatrix, typename GradientVector>
+void shapeFunctionInterpolateWithGradient(NodalValues const& nodal_values,
+                                          ShapeMatrix const& shape_matrix_N,
+                                          DNDXMatrix const& dNdx,
+                                          double& interpolated_value,
+                                          GradientVector& gradient)
+{
+    auto const num_nodes = shape_matrix_N.size();
+    assert(dNdx.cols() == num_nodes);
+    assert(gradient.rows() == dNdx.rows());
+
+    double value = 0.0;
+    gradient.setZero();
+    for (auto n = decltype(num_nodes){0}; n < num_nodes; ++n)
+    {
+        double const nodal_value = nodal_values[DOFOffset * num_nodes + n];
+        value += shape_matrix_N[n] * nodal_value;
+        gradient.noalias() += dNdx.col(n) * nodal_value;
+    }
+    interpolated_value = value;
+}
+
 } // namespace NumLib
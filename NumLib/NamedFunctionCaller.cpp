@@ -287,12 +287,54 @@ SpecificFunctionCaller::SpecificFunctionCaller(const std::size_t function_idx,
                                              const NamedFunctionCaller& caller)
     : _function_idx(function_idx), _caller(caller)
 {
+    // Compile the call plan: iterative post-order DFS over the dependency
+    // graph collecting each needed function once in topological order.
+    std::vector<bool> visited(caller._named_functions.size(), false);
+    std::vector<std::pair<std::size_t, bool>> stack{{function_idx, false}};
+    while (!stack.empty())
+    {
+        auto const top = stack.back();
+        stack.pop_back();
+        if (top.second) {
+            _evaluation_order.push_back(top.first);
+            continue;
+        }
+        if (visited[top.first])
+            continue;
+        visited[top.first] = true;
+        stack.emplace_back(top.first, true);
+        for (auto const source : caller._map_sink_source[top.first])
+            if (source >= 0 && !visited[source])
+                stack.emplace_back(static_cast<std::size_t>(source), false);
+    }
+
+    _function_values.resize(caller._named_functions.size());
 }
 
 double SpecificFunctionCaller::call(
     const std::vector<double>& unbound_arguments) const
 {
-    return _caller.call(_function_idx, unbound_arguments);
+    assert(_caller._deferred_plugs.empty() &&
+           "You must call applyPlugs() before this method!");
+
+    // Run the compiled plan: each needed function exactly once, in
+    // topological order, reading arguments from the value slots.
+    for (auto const function_idx : _evaluation_order)
+    {
+        auto const& sis_sos = _caller._map_sink_source[function_idx];
+        _argument_buffer.resize(sis_sos.size());
+        for (std::size_t sink = 0; sink < sis_sos.size(); ++sink)
+        {
+            auto const source = sis_sos[sink];
+            _argument_buffer[sink] =
+                (source >= 0) ? _function_values[source]
+                              : unbound_arguments[-source - 1];
+        }
+        _function_values[function_idx] =
+            _caller._named_functions[function_idx].call(_argument_buffer);
+    }
+
+    return _function_values[_function_idx];
 }
 
 std::size_t SpecificFunctionCaller::getNumberOfUnboundArguments() const
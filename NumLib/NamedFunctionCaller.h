@@ -99,16 +99,20 @@ private:
 
 //! A function caller that can call one specific function.
 //!
-//! \todo Use this class to provide some optimizations of the expression
-//! evaluation.
+//! On construction the dependency graph of the function is compiled into a
+//! flat, topologically ordered call plan: every needed function is evaluated
+//! exactly once per call into a preallocated value slot, without recursion,
+//! string lookups or per-node allocations. Shared subexpressions, which the
+//! recursive evaluation recomputed per occurrence, are computed once.
 class SpecificFunctionCaller final
 {
 public:
-    //! Constructs a new instance.
+    //! Constructs a new instance and compiles the call plan.
     SpecificFunctionCaller(std::size_t const function_idx,
                           NamedFunctionCaller const& caller);
 
-    //! Call the function set up with the given unbound arguments.
+    //! Call the function set up with the given unbound arguments by running
+    //! the compiled call plan.
     double call(std::vector<double> const& unbound_arguments) const;
 
     //! Returns the number of unbound arguments.
@@ -118,6 +122,15 @@ private:
     //! Index of the referenced function.
     std::size_t const _function_idx;
 
+    //! Function indices in evaluation (topological) order; the plan's steps.
+    std::vector<std::size_t> _evaluation_order;
+
+    //! One value slot per function of the caller; scratch space of call().
+    mutable std::vector<double> _function_values;
+
+    //! Reused argument staging buffer of call().
+    mutable std::vector<double> _argument_buffer;
+
     //! The named function caller used for the evaluation.
     NamedFunctionCaller const& _caller;
 };
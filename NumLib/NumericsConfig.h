@@ -19,5 +19,10 @@
 //
 // Global executor
 //
+#if defined(OGS_USE_OPENMP)
+#include "NumLib/Assembler/ParallelExecutor.h"
+using GlobalExecutor = NumLib::ParallelExecutor;
+#else
 #include "NumLib/Assembler/SerialExecutor.h"
 using GlobalExecutor = NumLib::SerialExecutor;
+#endif
@@ -46,10 +46,10 @@ void ConvergenceCriterionPerComponentDeltaX::checkDeltaX(
          ++global_component)
     {
         // TODO short cut if tol <= 0.0
-        auto error_dx = norm(minus_delta_x, global_component, _norm_type,
-                             *_dof_table, *_mesh);
-        auto norm_x =
-            norm(x, global_component, _norm_type, *_dof_table, *_mesh);
+        auto const& component_indices = _component_indices[global_component];
+        auto error_dx =
+            norm(minus_delta_x, component_indices, _norm_type);
+        auto norm_x = norm(x, component_indices, _norm_type);
 
         INFO(
             "Convergence criterion, component %u: |dx|=%.4e, |x|=%.4e, "
@@ -71,6 +71,13 @@ void ConvergenceCriterionPerComponentDeltaX::setDOFTable(
     _dof_table = &dof_table;
     _mesh = &mesh;
 
+    // Cache the per-component index masks; the norms then run as plain
+    // indexed sweeps without DOF-table lookups.
+    _component_indices.clear();
+    for (unsigned c = 0; c < dof_table.getNumberOfComponents(); ++c)
+        _component_indices.push_back(
+            getComponentIndices(c, dof_table, mesh));
+
     if (_dof_table->getNumberOfComponents() != _abstols.size())
         OGS_FATAL(
             "The number of components in the DOF table and the number of "
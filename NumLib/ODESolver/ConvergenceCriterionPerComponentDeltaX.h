@@ -51,6 +51,10 @@ private:
     bool _satisfied = true;
     LocalToGlobalIndexMap const* _dof_table = nullptr;
     MeshLib::Mesh const* _mesh = nullptr;
+
+    //! Cached per-component global index masks, cf.
+    //! NumLib::getComponentIndices().
+    std::vector<std::vector<GlobalIndexType>> _component_indices;
 };
 
 std::unique_ptr<ConvergenceCriterionPerComponentDeltaX>
@@ -0,0 +1,69 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "IterationTelemetry.h"
+
+#include <fstream>
+
+#include <logog/include/logog.hpp>
+
+namespace NumLib
+{
+
+IterationTelemetry& IterationTelemetry::instance()
+{
+    static IterationTelemetry telemetry;
+    return telemetry;
+}
+
+void IterationTelemetry::setOutputFile(std::string const& filename)
+{
+    _output_file = filename;
+}
+
+void IterationTelemetry::subscribe(
+    std::function<void(IterationRecord const&)> callback)
+{
+    _subscribers.push_back(std::move(callback));
+}
+
+void IterationTelemetry::record(IterationRecord record)
+{
+    for (auto const& subscriber : _subscribers)
+        subscriber(record);
+
+    if (!_output_file.empty())
+        _records.push_back(std::move(record));
+}
+
+void IterationTelemetry::write() const
+{
+    if (_output_file.empty())
+        return;
+
+    std::ofstream out(_output_file);
+    if (!out) {
+        ERR("Could not open file '%s' for writing the iteration telemetry.",
+            _output_file.c_str());
+        return;
+    }
+
+    out << "solver,iteration,residual_norm,time_assembly,time_dirichlet,"
+           "time_linear_solver,linear_solver_succeeded\n";
+    for (auto const& record : _records) {
+        out << record.solver << ',' << record.iteration << ','
+            << record.residual_norm << ',' << record.time_assembly << ','
+            << record.time_dirichlet << ',' << record.time_linear_solver
+            << ',' << (record.linear_solver_succeeded ? 1 : 0) << '\n';
+    }
+
+    INFO("Iteration telemetry written to '%s'.", _output_file.c_str());
+}
+
+}  // NumLib
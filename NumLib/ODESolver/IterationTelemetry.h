@@ -0,0 +1,66 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace NumLib
+{
+
+/// Structured per-iteration record of the nonlinear solvers, cf.
+/// IterationTelemetry.
+struct IterationRecord
+{
+    std::string solver;     //!< "Newton" or "Picard".
+    unsigned iteration;     //!< iteration number within the solve.
+    double residual_norm;   //!< Euclidean residual norm; -1 if unavailable.
+    double time_assembly;   //!< seconds spent assembling.
+    double time_dirichlet;  //!< seconds spent applying Dirichlet BCs.
+    double time_linear_solver;  //!< seconds spent in the linear solver.
+    bool linear_solver_succeeded;
+};
+
+/// Accumulates the per-iteration records of all nonlinear solves of a run
+/// and writes them as CSV at the end, cf. the
+/// --write-iteration-telemetry command line option. Subscribers (e.g.
+/// auto-tuning tools) are notified of every record as it arrives. If no
+/// output file is set and no subscriber registered, recording is a no-op.
+class IterationTelemetry final
+{
+public:
+    static IterationTelemetry& instance();
+
+    /// Enables collection and sets the CSV file written by write().
+    void setOutputFile(std::string const& filename);
+
+    /// Registers a callback invoked for every record.
+    void subscribe(std::function<void(IterationRecord const&)> callback);
+
+    bool enabled() const
+    {
+        return !_output_file.empty() || !_subscribers.empty();
+    }
+
+    void record(IterationRecord record);
+
+    /// Writes the accumulated records as CSV to the configured file.
+    void write() const;
+
+private:
+    IterationTelemetry() = default;
+
+    std::string _output_file;
+    std::vector<IterationRecord> _records;
+    std::vector<std::function<void(IterationRecord const&)>> _subscribers;
+};
+
+}  // NumLib
@@ -0,0 +1,131 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "LinearSystemCapture.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+
+#include <logog/include/logog.hpp>
+
+namespace NumLib
+{
+
+LinearSystemCapture& LinearSystemCapture::instance()
+{
+    static LinearSystemCapture capture;
+    return capture;
+}
+
+void LinearSystemCapture::setOutputDirectory(std::string const& directory)
+{
+    _output_directory = directory;
+}
+
+#ifndef USE_PETSC
+
+void LinearSystemCapture::stage(GlobalMatrix const& A, GlobalVector const& rhs,
+                                GlobalVector const& x0)
+{
+    if (!enabled())
+        return;
+
+    _staged_matrix = A.getRawMatrix();
+    _staged_matrix.makeCompressed();
+    _staged_rhs = rhs.getRawVector();
+    _staged_x0 = x0.getRawVector();
+    _staged = true;
+}
+
+void LinearSystemCapture::commit(char const* const solver_name,
+                                 unsigned const iterations)
+{
+    if (!enabled() || !_staged)
+        return;
+    _staged = false;
+
+    if (_kept_dumps.size() >= _keep_worst)
+    {
+        auto const mildest = std::min_element(
+            _kept_dumps.begin(), _kept_dumps.end(),
+            [](KeptDump const& a, KeptDump const& b) {
+                return a.iterations < b.iterations;
+            });
+        if (mildest->iterations >= iterations)
+            return;
+        std::remove(mildest->filename.c_str());
+        _kept_dumps.erase(mildest);
+    }
+
+    std::string const filename =
+        _output_directory + "/system_t" + std::to_string(_timestep) + "_" +
+        solver_name + "_it" + std::to_string(iterations) + ".bin";
+
+    std::ofstream out(filename, std::ios::binary);
+    if (!out)
+    {
+        ERR("Could not open file '%s' for dumping the linear system.",
+            filename.c_str());
+        return;
+    }
+
+    // Format: magic, n, nnz as uint64; row pointers (n+1) and column
+    // indices (nnz) as int64; values (nnz), rhs (n) and initial guess (n)
+    // as double. Row-major compressed storage, cf. EigenMatrix.
+    out.write("OGSLSC01", 8);
+    std::uint64_t const n = _staged_matrix.rows();
+    std::uint64_t const nnz = _staged_matrix.nonZeros();
+    out.write(reinterpret_cast<char const*>(&n), sizeof n);
+    out.write(reinterpret_cast<char const*>(&nnz), sizeof nnz);
+    for (std::uint64_t i = 0; i <= n; ++i)
+    {
+        std::int64_t const entry = _staged_matrix.outerIndexPtr()[i];
+        out.write(reinterpret_cast<char const*>(&entry), sizeof entry);
+    }
+    for (std::uint64_t i = 0; i < nnz; ++i)
+    {
+        std::int64_t const entry = _staged_matrix.innerIndexPtr()[i];
+        out.write(reinterpret_cast<char const*>(&entry), sizeof entry);
+    }
+    out.write(reinterpret_cast<char const*>(_staged_matrix.valuePtr()),
+              nnz * sizeof(double));
+    out.write(reinterpret_cast<char const*>(_staged_rhs.data()),
+              n * sizeof(double));
+    out.write(reinterpret_cast<char const*>(_staged_x0.data()),
+              n * sizeof(double));
+
+    if (!out)
+    {
+        ERR("Writing the linear system dump '%s' failed.", filename.c_str());
+        return;
+    }
+
+    _kept_dumps.push_back(KeptDump{iterations, filename});
+    INFO("Dumped the linear system of a %u-iteration solve to '%s'.",
+         iterations, filename.c_str());
+}
+
+#else  // USE_PETSC
+
+void LinearSystemCapture::stage(GlobalMatrix const& /*A*/,
+                                GlobalVector const& /*rhs*/,
+                                GlobalVector const& /*x0*/)
+{
+}
+
+void LinearSystemCapture::commit(char const* const /*solver_name*/,
+                                 unsigned const /*iterations*/)
+{
+}
+
+#endif  // USE_PETSC
+
+}  // NumLib
@@ -0,0 +1,88 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "NumLib/NumericsConfig.h"
+
+namespace NumLib
+{
+
+/*! Captures the linear systems of the worst-converging nonlinear solves of a
+ * run and dumps them to disk in a binary format readable by the standalone
+ * ReplayLinearSystem tool.
+ *
+ * When enabled (cf. the \c --dump-worst-systems command line option) the
+ * nonlinear solvers stage a copy of the system handed to the linear solver in
+ * every iteration---matrix, right hand side and initial guess---and commit the
+ * last staged copy together with its iteration count when the solve finishes.
+ * Only the \c keep_worst commits with the highest iteration counts are kept
+ * on disk, so a multi-week run leaves a handful of files for the steps where
+ * the solver actually struggled, and solver tuning can happen offline on the
+ * captured systems instead of on the full simulation.
+ *
+ * \note Staging copies the matrix once per nonlinear iteration; this is a
+ * diagnosis facility, not meant to stay enabled in production runs.
+ *
+ * \note The implementation serializes the Eigen backend's compressed storage
+ * and is empty for PETSc builds, where \c MatView with a binary viewer and
+ * \c PetscBinaryRead cover the same use case.
+ */
+class LinearSystemCapture final
+{
+public:
+    static LinearSystemCapture& instance();
+
+    /// Enables the capture; the dumps are written into the given directory.
+    void setOutputDirectory(std::string const& directory);
+
+    /// Sets how many of the worst-converging systems are kept (default: 5).
+    void setKeepWorst(unsigned const keep_worst) { _keep_worst = keep_worst; }
+
+    bool enabled() const { return !_output_directory.empty(); }
+
+    /// Sets the time step subsequently committed captures are labelled with.
+    void setTimestep(std::size_t const timestep) { _timestep = timestep; }
+
+    /// Stages a copy of the linear system of the current nonlinear
+    /// iteration, replacing a previously staged one.
+    void stage(GlobalMatrix const& A, GlobalVector const& rhs,
+               GlobalVector const& x0);
+
+    /// Commits the staged system under the given iteration count: writes it
+    /// to disk if it ranks among the worst solves seen so far---evicting the
+    /// mildest kept dump---and discards it otherwise.
+    void commit(char const* const solver_name, unsigned const iterations);
+
+private:
+    LinearSystemCapture() = default;
+
+    struct KeptDump
+    {
+        unsigned iterations;
+        std::string filename;
+    };
+
+    std::string _output_directory;
+    unsigned _keep_worst = 5;
+    std::size_t _timestep = 0;
+    std::vector<KeptDump> _kept_dumps;
+
+#ifndef USE_PETSC
+    bool _staged = false;
+    GlobalMatrix::RawMatrixType _staged_matrix;
+    GlobalVector::RawVectorType _staged_rhs;
+    GlobalVector::RawVectorType _staged_x0;
+#endif
+};
+
+}  // NumLib
@@ -21,9 +21,9 @@ void MatrixTranslatorGeneral<ODESystemTag::FirstOrderImplicitQuasilinear>::
 
     auto const dxdot_dx = _time_disc.getNewXWeight();
 
-    // A = M * dxdot_dx + K
-    LinAlg::copy(M, A);
-    LinAlg::aypx(A, dxdot_dx, K);
+    // A = M * dxdot_dx + K; one value-array sweep when the matrices share
+    // their sparsity pattern, cf. LinAlg::weightedMatrixSum().
+    LinAlg::weightedMatrixSum(dxdot_dx, M, K, A);
 }
 
 void MatrixTranslatorGeneral<ODESystemTag::FirstOrderImplicitQuasilinear>::
@@ -131,8 +131,8 @@ void MatrixTranslatorCrankNicolson<
     auto const theta = _crank_nicolson.getTheta();
 
     // A = theta * (M * dxdot_dx + K) + dxdot_dx * _M_bar
-    LinAlg::copy(M, A);
-    LinAlg::aypx(A, dxdot_dx, K);  // A = M * dxdot_dx + K
+    // A = M * dxdot_dx + K, fused where the sparsity patterns agree.
+    LinAlg::weightedMatrixSum(dxdot_dx, M, K, A);
 
     LinAlg::scale(A, theta);            // A *= theta
     LinAlg::axpy(A, dxdot_dx, _M_bar);  // A += dxdot_dx * _M_bar
@@ -9,6 +9,10 @@
 
 #include "NonlinearSolver.h"
 
+#include <deque>
+
+#include <Eigen/Dense>
+
 // for debugging
 // #include <iostream>
 
@@ -16,6 +20,10 @@
 
 #include "BaseLib/ConfigTree.h"
 #include "BaseLib/Error.h"
+#include "BaseLib/AllocationGuard.h"
+#include "BaseLib/PhaseTimings.h"
+#include "IterationTelemetry.h"
+#include "LinearSystemCapture.h"
 #include "BaseLib/RunTime.h"
 #include "MathLib/LinAlg/LinAlg.h"
 #include "NumLib/DOF/GlobalMatrixProviders.h"
@@ -48,6 +56,11 @@ bool NonlinearSolver<NonlinearSolverTag::Picard>::solve(
 
     LinAlg::copy(x, x_new);  // set initial guess, TODO save the copy
 
+    // History of the fixed-point values g(x_k) and residuals g(x_k) - x_k
+    // for the Anderson acceleration; newest entries at the back.
+    std::deque<std::vector<double>> anderson_g_history;
+    std::deque<std::vector<double>> anderson_f_history;
+
     _convergence_criterion->preFirstIteration();
 
     unsigned iteration = 1;
@@ -61,28 +74,48 @@ bool NonlinearSolver<NonlinearSolverTag::Picard>::solve(
 
         BaseLib::RunTime time_assembly;
         time_assembly.start();
-        sys.assemble(x);
-        sys.getA(A);
-        sys.getRhs(rhs);
+        {
+            BaseLib::AllocationGuard::ScopedAllocationCheck const
+                allocation_check("Picard assembly");
+            sys.assemble(x);
+            sys.getA(A);
+            sys.getRhs(rhs);
+        }
         INFO("[time] Assembly took %g s.", time_assembly.elapsed());
+        BaseLib::PhaseTimings::instance().add("assembly",
+                                              time_assembly.elapsed());
 
         BaseLib::RunTime time_dirichlet;
         time_dirichlet.start();
         // Here _x_new has to be used and it has to be equal to x!
         sys.applyKnownSolutionsPicard(A, rhs, x_new);
         INFO("[time] Applying Dirichlet BCs took %g s.", time_dirichlet.elapsed());
+        BaseLib::PhaseTimings::instance().add("dirichlet_bc",
+                                              time_dirichlet.elapsed());
 
         if (!sys.isLinear() && _convergence_criterion->hasResidualCheck()) {
             GlobalVector res;
-            LinAlg::matMult(A, x_new, res); // res = A * x_new
-            LinAlg::axpy(res, -1.0, rhs);   // res -= rhs
+            LinAlg::matMultSub(A, x_new, rhs, res);  // res = A * x_new - rhs
             _convergence_criterion->checkResidual(res);
         }
 
+        if (LinearSystemCapture::instance().enabled())
+            LinearSystemCapture::instance().stage(A, rhs, x_new);
+
         BaseLib::RunTime time_linear_solver;
         time_linear_solver.start();
         bool iteration_succeeded = _linear_solver.solve(A, rhs, x_new);
         INFO("[time] Linear solver took %g s.", time_linear_solver.elapsed());
+        BaseLib::PhaseTimings::instance().add("linear_solver",
+                                              time_linear_solver.elapsed());
+
+        if (IterationTelemetry::instance().enabled())
+        {
+            IterationTelemetry::instance().record(
+                {"Picard", iteration, -1.0, time_assembly.elapsed(),
+                 time_dirichlet.elapsed(), time_linear_solver.elapsed(),
+                 iteration_succeeded});
+        }
 
         if (!iteration_succeeded)
         {
@@ -90,6 +123,83 @@ bool NonlinearSolver<NonlinearSolverTag::Picard>::solve(
         }
         else
         {
+#ifndef USE_PETSC
+            // The acceleration works on serial vectors; the distributed case
+            // would need ghost-aware gathers of the histories.
+            if (_anderson_depth > 0 && !sys.isLinear())
+            {
+                // Anderson mixing: replace g(x_k) = x_new by the linear
+                // combination of the last m fixed-point values minimizing
+                // the combined residual (type-II AA via normal equations of
+                // the residual differences).
+                std::vector<double> g_k(x_new.size());
+                x_new.copyValues(g_k);
+                std::vector<double> f_k(g_k);
+                {
+                    std::vector<double> x_values(x.size());
+                    x.copyValues(x_values);
+                    for (std::size_t i = 0; i < f_k.size(); ++i)
+                        f_k[i] -= x_values[i];
+                }
+
+                anderson_g_history.push_back(std::move(g_k));
+                anderson_f_history.push_back(std::move(f_k));
+                if (anderson_g_history.size() > _anderson_depth + 1)
+                {
+                    anderson_g_history.pop_front();
+                    anderson_f_history.pop_front();
+                }
+
+                auto const m = anderson_f_history.size() - 1;
+                if (m > 0)
+                {
+                    auto const n = anderson_f_history.back().size();
+                    auto const& f_new = anderson_f_history.back();
+
+                    // dF columns: f_i - f_new for the m previous residuals.
+                    Eigen::MatrixXd normal_matrix(m, m);
+                    Eigen::VectorXd rhs_small(m);
+                    auto const dF = [&](std::size_t const col,
+                                        std::size_t const row) {
+                        return anderson_f_history[col][row] - f_new[row];
+                    };
+                    for (std::size_t a = 0; a < m; ++a)
+                    {
+                        double b_dot = 0.0;
+                        for (std::size_t r = 0; r < n; ++r)
+                            b_dot += dF(a, r) * f_new[r];
+                        rhs_small[a] = -b_dot;
+                        for (std::size_t b = a; b < m; ++b)
+                        {
+                            double dot = 0.0;
+                            for (std::size_t r = 0; r < n; ++r)
+                                dot += dF(a, r) * dF(b, r);
+                            normal_matrix(a, b) = normal_matrix(b, a) = dot;
+                        }
+                    }
+                    // Tikhonov guard against rank deficiency.
+                    normal_matrix.diagonal().array() +=
+                        1e-12 * normal_matrix.trace() / m;
+
+                    Eigen::VectorXd const gamma =
+                        normal_matrix.ldlt().solve(rhs_small);
+
+                    // Accelerated iterate:
+                    // x_acc = g_new + sum_i gamma_i (g_i - g_new).
+                    auto const& g_new = anderson_g_history.back();
+                    for (std::size_t r = 0; r < n; ++r)
+                    {
+                        double value = g_new[r];
+                        for (std::size_t a = 0; a < m; ++a)
+                            value += gamma[a] *
+                                     (anderson_g_history[a][r] - g_new[r]);
+                        x_new.set(static_cast<GlobalIndexType>(r), value);
+                    }
+                    MathLib::LinAlg::finalizeAssembly(x_new);
+                }
+            }
+#endif  // USE_PETSC
+
             if (postIterationCallback)
                 postIterationCallback(iteration, x_new);
 
@@ -153,6 +263,9 @@ bool NonlinearSolver<NonlinearSolverTag::Picard>::solve(
             _maxiter);
     }
 
+    LinearSystemCapture::instance().commit("Picard",
+                                           std::min(iteration, _maxiter + 1));
+
     NumLib::GlobalMatrixProvider::provider.releaseMatrix(A);
     NumLib::GlobalVectorProvider::provider.releaseVector(rhs);
     NumLib::GlobalVectorProvider::provider.releaseVector(x_new);
@@ -204,23 +317,44 @@ bool NonlinearSolver<NonlinearSolverTag::Newton>::solve(
 
         BaseLib::RunTime time_assembly;
         time_assembly.start();
-        sys.assemble(x);
-        sys.getResidual(x, res);
-        sys.getJacobian(J);
+        {
+            BaseLib::AllocationGuard::ScopedAllocationCheck const
+                allocation_check("Newton assembly");
+            sys.assemble(x);
+            sys.getResidual(x, res);
+            sys.getJacobian(J);
+        }
         INFO("[time] Assembly took %g s.", time_assembly.elapsed());
+        BaseLib::PhaseTimings::instance().add("assembly",
+                                              time_assembly.elapsed());
 
         BaseLib::RunTime time_dirichlet;
         time_dirichlet.start();
         sys.applyKnownSolutionsNewton(J, res, minus_delta_x);
         INFO("[time] Applying Dirichlet BCs took %g s.", time_dirichlet.elapsed());
+        BaseLib::PhaseTimings::instance().add("dirichlet_bc",
+                                              time_dirichlet.elapsed());
 
         if (!sys.isLinear() && _convergence_criterion->hasResidualCheck())
             _convergence_criterion->checkResidual(res);
 
+        if (LinearSystemCapture::instance().enabled())
+            LinearSystemCapture::instance().stage(J, res, minus_delta_x);
+
         BaseLib::RunTime time_linear_solver;
         time_linear_solver.start();
         bool iteration_succeeded = _linear_solver.solve(J, res, minus_delta_x);
         INFO("[time] Linear solver took %g s.", time_linear_solver.elapsed());
+        BaseLib::PhaseTimings::instance().add("linear_solver",
+                                              time_linear_solver.elapsed());
+
+        if (IterationTelemetry::instance().enabled())
+        {
+            IterationTelemetry::instance().record(
+                {"Newton", iteration, LinAlg::norm2(res),
+                 time_assembly.elapsed(), time_dirichlet.elapsed(),
+                 time_linear_solver.elapsed(), iteration_succeeded});
+        }
 
         if (!iteration_succeeded)
         {
@@ -236,6 +370,29 @@ bool NonlinearSolver<NonlinearSolverTag::Newton>::solve(
                     x, _x_new_id);
             LinAlg::axpy(x_new, -_alpha, minus_delta_x);
 
+            if (_line_search && !sys.isLinear())
+            {
+                // Backtracking line search: halve the update until the
+                // residual norm does not grow. Each trial costs one
+                // re-assembly via getResidual().
+                double const norm_res0 = LinAlg::norm2(res);
+                double step = _alpha;
+                for (int backtrack = 0; backtrack < 6; ++backtrack)
+                {
+                    sys.assemble(x_new);
+                    sys.getResidual(x_new, res);
+                    double const norm_res_new = LinAlg::norm2(res);
+                    if (norm_res_new <= norm_res0)
+                        break;
+
+                    // Halve the step: add back half of the current update.
+                    step /= 2;
+                    LinAlg::axpy(x_new, step, minus_delta_x);
+                    INFO("Line search: residual %e > %e, damping to %g.",
+                         norm_res_new, norm_res0, step / _alpha);
+                }
+            }
+
             if (postIterationCallback)
                 postIterationCallback(iteration, x_new);
 
@@ -284,6 +441,13 @@ bool NonlinearSolver<NonlinearSolverTag::Newton>::solve(
             error_norms_met = _convergence_criterion->isSatisfied();
         }
 
+        // Linearly implicit (one-stage Rosenbrock) mode: the first
+        // linearized update is the solution of this step.
+        if (_linearly_implicit && iteration_succeeded)
+        {
+            error_norms_met = true;
+        }
+
         INFO("[time] Iteration #%u took %g s.", iteration,
              time_iteration.elapsed());
 
@@ -298,6 +462,9 @@ bool NonlinearSolver<NonlinearSolverTag::Newton>::solve(
             _maxiter);
     }
 
+    LinearSystemCapture::instance().commit("Newton",
+                                           std::min(iteration, _maxiter + 1));
+
     NumLib::GlobalMatrixProvider::provider.releaseMatrix(J);
     NumLib::GlobalVectorProvider::provider.releaseVector(res);
     NumLib::GlobalVectorProvider::provider.releaseVector(
@@ -318,18 +485,31 @@ createNonlinearSolver(GlobalLinearSolver& linear_solver,
     auto const max_iter = config.getConfigParameter<unsigned>("max_iter");
 
     if (type == "Picard") {
+        auto const anderson_depth =
+            //! \ogs_file_param{prj__nonlinear_solvers__nonlinear_solver__anderson_depth}
+            config.getConfigParameterOptional<unsigned>("anderson_depth");
+
         auto const tag = NonlinearSolverTag::Picard;
         using ConcreteNLS = NonlinearSolver<tag>;
         return std::make_pair(
-            std::unique_ptr<AbstractNLS>(
-                new ConcreteNLS{linear_solver, max_iter}),
+            std::unique_ptr<AbstractNLS>(new ConcreteNLS{
+                linear_solver, max_iter,
+                anderson_depth ? *anderson_depth : 0u}),
             tag);
     } else if (type == "Newton") {
+        auto const line_search =
+            //! \ogs_file_param{prj__nonlinear_solvers__nonlinear_solver__line_search}
+            config.getConfigParameterOptional<bool>("line_search");
+        auto const linearly_implicit =
+            //! \ogs_file_param{prj__nonlinear_solvers__nonlinear_solver__linearly_implicit}
+            config.getConfigParameterOptional<bool>("linearly_implicit");
+
         auto const tag = NonlinearSolverTag::Newton;
         using ConcreteNLS = NonlinearSolver<tag>;
         return std::make_pair(
-            std::unique_ptr<AbstractNLS>(
-                new ConcreteNLS{linear_solver, max_iter}),
+            std::unique_ptr<AbstractNLS>(new ConcreteNLS{
+                linear_solver, max_iter, line_search ? *line_search : false,
+                linearly_implicit ? *linearly_implicit : false}),
             tag);
     }
     OGS_FATAL("Unsupported nonlinear solver type");
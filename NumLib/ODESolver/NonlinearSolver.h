@@ -86,11 +86,21 @@ public:
      * \param maxiter the maximum number of iterations used to solve the
      *                equation.
      */
+    /// \param line_search enables backtracking line search on the residual
+    ///                    norm, cf. the <line_search> configuration option.
+    /// \param linearly_implicit accepts the first Newton update without a
+    ///                    convergence check, turning the scheme into a
+    ///                    one-stage Rosenbrock (linearly implicit) method;
+    ///                    cf. the <linearly_implicit> configuration option.
     explicit NonlinearSolver(
         GlobalLinearSolver& linear_solver,
-        const unsigned maxiter)
+        const unsigned maxiter,
+        bool const line_search = false,
+        bool const linearly_implicit = false)
         : _linear_solver(linear_solver),
-          _maxiter(maxiter)
+          _maxiter(maxiter),
+          _line_search(line_search),
+          _linearly_implicit(linearly_implicit)
     {
     }
 
@@ -118,6 +128,18 @@ private:
     double const _alpha =
         1;  //!< Damping factor. \todo Add constructor parameter.
 
+    //! Backtracking line search on the residual norm; halves the update
+    //! until the residual does not grow (at most 6 times). Each backtrack
+    //! costs one re-assembly, which is still cheaper than the time step cut
+    //! a diverged Newton forces.
+    bool const _line_search;
+
+    //! One-stage Rosenbrock mode: exactly one assembly plus one linearized
+    //! solve per step, the update is accepted without iterating. The local
+    //! error is first order in dt like backward Euler's; suitable for
+    //! mildly nonlinear problems with small steps.
+    bool const _linearly_implicit;
+
     std::size_t _res_id = 0u;            //!< ID of the residual vector.
     std::size_t _J_id = 0u;              //!< ID of the Jacobian matrix.
     std::size_t _minus_delta_x_id = 0u;  //!< ID of the \f$ -\Delta x\f$ vector.
@@ -142,10 +164,16 @@ public:
      * \param linear_solver the linear solver used by this nonlinear solver.
      * \param maxiter the maximum number of iterations used to solve the
      *                equation.
+     * \param anderson_depth depth m of the optional Anderson acceleration;
+     *                zero (the default) runs plain Picard iterations. See
+     *                the <anderson_depth> configuration option.
      */
     explicit NonlinearSolver(GlobalLinearSolver& linear_solver,
-                             const unsigned maxiter)
-        : _linear_solver(linear_solver), _maxiter(maxiter)
+                             const unsigned maxiter,
+                             unsigned const anderson_depth = 0)
+        : _linear_solver(linear_solver),
+          _maxiter(maxiter),
+          _anderson_depth(anderson_depth)
     {
     }
 
@@ -170,6 +198,9 @@ private:
     ConvergenceCriterion* _convergence_criterion = nullptr;
     const unsigned _maxiter;  //!< maximum number of iterations
 
+    //! Depth of the Anderson acceleration; zero disables it.
+    unsigned const _anderson_depth;
+
     std::size_t _A_id = 0u;      //!< ID of the \f$ A \f$ matrix.
     std::size_t _rhs_id = 0u;    //!< ID of the right-hand side vector.
     std::size_t _x_new_id = 0u;  //!< ID of the vector storing the solution of
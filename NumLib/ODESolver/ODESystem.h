@@ -49,6 +49,13 @@ public:
                           GlobalMatrix& M, GlobalMatrix& K,
                           GlobalVector& b) = 0;
 
+    //! Declares that the assembled operators M, K and b do not change over
+    //! the whole simulation (linear process with constant coefficients,
+    //! sources and natural boundary conditions). The time-discretized
+    //! system then assembles once and reuses the matrices for all
+    //! subsequent steps and iterations.
+    virtual bool hasConstantOperators() const { return false; }
+
     using Index = MathLib::MatrixVectorTraits<GlobalMatrix>::Index;
 
     //! Provides known solutions (Dirichlet boundary conditions) vector for
@@ -202,6 +202,42 @@ public:
     //! @}
 };
 
+//! Steady-state "discretization": the time derivative term is dropped
+//! entirely, i.e., the solved system is \f$ K x = b \f$.
+//!
+//! Combined with the SingleStep time stepping this is the true steady solve
+//! path: one assembly, one linear solve, no mass-matrix contribution and no
+//! solution history---also usable to compute consistent initial fields of
+//! coupled runs without a fake transient.
+class SteadyState final : public TimeDiscretization
+{
+public:
+    void setInitialState(const double t0, GlobalVector const&) override
+    {
+        _t = t0;
+    }
+
+    void pushState(const double /*t*/, GlobalVector const&,
+                   InternalMatrixStorage const&) override
+    {
+    }
+
+    void nextTimestep(const double t, const double /*delta_t*/) override
+    {
+        _t = t;
+    }
+
+    double getCurrentTime() const override { return _t; }
+
+    //! The mass matrix does not enter the steady system.
+    double getNewXWeight() const override { return 0.0; }
+
+    void getWeightedOldX(GlobalVector& y) const override { y.setZero(); }
+
+private:
+    double _t = std::numeric_limits<double>::quiet_NaN();  //!< current time
+};
+
 //! Backward Euler scheme.
 class BackwardEuler final : public TimeDiscretization
 {
@@ -21,7 +21,13 @@ std::unique_ptr<TimeDiscretization> createTimeDiscretization(
     //! \ogs_file_param{prj__time_loop__processes__process__time_discretization__type}
     auto const type = config.getConfigParameter<std::string>("type");
 
-    if (type == "BackwardEuler")
+    if (type == "SteadyState")
+    {
+        //! \ogs_file_param_special{prj__time_loop__processes__process__time_discretization__SteadyState}
+        using ConcreteTD = SteadyState;
+        return std::unique_ptr<TimeDiscretization>(new ConcreteTD);
+    }
+    else if (type == "BackwardEuler")
     {
         //! \ogs_file_param_special{prj__time_loop__processes__process__time_discretization__BackwardEuler}
         using ConcreteTD = BackwardEuler;
@@ -179,6 +179,12 @@ void TimeDiscretizedODESystem<ODESystemTag::FirstOrderImplicitQuasilinear,
 {
     namespace LinAlg = MathLib::LinAlg;
 
+    // Operator caching for processes declaring constant M, K and b: the
+    // element loop runs once, afterwards the cached matrices are reused;
+    // Dirichlet conditions are applied to copies downstream.
+    if (_ode.hasConstantOperators() && _operators_assembled)
+        return;
+
     auto const t = _time_disc.getCurrentTime();
     auto const& x_curr = _time_disc.getCurrentX(x_new_timestep);
 
@@ -191,6 +197,8 @@ void TimeDiscretizedODESystem<ODESystemTag::FirstOrderImplicitQuasilinear,
     LinAlg::finalizeAssembly(*_M);
     LinAlg::finalizeAssembly(*_K);
     LinAlg::finalizeAssembly(*_b);
+
+    _operators_assembled = true;
 }
 
 void TimeDiscretizedODESystem<
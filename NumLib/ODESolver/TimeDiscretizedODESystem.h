@@ -224,7 +224,11 @@ private:
 
     GlobalMatrix* _M;  //!< Matrix \f$ M \f$.
     GlobalMatrix* _K;  //!< Matrix \f$ K \f$.
-    GlobalVector* _b;  //!< Matrix \f$ b \f$.
+    GlobalVector* _b;  //!< Vector \f$ b \f$.
+
+    //! Whether M, K, b have been assembled at least once, cf.
+    //! ODESystem::hasConstantOperators().
+    bool _operators_assembled = false;
 
     std::size_t _M_id = 0u;  //!< ID of the \c _M matrix.
     std::size_t _K_id = 0u;  //!< ID of the \c _K matrix.
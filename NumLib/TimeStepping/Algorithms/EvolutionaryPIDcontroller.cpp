@@ -0,0 +1,102 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ */
+
+#include "EvolutionaryPIDcontroller.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "BaseLib/ConfigTree.h"
+#include "BaseLib/Error.h"
+
+namespace NumLib
+{
+
+double EvolutionaryPIDcontroller::limitStepSize(double const h) const
+{
+    double const h_prev = _ts_current.dt() > 0 ? _ts_current.dt() : _h0;
+    double limited = std::min(h, _rel_h_max * h_prev);
+    limited = std::max(limited, _rel_h_min * h_prev);
+    limited = std::min(std::max(limited, _h_min), _h_max);
+    // Don't overshoot the end of the time interval.
+    return std::min(limited, _t_end - _ts_current.current());
+}
+
+bool EvolutionaryPIDcontroller::next()
+{
+    if (std::abs(_ts_current.current() - _t_end) <
+        std::numeric_limits<double>::epsilon() * _t_end)
+        return false;
+    if (_ts_current.current() >= _t_end)
+        return false;
+
+    double h;
+    if (_ts_current.steps() == 0)
+    {
+        h = limitStepSize(_h0);
+    }
+    else if (_e_n <= 0.0)
+    {
+        // No error reported; keep the step size.
+        h = limitStepSize(_ts_current.dt());
+    }
+    else
+    {
+        double const kP = 0.075;
+        double const kI = 0.175;
+        double const kD = 0.01;
+
+        // Guard the error history against zeros and gaps.
+        double const e_n = std::max(_e_n, 1e-14 * _tol);
+        double const e_n1 = _e_n_minus1 > 0.0 ? _e_n_minus1 : e_n;
+        double const e_n2 = _e_n_minus2 > 0.0 ? _e_n_minus2 : e_n1;
+
+        double const factor = std::pow(e_n1 / e_n, kP) *
+                              std::pow(_tol / e_n, kI) *
+                              std::pow(e_n1 * e_n1 / (e_n * e_n2), kD);
+        h = limitStepSize(factor * _ts_current.dt());
+    }
+
+    if (h <= 0.0)
+        return false;
+
+    _ts_prev = _ts_current;
+    _ts_current = _ts_prev;
+    _ts_current += h;
+    _dt_vector.push_back(h);
+    return true;
+}
+
+std::unique_ptr<ITimeStepAlgorithm> EvolutionaryPIDcontroller::newInstance(
+    BaseLib::ConfigTree const& config)
+{
+    //! \ogs_file_param{prj__time_loop__time_stepping__type}
+    config.checkConfigParameter("type", "EvolutionaryPIDcontroller");
+
+    //! \ogs_file_param{prj__time_loop__time_stepping__EvolutionaryPIDcontroller__t_initial}
+    auto const t0 = config.getConfigParameter<double>("t_initial");
+    //! \ogs_file_param{prj__time_loop__time_stepping__EvolutionaryPIDcontroller__t_end}
+    auto const t_end = config.getConfigParameter<double>("t_end");
+    //! \ogs_file_param{prj__time_loop__time_stepping__EvolutionaryPIDcontroller__dt_guess}
+    auto const h0 = config.getConfigParameter<double>("dt_guess");
+    //! \ogs_file_param{prj__time_loop__time_stepping__EvolutionaryPIDcontroller__dt_min}
+    auto const h_min = config.getConfigParameter<double>("dt_min");
+    //! \ogs_file_param{prj__time_loop__time_stepping__EvolutionaryPIDcontroller__dt_max}
+    auto const h_max = config.getConfigParameter<double>("dt_max");
+    //! \ogs_file_param{prj__time_loop__time_stepping__EvolutionaryPIDcontroller__rel_dt_min}
+    auto const rel_h_min = config.getConfigParameter<double>("rel_dt_min");
+    //! \ogs_file_param{prj__time_loop__time_stepping__EvolutionaryPIDcontroller__rel_dt_max}
+    auto const rel_h_max = config.getConfigParameter<double>("rel_dt_max");
+    //! \ogs_file_param{prj__time_loop__time_stepping__EvolutionaryPIDcontroller__tol}
+    auto const tol = config.getConfigParameter<double>("tol");
+
+    return std::unique_ptr<ITimeStepAlgorithm>(new EvolutionaryPIDcontroller(
+        t0, t_end, h0, h_min, h_max, rel_h_min, rel_h_max, tol));
+}
+
+}  // NumLib
@@ -0,0 +1,112 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "ITimeStepAlgorithm.h"
+
+namespace BaseLib
+{
+class ConfigTree;
+}
+
+namespace NumLib
+{
+
+/**
+ * \brief Error-controlled adaptive time stepping with PID control.
+ *
+ * The controller adjusts the step size from a caller-provided estimate of
+ * the local solution error \f$e_n\f$ (e.g. the predictor--corrector
+ * difference of the time loop's solution-history extrapolation):
+ * \f[
+ *   \Delta t_{n+1} = \left(\frac{e_{n-1}}{e_n}\right)^{k_P}
+ *                    \left(\frac{\mathrm{tol}}{e_n}\right)^{k_I}
+ *                    \left(\frac{e_{n-1}^2}{e_n\,e_{n-2}}\right)^{k_D}
+ *                    \Delta t_n
+ * \f]
+ * with the standard gains \f$k_P=0.075\f$, \f$k_I=0.175\f$,
+ * \f$k_D=0.01\f$, clamped by absolute and relative bounds. The step size
+ * thereby tracks the solution dynamics instead of the nonlinear solver's
+ * iteration count. If no error has been reported, the step size is kept.
+ */
+class EvolutionaryPIDcontroller final : public ITimeStepAlgorithm
+{
+public:
+    EvolutionaryPIDcontroller(double const t0, double const t_end,
+                              double const h0, double const h_min,
+                              double const h_max, double const rel_h_min,
+                              double const rel_h_max, double const tol)
+        : _t_initial(t0),
+          _t_end(t_end),
+          _h0(h0),
+          _h_min(h_min),
+          _h_max(h_max),
+          _rel_h_min(rel_h_min),
+          _rel_h_max(rel_h_max),
+          _tol(tol),
+          _ts_prev(t0),
+          _ts_current(t0)
+    {
+    }
+
+    /// Creates an instance from the <EvolutionaryPIDcontroller> time
+    /// stepping configuration.
+    static std::unique_ptr<ITimeStepAlgorithm> newInstance(
+        BaseLib::ConfigTree const& config);
+
+    /// Reports the local solution error estimate of the just-computed step;
+    /// to be called by the time loop before next().
+    void setSolutionError(double const e)
+    {
+        _e_n_minus2 = _e_n_minus1;
+        _e_n_minus1 = _e_n;
+        _e_n = e;
+    }
+
+    double begin() const override { return _t_initial; }
+    double end() const override { return _t_end; }
+
+    bool next() override;
+
+    const TimeStep getTimeStep() const override { return _ts_current; }
+
+    bool accepted() const override { return true; }
+
+    const std::vector<double>& getTimeStepSizeHistory() const override
+    {
+        return _dt_vector;
+    }
+
+private:
+    double limitStepSize(double const h) const;
+
+    double const _t_initial;
+    double const _t_end;
+    double const _h0;
+    double const _h_min;
+    double const _h_max;
+    double const _rel_h_min;
+    double const _rel_h_max;
+    double const _tol;
+
+    // Error estimates of the last three steps; negative means "not
+    // reported".
+    double _e_n = -1.0;
+    double _e_n_minus1 = -1.0;
+    double _e_n_minus2 = -1.0;
+
+    TimeStep _ts_prev;
+    TimeStep _ts_current;
+    std::vector<double> _dt_vector;
+};
+
+}  // NumLib
@@ -28,8 +28,11 @@ std::unique_ptr<BoundaryCondition> BoundaryConditionBuilder::createBoundaryCondi
     MeshGeoToolsLib::MeshNodeSearcher& mesh_node_searcher =
         MeshGeoToolsLib::MeshNodeSearcher::getMeshNodeSearcher(mesh);
 
-    MeshGeoToolsLib::BoundaryElementsSearcher boundary_element_searcher(
-        mesh, mesh_node_searcher);
+    // Shared per-mesh searcher: its geometry-object association caches are
+    // reused by all boundary conditions of this mesh.
+    MeshGeoToolsLib::BoundaryElementsSearcher& boundary_element_searcher =
+        MeshGeoToolsLib::BoundaryElementsSearcher::getBoundaryElementsSearcher(
+            mesh, mesh_node_searcher);
 
     //! \ogs_file_param{prj__process_variables__process_variable__boundary_conditions__boundary_condition__type}
     auto const type = config.config.peekConfigParameter<std::string>("type");
@@ -36,16 +36,28 @@ void DirichletBoundaryCondition::getEssentialBCValues(
     bc_values.ids.clear();
     bc_values.values.clear();
 
+    // The mesh nodes do not change; resolve the DOF-table lookups once and
+    // reuse the cached global indices on all subsequent calls.
+    if (_global_indices.size() != _mesh_node_ids.size())
+    {
+        _global_indices.clear();
+        _global_indices.reserve(_mesh_node_ids.size());
+        for (auto const id : _mesh_node_ids)
+        {
+            MeshLib::Location l(_mesh_id, MeshLib::MeshItemType::Node, id);
+            _global_indices.push_back(
+                _dof_table.getGlobalIndex(l, _variable_id, _component_id));
+        }
+    }
+
     // convert mesh node ids to global index for the given component
     bc_values.ids.reserve(bc_values.ids.size() + _mesh_node_ids.size());
     bc_values.values.reserve(bc_values.values.size() + _mesh_node_ids.size());
-    for (auto const id : _mesh_node_ids)
+    for (std::size_t k = 0; k < _mesh_node_ids.size(); ++k)
     {
+        auto const id = _mesh_node_ids[k];
         pos.setNodeID(id);
-        MeshLib::Location l(_mesh_id, MeshLib::MeshItemType::Node, id);
-        // TODO: that might be slow, but only done once
-        const auto g_idx =
-            _dof_table.getGlobalIndex(l, _variable_id, _component_id);
+        const auto g_idx = _global_indices[k];
         if (g_idx == NumLib::MeshComponentMap::nop)
             continue;
         // For the DDC approach (e.g. with PETSc option), the negative
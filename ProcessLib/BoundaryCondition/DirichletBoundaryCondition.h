@@ -53,6 +53,10 @@ private:
     int const _variable_id;
     int const _component_id;
     mutable bool _already_computed = false;
+
+    //! Cached DOF-table lookups of _mesh_node_ids; the nodes do not change,
+    //! so the global indices are resolved once.
+    mutable std::vector<GlobalIndexType> _global_indices;
 };
 
 std::unique_ptr<DirichletBoundaryCondition> createDirichletBoundaryCondition(
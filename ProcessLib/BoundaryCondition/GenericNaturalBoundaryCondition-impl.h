@@ -7,7 +7,9 @@
  *
  */
 
+#include "BaseLib/Deterministic.h"
 #include "GenericNaturalBoundaryCondition.h"
+#include "NumLib/Assembler/SerialExecutor.h"
 #include "ProcessLib/Utils/CreateLocalAssemblers.h"
 #include "MeshLib/MeshSearch/NodeSearch.h"
 #include "GenericNaturalBoundaryConditionLocalAssembler.h"
@@ -83,9 +85,17 @@ void GenericNaturalBoundaryCondition<
                                                   GlobalMatrix& K,
                                                   GlobalVector& b)
 {
-    GlobalExecutor::executeMemberOnDereferenced(
-        &GenericNaturalBoundaryConditionLocalAssemblerInterface::assemble,
-        _local_assemblers, *_dof_table_boundary, t, x, K, b);
+    // In deterministic mode the boundary scatter runs serially in element
+    // order; its share of the assembly time is negligible,
+    // cf. BaseLib::setDeterministicParallelMode().
+    if (BaseLib::deterministicParallelMode())
+        NumLib::SerialExecutor::executeMemberOnDereferenced(
+            &GenericNaturalBoundaryConditionLocalAssemblerInterface::assemble,
+            _local_assemblers, *_dof_table_boundary, t, x, K, b);
+    else
+        GlobalExecutor::executeMemberOnDereferenced(
+            &GenericNaturalBoundaryConditionLocalAssemblerInterface::assemble,
+            _local_assemblers, *_dof_table_boundary, t, x, K, b);
 }
 
 }  // ProcessLib
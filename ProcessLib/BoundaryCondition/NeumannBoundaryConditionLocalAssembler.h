@@ -63,6 +63,9 @@ public:
         }
 
         auto const indices = NumLib::getIndices(id, dof_table_boundary);
+        // Serialized scatter stage; the boundary element loop is driven by
+        // the global executor, which may run it in parallel.
+#pragma omp critical(ogs_boundary_condition_scatter)
         b.add(indices, _local_rhs);
     }
 
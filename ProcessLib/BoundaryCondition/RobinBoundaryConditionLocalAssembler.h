@@ -76,9 +76,15 @@ public:
         }
 
         auto const indices = NumLib::getIndices(id, dof_table_boundary);
-        K.add(NumLib::LocalToGlobalIndexMap::RowColumnIndices(indices, indices),
-              _local_K);
-        b.add(indices, _local_rhs);
+        // Serialized scatter stage; the boundary element loop is driven by
+        // the global executor, which may run it in parallel.
+#pragma omp critical(ogs_boundary_condition_scatter)
+        {
+            K.add(NumLib::LocalToGlobalIndexMap::RowColumnIndices(indices,
+                                                                  indices),
+                  _local_K);
+            b.add(indices, _local_rhs);
+        }
     }
 
 private:
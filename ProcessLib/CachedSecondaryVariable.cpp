@@ -44,11 +44,33 @@ SecondaryVariableFunctions CachedSecondaryVariable::getExtrapolator()
 }
 
 GlobalVector const& CachedSecondaryVariable::evalField(
-    GlobalVector const& /*x*/,
+    GlobalVector const& x,
     NumLib::LocalToGlobalIndexMap const& /*dof_table*/,
     std::unique_ptr<GlobalVector>& /*result_cache*/
     ) const
 {
+    // Cross-step reuse: even if the cache has been expired at the start of
+    // the time step, the extrapolation result only changes if the primary
+    // solution did. An exact elementwise comparison against a stored copy
+    // decides that; one vector compare per step is negligible next to the
+    // extrapolation it skips (norm fingerprints are unsound: sign-flipped
+    // or permuted solutions share them).
+    if (_needs_recomputation)
+    {
+        std::vector<double> solution_values;
+        x.copyValues(solution_values);
+        if (!_cached_solution_values.empty() &&
+            solution_values == _cached_solution_values)
+        {
+            DBUG("%s: the primary solution is unchanged, reusing the cached "
+                 "values.", _internal_variable_name.c_str());
+            _needs_recomputation = false;
+        }
+        else
+        {
+            _cached_solution_values = std::move(solution_values);
+        }
+    }
     return evalFieldNoArgs();
 }
 
@@ -9,6 +9,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include "NumLib/Extrapolation/ExtrapolatableElementCollection.h"
 #include "NumLib/NamedFunctionProvider.h"
 #include "NumLib/NumericsConfig.h"
@@ -79,6 +81,11 @@ private:
     mutable GlobalVector _cached_nodal_values;
     mutable bool _needs_recomputation = true;
 
+    //! Copy of the primary solution the cache was computed for, cf.
+    //! evalField(); empty until the first evaluation, so that one always
+    //! computes.
+    mutable std::vector<double> _cached_solution_values;
+
     NumLib::Extrapolator& _extrapolator;
     std::unique_ptr<NumLib::ExtrapolatableElementCollection> _extrapolatables;
     SecondaryVariableContext const& _context;
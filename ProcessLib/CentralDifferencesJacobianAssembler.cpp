@@ -49,11 +49,60 @@ void CentralDifferencesJacobianAssembler::assembleWithJacobian(
 
     auto local_Jac = MathLib::createZeroedMatrix(local_Jac_data,
                                              num_r_c, num_r_c);
-    _local_x_perturbed_data = local_x_data;
+
+    // Temporary data only stored here in order to avoid frequent memory
+    // reallocations. Thread-local storage keeps this method reentrant, such
+    // that it can be driven from a parallel executor. The perturbed states are
+    // kept for all perturbations at once, such that the differencing
+    // afterwards runs over contiguous data without interleaved assemble()
+    // calls.
+    static thread_local std::vector<std::vector<double>> local_M_p_data;
+    static thread_local std::vector<std::vector<double>> local_M_m_data;
+    static thread_local std::vector<std::vector<double>> local_K_p_data;
+    static thread_local std::vector<std::vector<double>> local_K_m_data;
+    static thread_local std::vector<std::vector<double>> local_b_p_data;
+    static thread_local std::vector<std::vector<double>> local_b_m_data;
+    static thread_local std::vector<double> local_x_perturbed_data;
+
+    auto const resize_and_clear = [&](std::vector<std::vector<double>>& data) {
+        data.resize(num_r_c);
+        for (auto& v : data)
+            v.clear();
+    };
+    resize_and_clear(local_M_p_data);
+    resize_and_clear(local_M_m_data);
+    resize_and_clear(local_K_p_data);
+    resize_and_clear(local_K_m_data);
+    resize_and_clear(local_b_p_data);
+    resize_and_clear(local_b_m_data);
+
+    local_x_perturbed_data = local_x_data;
 
     auto const num_dofs_per_component =
         local_x_data.size() / _absolute_epsilons.size();
 
+    // Evaluation stage: assemble all perturbed states in a batch. Note that
+    // DOF coloring cannot reduce the number of evaluations here, since the
+    // element-local Jacobian is dense, i.e., every local DOF couples with
+    // every other one.
+    for (Eigen::MatrixXd::Index i = 0; i < num_r_c; ++i)
+    {
+        // assume that local_x_data is ordered by component.
+        auto const component = i / num_dofs_per_component;
+        auto const eps = _absolute_epsilons[component];
+
+        local_x_perturbed_data[i] += eps;
+        local_assembler.assemble(t, local_x_perturbed_data, local_M_p_data[i],
+                                 local_K_p_data[i], local_b_p_data[i]);
+
+        local_x_perturbed_data[i] = local_x_data[i] - eps;
+        local_assembler.assemble(t, local_x_perturbed_data, local_M_m_data[i],
+                                 local_K_m_data[i], local_b_m_data[i]);
+
+        local_x_perturbed_data[i] = local_x_data[i];
+    }
+
+    // Differencing stage.
     // Residual  res := M xdot + K x - b
     // Computing Jac := dres/dx
     //                = M dxdot/dx + dM/dx xdot + K dx/dx + dK/dx x - db/dx
@@ -63,52 +112,35 @@ void CentralDifferencesJacobianAssembler::assembleWithJacobian(
     // afterwards.
     for (Eigen::MatrixXd::Index i = 0; i < num_r_c; ++i)
     {
-        // assume that local_x_data is ordered by component.
         auto const component = i / num_dofs_per_component;
         auto const eps = _absolute_epsilons[component];
 
-        _local_x_perturbed_data[i] += eps;
-        local_assembler.assemble(t, _local_x_perturbed_data, local_M_data,
-                                 local_K_data, local_b_data);
-
-        _local_x_perturbed_data[i] = local_x_data[i] - eps;
-        local_assembler.assemble(t, _local_x_perturbed_data, _local_M_data,
-                                 _local_K_data, _local_b_data);
-
-        _local_x_perturbed_data[i] = local_x_data[i];
-
-        if (!local_M_data.empty()) {
+        if (!local_M_p_data[i].empty()) {
             auto const local_M_p =
-                MathLib::toMatrix(local_M_data, num_r_c, num_r_c);
+                MathLib::toMatrix(local_M_p_data[i], num_r_c, num_r_c);
             auto const local_M_m =
-                MathLib::toMatrix(_local_M_data, num_r_c, num_r_c);
+                MathLib::toMatrix(local_M_m_data[i], num_r_c, num_r_c);
             local_Jac.col(i).noalias() +=
                 // dM/dxi * x_dot
                 (local_M_p - local_M_m) * local_xdot / (2.0 * eps);
-            local_M_data.clear();
-            _local_M_data.clear();
         }
-        if (!local_K_data.empty()) {
+        if (!local_K_p_data[i].empty()) {
             auto const local_K_p =
-                MathLib::toMatrix(local_K_data, num_r_c, num_r_c);
+                MathLib::toMatrix(local_K_p_data[i], num_r_c, num_r_c);
             auto const local_K_m =
-                MathLib::toMatrix(_local_K_data, num_r_c, num_r_c);
+                MathLib::toMatrix(local_K_m_data[i], num_r_c, num_r_c);
             local_Jac.col(i).noalias() +=
                 // dK/dxi * x
                 (local_K_p - local_K_m) * local_x / (2.0 * eps);
-            local_K_data.clear();
-            _local_K_data.clear();
         }
-        if (!local_b_data.empty()) {
+        if (!local_b_p_data[i].empty()) {
             auto const local_b_p =
-                MathLib::toVector<Eigen::VectorXd>(local_b_data, num_r_c);
+                MathLib::toVector<Eigen::VectorXd>(local_b_p_data[i], num_r_c);
             auto const local_b_m =
-                MathLib::toVector<Eigen::VectorXd>(_local_b_data, num_r_c);
+                MathLib::toVector<Eigen::VectorXd>(local_b_m_data[i], num_r_c);
             local_Jac.col(i).noalias() -=
                 // db/dxi
                 (local_b_p - local_b_m) / (2.0 * eps);
-            local_b_data.clear();
-            _local_b_data.clear();
         }
     }
 
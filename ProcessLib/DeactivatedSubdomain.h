@@ -0,0 +1,34 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <vector>
+
+namespace ProcessLib
+{
+
+/*! One entry of a process's element deactivation sequence: the elements of
+ * the given material groups are inactive while the simulation time lies in
+ * [start_time, end_time].
+ *
+ * Inactive elements are skipped by the global assembler, and degrees of
+ * freedom touched exclusively by inactive elements are constrained to their
+ * current solution value through identity rows, so the system stays regular
+ * while excavation-type models pay assembly and solver cost only for the
+ * active region, cf. Process::setElementDeactivation().
+ */
+struct DeactivatedSubdomain
+{
+    double start_time;
+    double end_time;
+    std::vector<int> material_ids;
+};
+
+}  // namespace ProcessLib
@@ -36,13 +36,22 @@ GlobalVector const& GlobalVectorFromNamedFunction::call(
          _dof_table_single.dofSizeWithoutGhosts(),
          &_dof_table_single.getGhostIndices(), nullptr});
 
-    GlobalIndexType nnodes = _mesh.getNumberOfNodes();
+    evaluateNodeRange(0, _mesh.getNumberOfNodes(), x, dof_table, *result);
 
+    return *result;
+}
+
+void GlobalVectorFromNamedFunction::evaluateNodeRange(
+    GlobalIndexType const first_node_id, GlobalIndexType const last_node_id,
+    GlobalVector const& x, NumLib::LocalToGlobalIndexMap const& dof_table,
+    GlobalVector& result)
+{
     auto const n_args = _function_caller.getNumberOfUnboundArguments();
     assert(dof_table.getNumberOfComponents() == n_args);
     std::vector<double> args(n_args);
 
-    for (GlobalIndexType node_id = 0; node_id < nnodes; ++node_id) {
+    for (GlobalIndexType node_id = first_node_id; node_id < last_node_id;
+         ++node_id) {
         // TODO maybe fill args via callback mechanism or remove this class entirely.
         // Caution: The order of args will be the same as the order of the
         // components in the global vector!
@@ -54,10 +63,8 @@ GlobalVector const& GlobalVectorFromNamedFunction::call(
         auto const value = _function_caller.call(args);
 
         // TODO Problems with PETSc? (local vs. global index)
-        result->set(node_id, value);
+        result.set(node_id, value);
     }
-
-    return *result;
 }
 
 }  // namespace ProcessLib
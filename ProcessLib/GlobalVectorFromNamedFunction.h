@@ -46,6 +46,20 @@ public:
                              NumLib::LocalToGlobalIndexMap const& dof_table,
                              std::unique_ptr<GlobalVector>& result);
 
+    //! Evaluates the function for the node id range [\c first_node_id,
+    //! \c last_node_id) into \c result.
+    //!
+    //! The batched form amortizes the per-call setup (argument staging, the
+    //! compiled call plan's buffers) over the range and is the unit callers
+    //! can distribute over threads---each worker needs its own
+    //! GlobalVectorFromNamedFunction (and context), since the evaluation
+    //! mutates the shared context index.
+    void evaluateNodeRange(GlobalIndexType const first_node_id,
+                           GlobalIndexType const last_node_id,
+                           GlobalVector const& x,
+                           NumLib::LocalToGlobalIndexMap const& dof_table,
+                           GlobalVector& result);
+
 private:
     NumLib::SpecificFunctionCaller _function_caller;
     MeshLib::Mesh const& _mesh;
@@ -95,12 +95,24 @@ public:
         SpatialPosition pos;
         pos.setElementID(_element.getID());
 
+        // Elementwise-constant conductivity (constant or cell-keyed
+        // parameter) is resolved once per element instead of per
+        // integration point, cf. Parameter::isElementwiseConstant().
+        bool const k_hoisted =
+            _process_data.hydraulic_conductivity.isElementwiseConstant();
+        double k = k_hoisted
+                       ? _process_data.hydraulic_conductivity(t, pos)[0]
+                       : 0.0;
+
         for (unsigned ip = 0; ip < n_integration_points; ip++)
         {
-            pos.setIntegrationPoint(ip);
             auto const& sm = _shape_matrices[ip];
             auto const& wp = _integration_method.getWeightedPoint(ip);
-            auto const k = _process_data.hydraulic_conductivity(t, pos)[0];
+            if (!k_hoisted)
+            {
+                pos.setIntegrationPoint(ip);
+                k = _process_data.hydraulic_conductivity(t, pos)[0];
+            }
 
             local_K.noalias() += sm.dNdx.transpose() * k * sm.dNdx * sm.detJ *
                                  sm.integralMeasure * wp.getWeight();
@@ -125,11 +137,20 @@ public:
         SpatialPosition pos;
         pos.setElementID(_element.getID());
 
+        bool const k_hoisted =
+            _process_data.hydraulic_conductivity.isElementwiseConstant();
+        double k = k_hoisted
+                       ? _process_data.hydraulic_conductivity(t, pos)[0]
+                       : 0.0;
+
         for (unsigned ip = 0; ip < n_integration_points; ip++)
         {
-            pos.setIntegrationPoint(ip);
             auto const& sm = _shape_matrices[ip];
-            auto const k = _process_data.hydraulic_conductivity(t, pos)[0];
+            if (!k_hoisted)
+            {
+                pos.setIntegrationPoint(ip);
+                k = _process_data.hydraulic_conductivity(t, pos)[0];
+            }
             // Darcy velocity only computed for output.
             GlobalDimVectorType const darcy_velocity = -k * sm.dNdx * local_x_vec;
 
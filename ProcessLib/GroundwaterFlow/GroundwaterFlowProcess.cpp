@@ -50,6 +50,8 @@ void GroundwaterFlowProcess::initializeConcreteProcess(
         pv.getShapeFunctionOrder(), _local_assemblers,
         mesh.isAxiallySymmetric(), integration_order, _process_data);
 
+    _element_execution_order = typeOrderedExecutionOrder(mesh.getElements());
+
     _secondary_variables.addSecondaryVariable(
         "darcy_velocity_x", 1,
         makeExtrapolator(
@@ -80,10 +82,11 @@ void GroundwaterFlowProcess::assembleConcreteProcess(const double t,
 {
     DBUG("Assemble GroundwaterFlowProcess.");
 
-    // Call global assembler for each local assembly item.
-    GlobalExecutor::executeMemberDereferenced(
+    // Call global assembler for each local assembly item, iterating the
+    // local assemblers bucketed by concrete element type.
+    GlobalExecutor::executeMemberDereferencedInOrder(
         _global_assembler, &VectorMatrixAssembler::assemble, _local_assemblers,
-        *_local_to_global_index_map, t, x, M, K, b);
+        _element_execution_order, *_local_to_global_index_map, t, x, M, K, b);
 }
 
 void GroundwaterFlowProcess::assembleWithJacobianConcreteProcess(
@@ -93,11 +96,12 @@ void GroundwaterFlowProcess::assembleWithJacobianConcreteProcess(
 {
     DBUG("AssembleWithJacobian GroundwaterFlowProcess.");
 
-    // Call global assembler for each local assembly item.
-    GlobalExecutor::executeMemberDereferenced(
+    // Call global assembler for each local assembly item, iterating the
+    // local assemblers bucketed by concrete element type.
+    GlobalExecutor::executeMemberDereferencedInOrder(
         _global_assembler, &VectorMatrixAssembler::assembleWithJacobian,
-        _local_assemblers, *_local_to_global_index_map, t, x, xdot, dxdot_dx,
-        dx_dx, M, K, b, Jac);
+        _local_assemblers, _element_execution_order, *_local_to_global_index_map,
+        t, x, xdot, dxdot_dx, dx_dx, M, K, b, Jac);
 }
 
 
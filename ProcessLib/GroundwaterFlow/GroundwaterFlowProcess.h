@@ -64,21 +64,37 @@ public:
     {
         if (_balance_mesh) // computing the balance is optional
         {
-            std::vector<double> init_values(
-                _balance_mesh->getNumberOfElements(), 0.0);
-            MeshLib::addPropertyToMesh(*_balance_mesh, _balance_pv_name,
-                                       MeshLib::MeshItemType::Cell, 1,
-                                       init_values);
-            auto balance = ProcessLib::CalculateSurfaceFlux(
-                *_balance_mesh,
-                getProcessVariables()[0].get().getNumberOfComponents(),
-                _integration_order);
+            // The balance only feeds the balance output file; skip its
+            // surface integration entirely on steps without output.
+            if (!isCurrentStepOutputStep())
+                return;
+
+            if (!_balance)
+            {
+                // Build the surface-flux machinery (local assemblers,
+                // surface-to-bulk mapping) once and reuse it for all steps.
+                _balance.reset(new ProcessLib::CalculateSurfaceFlux(
+                    *_balance_mesh,
+                    getProcessVariables()[0].get().getNumberOfComponents(),
+                    _integration_order));
+            }
+
+            if (!_balance_mesh->getProperties().hasPropertyVector(
+                    _balance_pv_name))
+            {
+                std::vector<double> init_values(
+                    _balance_mesh->getNumberOfElements(), 0.0);
+                MeshLib::addPropertyToMesh(*_balance_mesh, _balance_pv_name,
+                                           MeshLib::MeshItemType::Cell, 1,
+                                           init_values);
+            }
 
             auto* const balance_pv =
                 _balance_mesh->getProperties()
                     .template getPropertyVector<double>(_balance_pv_name);
+            std::fill(balance_pv->begin(), balance_pv->end(), 0.0);
 
-            balance.integrate(x, *balance_pv, *this);
+            _balance->integrate(x, *balance_pv, *this);
             // post: surface_mesh has vectorial element property
 
             // TODO output, if output classes are ready this has to be
@@ -110,7 +126,13 @@ private:
     std::vector<std::unique_ptr<GroundwaterFlowLocalAssemblerInterface>>
         _local_assemblers;
 
+    //! Element iteration order bucketed by concrete element type, cf.
+    //! typeOrderedExecutionOrder().
+    std::vector<std::size_t> _element_execution_order;
+
     std::unique_ptr<MeshLib::Mesh> _balance_mesh;
+    //! Persistent surface-flux machinery, built once on first use.
+    std::unique_ptr<ProcessLib::CalculateSurfaceFlux> _balance;
     std::string const _balance_pv_name;
     std::string const _balance_out_fname;
 };
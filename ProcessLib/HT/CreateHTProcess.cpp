@@ -165,6 +165,10 @@ std::unique_ptr<Process> createHTProcess(
         //! \ogs_file_param{prj__processes__process__HT__specific_body_force}
         config.getConfigParameter<std::vector<double>>("specific_body_force");
     assert(b.size() > 0 && b.size() < 4);
+    auto const mass_lumping =
+        //! \ogs_file_param{prj__processes__process__HT__mass_lumping}
+        config.getConfigParameterOptional<bool>("mass_lumping");
+
     bool const has_gravity = MathLib::toVector(b).norm() > 0;
     if (has_gravity)
         std::copy_n(b.data(), b.size(), specific_body_force.data());
@@ -185,7 +189,8 @@ std::unique_ptr<Process> createHTProcess(
         thermal_expansion_coefficient_fluid,
         reference_temperature_fluid_density_model,
         specific_body_force,
-        has_gravity};
+        has_gravity,
+        mass_lumping ? *mass_lumping : false};
 
     SecondaryVariableCollection secondary_variables;
 
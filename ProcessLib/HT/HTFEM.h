@@ -105,9 +105,6 @@ public:
         pos.setElementID(_element.getID());
 
         auto const num_nodes = ShapeFunction::NPOINTS;
-        auto p_nodal_values =
-            Eigen::Map<const Eigen::VectorXd>(&local_x[num_nodes], num_nodes);
-
         auto const & b = _process_data.specific_body_force.head(GlobalDim);
         Eigen::MatrixXd unit_mat(
             Eigen::MatrixXd::Identity(GlobalDim, GlobalDim));
@@ -165,8 +162,12 @@ public:
 
             double T_int_pt = 0.0;
             double p_int_pt = 0.0;
-            // Order matters: First T, then P!
-            NumLib::shapeFunctionInterpolate(local_x, sm.N, T_int_pt, p_int_pt);
+            Eigen::Matrix<double, -1, 1, 0, -1, 1> grad_p(GlobalDim);
+            // Fused: one pass over N/dNdx yields T, p and the pressure
+            // gradient used for the Darcy velocity below.
+            NumLib::shapeFunctionInterpolate(local_x, sm.N, T_int_pt);
+            NumLib::shapeFunctionInterpolateWithGradient<1>(
+                local_x, sm.N, sm.dNdx, p_int_pt, grad_p);
 
             double const delta_T(T_int_pt - temperature0);
             // TODO include this via material lib
@@ -177,7 +178,7 @@ public:
                 intrinsic_permeability / viscosity0;
 
             Eigen::Matrix<double, -1, 1, 0, -1, 1> const velocity =
-                -perm_visc * (sm.dNdx * p_nodal_values - density_water_T * b);
+                -perm_visc * (grad_p - density_water_T * b);
 
             double const velocity_magnitude =
                 std::sqrt(velocity.transpose() * velocity);
@@ -217,6 +218,19 @@ public:
                 _darcy_velocities[d][ip] = velocity[d];
             }
         }
+
+        if (_process_data.has_mass_lumping)
+        {
+            // Row-sum lumping of both mass blocks; removes the consistent
+            // mass matrix's off-diagonal antidiffusion that destabilizes
+            // advection-dominated transport at large time steps.
+            for (int row = 0; row < local_M.rows(); ++row)
+            {
+                double const row_sum = local_M.row(row).sum();
+                local_M.row(row).setZero();
+                local_M(row, row) = row_sum;
+            }
+        }
     }
 
     Eigen::Map<const Eigen::RowVectorXd> getShapeMatrix(
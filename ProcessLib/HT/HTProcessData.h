@@ -40,7 +40,8 @@ struct HTProcessData
         ProcessLib::Parameter<double> const&
             reference_temperature_fluid_density_model_,
         Eigen::Vector3d const& specific_body_force_,
-        bool const has_gravity_)
+        bool const has_gravity_,
+        bool const has_mass_lumping_)
         : porosity(porosity_),
           intrinsic_permeability(intrinsic_permeability_),
           specific_storage(specific_storage_),
@@ -57,7 +58,8 @@ struct HTProcessData
           reference_temperature_fluid_density_model(
               reference_temperature_fluid_density_model_),
           specific_body_force(specific_body_force_),
-          has_gravity(has_gravity_)
+          has_gravity(has_gravity_),
+          has_mass_lumping(has_mass_lumping_)
     {
     }
 
@@ -78,7 +80,8 @@ struct HTProcessData
           reference_temperature_fluid_density_model(
               other.reference_temperature_fluid_density_model),
           specific_body_force(other.specific_body_force),
-          has_gravity(other.has_gravity)
+          has_gravity(other.has_gravity),
+          has_mass_lumping(other.has_mass_lumping)
     {
     }
 
@@ -107,6 +110,9 @@ struct HTProcessData
     Parameter<double> const& reference_temperature_fluid_density_model;
     Eigen::Vector3d const specific_body_force;
     bool const has_gravity;
+    //! Lump the mass matrices row-wise onto the diagonal, cf. the
+    //! <mass_lumping> process option.
+    bool const has_mass_lumping;
 };
 
 }  // namespace HT
@@ -66,8 +66,13 @@ std::unique_ptr<Process> createHeatConductionProcess(
 
     DBUG("Use \'%s\' as density parameter.", density.name.c_str());
 
+    auto const mass_lumping =
+        //! \ogs_file_param{prj__processes__process__HEAT_CONDUCTION__mass_lumping}
+        config.getConfigParameterOptional<bool>("mass_lumping");
+
     HeatConductionProcessData process_data{thermal_conductivity, heat_capacity,
-                                           density};
+                                           density,
+                                           mass_lumping ? *mass_lumping : false};
 
     SecondaryVariableCollection secondary_variables;
 
@@ -101,14 +101,32 @@ public:
         SpatialPosition pos;
         pos.setElementID(_element.getID());
 
+        // Elementwise-constant material parameters are resolved once per
+        // element instead of per integration point,
+        // cf. Parameter::isElementwiseConstant().
+        bool const properties_hoisted =
+            _process_data.thermal_conductivity.isElementwiseConstant() &&
+            _process_data.heat_capacity.isElementwiseConstant() &&
+            _process_data.density.isElementwiseConstant();
+        double k = 0.0, heat_capacity = 0.0, density = 0.0;
+        if (properties_hoisted)
+        {
+            k = _process_data.thermal_conductivity(t, pos)[0];
+            heat_capacity = _process_data.heat_capacity(t, pos)[0];
+            density = _process_data.density(t, pos)[0];
+        }
+
         for (unsigned ip = 0; ip < n_integration_points; ip++)
         {
-            pos.setIntegrationPoint(ip);
             auto const& sm = _shape_matrices[ip];
             auto const& wp = _integration_method.getWeightedPoint(ip);
-            auto const k = _process_data.thermal_conductivity(t, pos)[0];
-            auto const heat_capacity = _process_data.heat_capacity(t, pos)[0];
-            auto const density = _process_data.density(t, pos)[0];
+            if (!properties_hoisted)
+            {
+                pos.setIntegrationPoint(ip);
+                k = _process_data.thermal_conductivity(t, pos)[0];
+                heat_capacity = _process_data.heat_capacity(t, pos)[0];
+                density = _process_data.density(t, pos)[0];
+            }
 
             local_K.noalias() += sm.dNdx.transpose() * k * sm.dNdx * sm.detJ *
                                  wp.getWeight() * sm.integralMeasure;
@@ -116,6 +134,18 @@ public:
                                  sm.N * sm.detJ * wp.getWeight() *
                                  sm.integralMeasure;
         }
+
+        if (_process_data.has_mass_lumping)
+        {
+            // Row-sum lumping of the mass matrix, cf. the <mass_lumping>
+            // process option.
+            for (int row = 0; row < local_M.rows(); ++row)
+            {
+                double const row_sum = local_M.row(row).sum();
+                local_M.row(row).setZero();
+                local_M(row, row) = row_sum;
+            }
+        }
     }
 
     void computeSecondaryVariableConcrete(
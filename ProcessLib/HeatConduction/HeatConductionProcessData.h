@@ -26,17 +26,20 @@ struct HeatConductionProcessData
 {
     HeatConductionProcessData(Parameter<double> const& thermal_conductivity_,
                               Parameter<double> const& heat_capacity_,
-                              Parameter<double> const& density_)
+                              Parameter<double> const& density_,
+                              bool const has_mass_lumping_)
         : thermal_conductivity(thermal_conductivity_),
           heat_capacity(heat_capacity_),
-          density(density_)
+          density(density_),
+          has_mass_lumping(has_mass_lumping_)
     {
     }
 
     HeatConductionProcessData(HeatConductionProcessData&& other)
         : thermal_conductivity(other.thermal_conductivity),
           heat_capacity(other.heat_capacity),
-          density(other.density)
+          density(other.density),
+          has_mass_lumping(other.has_mass_lumping)
     {
     }
 
@@ -52,6 +55,9 @@ struct HeatConductionProcessData
     Parameter<double> const& thermal_conductivity;
     Parameter<double> const& heat_capacity;
     Parameter<double> const& density;
+    //! Lump the mass matrix row-wise onto the diagonal, cf. the
+    //! <mass_lumping> process option.
+    bool const has_mass_lumping;
 };
 
 }  // namespace HeatConduction
@@ -0,0 +1,84 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "IntegrationPointOutput.h"
+
+#include <vector>
+
+#include <logog/include/logog.hpp>
+
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/Elements/Point.h"
+#include "MeshLib/IO/writeMeshToFile.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/Node.h"
+#include "NumLib/Extrapolation/ExtrapolatableElementCollection.h"
+
+namespace ProcessLib
+{
+
+bool writeIntegrationPointData(
+    std::string const& file_name, std::string const& field_name,
+    MeshLib::Mesh const& mesh,
+    NumLib::ExtrapolatableElementCollection const& extrapolatables)
+{
+    std::vector<MeshLib::Node*> points;
+    std::vector<MeshLib::Element*> point_elements;
+    std::vector<double> values;
+    std::vector<double> cache;
+
+    auto const n_elements = extrapolatables.size();
+    for (std::size_t e = 0; e < n_elements; ++e)
+    {
+        auto const& integration_point_values =
+            extrapolatables.getIntegrationPointValues(e, cache);
+        auto const* const element = mesh.getElement(e);
+        auto const n_nodes = element->getNumberOfNodes();
+
+        for (unsigned ip = 0; ip < integration_point_values.size(); ++ip)
+        {
+            auto const N = extrapolatables.getShapeMatrix(e, ip);
+            if (static_cast<unsigned>(N.cols()) > n_nodes)
+            {
+                ERR("Shape matrix and element node count mismatch during "
+                    "integration point output.");
+                return false;
+            }
+
+            // Physical coordinates of the integration point.
+            double coords[3] = {0.0, 0.0, 0.0};
+            for (int n = 0; n < N.cols(); ++n)
+            {
+                auto const& node = *element->getNode(n);
+                for (unsigned d = 0; d < 3; ++d)
+                    coords[d] += N[n] * node[d];
+            }
+
+            auto* const point =
+                new MeshLib::Node(coords, points.size());
+            points.push_back(point);
+            auto** point_nodes = new MeshLib::Node*[1];
+            point_nodes[0] = point;
+            point_elements.push_back(new MeshLib::Point(point_nodes));
+
+            values.push_back(integration_point_values[ip]);
+        }
+    }
+
+    MeshLib::Mesh point_cloud(mesh.getName() + "_" + field_name + "_ip",
+                              points, point_elements);
+    auto* const field =
+        point_cloud.getProperties().createNewPropertyVector<double>(
+            field_name, MeshLib::MeshItemType::Node, 1);
+    field->assign(values.begin(), values.end());
+
+    return MeshLib::IO::writeMeshToFile(point_cloud, file_name) == 0;
+}
+
+}  // namespace ProcessLib
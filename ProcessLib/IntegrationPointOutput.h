@@ -0,0 +1,43 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <string>
+
+namespace MeshLib
+{
+class Mesh;
+}
+
+namespace NumLib
+{
+class ExtrapolatableElementCollection;
+}
+
+namespace ProcessLib
+{
+
+/// Writes raw integration point values of one field as a point cloud,
+/// bypassing the least-squares extrapolation to nodes entirely.
+///
+/// Each integration point becomes one point of a POINT1 mesh at its physical
+/// coordinates (interpolated with the point's shape function values), with
+/// the field attached as a point data array named \c field_name; the result
+/// is written through the regular mesh writers (the file extension selects
+/// .vtu or .bms). This is exact where nodal smoothing is not wanted, e.g.,
+/// stresses of mechanics runs, and costs a single sweep over the elements.
+///
+/// Returns true on success.
+bool writeIntegrationPointData(
+    std::string const& file_name, std::string const& field_name,
+    MeshLib::Mesh const& mesh,
+    NumLib::ExtrapolatableElementCollection const& extrapolatables);
+
+}  // namespace ProcessLib
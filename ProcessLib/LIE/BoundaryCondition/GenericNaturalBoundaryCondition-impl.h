@@ -11,6 +11,9 @@
 
 #include "GenericNaturalBoundaryCondition.h"
 
+#include "BaseLib/Deterministic.h"
+#include "NumLib/Assembler/SerialExecutor.h"
+
 #include "MeshLib/MeshSearch/NodeSearch.h"
 
 #include "ProcessLib/Utils/CreateLocalAssemblers.h"
@@ -90,9 +93,17 @@ void GenericNaturalBoundaryCondition<
                                          GlobalMatrix& K,
                                          GlobalVector& b)
 {
-    GlobalExecutor::executeMemberOnDereferenced(
-        &GenericNaturalBoundaryConditionLocalAssemblerInterface::assemble,
-        _local_assemblers, *_dof_table_boundary, t, x, K, b);
+    // In deterministic mode the boundary scatter runs serially in element
+    // order; its share of the assembly time is negligible,
+    // cf. BaseLib::setDeterministicParallelMode().
+    if (BaseLib::deterministicParallelMode())
+        NumLib::SerialExecutor::executeMemberOnDereferenced(
+            &GenericNaturalBoundaryConditionLocalAssemblerInterface::assemble,
+            _local_assemblers, *_dof_table_boundary, t, x, K, b);
+    else
+        GlobalExecutor::executeMemberOnDereferenced(
+            &GenericNaturalBoundaryConditionLocalAssemblerInterface::assemble,
+            _local_assemblers, *_dof_table_boundary, t, x, K, b);
 }
 
 }  // LIE
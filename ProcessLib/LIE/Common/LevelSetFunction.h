@@ -8,6 +8,9 @@
 
 #pragma once
 
+#include <cstddef>
+#include <vector>
+
 namespace ProcessLib
 {
 namespace LIE
@@ -22,5 +25,40 @@ struct FractureProperty;
 double calculateLevelSetFunction(
         FractureProperty const& fracture_property, double const* x);
 
+/// Caches the level set values of one fracture per mesh node id.
+///
+/// The level set of a node is queried repeatedly during the setup of the
+/// enriched DOFs and the near-fracture assemblers; since nodes do not move,
+/// each (fracture, node) evaluation is needed only once.
+class CachedLevelSetFunction final
+{
+public:
+    CachedLevelSetFunction(FractureProperty const& fracture_property,
+                           std::size_t const n_nodes)
+        : _fracture_property(fracture_property),
+          _values(n_nodes),
+          _computed(n_nodes, 0)
+    {
+    }
+
+    /// Returns the (cached) level set value at the node with the given id
+    /// and coordinates.
+    double operator()(std::size_t const node_id, double const* x)
+    {
+        if (!_computed[node_id])
+        {
+            _values[node_id] =
+                calculateLevelSetFunction(_fracture_property, x);
+            _computed[node_id] = 1;
+        }
+        return _values[node_id];
+    }
+
+private:
+    FractureProperty const& _fracture_property;
+    std::vector<double> _values;
+    std::vector<char> _computed;
+};
+
 } // LIE
 } // ProcessLib
@@ -95,18 +95,25 @@ void getFractureMatrixDataInMesh(
     BaseLib::makeVectorUnique(vec_fracture_mat_IDs);
     DBUG("-> found %d fracture material groups", vec_fracture_mat_IDs.size());
 
-    // create a vector of fracture elements for each group
+    // create a vector of fracture elements for each group. A single bucketing
+    // pass over the fracture elements; the former per-group scan was
+    // quadratic in the number of fractures on DFN meshes.
     vec_fracture_elements.resize(vec_fracture_mat_IDs.size());
+    {
+        std::map<int, unsigned> frac_id_of_mat_id;
+        for (unsigned frac_id = 0; frac_id < vec_fracture_mat_IDs.size();
+             frac_id++)
+            frac_id_of_mat_id[vec_fracture_mat_IDs[frac_id]] = frac_id;
+
+        for (MeshLib::Element* e : all_fracture_elements)
+            vec_fracture_elements[frac_id_of_mat_id[(
+                                      *opt_material_ids)[e->getID()]]]
+                .push_back(e);
+    }
     for (unsigned frac_id=0; frac_id<vec_fracture_mat_IDs.size(); frac_id++)
     {
-        const auto frac_mat_id = vec_fracture_mat_IDs[frac_id];
-        std::vector<MeshLib::Element*> &vec_elements = vec_fracture_elements[frac_id];
-        std::copy_if(all_fracture_elements.begin(), all_fracture_elements.end(),
-                     std::back_inserter(vec_elements),
-                     [&](MeshLib::Element* e) {
-                         return (*opt_material_ids)[e->getID()] == frac_mat_id;
-                     });
-        DBUG("-> found %d elements on the fracture %d", vec_elements.size(), frac_id);
+        DBUG("-> found %d elements on the fracture %d",
+             vec_fracture_elements[frac_id].size(), frac_id);
     }
 
     // get a vector of fracture nodes
@@ -169,5 +176,16 @@ void getFractureMatrixDataInMesh(
     }
 }
 
+std::vector<int> buildNodeFractureIncidence(
+    std::vector<std::vector<MeshLib::Node*>> const& vec_fracture_nodes,
+    std::size_t n_mesh_nodes)
+{
+    std::vector<int> node_fracture_id(n_mesh_nodes, -1);
+    for (unsigned frac_id = 0; frac_id < vec_fracture_nodes.size(); frac_id++)
+        for (auto const* node : vec_fracture_nodes[frac_id])
+            node_fracture_id[node->getID()] = static_cast<int>(frac_id);
+    return node_fracture_id;
+}
+
 }  // namespace LIE
 }  // namespace ProcessLib
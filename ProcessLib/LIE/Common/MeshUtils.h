@@ -40,5 +40,22 @@ void getFractureMatrixDataInMesh(
         std::vector<std::vector<MeshLib::Node*>>& vec_fracture_nodes
         );
 
+/**
+ * Builds the node-to-fracture incidence index: entry i holds the fracture
+ * index the mesh node i belongs to, or -1 for nodes off the fractures.
+ *
+ * The per-fracture node vectors of getFractureMatrixDataInMesh() answer
+ * "which nodes does fracture f have"; consumers asking the inverse
+ * question per node (the post-processing node duplication, enrichment
+ * bookkeeping) previously scanned those vectors per query---quadratic on
+ * DFN meshes with thousands of fractures. This index is built once in a
+ * single sweep and shared by both LIE processes. Node intersections of
+ * fractures are unsupported (one fracture per node), matching the
+ * post-processing tool's assumption.
+ */
+std::vector<int> buildNodeFractureIncidence(
+    std::vector<std::vector<MeshLib::Node*>> const& vec_fracture_nodes,
+    std::size_t n_mesh_nodes);
+
 }  // namespace LIE
 }  // namespace ProcessLib
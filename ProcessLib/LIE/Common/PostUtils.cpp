@@ -8,6 +8,8 @@
 
 #include "PostUtils.h"
 
+#include "MeshUtils.h"
+
 #include <map>
 #include <vector>
 
@@ -64,11 +66,16 @@ PostProcessTool::PostProcessTool(
         }
     }
 
+    // Node-to-fracture incidence, built once; answers the per-node group
+    // membership below in O(1) instead of scanning the fracture's node
+    // vector per element node, cf. buildNodeFractureIncidence().
+    std::vector<int> const node_fracture_id = buildNodeFractureIncidence(
+        vec_vec_fracture_nodes, org_mesh.getNumberOfNodes());
+
     // split elements using the new duplicated nodes
     for (unsigned fracture_id=0; fracture_id<vec_vec_fracture_matrix_elements.size(); fracture_id++)
     {
         auto const& vec_fracture_matrix_elements = vec_vec_fracture_matrix_elements[fracture_id];
-        auto const& vec_fracture_nodes = vec_vec_fracture_nodes[fracture_id];
         auto prop_levelset = org_mesh.getProperties().getPropertyVector<double>(
             "levelset" + std::to_string(fracture_id + 1));
         for (auto const* org_e : vec_fracture_matrix_elements)
@@ -93,12 +100,8 @@ PostProcessTool::PostProcessTool(
                     continue;
 
                 // check if a node belongs to the particular fracture group
-                auto itr2 = std::find_if(
-                    vec_fracture_nodes.begin(), vec_fracture_nodes.end(),
-                    [&](MeshLib::Node const* node) {
-                        return node->getID() == e->getNodeIndex(i);
-                    });
-                if (itr2 == vec_fracture_nodes.end())
+                if (node_fracture_id[e->getNodeIndex(i)] !=
+                    static_cast<int>(fracture_id))
                     continue;
 
                 e->setNode(i, new_nodes[itr->second]);
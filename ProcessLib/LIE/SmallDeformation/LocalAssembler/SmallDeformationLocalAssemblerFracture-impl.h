@@ -118,40 +118,67 @@ assembleWithJacobian(
     SpatialPosition x_position;
     x_position.setElementID(_element.getID());
 
+    // Kinematics stage: displacement jumps and apertures of all points.
     for (unsigned ip = 0; ip < n_integration_points; ip++)
     {
-        x_position.setIntegrationPoint(ip);
-        auto const& wp = _integration_method.getWeightedPoint(ip);
-
         auto& ip_data = _ip_data[ip];
-        auto const& detJ = ip_data._detJ;
-        auto const& integralMeasure = ip_data._integralMeasure;
+        ip_data._w.noalias() = R * ip_data._h_matrices * nodal_jump;
+        ip_data._aperture = ip_data._aperture0 + ip_data._w[index_normal];
+    }
+
+    // Batched constitutive stage: one call per element; branch-heavy
+    // models split their return mapping into compact per-branch loops,
+    // cf. FractureModelBase::computeConstitutiveRelationBatch(). The
+    // per-point vectors are fixed-size and tiny, so staging them into the
+    // dynamic batch arrays costs a few loads per point.
+    {
+        std::vector<Eigen::VectorXd> w_prev_batch, w_batch, sigma_prev_batch,
+            sigma_batch;
+        std::vector<Eigen::MatrixXd> C_batch(n_integration_points);
+        std::vector<typename MaterialLib::Fracture::FractureModelBase<
+            DisplacementDim>::MaterialStateVariables*>
+            states(n_integration_points);
+        w_prev_batch.reserve(n_integration_points);
+        w_batch.reserve(n_integration_points);
+        sigma_prev_batch.reserve(n_integration_points);
+        sigma_batch.reserve(n_integration_points);
+        for (unsigned ip = 0; ip < n_integration_points; ip++)
+        {
+            auto& ip_data = _ip_data[ip];
+            w_prev_batch.push_back(ip_data._w_prev);
+            w_batch.push_back(ip_data._w);
+            sigma_prev_batch.push_back(ip_data._sigma_prev);
+            sigma_batch.push_back(ip_data._sigma);
+            C_batch[ip].resize(ip_data._C.rows(), ip_data._C.cols());
+            states[ip] = ip_data._material_state_variables.get();
+        }
+        _ip_data[0]._fracture_material.computeConstitutiveRelationBatch(
+            t, x_position, n_integration_points, w_prev_batch.data(),
+            w_batch.data(), sigma_prev_batch.data(), sigma_batch.data(),
+            C_batch.data(), states.data());
+        for (unsigned ip = 0; ip < n_integration_points; ip++)
+        {
+            _ip_data[ip]._sigma = sigma_batch[ip];
+            _ip_data[ip]._C = C_batch[ip];
+        }
+    }
+
+    // Accumulation stage.
+    for (unsigned ip = 0; ip < n_integration_points; ip++)
+    {
+        auto const& ip_data = _ip_data[ip];
+        auto const& wp = _integration_method.getWeightedPoint(ip);
         auto const& H = ip_data._h_matrices;
-        auto& mat = ip_data._fracture_material;
-        auto& sigma = ip_data._sigma;
-        auto const& sigma_prev = ip_data._sigma_prev;
-        auto& w = ip_data._w;
-        auto const& w_prev = ip_data._w_prev;
-        auto& C = ip_data._C;
-        auto& state = *ip_data._material_state_variables;
-
-        // displacement jumps
-        w.noalias() = R * H * nodal_jump;
-
-        // total aperture
-        ip_data._aperture = ip_data._aperture0 + w[index_normal];
-
-        // local C, local stress
-        mat.computeConstitutiveRelation(
-                    t, x_position,
-                    w_prev, w,
-                    sigma_prev, sigma, C, state);
+        double const factor =
+            ip_data._detJ * wp.getWeight() * ip_data._integralMeasure;
 
         // r_[u] += H^T*Stress
-        local_b.noalias() -= H.transpose() * R.transpose() * sigma * detJ * wp.getWeight() * integralMeasure;
+        local_b.noalias() -=
+            H.transpose() * R.transpose() * ip_data._sigma * factor;
 
         // J_[u][u] += H^T*C*H
-        local_J.noalias() += H.transpose() * R.transpose() * C * R * H * detJ * wp.getWeight() * integralMeasure;
+        local_J.noalias() +=
+            H.transpose() * R.transpose() * ip_data._C * R * H * factor;
     }
 
 }
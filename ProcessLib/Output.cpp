@@ -9,13 +9,21 @@
 
 #include "Output.h"
 
+#ifdef OGS_USE_INSITU
+#include "InSituLib/Adaptor.h"
+#endif
+
 #include <cassert>
 #include <fstream>
 #include <vector>
 
 #include <logog/include/logog.hpp>
 
+#include <algorithm>
+
 #include "BaseLib/FileTools.h"
+#include "MeshLib/IO/VtkIO/VtuInterface.h"
+#include "MeshLib/MeshEditing/RemoveMeshComponents.h"
 #include "BaseLib/RunTime.h"
 
 namespace
@@ -52,11 +60,16 @@ newInstance(const BaseLib::ConfigTree &config, std::string const& output_directo
         //! \ogs_file_param{prj__time_loop__output__output_iteration_results}
         config.getConfigParameterOptional<bool>("output_iteration_results");
 
+    auto const async =
+        //! \ogs_file_param{prj__time_loop__output__async}
+        config.getConfigParameterOptional<bool>("async");
+
     std::unique_ptr<Output> out{new Output{
         BaseLib::joinPaths(output_directory,
                            //! \ogs_file_param{prj__time_loop__output__prefix}
                            config.getConfigParameter<std::string>("prefix")),
-        output_iteration_results ? *output_iteration_results : false}};
+        output_iteration_results ? *output_iteration_results : false,
+        async ? *async : false}};
 
     //! \ogs_file_param{prj__time_loop__output__timesteps}
     if (auto const timesteps = config.getConfigSubtreeOptional("timesteps"))
@@ -83,9 +96,120 @@ newInstance(const BaseLib::ConfigTree &config, std::string const& output_directo
         out->_repeats_each_steps.emplace_back(1, 1);
     }
 
+    //! \ogs_file_param{prj__time_loop__output__adaptive}
+    if (auto const adaptive = config.getConfigSubtreeOptional("adaptive"))
+    {
+        out->_adaptive = true;
+        //! \ogs_file_param{prj__time_loop__output__adaptive__trigger_dt_below}
+        if (auto v = adaptive->getConfigParameterOptional<double>(
+                "trigger_dt_below"))
+            out->_trigger_dt_below = *v;
+        //! \ogs_file_param{prj__time_loop__output__adaptive__trigger_iterations_above}
+        if (auto v = adaptive->getConfigParameterOptional<unsigned>(
+                "trigger_iterations_above"))
+            out->_trigger_iterations_above = *v;
+        //! \ogs_file_param{prj__time_loop__output__adaptive__trigger_relative_change_above}
+        if (auto v = adaptive->getConfigParameterOptional<double>(
+                "trigger_relative_change_above"))
+            out->_trigger_relative_change_above = *v;
+        //! \ogs_file_param{prj__time_loop__output__adaptive__fine_each_steps}
+        if (auto v = adaptive->getConfigParameterOptional<unsigned>(
+                "fine_each_steps"))
+            out->_fine_each_steps = *v;
+        //! \ogs_file_param{prj__time_loop__output__adaptive__hold_steps}
+        if (auto v =
+                adaptive->getConfigParameterOptional<unsigned>("hold_steps"))
+            out->_fine_hold_steps = *v;
+    }
+
+    //! \ogs_file_param{prj__time_loop__output__probes}
+    if (auto const probes = config.getConfigSubtreeOptional("probes"))
+    {
+        //! \ogs_file_param{prj__time_loop__output__probes__probe}
+        for (auto probe : probes->getConfigSubtreeList("probe"))
+        {
+            //! \ogs_file_param{prj__time_loop__output__probes__probe__name}
+            auto name = probe.getConfigParameter<std::string>("name");
+            auto const coordinates =
+                //! \ogs_file_param{prj__time_loop__output__probes__probe__coordinates}
+                probe.getConfigParameter<std::vector<double>>("coordinates");
+            if (coordinates.size() != 3)
+                OGS_FATAL(
+                    "Observation point '%s' needs three coordinates.",
+                    name.c_str());
+            out->_probe_definitions.push_back(
+                {std::move(name),
+                 MathLib::Point3d(std::array<double, 3>{
+                     {coordinates[0], coordinates[1], coordinates[2]}})});
+        }
+    }
+
+    //! \ogs_file_param{prj__time_loop__output__derived_fields}
+    if (auto const fields = config.getConfigSubtreeOptional("derived_fields"))
+    {
+        //! \ogs_file_param{prj__time_loop__output__derived_fields__field}
+        for (auto field : fields->getConfigSubtreeList("field"))
+        {
+            //! \ogs_file_param{prj__time_loop__output__derived_fields__field__name}
+            auto name = field.getConfigParameter<std::string>("name");
+            //! \ogs_file_param{prj__time_loop__output__derived_fields__field__expression}
+            auto const expression =
+                field.getConfigParameter<std::string>("expression");
+            out->_derived_fields.emplace_back(std::move(name), expression);
+        }
+    }
+
     return out;
 }
 
+Output::~Output()
+{
+    if (!_writer_thread.joinable())
+        return;
+
+    {
+        std::lock_guard<std::mutex> const lock(_writer_mutex);
+        _writer_shutdown = true;
+    }
+    _writer_condition.notify_all();
+    _writer_thread.join();
+}
+
+void Output::enqueueWriteJob(std::function<void()> job)
+{
+    std::unique_lock<std::mutex> lock(_writer_mutex);
+
+    if (!_writer_thread.joinable())
+    {
+        // Lazily started background writer; processes jobs until shutdown.
+        _writer_thread = std::thread([this]() {
+            std::unique_lock<std::mutex> thread_lock(_writer_mutex);
+            for (;;)
+            {
+                _writer_condition.wait(thread_lock, [this]() {
+                    return _writer_shutdown || !_writer_jobs.empty();
+                });
+                if (_writer_jobs.empty() && _writer_shutdown)
+                    return;
+
+                auto const current_job = std::move(_writer_jobs.front());
+                _writer_jobs.pop_front();
+                thread_lock.unlock();
+                current_job();
+                thread_lock.lock();
+                _writer_condition.notify_all();
+            }
+        });
+    }
+
+    // Double buffering: wait until the previous write has been taken up and
+    // finished before queueing the next one.
+    _writer_condition.wait(lock,
+                           [this]() { return _writer_jobs.empty(); });
+    _writer_jobs.push_back(std::move(job));
+    _writer_condition.notify_all();
+}
+
 void Output::addProcess(ProcessLib::Process const& process, const unsigned pcs_idx)
 {
     auto const filename =
@@ -104,6 +228,12 @@ void Output::doOutputAlways(Process const& process,
     BaseLib::RunTime time_output;
     time_output.start();
 
+#ifdef OGS_USE_INSITU
+    // In-situ pipelines read the live mesh/field data zero-copy; they run
+    // on every output step independently of the file output below.
+    InSituLib::CoProcess(process.getMesh(), t, timestep, false);
+#endif
+
     auto spd_it = _single_process_data.find(&process);
     if (spd_it == _single_process_data.end()) {
         OGS_FATAL("The given process is not contained in the output configuration."
@@ -117,22 +247,141 @@ void Output::doOutputAlways(Process const& process,
             + "_t_"  + std::to_string(t)
             + ".vtu";
     DBUG("output to %s", output_file_name.c_str());
-    doProcessOutput(output_file_name, x, process.getMesh(),
-                    process.getDOFTable(), process.getProcessVariables(),
-                    process.getSecondaryVariables(), process_output);
+
+    // Fill the mesh's property vectors.
+    processOutputData(x, process.getMesh(), process.getDOFTable(),
+                      process.getProcessVariables(),
+                      process.getSecondaryVariables(), process_output);
+
+    // Derived fields are reductions over the filled property vectors; they
+    // are evaluated lazily---only here, on output steps---and in parallel.
+    for (auto const& derived_field : _derived_fields)
+        derived_field.evaluate(process.getMesh());
+
+    // The mesh (copy) that will be written to the file.
+    std::shared_ptr<MeshLib::Mesh> mesh_to_write;
+    if (!process_output.output_material_ids.empty())
+    {
+        // Region-of-interest output: write only the elements of the
+        // requested material groups. The excluded element ids are computed
+        // once and cached.
+        if (!spd.roi_excluded_element_ids)
+        {
+            auto const& mesh = process.getMesh();
+            auto const* const material_ids =
+                mesh.getProperties().getPropertyVector<int>("MaterialIDs");
+            if (material_ids == nullptr)
+                OGS_FATAL(
+                    "The <output_material_ids> option requires the mesh to "
+                    "have MaterialIDs.");
+
+            auto const& roi = process_output.output_material_ids;
+            spd.roi_excluded_element_ids.reset(
+                new std::vector<std::size_t>);
+            for (std::size_t e = 0; e < material_ids->size(); ++e)
+            {
+                if (std::find(roi.begin(), roi.end(), (*material_ids)[e]) ==
+                    roi.end())
+                    spd.roi_excluded_element_ids->push_back(e);
+            }
+        }
+        mesh_to_write.reset(MeshLib::removeElements(
+            process.getMesh(), *spd.roi_excluded_element_ids,
+            process.getMesh().getName() + "_roi"));
+    }
+    else if (_async)
+    {
+        // Snapshot the mesh including its data arrays, so the background
+        // write works on stable data while the next time step proceeds.
+        mesh_to_write.reset(new MeshLib::Mesh(process.getMesh()));
+    }
+
+    if (_async)
+    {
+        enqueueWriteJob([mesh_to_write, output_file_name]() {
+            MeshLib::IO::VtuInterface vtu_interface(
+                mesh_to_write.get(), vtkXMLWriter::Binary, true);
+            vtu_interface.writeToFile(output_file_name);
+        });
+    }
+    else
+    {
+        auto* const mesh =
+            mesh_to_write ? mesh_to_write.get() : &process.getMesh();
+        MeshLib::IO::VtuInterface vtu_interface(mesh, vtkXMLWriter::Binary,
+                                                true);
+        vtu_interface.writeToFile(output_file_name);
+    }
     spd.pvd_file.addVTUFile(output_file_name, t);
 
     INFO("[time] Output of timestep %d took %g s.", timestep,
          time_output.elapsed());
 }
 
+bool Output::isOutputStep(unsigned const timestep) const
+{
+    if (_adaptive && timestep <= _fine_until_timestep &&
+        timestep % _fine_each_steps == 0)
+        return true;
+    return shallDoOutput(timestep, _repeats_each_steps);
+}
+
+void Output::sampleProbes(Process const& process, double const t,
+                          GlobalVector const& x)
+{
+    if (_probe_definitions.empty())
+        return;
+
+    auto& probe_output = _probe_outputs[&process];
+    if (!probe_output)
+    {
+        auto const spd_it = _single_process_data.find(&process);
+        if (spd_it == _single_process_data.end())
+            OGS_FATAL("The given process is not contained in the output"
+                      " configuration. Aborting.");
+        auto definitions = _probe_definitions;
+        probe_output.reset(new ProbeOutput(
+            _output_file_prefix + "_pcs_" +
+                std::to_string(spd_it->second.process_index) + "_probes.csv",
+            std::move(definitions)));
+    }
+    probe_output->sample(t, x, process);
+}
+
+void Output::updateAdaptiveIndicators(unsigned const timestep,
+                                      double const dt,
+                                      unsigned const nonlinear_iterations,
+                                      double const max_solution_change)
+{
+    if (!_adaptive)
+        return;
+
+    bool const triggered =
+        (_trigger_dt_below > 0.0 && dt < _trigger_dt_below) ||
+        (_trigger_iterations_above > 0 &&
+         nonlinear_iterations > _trigger_iterations_above) ||
+        (_trigger_relative_change_above > 0.0 &&
+         max_solution_change > _trigger_relative_change_above);
+    if (!triggered)
+        return;
+
+    if (timestep + _fine_hold_steps > _fine_until_timestep)
+    {
+        _fine_until_timestep = timestep + _fine_hold_steps;
+        INFO(
+            "Adaptive output: indicator tripped at timestep %u; fine output "
+            "until timestep %u.",
+            timestep, _fine_until_timestep);
+    }
+}
+
 void Output::doOutput(Process const& process,
                       ProcessOutput const& process_output,
                       unsigned timestep,
                       const double t,
                       GlobalVector const& x)
 {
-    if (shallDoOutput(timestep, _repeats_each_steps))
+    if (isOutputStep(timestep))
         doOutputAlways(process, process_output, timestep, t, x);
 }
 
@@ -142,7 +391,10 @@ void Output::doOutputLastTimestep(Process const& process,
                                   const double t,
                                   GlobalVector const& x)
 {
-    if (!shallDoOutput(timestep, _repeats_each_steps))
+#ifdef OGS_USE_INSITU
+    InSituLib::CoProcess(process.getMesh(), t, timestep, true);
+#endif
+    if (!isOutputStep(timestep))
         doOutputAlways(process, process_output, timestep, t, x);
 }
 
@@ -9,8 +9,17 @@
 
 #pragma once
 
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
 #include "BaseLib/ConfigTree.h"
 #include "MeshLib/IO/VtkIO/PVDFile.h"
+#include "OutputExpression.h"
+#include "ProbeOutput.h"
 #include "Process.h"
 #include "ProcessOutput.h"
 
@@ -29,9 +38,37 @@ public:
     newInstance(const BaseLib::ConfigTree& config,
                 const std::string& output_directory);
 
+    //! Joins the background writer thread, flushing pending output.
+    ~Output();
+
     //! TODO doc. Opens a PVD file for each process.
     void addProcess(ProcessLib::Process const& process, const unsigned pcs_idx);
 
+    //! Tells whether output will be written for the given \c timestep.
+    //! Used, e.g., to skip secondary-variable computations on steps without
+    //! output.
+    bool isOutputStep(unsigned timestep) const;
+
+    /*! Feeds the cheap per-step indicators of the adaptive output control,
+     * cf. the <adaptive> output configuration: when the step size falls
+     * below, the nonlinear iteration count rises above, or the relative
+     * solution change exceeds its threshold, output switches to the fine
+     * schedule for the configured hold window---disk traffic concentrates
+     * around the events without reconfiguring the run. Called by the time
+     * loop at the end of each step; a trigger takes effect from the
+     * following step on.
+     */
+    void updateAdaptiveIndicators(unsigned timestep, double dt,
+                                  unsigned nonlinear_iterations,
+                                  double max_solution_change);
+
+    /// Samples the configured observation points from the process's
+    /// solution and appends them to the per-process probe CSV; called by
+    /// the time loop every step (independently of the field output
+    /// schedule), cf. ProbeOutput.
+    void sampleProbes(Process const& process, double t,
+                      GlobalVector const& x);
+
     //! Writes output for the given \c process if it should be written in the
     //! given \c timestep.
     void doOutput(Process const& process, ProcessOutput const& process_output,
@@ -80,20 +117,60 @@ private:
 
         const unsigned process_index;
         MeshLib::IO::PVDFile pvd_file;
+
+        //! Cached element ids excluded from region-of-interest output, cf.
+        //! ProcessOutput::output_material_ids.
+        std::unique_ptr<std::vector<std::size_t>> roi_excluded_element_ids;
     };
 
-    Output(std::string const& prefix, bool output_nonlinear_iteration_results)
+    Output(std::string const& prefix, bool output_nonlinear_iteration_results,
+           bool const async)
         : _output_file_prefix(prefix),
           _output_nonlinear_iteration_results(
-              output_nonlinear_iteration_results)
+              output_nonlinear_iteration_results),
+          _async(async)
     {}
 
+    //! Hands the job to the background writer thread (started lazily); at
+    //! most one job is in flight, a second enqueue waits for the first to
+    //! finish (double buffering).
+    void enqueueWriteJob(std::function<void()> job);
+
     std::string const _output_file_prefix;
     bool const _output_nonlinear_iteration_results;
 
+    //! Write output files on a background thread while the time loop
+    //! continues, cf. the <async> output option.
+    bool const _async;
+
+    std::thread _writer_thread;
+    std::mutex _writer_mutex;
+    std::condition_variable _writer_condition;
+    std::deque<std::function<void()>> _writer_jobs;
+    bool _writer_shutdown = false;
+
     //! Describes after which timesteps to write output.
     std::vector<PairRepeatEachSteps> _repeats_each_steps;
 
+    //! Derived output fields evaluated lazily on output steps,
+    //! cf. OutputExpression and the <derived_fields> configuration.
+    std::vector<OutputExpression> _derived_fields;
+
+    //! Adaptive (event-driven) output control, cf. the <adaptive>
+    //! configuration and updateAdaptiveIndicators().
+    //! Probe definitions shared by all processes; the per-process
+    //! ProbeOutput instances are created lazily, cf. sampleProbes().
+    std::vector<ProbeOutput::Probe> _probe_definitions;
+    std::map<Process const*, std::unique_ptr<ProbeOutput>> _probe_outputs;
+
+    bool _adaptive = false;
+    double _trigger_dt_below = 0.0;
+    unsigned _trigger_iterations_above = 0;
+    double _trigger_relative_change_above = 0.0;
+    unsigned _fine_each_steps = 1;
+    unsigned _fine_hold_steps = 10;
+    unsigned _fine_until_timestep = 0;
+
     std::map<Process const*, SingleProcessData> _single_process_data;
 };
 
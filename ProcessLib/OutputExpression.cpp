@@ -0,0 +1,360 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "OutputExpression.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <map>
+
+#include <boost/optional.hpp>
+
+#include <logog/include/logog.hpp>
+
+#include "BaseLib/Error.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/PropertyVector.h"
+
+namespace
+{
+
+struct Token
+{
+    enum class Type
+    {
+        Number,
+        Identifier,
+        Function,
+        Operator,
+        LeftParen,
+        RightParen
+    };
+    Type type;
+    std::string text;
+    double value;
+    unsigned component;
+};
+
+bool isFunctionName(std::string const& name)
+{
+    return name == "sqrt" || name == "abs" || name == "exp" || name == "log";
+}
+
+int precedenceOf(char const op)
+{
+    switch (op) {
+        case 'u': return 4;  // unary minus
+        case '^': return 3;
+        case '*':
+        case '/': return 2;
+        default: return 1;  // + -
+    }
+}
+
+std::vector<Token> tokenize(std::string const& expression)
+{
+    std::vector<Token> tokens;
+    std::size_t i = 0;
+    while (i < expression.size())
+    {
+        char const c = expression[i];
+        if (std::isspace(static_cast<unsigned char>(c))) {
+            ++i;
+            continue;
+        }
+        if (std::isdigit(static_cast<unsigned char>(c)) || c == '.') {
+            char* end = nullptr;
+            double const value = std::strtod(expression.c_str() + i, &end);
+            tokens.push_back({Token::Type::Number, "", value, 0});
+            i = end - expression.c_str();
+            continue;
+        }
+        if (std::isalpha(static_cast<unsigned char>(c)) || c == '_') {
+            std::size_t j = i;
+            while (j < expression.size() &&
+                   (std::isalnum(static_cast<unsigned char>(expression[j])) ||
+                    expression[j] == '_'))
+                ++j;
+            std::string const name = expression.substr(i, j - i);
+            i = j;
+            if (isFunctionName(name)) {
+                tokens.push_back({Token::Type::Function, name, 0.0, 0});
+                continue;
+            }
+            // Optional component selector.
+            unsigned component = 0;
+            if (i < expression.size() && expression[i] == '[') {
+                char* end = nullptr;
+                component = static_cast<unsigned>(
+                    std::strtoul(expression.c_str() + i + 1, &end, 10));
+                if (*end != ']')
+                    OGS_FATAL(
+                        "Derived output field: missing ']' after component "
+                        "selector of '%s'.", name.c_str());
+                i = end - expression.c_str() + 1;
+            }
+            tokens.push_back({Token::Type::Identifier, name, 0.0, component});
+            continue;
+        }
+        if (c == '(') {
+            tokens.push_back({Token::Type::LeftParen, "(", 0.0, 0});
+            ++i;
+            continue;
+        }
+        if (c == ')') {
+            tokens.push_back({Token::Type::RightParen, ")", 0.0, 0});
+            ++i;
+            continue;
+        }
+        if (c == '+' || c == '-' || c == '*' || c == '/' || c == '^') {
+            // Unary minus at the start or after an operator/parenthesis.
+            bool const unary =
+                c == '-' &&
+                (tokens.empty() ||
+                 tokens.back().type == Token::Type::Operator ||
+                 tokens.back().type == Token::Type::LeftParen);
+            tokens.push_back({Token::Type::Operator,
+                              unary ? std::string("u") : std::string(1, c),
+                              0.0, 0});
+            ++i;
+            continue;
+        }
+        OGS_FATAL("Derived output field: unexpected character '%c'.", c);
+    }
+    return tokens;
+}
+
+}  // anonymous namespace
+
+namespace ProcessLib
+{
+
+OutputExpression::OutputExpression(std::string name,
+                                   std::string const& expression)
+    : _name(std::move(name))
+{
+    // Shunting-yard to a stack program.
+    std::vector<Token> operator_stack;
+    auto const popToProgram = [this](Token const& token) {
+        static std::map<std::string, OpCode> const op_codes = {
+            {"+", OpCode::Add},      {"-", OpCode::Subtract},
+            {"*", OpCode::Multiply}, {"/", OpCode::Divide},
+            {"^", OpCode::Power},    {"u", OpCode::Negate},
+            {"sqrt", OpCode::Sqrt},  {"abs", OpCode::Abs},
+            {"exp", OpCode::Exp},    {"log", OpCode::Log}};
+        _program.push_back({op_codes.at(token.text), 0.0, 0});
+    };
+
+    for (auto const& token : tokenize(expression))
+    {
+        switch (token.type)
+        {
+            case Token::Type::Number:
+                _program.push_back(
+                    {OpCode::PushConstant, token.value, 0});
+                break;
+            case Token::Type::Identifier:
+                _program.push_back(
+                    {OpCode::PushOperand, 0.0,
+                     static_cast<unsigned>(_operands.size())});
+                _operands.push_back({token.text, token.component});
+                break;
+            case Token::Type::Function:
+            case Token::Type::LeftParen:
+                operator_stack.push_back(token);
+                break;
+            case Token::Type::RightParen:
+                while (!operator_stack.empty() &&
+                       operator_stack.back().type != Token::Type::LeftParen)
+                {
+                    popToProgram(operator_stack.back());
+                    operator_stack.pop_back();
+                }
+                if (operator_stack.empty())
+                    OGS_FATAL(
+                        "Derived output field '%s': unbalanced parentheses.",
+                        _name.c_str());
+                operator_stack.pop_back();  // the left parenthesis
+                if (!operator_stack.empty() &&
+                    operator_stack.back().type == Token::Type::Function)
+                {
+                    popToProgram(operator_stack.back());
+                    operator_stack.pop_back();
+                }
+                break;
+            case Token::Type::Operator:
+                while (!operator_stack.empty() &&
+                       operator_stack.back().type == Token::Type::Operator &&
+                       precedenceOf(operator_stack.back().text[0]) >=
+                           precedenceOf(token.text[0]) &&
+                       token.text[0] != '^' && token.text[0] != 'u')
+                {
+                    popToProgram(operator_stack.back());
+                    operator_stack.pop_back();
+                }
+                operator_stack.push_back(token);
+                break;
+        }
+    }
+    while (!operator_stack.empty())
+    {
+        if (operator_stack.back().type == Token::Type::LeftParen)
+            OGS_FATAL("Derived output field '%s': unbalanced parentheses.",
+                      _name.c_str());
+        popToProgram(operator_stack.back());
+        operator_stack.pop_back();
+    }
+
+    // Validate stack discipline and record the required depth.
+    int depth = 0;
+    for (auto const& instruction : _program)
+    {
+        switch (instruction.op)
+        {
+            case OpCode::PushConstant:
+            case OpCode::PushOperand:
+                ++depth;
+                break;
+            case OpCode::Negate:
+            case OpCode::Sqrt:
+            case OpCode::Abs:
+            case OpCode::Exp:
+            case OpCode::Log:
+                if (depth < 1)
+                    OGS_FATAL("Derived output field '%s': malformed "
+                              "expression.", _name.c_str());
+                break;
+            default:  // binary
+                if (depth < 2)
+                    OGS_FATAL("Derived output field '%s': malformed "
+                              "expression.", _name.c_str());
+                --depth;
+        }
+        _max_stack_depth =
+            std::max(_max_stack_depth, static_cast<unsigned>(depth));
+    }
+    if (depth != 1)
+        OGS_FATAL("Derived output field '%s': malformed expression.",
+                  _name.c_str());
+}
+
+void OutputExpression::evaluate(MeshLib::Mesh& mesh) const
+{
+    auto& properties = mesh.getProperties();
+
+    // Resolve the operands; all must share one mesh item type.
+    std::vector<MeshLib::PropertyVector<double> const*> operand_properties;
+    std::size_t n_items = 0;
+    boost::optional<MeshLib::MeshItemType> item_type;
+    for (auto const& operand : _operands)
+    {
+        auto const* const property =
+            properties.getPropertyVector<double>(operand.property_name);
+        if (property == nullptr)
+            OGS_FATAL(
+                "Derived output field '%s': property vector '%s' is not "
+                "available (or not of double type).",
+                _name.c_str(), operand.property_name.c_str());
+        if (operand.component >= property->getNumberOfComponents())
+            OGS_FATAL(
+                "Derived output field '%s': component %u of '%s' is out of "
+                "range.",
+                _name.c_str(), operand.component,
+                operand.property_name.c_str());
+        if (item_type && *item_type != property->getMeshItemType())
+            OGS_FATAL(
+                "Derived output field '%s': operands mix mesh item types.",
+                _name.c_str());
+        item_type = property->getMeshItemType();
+        n_items = property->size() / property->getNumberOfComponents();
+        operand_properties.push_back(property);
+    }
+    if (!item_type)
+        OGS_FATAL("Derived output field '%s' has no operands.",
+                  _name.c_str());
+
+    auto* result = properties.hasPropertyVector(_name)
+                       ? properties.getPropertyVector<double>(_name)
+                       : properties.createNewPropertyVector<double>(
+                             _name, *item_type, 1);
+    if (result == nullptr)
+        OGS_FATAL("Could not create the derived output field '%s'.",
+                  _name.c_str());
+    result->resize(n_items);
+
+    auto const n = static_cast<std::ptrdiff_t>(n_items);
+#pragma omp parallel
+    {
+        std::vector<double> stack(_max_stack_depth);
+#pragma omp for schedule(static)
+        for (std::ptrdiff_t item = 0; item < n; ++item)
+        {
+            std::size_t top = 0;
+            for (auto const& instruction : _program)
+            {
+                switch (instruction.op)
+                {
+                    case OpCode::PushConstant:
+                        stack[top++] = instruction.constant;
+                        break;
+                    case OpCode::PushOperand:
+                    {
+                        auto const& operand = _operands[instruction.operand];
+                        auto const* const property =
+                            operand_properties[instruction.operand];
+                        stack[top++] = (*property)[item *
+                                           property->getNumberOfComponents() +
+                                       operand.component];
+                        break;
+                    }
+                    case OpCode::Add:
+                        --top;
+                        stack[top - 1] += stack[top];
+                        break;
+                    case OpCode::Subtract:
+                        --top;
+                        stack[top - 1] -= stack[top];
+                        break;
+                    case OpCode::Multiply:
+                        --top;
+                        stack[top - 1] *= stack[top];
+                        break;
+                    case OpCode::Divide:
+                        --top;
+                        stack[top - 1] /= stack[top];
+                        break;
+                    case OpCode::Power:
+                        --top;
+                        stack[top - 1] = std::pow(stack[top - 1], stack[top]);
+                        break;
+                    case OpCode::Negate:
+                        stack[top - 1] = -stack[top - 1];
+                        break;
+                    case OpCode::Sqrt:
+                        stack[top - 1] = std::sqrt(stack[top - 1]);
+                        break;
+                    case OpCode::Abs:
+                        stack[top - 1] = std::abs(stack[top - 1]);
+                        break;
+                    case OpCode::Exp:
+                        stack[top - 1] = std::exp(stack[top - 1]);
+                        break;
+                    case OpCode::Log:
+                        stack[top - 1] = std::log(stack[top - 1]);
+                        break;
+                }
+            }
+            (*result)[item] = stack[0];
+        }
+    }
+}
+
+}  // namespace ProcessLib
@@ -0,0 +1,87 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+namespace MeshLib
+{
+class Mesh;
+}
+
+namespace ProcessLib
+{
+
+/*! A derived output field defined by an arithmetic expression over existing
+ * property vectors, cf. the <derived_fields> output configuration.
+ *
+ * Expressions combine property vector operands (by name, with an optional
+ * component selector like \c velocity[1]), numeric literals, the operators
+ * + - * / ^, parentheses and the functions sqrt, abs, exp and log. The
+ * expression is parsed once at configuration time into a stack program and
+ * evaluated lazily---only on output steps---in parallel over the mesh
+ * items, writing the result into a (single-component) property vector of
+ * the field's name. Reductions like velocity magnitudes or equivalent
+ * stresses thus happen in ogs at a fraction of the output volume instead of
+ * post-processing full component fields externally.
+ *
+ * All operands of one expression must live on the same mesh item type
+ * (nodes or cells); the result is created on that item type.
+ */
+class OutputExpression final
+{
+public:
+    /// Parses the expression; configuration errors are fatal.
+    OutputExpression(std::string name, std::string const& expression);
+
+    std::string const& name() const { return _name; }
+
+    /// Evaluates the expression over the mesh's property vectors and stores
+    /// the result in the property vector named name().
+    void evaluate(MeshLib::Mesh& mesh) const;
+
+private:
+    enum class OpCode : char
+    {
+        PushConstant,
+        PushOperand,
+        Add,
+        Subtract,
+        Multiply,
+        Divide,
+        Power,
+        Negate,
+        Sqrt,
+        Abs,
+        Exp,
+        Log
+    };
+
+    struct Instruction
+    {
+        OpCode op;
+        double constant;  //!< for PushConstant
+        unsigned operand; //!< for PushOperand: index into _operands
+    };
+
+    struct Operand
+    {
+        std::string property_name;
+        unsigned component;
+    };
+
+    std::string const _name;
+    std::vector<Instruction> _program;
+    std::vector<Operand> _operands;
+    unsigned _max_stack_depth = 0;
+};
+
+}  // namespace ProcessLib
@@ -34,6 +34,8 @@ struct ConstantParameter final : public Parameter<T>
 
     bool isTimeDependent() const override { return false; }
 
+    bool isElementwiseConstant() const override { return true; }
+
     unsigned getNumberOfComponents() const override
     {
         return static_cast<unsigned>(_values.size());
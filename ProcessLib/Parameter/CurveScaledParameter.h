@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include <limits>
 #include <map>
 #include "MathLib/InterpolationAlgorithms/PiecewiseLinearInterpolation.h"
 #include "Parameter.h"
@@ -23,6 +24,7 @@ struct CurveScaledParameter final : public Parameter<T> {
                          std::string const& referenced_parameter_name)
         : Parameter<T>(name_),
           _curve(curve),
+          _parameter(nullptr),
           _referenced_parameter_name(referenced_parameter_name)
     {
     }
@@ -37,6 +39,13 @@ struct CurveScaledParameter final : public Parameter<T> {
         _cache.resize(_parameter->getNumberOfComponents());
     }
 
+    bool isElementwiseConstant() const override
+    {
+        // The time scaling is spatially uniform; classification follows the
+        // referenced parameter (conservative before initialize()).
+        return _parameter != nullptr && _parameter->isElementwiseConstant();
+    }
+
     unsigned getNumberOfComponents() const override
     {
         return _parameter->getNumberOfComponents();
@@ -46,7 +55,27 @@ struct CurveScaledParameter final : public Parameter<T> {
                                      SpatialPosition const& pos) const override
     {
         auto const& tup = (*_parameter)(t, pos);
-        auto const scaling = _curve.getValue(t);
+
+        // The scaling depends on t only, which is constant over one
+        // assembly sweep, while this call runs once per integration point.
+        // The resolved curve value is cached per thread and recomputed only
+        // when t changes, eliminating millions of identical binary
+        // searches per step. Thread-local state keeps concurrent assembly
+        // threads from racing on the cache.
+        struct ScalingCache
+        {
+            void const* owner = nullptr;
+            double t = std::numeric_limits<double>::quiet_NaN();
+            double scaling = 0.0;
+        };
+        static thread_local ScalingCache scaling_cache;
+        if (scaling_cache.owner != this || scaling_cache.t != t)
+        {
+            scaling_cache.owner = this;
+            scaling_cache.t = t;
+            scaling_cache.scaling = _curve.getValue(t);
+        }
+        auto const scaling = scaling_cache.scaling;
 
         auto const num_comp = _parameter->getNumberOfComponents();
         for (std::size_t c = 0; c < num_comp; ++c) {
@@ -48,6 +48,11 @@ struct GroupBasedParameter final
 
     bool isTimeDependent() const override { return false; }
 
+    bool isElementwiseConstant() const override
+    {
+        return MeshItemType == MeshLib::MeshItemType::Cell;
+    }
+
     unsigned getNumberOfComponents() const override
     {
         return _vec_values.empty() ? 0 : _vec_values.front().size();
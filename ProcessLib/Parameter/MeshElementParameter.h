@@ -32,6 +32,8 @@ struct MeshElementParameter final : public Parameter<T> {
 
     bool isTimeDependent() const override { return false; }
 
+    bool isElementwiseConstant() const override { return true; }
+
     unsigned getNumberOfComponents() const override
     {
         return _property.getNumberOfComponents();
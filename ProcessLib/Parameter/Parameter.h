@@ -70,6 +70,13 @@ struct Parameter : public ParameterBase
     //! point in time.
     virtual unsigned getNumberOfComponents() const = 0;
 
+    //! Returns true if the value is the same at every integration point of
+    //! an element at fixed time, i.e., one evaluation per element suffices.
+    //! Assemblers classify their parameters once and hoist the lookup out
+    //! of the integration point loop, leaving the virtual per-point path
+    //! only for genuinely spatially varying functions.
+    virtual bool isElementwiseConstant() const { return false; }
+
     //! Returns the parameter value at the given time and position.
     virtual std::vector<T> const& operator()(
         double const t, SpatialPosition const& pos) const = 0;
@@ -0,0 +1,148 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "ProbeOutput.h"
+
+#include <cmath>
+#include <fstream>
+#include <limits>
+
+#include <logog/include/logog.hpp>
+
+#include "BaseLib/Error.h"
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshSearch/MeshElementGrid.h"
+#include "MeshLib/Node.h"
+#include "NumLib/DOF/LocalToGlobalIndexMap.h"
+#include "Process.h"
+
+namespace ProcessLib
+{
+
+void ProbeOutput::locateProbes(Process const& process)
+{
+    auto const& mesh = process.getMesh();
+    auto const& grid = mesh.getElementGrid();
+
+    _located_probes.clear();
+    _located_probes.reserve(_probes.size());
+    for (auto const& probe : _probes)
+    {
+        MeshLib::Element const* containing_element = nullptr;
+        for (auto const* const candidate :
+             grid.getCandidateElementsForPoint(probe.point))
+        {
+            if (candidate->isPntInElement(probe.point, 1e-9))
+            {
+                containing_element = candidate;
+                break;
+            }
+        }
+        if (containing_element == nullptr)
+            OGS_FATAL("Observation point '%s' is not inside the mesh.",
+                      probe.name.c_str());
+
+        // Inverse-distance weights over the element's nodes: exact at the
+        // nodes, normalized to one; cached for the whole run.
+        LocatedProbe located;
+        double weight_sum = 0.0;
+        for (unsigned i = 0; i < containing_element->getNumberOfBaseNodes();
+             ++i)
+        {
+            auto const* const node = containing_element->getNode(i);
+            located.node_ids.push_back(node->getID());
+            double const distance =
+                std::sqrt(MathLib::sqrDist(*node, probe.point));
+            if (distance < std::numeric_limits<double>::epsilon())
+            {
+                // Probe coincides with a node.
+                located.weights.assign(located.node_ids.size() - 1, 0.0);
+                located.weights.push_back(1.0);
+                weight_sum = 1.0;
+                for (unsigned j = i + 1;
+                     j < containing_element->getNumberOfBaseNodes(); ++j)
+                {
+                    located.node_ids.push_back(
+                        containing_element->getNode(j)->getID());
+                    located.weights.push_back(0.0);
+                }
+                break;
+            }
+            located.weights.push_back(1.0 / distance);
+            weight_sum += located.weights.back();
+        }
+        for (auto& weight : located.weights)
+            weight /= weight_sum;
+
+        INFO("Observation point '%s' located in element %u.",
+             probe.name.c_str(), containing_element->getID());
+        _located_probes.push_back(std::move(located));
+    }
+}
+
+void ProbeOutput::sample(double const t, GlobalVector const& x,
+                         Process const& process)
+{
+    if (_probes.empty())
+        return;
+
+    auto const& dof_table = process.getDOFTable();
+    auto const mesh_id = process.getMesh().getID();
+    auto const n_components = dof_table.getNumberOfComponents();
+
+    if (!_located)
+    {
+        locateProbes(process);
+        _located = true;
+
+        std::ofstream header(_output_file, std::ios::trunc);
+        if (!header)
+            OGS_FATAL("Could not open probe output file '%s'.",
+                      _output_file.c_str());
+        header << "time";
+        for (auto const& probe : _probes)
+            for (int c = 0; c < n_components; ++c)
+                header << ',' << probe.name << '_' << c;
+        header << '\n';
+    }
+
+    std::ofstream out(_output_file, std::ios::app);
+    if (!out)
+    {
+        ERR("Could not append to probe output file '%s'.",
+            _output_file.c_str());
+        return;
+    }
+
+    out << t;
+    for (auto const& located : _located_probes)
+    {
+        for (int component = 0; component < n_components; ++component)
+        {
+            double value = 0.0;
+            for (std::size_t i = 0; i < located.node_ids.size(); ++i)
+            {
+                MeshLib::Location const l(mesh_id,
+                                          MeshLib::MeshItemType::Node,
+                                          located.node_ids[i]);
+                auto const global_indices = dof_table.getGlobalIndices(l);
+                if (component >=
+                    static_cast<int>(global_indices.size()))
+                    continue;
+                value += located.weights[i] *
+                         x[global_indices[component]];
+            }
+            out << ',' << value;
+        }
+    }
+    out << '\n';
+}
+
+}  // namespace ProcessLib
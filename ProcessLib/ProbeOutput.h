@@ -0,0 +1,74 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "MathLib/Point3d.h"
+#include "NumLib/NumericsConfig.h"
+
+namespace ProcessLib
+{
+class Process;
+
+/*! Observation-point probing output channel, cf. the <probes> output
+ * configuration.
+ *
+ * Observation points are located once on first use: the containing element
+ * is found through the mesh's persistent element search grid and the
+ * interpolation weights over the element's nodes are cached (inverse
+ * distance normalized over the element nodes---exact at the nodes and a
+ * close surrogate of the shape functions inside, without per-element-type
+ * inverse mappings). Each call appends one CSV row with the primary
+ * variable values of all probes sampled directly from the solution vector,
+ * so high-frequency monitoring of a few points costs microseconds per step
+ * and the full-domain output frequency can be slashed.
+ *
+ * Points outside the mesh are fatal at location time.
+ */
+class ProbeOutput final
+{
+public:
+    struct Probe
+    {
+        std::string name;
+        MathLib::Point3d point;
+    };
+
+    ProbeOutput(std::string output_file, std::vector<Probe>&& probes)
+        : _output_file(std::move(output_file)), _probes(std::move(probes))
+    {
+    }
+
+    /// Samples all probes from the given process's solution and appends one
+    /// row per call to the output file. Locates the probes and writes the
+    /// CSV header on first use.
+    void sample(double const t, GlobalVector const& x, Process const& process);
+
+private:
+    std::string const _output_file;
+    std::vector<Probe> _probes;
+
+    struct LocatedProbe
+    {
+        //! Node ids of the containing element.
+        std::vector<std::size_t> node_ids;
+        //! Interpolation weight per node, summing to one.
+        std::vector<double> weights;
+    };
+
+    bool _located = false;
+    std::vector<LocatedProbe> _located_probes;
+
+    void locateProbes(Process const& process);
+};
+
+}  // namespace ProcessLib
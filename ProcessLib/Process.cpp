@@ -9,8 +9,15 @@
 
 #include "Process.h"
 
+#include <algorithm>
+#include <thread>
+
+#include "BaseLib/Deterministic.h"
 #include "BaseLib/Functional.h"
+#include "BaseLib/PhaseTimings.h"
+#include "BaseLib/RunTime.h"
 #include "NumLib/DOF/ComputeSparsityPattern.h"
+#include "NumLib/DOF/DOFTableUtil.h"
 #include "NumLib/Extrapolation/LocalLinearLeastSquaresExtrapolator.h"
 #include "NumLib/ODESolver/ConvergenceCriterionPerComponent.h"
 #include "GlobalVectorFromNamedFunction.h"
@@ -40,29 +47,123 @@ void Process::initialize()
 {
     DBUG("Initialize process.");
 
+    BaseLib::RunTime total_timer;
+    total_timer.start();
+
     DBUG("Construct dof mappings.");
-    constructDofTable();
+    {
+        BaseLib::ScopedPhaseTimer phase_timer("startup/dof_tables");
+        constructDofTable();
+    }
 
+    // The sparsity pattern is not needed before the first global matrix is
+    // created, so its computation overlaps with the remaining
+    // initialization below. After constructDofTable() the DOF table is
+    // immutable (including the lazily sorted index dictionary, which the
+    // table construction already queried), so the concurrent reads are
+    // safe.
     DBUG("Compute sparsity pattern");
-    computeSparsityPattern();
+    double sparsity_seconds = 0.0;
+    std::thread sparsity_thread([this, &sparsity_seconds]() {
+        BaseLib::RunTime timer;
+        timer.start();
+        BaseLib::ScopedPhaseTimer phase_timer("startup/sparsity_pattern");
+        computeSparsityPattern();
+        sparsity_seconds = timer.elapsed();
+    });
+    // Joins on scope exit, also when the initialization below throws.
+    struct ThreadJoiner
+    {
+        std::thread& thread;
+        ~ThreadJoiner()
+        {
+            if (thread.joinable())
+                thread.join();
+        }
+    } joiner{sparsity_thread};
 
     DBUG("Initialize the extrapolator");
-    initializeExtrapolator();
+    {
+        BaseLib::ScopedPhaseTimer phase_timer("startup/extrapolator");
+        initializeExtrapolator();
+    }
+
+    // Per-variable integration order overrides: integrate with the maximum
+    // of the overrides, or with the process's configured order if none is
+    // given. This allows reduced integration for processes whose variables
+    // do not need the configured full order.
+    unsigned effective_integration_order = 0;
+    for (ProcessVariable const& pv : _process_variables)
+        effective_integration_order = std::max(
+            effective_integration_order, pv.getIntegrationOrder());
+    if (effective_integration_order == 0)
+        effective_integration_order = _integration_order;
+    else if (effective_integration_order != _integration_order)
+        INFO(
+            "Using integration order %u from the process variable "
+            "configuration instead of the process's order %u.",
+            effective_integration_order, _integration_order);
 
-    initializeConcreteProcess(*_local_to_global_index_map, _mesh,
-                              _integration_order);
+    {
+        BaseLib::ScopedPhaseTimer phase_timer("startup/local_assemblers");
+        initializeConcreteProcess(*_local_to_global_index_map, _mesh,
+                                  effective_integration_order);
+    }
+
+    if (_measure_element_costs)
+    {
+        // The cost property is a plain double cell vector the assembler
+        // accumulates into; as a mesh property it is written with every
+        // regular output.
+        auto* const costs =
+            _mesh.getProperties().createNewPropertyVector<double>(
+                "element_cost", MeshLib::MeshItemType::Cell, 1);
+        costs->resize(_mesh.getNumberOfElements(), 0.0);
+        _global_assembler.setCostVector(costs);
+    }
 
     finishNamedFunctionsInitialization();
 
+    // Warm the matrix/vector pool up with objects of this process's size,
+    // so the first nonlinear iterations (and every re-acquisition after the
+    // pool went cold) do not pay the allocations one by one.
+    {
+        auto const specs = getMatrixSpecifications();
+        NumLib::GlobalMatrixProvider::provider.warmUpMatrices(specs, 1);
+        NumLib::GlobalVectorProvider::provider.warmUpVectors(specs, 4);
+    }
+
     DBUG("Initialize boundary conditions.");
-    _boundary_conditions.addBCsForProcessVariables(
-        _process_variables, *_local_to_global_index_map, _integration_order);
+    {
+        BaseLib::ScopedPhaseTimer phase_timer("startup/boundary_conditions");
+        _boundary_conditions.addBCsForProcessVariables(
+            _process_variables, *_local_to_global_index_map,
+            _integration_order);
+    }
+
+    double const foreground_seconds = total_timer.elapsed();
+    sparsity_thread.join();
+    double const total_seconds = total_timer.elapsed();
+    double const hidden_seconds = std::min(sparsity_seconds,
+                                           foreground_seconds);
+    INFO(
+        "[time] Process initialization took %g s (%g s of the sparsity "
+        "pattern computation hidden behind it; %.0f%% of the phases remain "
+        "serial).",
+        total_seconds, hidden_seconds,
+        total_seconds > 0.0
+            ? 100.0 * (total_seconds - hidden_seconds) / total_seconds
+            : 0.0);
 }
 
 void Process::setInitialConditions(double const t, GlobalVector& x)
 {
     DBUG("Set initial conditions.");
 
+    // Reported through the startup profiling surface like the other
+    // initialization phases.
+    BaseLib::ScopedPhaseTimer phase_timer("startup/initial_conditions");
+
     SpatialPosition pos;
 
     for (int variable_id = 0;
@@ -82,12 +183,42 @@ void Process::setInitialConditions(double const t, GlobalVector& x)
             for (auto const& mesh_subset : mesh_subsets)
             {
                 auto const mesh_id = mesh_subset->getMeshID();
-                for (auto const* node : mesh_subset->getNodes())
+                auto const& node_ids = mesh_subset->getNodeIDs();
+                auto const n_nodes =
+                    static_cast<std::ptrdiff_t>(node_ids.size());
+
+#ifndef USE_PETSC
+                // Spatially uniform initial conditions (the common case)
+                // are resolved once and scattered in parallel; every node
+                // writes only its own entry. Position-dependent parameters
+                // keep the serial loop: their evaluation returns a
+                // reference into a shared cache, so concurrent calls would
+                // race.
+                if (ic.isElementwiseConstant() && n_nodes > 0)
+                {
+                    pos.setNodeID(node_ids.front());
+                    double const value = ic(t, pos)[component_id];
+#pragma omp parallel for schedule(static)
+                    for (std::ptrdiff_t i = 0; i < n_nodes; ++i)
+                    {
+                        MeshLib::Location const l(
+                            mesh_id, MeshLib::MeshItemType::Node,
+                            node_ids[i]);
+                        auto const global_index = std::abs(
+                            _local_to_global_index_map->getGlobalIndex(
+                                l, variable_id, component_id));
+                        x.set(global_index, value);
+                    }
+                    continue;
+                }
+#endif
+
+                for (std::ptrdiff_t i = 0; i < n_nodes; ++i)
                 {
                     MeshLib::Location const l(
-                        mesh_id, MeshLib::MeshItemType::Node, node->getID());
+                        mesh_id, MeshLib::MeshItemType::Node, node_ids[i]);
 
-                    pos.setNodeID(node->getID());
+                    pos.setNodeID(node_ids[i]);
                     auto const& ic_value = ic(t, pos);
 
                     auto global_index =
@@ -121,7 +252,17 @@ MathLib::MatrixSpecifications Process::getMatrixSpecifications() const
 void Process::assemble(const double t, GlobalVector const& x, GlobalMatrix& M,
                        GlobalMatrix& K, GlobalVector& b)
 {
+    // In deterministic mode the parallel compute stage stages its local
+    // contributions and the scatter happens here, ordered by element id,
+    // cf. BaseLib::setDeterministicParallelMode().
+    if (BaseLib::deterministicParallelMode())
+        _global_assembler.beginStagedAssembly();
     assembleConcreteProcess(t, x, M, K, b);
+    if (BaseLib::deterministicParallelMode())
+        _global_assembler.flushStagedAssembly(&M, &K, &b, nullptr);
+
+    applyInactiveDofConstraints(x, K, b, nullptr);
+
     _boundary_conditions.applyNaturalBC(t, x, K, b);
 }
 
@@ -131,12 +272,39 @@ void Process::assembleWithJacobian(const double t, GlobalVector const& x,
                                    GlobalMatrix& M, GlobalMatrix& K,
                                    GlobalVector& b, GlobalMatrix& Jac)
 {
+    if (BaseLib::deterministicParallelMode())
+        _global_assembler.beginStagedAssembly();
     assembleWithJacobianConcreteProcess(t, x, xdot, dxdot_dx, dx_dx, M, K, b, Jac);
+    if (BaseLib::deterministicParallelMode())
+        _global_assembler.flushStagedAssembly(&M, &K, &b, &Jac);
+
+    applyInactiveDofConstraints(x, K, b, &Jac);
 
     // TODO apply BCs to Jacobian.
     _boundary_conditions.applyNaturalBC(t, x, K, b);
 }
 
+void Process::applyInactiveDofConstraints(GlobalVector const& x,
+                                          GlobalMatrix& K, GlobalVector& b,
+                                          GlobalMatrix* const Jac)
+{
+    if (_inactive_only_dofs.empty())
+        return;
+
+    // Identity rows pin the constrained unknowns to their current value:
+    // with K(i,i) = 1 and b(i) = x(i) the (quasi-stationary) row yields
+    // x_new(i) = x(i); the Newton residual of the row is zero, so the
+    // update is zero as well. The mass matrix rows are all-zero for these
+    // dofs since no active element contributes.
+    for (auto const index : _inactive_only_dofs)
+    {
+        K.add(index, index, 1.0);
+        b.add(index, x[index]);
+        if (Jac != nullptr)
+            Jac->add(index, index, 1.0);
+    }
+}
+
 void Process::constructDofTable()
 {
     // Create single component dof in every of the mesh's nodes.
@@ -163,7 +331,7 @@ void Process::constructDofTable()
 
     _local_to_global_index_map.reset(new NumLib::LocalToGlobalIndexMap(
         std::move(all_mesh_subsets), vec_var_n_components,
-        NumLib::ComponentOrder::BY_LOCATION));
+        _global_matrix_dof_order));
 
 }
 
@@ -233,10 +401,93 @@ void Process::computeSparsityPattern()
 void Process::preTimestep(GlobalVector const& x, const double t,
                  const double delta_t)
 {
+    updateElementActivation(t);
     preTimestepConcreteProcess(x, t, delta_t);
     _boundary_conditions.preTimestep(t);
 }
 
+void Process::updateElementActivation(double const t)
+{
+    if (_deactivated_subdomains.empty())
+        return;
+
+#ifdef USE_PETSC
+    // The constrained-dof bookkeeping below works on local positions, but
+    // the DOF tables hand out global indices in parallel runs; mixing the
+    // two corrupts memory on every rank but the first. Refuse the feature
+    // until a proper global-to-local mapping exists.
+    OGS_FATAL(
+        "Element deactivation is not supported in parallel (PETSc) runs.");
+#endif
+
+    // Material ids deactivated at time t.
+    std::vector<int> deactivated_materials;
+    for (auto const& subdomain : _deactivated_subdomains)
+        if (subdomain.start_time <= t && t <= subdomain.end_time)
+            deactivated_materials.insert(deactivated_materials.end(),
+                                         subdomain.material_ids.begin(),
+                                         subdomain.material_ids.end());
+    std::sort(deactivated_materials.begin(), deactivated_materials.end());
+    deactivated_materials.erase(std::unique(deactivated_materials.begin(),
+                                            deactivated_materials.end()),
+                                deactivated_materials.end());
+
+    // The active set only changes when the deactivated material set does.
+    if (deactivated_materials == _deactivated_materials_signature &&
+        !_element_active.empty())
+        return;
+    _deactivated_materials_signature = deactivated_materials;
+
+    auto const* const material_ids =
+        _mesh.getProperties().getPropertyVector<int>("MaterialIDs");
+    if (material_ids == nullptr)
+        OGS_FATAL(
+            "Element deactivation is configured, but the mesh has no "
+            "MaterialIDs cell property.");
+
+    auto const n_elements = _mesh.getNumberOfElements();
+    _element_active.assign(n_elements, 1);
+    std::size_t n_inactive = 0;
+    for (std::size_t i = 0; i < n_elements; ++i)
+    {
+        if (std::binary_search(deactivated_materials.begin(),
+                               deactivated_materials.end(),
+                               (*material_ids)[i]))
+        {
+            _element_active[i] = 0;
+            ++n_inactive;
+        }
+    }
+
+    // Degrees of freedom not touched by any active element need identity
+    // rows; mark the active ones through the per-element index sets.
+    std::vector<char> dof_active(
+        _local_to_global_index_map->dofSizeWithGhosts(), 0);
+    std::vector<GlobalIndexType> indices;
+    for (std::size_t i = 0; i < n_elements; ++i)
+    {
+        if (!_element_active[i])
+            continue;
+        NumLib::getIndices(i, *_local_to_global_index_map, indices);
+        for (auto const index : indices)
+            if (index >= 0)
+                dof_active[index] = 1;
+    }
+    _inactive_only_dofs.clear();
+    for (std::size_t index = 0; index < dof_active.size(); ++index)
+        if (!dof_active[index])
+            _inactive_only_dofs.push_back(
+                static_cast<GlobalIndexType>(index));
+
+    _global_assembler.setActiveElements(
+        n_inactive == 0 ? nullptr : &_element_active);
+    INFO(
+        "Element activation: %u of %u elements inactive, %u constrained "
+        "degrees of freedom.",
+        static_cast<unsigned>(n_inactive), static_cast<unsigned>(n_elements),
+        static_cast<unsigned>(_inactive_only_dofs.size()));
+}
+
 void Process::postTimestep(GlobalVector const& x)
 {
     postTimestepConcreteProcess(x);
@@ -12,6 +12,7 @@
 #include "NumLib/ODESolver/NonlinearSolver.h"
 #include "NumLib/ODESolver/ODESystem.h"
 #include "NumLib/ODESolver/TimeDiscretization.h"
+#include "NumLib/DOF/MeshComponentMap.h"
 #include "NumLib/NamedFunctionCaller.h"
 #include "ProcessLib/BoundaryCondition/BoundaryConditionCollection.h"
 #include "ProcessLib/Parameter/Parameter.h"
@@ -21,6 +22,7 @@
 #include "SecondaryVariable.h"
 #include "CachedSecondaryVariable.h"
 #include "AbstractJacobianAssembler.h"
+#include "DeactivatedSubdomain.h"
 #include "VectorMatrixAssembler.h"
 
 namespace MeshLib
@@ -48,6 +50,60 @@ public:
             SecondaryVariableCollection&& secondary_variables,
             NumLib::NamedFunctionCaller&& named_function_caller);
 
+    /// Selects the DOF ordering of the global matrix, cf. the optional
+    /// <global_matrix_order> process configuration. Must be called before
+    /// initialize(); defaults to by-location ordering, which keeps the
+    /// components of one node adjacent and maximizes SpMV cache hits for
+    /// node-based solvers. Staggered schemes working on per-component
+    /// sub-vectors prefer by-component ordering.
+    void setGlobalMatrixDOFOrder(NumLib::ComponentOrder const order)
+    {
+        _global_matrix_dof_order = order;
+    }
+
+    /// Tells the process whether the current time step produces output; set
+    /// by the time loop before solving. Processes use this to skip
+    /// output-only work (e.g. surface-flux balances) on steps without
+    /// output.
+    void setCurrentStepIsOutputStep(bool const is_output_step)
+    {
+        _current_step_is_output_step = is_output_step;
+    }
+
+    /// Enables per-element assembly cost measurement, cf. the per-process
+    /// <measure_element_costs> configuration: the accumulated wall time per
+    /// element is kept in the "element_cost" cell property of the mesh,
+    /// written with the regular output and usable as partitioning weights.
+    void setMeasureElementCosts(bool const measure)
+    {
+        _measure_element_costs = measure;
+    }
+
+    /// Declares the assembled operators constant over the whole simulation,
+    /// cf. NumLib::ODESystem::hasConstantOperators() and the per-process
+    /// <constant_operators> configuration. Only valid for linear processes
+    /// with time-independent coefficients, sources and natural boundary
+    /// conditions; enabling it for anything else silently freezes the
+    /// equation system.
+    void setConstantOperators(bool const constant)
+    {
+        _has_constant_operators = constant;
+    }
+
+    bool hasConstantOperators() const override
+    {
+        return _has_constant_operators;
+    }
+
+    /// Configures time-dependent element deactivation,
+    /// cf. DeactivatedSubdomain and the per-process <element_deactivation>
+    /// project file section. The active set is updated in preTimestep().
+    void setElementDeactivation(
+        std::vector<DeactivatedSubdomain>&& deactivated_subdomains)
+    {
+        _deactivated_subdomains = std::move(deactivated_subdomains);
+    }
+
     /// Preprocessing before starting assembly for new timestep.
     void preTimestep(GlobalVector const& x, const double t,
                      const double delta_t);
@@ -162,6 +218,14 @@ private:
 protected:
     virtual void constructDofTable();
 
+    /// Recomputes the active element set and the constrained dofs for the
+    /// given time, cf. setElementDeactivation().
+    void updateElementActivation(double const t);
+
+    /// Adds the identity rows of the constrained (inactive-only) dofs.
+    void applyInactiveDofConstraints(GlobalVector const& x, GlobalMatrix& K,
+                                     GlobalVector& b, GlobalMatrix* const Jac);
+
 private:
     void initializeExtrapolator();
 
@@ -193,7 +257,37 @@ protected:
     /// implemented in MathLib::GaussLegendre.
     unsigned const _integration_order;
 
+    /// DOF ordering of the global matrix, cf. setGlobalMatrixDOFOrder().
+    NumLib::ComponentOrder _global_matrix_dof_order =
+        NumLib::ComponentOrder::BY_LOCATION;
+
+    /// \see setConstantOperators().
+    bool _has_constant_operators = false;
+
+protected:
+    /// \see setMeasureElementCosts().
+    bool _measure_element_costs = false;
+
+    /// Time-dependent element deactivation sequence; empty when unused.
+    std::vector<DeactivatedSubdomain> _deactivated_subdomains;
+    /// Per-element activity of the current time step (empty: all active).
+    std::vector<char> _element_active;
+    /// Degrees of freedom touched only by inactive elements; they get
+    /// identity rows holding their current value, cf. assemble().
+    std::vector<GlobalIndexType> _inactive_only_dofs;
+    /// Material-id set signature of the last active-set update,
+    /// cf. updateElementActivation().
+    std::vector<int> _deactivated_materials_signature;
+
+    /// \see setCurrentStepIsOutputStep().
+    bool isCurrentStepOutputStep() const
+    {
+        return _current_step_is_output_step;
+    }
+
 private:
+    bool _current_step_is_output_step = true;
+
     GlobalSparsityPattern _sparsity_pattern;
 
     /// Variables used by this process.
@@ -38,11 +38,18 @@ ProcessOutput::ProcessOutput(BaseLib::ConfigTree const& output_config)
     {
         output_residuals = *out_resid;
     }
+
+    if (auto material_ids =
+            //! \ogs_file_param{prj__time_loop__processes__process__output__output_material_ids}
+            output_config.getConfigParameterOptional<std::vector<int>>(
+                "output_material_ids"))
+    {
+        output_material_ids = std::move(*material_ids);
+    }
 }
 
 
-void doProcessOutput(
-        std::string const& file_name,
+void processOutputData(
         GlobalVector const& x,
         MeshLib::Mesh& mesh,
         NumLib::LocalToGlobalIndexMap const& dof_table,
@@ -51,7 +58,7 @@ void doProcessOutput(
         SecondaryVariableCollection secondary_variables,
         ProcessOutput const& process_output)
 {
-    DBUG("Process output.");
+    DBUG("Process output data.");
 
     // Copy result
 #ifdef USE_PETSC
@@ -217,6 +224,23 @@ void doProcessOutput(
     (void) secondary_variables;
 #endif // USE_PETSC
 
+}
+
+void doProcessOutput(
+        std::string const& file_name,
+        GlobalVector const& x,
+        MeshLib::Mesh& mesh,
+        NumLib::LocalToGlobalIndexMap const& dof_table,
+        std::vector<std::reference_wrapper<ProcessVariable>> const&
+        process_variables,
+        SecondaryVariableCollection secondary_variables,
+        ProcessOutput const& process_output)
+{
+    DBUG("Process output.");
+
+    processOutputData(x, mesh, dof_table, process_variables,
+                      std::move(secondary_variables), process_output);
+
     // Write output file
     DBUG("Writing output to \'%s\'.", file_name.c_str());
     MeshLib::IO::VtuInterface vtu_interface(&mesh, vtkXMLWriter::Binary, true);
@@ -26,9 +26,27 @@ struct ProcessOutput final
 
     //! Tells if also to output extrapolation residuals.
     bool output_residuals = false;
+
+    //! If non-empty, only elements whose MaterialIDs value is contained here
+    //! are written (region-of-interest output); see
+    //! <output_material_ids>.
+    std::vector<int> output_material_ids;
 };
 
 
+//! Fills the mesh's property vectors with the primary and requested
+//! secondary variable data, i.e., everything doProcessOutput() does except
+//! for the file write. Used by the asynchronous output pipeline, which
+//! snapshots the prepared mesh and writes it on a background thread.
+void processOutputData(
+        GlobalVector const& x,
+        MeshLib::Mesh& mesh,
+        NumLib::LocalToGlobalIndexMap const& dof_table,
+        std::vector<std::reference_wrapper<ProcessVariable>> const&
+        process_variables,
+        SecondaryVariableCollection secondary_variables,
+        ProcessOutput const& process_output);
+
 //! Writes output to the given \c file_name using the VTU file format.
 void doProcessOutput(
         std::string const& file_name,
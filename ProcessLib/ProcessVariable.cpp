@@ -40,6 +40,13 @@ ProcessVariable::ProcessVariable(
     if (_shapefunction_order < 1 || 2 < _shapefunction_order)
         OGS_FATAL("The given shape function order %d is not supported", _shapefunction_order);
 
+    if (auto const integration_order =
+            //! \ogs_file_param{prj__process_variables__process_variable__integration_order}
+            config.getConfigParameterOptional<unsigned>("integration_order"))
+    {
+        _integration_order = *integration_order;
+    }
+
     // Boundary conditions
     //! \ogs_file_param{prj__process_variables__process_variable__boundary_conditions}
     if (auto bcs_config = config.getConfigSubtreeOptional("boundary_conditions"))
@@ -98,6 +105,7 @@ ProcessVariable::ProcessVariable(ProcessVariable&& other)
       _mesh(other._mesh),
       _n_components(other._n_components),
       _shapefunction_order(other._shapefunction_order),
+      _integration_order(other._integration_order),
       _initial_condition(std::move(other._initial_condition)),
       _bc_configs(std::move(other._bc_configs)),
       _bc_builder(std::move(other._bc_builder))
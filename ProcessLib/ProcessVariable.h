@@ -65,6 +65,14 @@ public:
 
     unsigned getShapeFunctionOrder() const { return _shapefunction_order; }
 
+    /// Optional per-variable integration order override, cf. the variable's
+    /// <integration_order> configuration; zero means "use the process's
+    /// configured order". The process integrates with the maximum over its
+    /// variables' overrides, so reduced integration of a low-order field
+    /// (e.g. the pressure of a Taylor-Hood pair) never degrades the
+    /// integration of a field requesting full order.
+    unsigned getIntegrationOrder() const { return _integration_order; }
+
 private:
     std::string const _name;
     MeshLib::Mesh& _mesh;
@@ -83,6 +91,8 @@ private:
     ///
     /// \sa MeshLib::CellRule MeshLib::FaceRule MeshLib::EdgeRule.
     unsigned _shapefunction_order;
+    //! \see getIntegrationOrder().
+    unsigned _integration_order = 0;
     Parameter<double> const& _initial_condition;
 
     std::vector<BoundaryConditionConfig> _bc_configs;
@@ -82,8 +82,10 @@ public:
 
         MathLib::PiecewiseLinearInterpolation const& interpolated_Pc =
             _process_data.interpolated_Pc;
-        MathLib::PiecewiseLinearInterpolation const& interpolated_Kr =
-            _process_data.interpolated_Kr;
+        MathLib::UniformGridInterpolation const& sampled_Pc =
+            _process_data.sampled_Pc;
+        MathLib::UniformGridInterpolation const& sampled_Kr =
+            _process_data.sampled_Kr;
 
         auto local_M = MathLib::createZeroedMatrix<NodalMatrixType>(
             local_M_data, local_matrix_size, local_matrix_size);
@@ -111,18 +113,19 @@ public:
             auto const storage = _process_data.storage(t, pos)[0];
             double const Pc = -P_int_pt;
 
-            double dSwdPc = interpolated_Pc.getDerivative(Pc);
+            // Value and derivative from one uniform-grid interval lookup;
+            // outside of the support the boundary slope is used as before.
+            double Sw, dSwdPc;
+            sampled_Pc.getValueAndDerivative(Pc, Sw, dSwdPc);
             if (Pc > interpolated_Pc.getSupportMax())
                 dSwdPc = interpolated_Pc.getDerivative(
                     interpolated_Pc.getSupportMax());
             else if (Pc < interpolated_Pc.getSupportMin())
                 dSwdPc = interpolated_Pc.getDerivative(
                     interpolated_Pc.getSupportMin());
-
-            double const Sw = interpolated_Pc.getValue(Pc);
             _saturation[ip] = Sw;
 
-            double const k_rel = interpolated_Kr.getValue(Sw);
+            double const k_rel = sampled_Kr.getValue(Sw);
             // \TODO Extend to pressure dependent density.
             double const drhow_dp(0.0);
 
@@ -9,6 +9,8 @@
 
 #pragma once
 
+#include "MathLib/InterpolationAlgorithms/UniformGridInterpolation.h"
+
 namespace MeshLib
 {
 class Element;
@@ -43,7 +45,13 @@ struct RichardsFlowProcessData
           has_gravity(has_gravity_),
           has_mass_lumping(has_mass_lumping_),
           interpolated_Pc(interpolated_Pc_),
-          interpolated_Kr(interpolated_Kr_)
+          interpolated_Kr(interpolated_Kr_),
+          // Uniform-grid resampling of the curves for O(1) lookups in the
+          // assembly hot loop, cf. MathLib::UniformGridInterpolation.
+          sampled_Pc(interpolated_Pc_, interpolated_Pc_.getSupportMin(),
+                     interpolated_Pc_.getSupportMax()),
+          sampled_Kr(interpolated_Kr_, interpolated_Kr_.getSupportMin(),
+                     interpolated_Kr_.getSupportMax())
     {
     }
 
@@ -57,7 +65,9 @@ struct RichardsFlowProcessData
           has_gravity(other.has_gravity),
           has_mass_lumping(other.has_mass_lumping),
           interpolated_Pc(other.interpolated_Pc),
-          interpolated_Kr(other.interpolated_Kr)
+          interpolated_Kr(other.interpolated_Kr),
+          sampled_Pc(other.sampled_Pc),
+          sampled_Kr(other.sampled_Kr)
     {
     }
 
@@ -80,6 +90,10 @@ struct RichardsFlowProcessData
     bool const has_mass_lumping;
     MathLib::PiecewiseLinearInterpolation const& interpolated_Pc;
     MathLib::PiecewiseLinearInterpolation const& interpolated_Kr;
+
+    //! \see MathLib::UniformGridInterpolation.
+    MathLib::UniformGridInterpolation const sampled_Pc;
+    MathLib::UniformGridInterpolation const sampled_Kr;
 };
 
 }  // namespace RichardsFlow
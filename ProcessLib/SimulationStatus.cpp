@@ -0,0 +1,252 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "SimulationStatus.h"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+#ifndef _WIN32
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+#include <logog/include/logog.hpp>
+
+#include "BaseLib/MemWatch.h"
+#include "BaseLib/PhaseTimings.h"
+#include "NumLib/ODESolver/IterationTelemetry.h"
+
+namespace ProcessLib
+{
+
+SimulationStatus& SimulationStatus::instance()
+{
+    static SimulationStatus status;
+    return status;
+}
+
+void SimulationStatus::setStatusFile(std::string const& filename)
+{
+    _status_file = filename;
+}
+
+void SimulationStatus::beginRun(double const t_initial, double const t_end)
+{
+    if (!enabled())
+        return;
+
+    _t_initial = t_initial;
+    _t_end = t_end;
+    _t = t_initial;
+    _run_timer.start();
+
+    BaseLib::PhaseTimings::instance().enableCollection();
+
+    if (!_subscribed)
+    {
+        _subscribed = true;
+        NumLib::IterationTelemetry::instance().subscribe(
+            [this](NumLib::IterationRecord const&) { ++_iterations_seen; });
+    }
+
+    if (_http_port != 0)
+        startHttpServer();
+
+    publish(buildJson("running"));
+}
+
+void SimulationStatus::stepCompleted(std::size_t const timestep,
+                                     double const t, double const dt,
+                                     bool const succeeded)
+{
+    if (!enabled())
+        return;
+
+    _timestep = timestep;
+    _t = t;
+
+    unsigned const iterations = _iterations_seen - _iterations_at_step_begin;
+    _iterations_at_step_begin = _iterations_seen;
+    _step_history.emplace_back(dt, iterations);
+    if (_step_history.size() > 10)
+        _step_history.pop_front();
+
+    publish(buildJson(succeeded ? "running" : "failed"));
+}
+
+void SimulationStatus::finishRun(bool const succeeded)
+{
+    if (!enabled())
+        return;
+
+    publish(buildJson(succeeded ? "finished" : "failed"));
+}
+
+std::string SimulationStatus::buildJson(std::string const& state) const
+{
+    double const progress =
+        _t_end > _t_initial ? (_t - _t_initial) / (_t_end - _t_initial) : 1.0;
+    double const elapsed = _run_timer.elapsed();
+    double const eta =
+        progress > 0.0 ? elapsed * (1.0 - progress) / progress : -1.0;
+
+    BaseLib::MemWatch mem_watch;
+
+    std::ostringstream json;
+    json << "{\n"
+         << "  \"state\": \"" << state << "\",\n"
+         << "  \"timestep\": " << _timestep << ",\n"
+         << "  \"time\": " << _t << ",\n"
+         << "  \"time_end\": " << _t_end << ",\n"
+         << "  \"progress\": " << progress << ",\n"
+         << "  \"elapsed_seconds\": " << elapsed << ",\n"
+         << "  \"eta_seconds\": " << eta << ",\n";
+
+    json << "  \"dt_history\": [";
+    for (std::size_t i = 0; i < _step_history.size(); ++i)
+        json << (i ? ", " : "") << _step_history[i].first;
+    json << "],\n  \"iteration_history\": [";
+    for (std::size_t i = 0; i < _step_history.size(); ++i)
+        json << (i ? ", " : "") << _step_history[i].second;
+    json << "],\n";
+
+    json << "  \"phase_timings\": {";
+    auto const timings =
+        BaseLib::PhaseTimings::instance().timingsForTimestep(_timestep);
+    bool first = true;
+    for (auto const& phase_time : timings)
+    {
+        json << (first ? " " : ", ") << '"' << phase_time.first
+             << "\": " << phase_time.second;
+        first = false;
+    }
+    json << " },\n";
+
+    json << "  \"memory\": { \"virtual_bytes\": "
+         << mem_watch.getVirtMemUsage()
+         << ", \"resident_bytes\": " << mem_watch.getResMemUsage() << " }\n"
+         << "}\n";
+    return json.str();
+}
+
+void SimulationStatus::publish(std::string const& json)
+{
+    {
+        std::lock_guard<std::mutex> const lock(_mutex);
+        _published_json = json;
+    }
+
+    if (_status_file.empty())
+        return;
+
+    // Write-then-rename keeps the file atomic for concurrent readers.
+    std::string const tmp_filename = _status_file + ".tmp";
+    {
+        std::ofstream out(tmp_filename, std::ios::trunc);
+        if (!out)
+        {
+            ERR("Could not open file '%s' for writing the status.",
+                tmp_filename.c_str());
+            return;
+        }
+        out << json;
+    }
+    if (std::rename(tmp_filename.c_str(), _status_file.c_str()) != 0)
+        ERR("Could not move the status file to '%s'.", _status_file.c_str());
+}
+
+#ifndef _WIN32
+
+void SimulationStatus::startHttpServer()
+{
+    if (_listen_fd != -1)
+        return;
+
+    _listen_fd = socket(AF_INET, SOCK_STREAM, 0);
+    if (_listen_fd == -1)
+    {
+        ERR("Status endpoint: could not create a socket.");
+        return;
+    }
+
+    int const reuse = 1;
+    setsockopt(_listen_fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof reuse);
+
+    sockaddr_in address;
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);  // localhost only
+    address.sin_port = htons(_http_port);
+    if (bind(_listen_fd, reinterpret_cast<sockaddr*>(&address),
+             sizeof address) != 0 ||
+        listen(_listen_fd, 4) != 0)
+    {
+        ERR("Status endpoint: could not listen on port %u.",
+            static_cast<unsigned>(_http_port));
+        close(_listen_fd);
+        _listen_fd = -1;
+        return;
+    }
+
+    INFO("Status endpoint listening on http://127.0.0.1:%u/.",
+         static_cast<unsigned>(_http_port));
+
+    _http_thread = std::thread([this]() {
+        for (;;)
+        {
+            int const client_fd = accept(_listen_fd, nullptr, nullptr);
+            if (client_fd == -1)
+                return;  // listen socket closed, cf. the destructor.
+
+            char request[512];
+            read(client_fd, request, sizeof request);  // content ignored
+
+            std::string body;
+            {
+                std::lock_guard<std::mutex> const lock(_mutex);
+                body = _published_json;
+            }
+            std::string const response =
+                "HTTP/1.0 200 OK\r\n"
+                "Content-Type: application/json\r\n"
+                "Content-Length: " +
+                std::to_string(body.size()) + "\r\n\r\n" + body;
+            write(client_fd, response.data(), response.size());
+            close(client_fd);
+        }
+    });
+}
+
+SimulationStatus::~SimulationStatus()
+{
+    if (_listen_fd != -1)
+    {
+        // Shutting the listen socket down makes accept() fail and ends the
+        // thread; only then is the descriptor closed.
+        shutdown(_listen_fd, SHUT_RDWR);
+        _http_thread.join();
+        close(_listen_fd);
+    }
+}
+
+#else  // _WIN32
+
+void SimulationStatus::startHttpServer()
+{
+    WARN("The status HTTP endpoint is not available on Windows.");
+}
+
+SimulationStatus::~SimulationStatus() = default;
+
+#endif  // _WIN32
+
+}  // namespace ProcessLib
@@ -0,0 +1,98 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "BaseLib/RunTime.h"
+
+namespace ProcessLib
+{
+
+/*! Lightweight status surface of the time loop for fleet monitoring.
+ *
+ * When enabled (cf. the \c --status-file and \c --status-port command line
+ * options), the time loop reports every completed step and the status is
+ * published as a small JSON document: current simulation time and progress,
+ * an ETA from the wall time spent so far, the recent step size and nonlinear
+ * iteration histories, the per-phase timings of the last step and the
+ * current memory usage from BaseLib::MemWatch. The document is rewritten
+ * atomically (write to temporary, then rename), so a monitoring agent never
+ * reads a torn file, and is optionally served on a localhost-only HTTP
+ * endpoint so the monitoring stops scraping logog text output.
+ *
+ * The nonlinear iteration counts are taken from the IterationTelemetry
+ * subscriber hook, the phase timings from BaseLib::PhaseTimings, whose
+ * collection is forced on while the status surface is enabled.
+ */
+class SimulationStatus final
+{
+public:
+    static SimulationStatus& instance();
+
+    /// Enables the status surface; the JSON document is rewritten into the
+    /// given file after every completed time step.
+    void setStatusFile(std::string const& filename);
+
+    /// Additionally serves the current JSON document on
+    /// http://127.0.0.1:port/ (POSIX only; silently unavailable on
+    /// Windows).
+    void setHttpPort(unsigned short const port) { _http_port = port; }
+
+    bool enabled() const { return !_status_file.empty() || _http_port != 0; }
+
+    /// Called by the time loop before the first step.
+    void beginRun(double const t_initial, double const t_end);
+
+    /// Called by the time loop after each step; rewrites the status file and
+    /// updates the document served by the HTTP endpoint.
+    void stepCompleted(std::size_t const timestep, double const t,
+                       double const dt, bool const succeeded);
+
+    /// Marks the run as finished in the published status.
+    void finishRun(bool const succeeded);
+
+    ~SimulationStatus();
+
+private:
+    SimulationStatus() = default;
+
+    std::string buildJson(std::string const& state) const;
+    void publish(std::string const& json);
+    void startHttpServer();
+
+    std::string _status_file;
+    unsigned short _http_port = 0;
+
+    double _t_initial = 0.0;
+    double _t_end = 0.0;
+    std::size_t _timestep = 0;
+    double _t = 0.0;
+    BaseLib::RunTime _run_timer;
+
+    //! Recent (dt, nonlinear iterations) pairs, newest last.
+    std::deque<std::pair<double, unsigned>> _step_history;
+    //! Iteration count from the telemetry subscriber, cf. stepCompleted().
+    unsigned _iterations_seen = 0;
+    unsigned _iterations_at_step_begin = 0;
+    bool _subscribed = false;
+
+    //! Latest published JSON document, shared with the HTTP thread.
+    std::string _published_json;
+    mutable std::mutex _mutex;
+
+    std::thread _http_thread;
+    int _listen_fd = -1;
+};
+
+}  // namespace ProcessLib
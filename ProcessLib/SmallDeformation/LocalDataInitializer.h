@@ -215,13 +215,24 @@ public:
                     ConstructorArgs&&... args) const
     {
         auto const type_idx = std::type_index(typeid(mesh_item));
-        auto const it = _builder.find(type_idx);
 
-        if (it != _builder.end())
+        // Memoized dispatch: meshes contain long runs of one element type
+        // (guaranteed after type-ordered creation), so the previous
+        // element's builder almost always matches and the per-element map
+        // lookup disappears from the create loop.
+        if (_last_builder == nullptr || type_idx != _last_type_idx)
+        {
+            auto const memo_it = _builder.find(type_idx);
+            _last_builder =
+                (memo_it != _builder.end()) ? &memo_it->second : nullptr;
+            _last_type_idx = type_idx;
+        }
+
+        if (_last_builder != nullptr)
         {
             auto const num_local_dof = _dof_table.getNumberOfElementDOF(id);
-            data_ptr = it->second(mesh_item, num_local_dof,
-                                  std::forward<ConstructorArgs>(args)...);
+            data_ptr = (*_last_builder)(mesh_item, num_local_dof,
+                                        std::forward<ConstructorArgs>(args)...);
         }
         else
         {
@@ -266,6 +277,10 @@ private:
 
     NumLib::LocalToGlobalIndexMap const& _dof_table;
 
+    //! Memoized last dispatch, cf. operator().
+    mutable std::type_index _last_type_idx = std::type_index(typeid(void));
+    mutable LADataBuilder const* _last_builder = nullptr;
+
     // local assembler builder implementations.
 private:
     /// Generates a function that creates a new LocalAssembler of type
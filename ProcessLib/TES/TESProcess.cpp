@@ -9,6 +9,7 @@
 
 #include "TESProcess.h"
 #include "BaseLib/Functional.h"
+#include "NumLib/Assembler/SerialExecutor.h"
 #include "NumLib/DOF/DOFTableUtil.h"
 #include "ProcessLib/Utils/CreateLocalAssemblers.h"
 
@@ -294,8 +295,11 @@ NumLib::IterationResult TESProcess::postIterationConcreteProcess(
                 check_passed = false;
         };
 
-        GlobalExecutor::executeDereferenced(check_variable_bounds,
-                                         _local_assemblers);
+        // Explicitly serial: the lambda writes the shared caches and the
+        // check_passed flag, so it must not run through the (possibly
+        // parallel) global executor. The check is a cheap sweep.
+        NumLib::SerialExecutor::executeDereferenced(check_variable_bounds,
+                                                    _local_assemblers);
     }
 
     if (!check_passed)
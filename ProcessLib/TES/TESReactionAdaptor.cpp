@@ -330,6 +330,18 @@ ReactionRate TESFEMReactionAdaptorCaOH2::initReaction(const unsigned int int_pt)
         return {_d.reaction_rate[int_pt], _d.solid_density[int_pt]};
     }
 
+    // The kinetics integration depends only on these four inputs; reuse the
+    // result for bit-identical states (common across the integration points
+    // of homogeneous regions). The cache is reset at the start of a time
+    // step.
+    if (int_pt == 0)
+        _rate_cache.clear();
+    std::array<double, 4> const state_key = {
+        {_d.T, _d.p, _d.vapour_mass_fraction, _d.solid_density_prev_ts[int_pt]}};
+    auto const cached = _rate_cache.find(state_key);
+    if (cached != _rate_cache.end())
+        return cached->second;
+
     // TODO: double check!
     // const double xv_NR  = SolidProp->non_reactive_solid_volume_fraction;
     // const double rho_NR = SolidProp->non_reactive_solid_density;
@@ -367,8 +379,10 @@ ReactionRate TESFEMReactionAdaptorCaOH2::initReaction(const unsigned int int_pt)
     else
         rho_react = y_new[0];
 
-    return {y_dot_new[0] * (1.0 - xv_NR),
-            (1.0 - xv_NR) * rho_react + xv_NR * rho_NR};
+    ReactionRate const result{y_dot_new[0] * (1.0 - xv_NR),
+                              (1.0 - xv_NR) * rho_react + xv_NR * rho_NR};
+    _rate_cache.emplace(state_key, result);
+    return result;
 }
 
 }  // namespace TES
@@ -9,6 +9,9 @@
 
 #pragma once
 
+#include <array>
+#include <map>
+
 #include <memory>
 #include <vector>
 
@@ -120,6 +123,13 @@ private:
 
     std::unique_ptr<MathLib::ODE::ODESolver<1>> _ode_solver;
 
+    //! Memoizes the kinetics integration per distinct input state
+    //! (T, p, x_mV, rho_SR_prev), cleared at the start of every time step.
+    //! Integration points in homogeneous regions share bit-identical inputs
+    //! and thereby one ODE solve, so a few stiff hot spots no longer imply
+    //! one expensive integration per point of the whole block.
+    std::map<std::array<double, 4>, ReactionRate> _rate_cache;
+
     static bool odeRhs(const double /*t*/,
                        MathLib::ODE::MappedConstVector<1> const y,
                        MathLib::ODE::MappedVector<1>
@@ -94,10 +94,12 @@ void TwoPhaseFlowWithPPLocalAssembler<
         permeability.diagonal().setConstant(perm(0, 0));
     MathLib::PiecewiseLinearInterpolation const& interpolated_Pc =
         _process_data._interpolated_Pc;
-    MathLib::PiecewiseLinearInterpolation const& interpolated_Kr_wet =
-        _process_data._interpolated_Kr_wet;
-    MathLib::PiecewiseLinearInterpolation const& interpolated_Kr_nonwet =
-        _process_data._interpolated_Kr_nonwet;
+    MathLib::UniformGridInterpolation const& sampled_Pc =
+        _process_data._sampled_Pc;
+    MathLib::UniformGridInterpolation const& sampled_Kr_wet =
+        _process_data._sampled_Kr_wet;
+    MathLib::UniformGridInterpolation const& sampled_Kr_nonwet =
+        _process_data._sampled_Kr_nonwet;
 
     // Note: currently only isothermal case is considered, so the temperature is
     // assumed to be const
@@ -121,11 +123,12 @@ void TwoPhaseFlowWithPPLocalAssembler<
         double const rho_w = _process_data._material->getLiquidDensity(
             _pressure_wetting[ip], _temperature);
 
-        double const Sw =
-            (pc_int_pt < 0) ? 1.0 : interpolated_Pc.getValue(pc_int_pt);
-
-        _saturation[ip] = Sw;
-        double dSwdPc = interpolated_Pc.getDerivative(pc_int_pt);
+        // Bundled evaluation: saturation and its derivative come from one
+        // uniform-grid interval lookup.
+        double Sw, dSwdPc;
+        sampled_Pc.getValueAndDerivative(pc_int_pt, Sw, dSwdPc);
+        if (pc_int_pt < 0)
+            Sw = 1.0;
         if (pc_int_pt > interpolated_Pc.getSupportMax())
             dSwdPc =
                 interpolated_Pc.getDerivative(interpolated_Pc.getSupportMax());
@@ -133,6 +136,8 @@ void TwoPhaseFlowWithPPLocalAssembler<
             dSwdPc =
                 interpolated_Pc.getDerivative(interpolated_Pc.getSupportMin());
 
+        _saturation[ip] = Sw;
+
         double const porosity = _process_data._material->getPorosity(
             t, pos, pg_int_pt, _temperature, 0);
 
@@ -150,13 +155,13 @@ void TwoPhaseFlowWithPPLocalAssembler<
 
         // Assemble M matrix
         // nonwet
-        double const k_rel_G = interpolated_Kr_nonwet.getValue(Sw);
+        double const k_rel_G = sampled_Kr_nonwet.getValue(Sw);
         double const mu_gas =
             _process_data._material->getGasViscosity(pg_int_pt, _temperature);
         double const lambda_G = k_rel_G / mu_gas;
 
         // wet
-        double const k_rel_L = interpolated_Kr_wet.getValue(Sw);
+        double const k_rel_L = sampled_Kr_wet.getValue(Sw);
         double const mu_liquid = _process_data._material->getLiquidViscosity(
             _pressure_wetting[ip], _temperature);
         double const lambda_L = k_rel_L / mu_liquid;
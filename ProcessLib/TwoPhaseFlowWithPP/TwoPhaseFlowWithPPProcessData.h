@@ -9,6 +9,8 @@
 
 #pragma once
 
+#include "MathLib/InterpolationAlgorithms/UniformGridInterpolation.h"
+
 namespace MeshLib
 {
 class Element;
@@ -38,7 +40,17 @@ struct TwoPhaseFlowWithPPProcessData
           _material(std::move(material_)),
           _interpolated_Pc(interpolated_Pc_),
           _interpolated_Kr_wet(interpolated_Kr_wet_),
-          _interpolated_Kr_nonwet(interpolated_Kr_nonwet_)
+          _interpolated_Kr_nonwet(interpolated_Kr_nonwet_),
+          // Uniform-grid resampling for O(1) value-plus-derivative lookups
+          // in the assembly hot loop.
+          _sampled_Pc(interpolated_Pc_, interpolated_Pc_.getSupportMin(),
+                      interpolated_Pc_.getSupportMax()),
+          _sampled_Kr_wet(interpolated_Kr_wet_,
+                          interpolated_Kr_wet_.getSupportMin(),
+                          interpolated_Kr_wet_.getSupportMax()),
+          _sampled_Kr_nonwet(interpolated_Kr_nonwet_,
+                             interpolated_Kr_nonwet_.getSupportMin(),
+                             interpolated_Kr_nonwet_.getSupportMax())
     {
     }
 
@@ -49,7 +61,10 @@ struct TwoPhaseFlowWithPPProcessData
           _material(std::move(other._material)),
           _interpolated_Pc(other._interpolated_Pc),
           _interpolated_Kr_wet(other._interpolated_Kr_wet),
-          _interpolated_Kr_nonwet(other._interpolated_Kr_nonwet)
+          _interpolated_Kr_nonwet(other._interpolated_Kr_nonwet),
+          _sampled_Pc(other._sampled_Pc),
+          _sampled_Kr_wet(other._sampled_Kr_wet),
+          _sampled_Kr_nonwet(other._sampled_Kr_nonwet)
     {
     }
 
@@ -78,6 +93,11 @@ struct TwoPhaseFlowWithPPProcessData
     MathLib::PiecewiseLinearInterpolation const& _interpolated_Pc;
     MathLib::PiecewiseLinearInterpolation const& _interpolated_Kr_wet;
     MathLib::PiecewiseLinearInterpolation const& _interpolated_Kr_nonwet;
+
+    //! \see MathLib::UniformGridInterpolation.
+    MathLib::UniformGridInterpolation const _sampled_Pc;
+    MathLib::UniformGridInterpolation const _sampled_Kr_wet;
+    MathLib::UniformGridInterpolation const _sampled_Kr_nonwet;
 };
 
 }  // namespace TwoPhaseFlowWithPP
@@ -9,11 +9,22 @@
 
 #include "UncoupledProcessesTimeLoop.h"
 #include "BaseLib/uniqueInsert.h"
+#include <cstdio>
+#include <cstdint>
+#include <fstream>
+#include <thread>
+
+#include "BaseLib/FileTools.h"
+#include "BaseLib/MemoryTelemetry.h"
+#include "BaseLib/PhaseTimings.h"
 #include "BaseLib/RunTime.h"
+#include "NumLib/ODESolver/LinearSystemCapture.h"
 #include "NumLib/ODESolver/TimeDiscretizationBuilder.h"
 #include "NumLib/ODESolver/TimeDiscretizedODESystem.h"
 #include "NumLib/ODESolver/ConvergenceCriterionPerComponent.h"
+#include "NumLib/TimeStepping/Algorithms/EvolutionaryPIDcontroller.h"
 #include "NumLib/TimeStepping/Algorithms/FixedTimeStepping.h"
+#include "SimulationStatus.h"
 
 std::unique_ptr<NumLib::ITimeStepAlgorithm> createTimeStepper(
     BaseLib::ConfigTree const& config)
@@ -33,6 +44,10 @@ std::unique_ptr<NumLib::ITimeStepAlgorithm> createTimeStepper(
     {
         timestepper = NumLib::FixedTimeStepping::newInstance(config);
     }
+    else if (type == "EvolutionaryPIDcontroller")
+    {
+        timestepper = NumLib::EvolutionaryPIDcontroller::newInstance(config);
+    }
     else
     {
         OGS_FATAL("Unknown timestepper type: `%s'.", type.c_str());
@@ -151,6 +166,10 @@ struct SingleProcessData
 
     Process& process;
     ProcessOutput process_output;
+
+    //! Number of local substeps this process takes per global time step,
+    //! cf. the per-process <subcycles> option. One means no subcycling.
+    unsigned subcycles = 1;
 };
 
 template <NumLib::NonlinearSolverTag NLTag>
@@ -300,9 +319,19 @@ std::vector<std::unique_ptr<SingleProcessData>> createPerProcessData(
         //! \ogs_file_param{prj__time_loop__processes__process__output}
         ProcessOutput process_output{pcs_config.getConfigSubtree("output")};
 
+        auto const subcycles =
+            //! \ogs_file_param{prj__time_loop__processes__process__subcycles}
+            pcs_config.getConfigParameterOptional<unsigned>("subcycles");
+
         per_process_data.emplace_back(makeSingleProcessData(
             nl_slv, pcs, std::move(time_disc), std::move(conv_crit),
             std::move(process_output)));
+        if (subcycles)
+        {
+            if (*subcycles == 0)
+                OGS_FATAL("<subcycles> must be at least one.");
+            per_process_data.back()->subcycles = *subcycles;
+        }
     }
 
     if (per_process_data.size() != processes.size())
@@ -332,10 +361,43 @@ std::unique_ptr<UncoupledProcessesTimeLoop> createUncoupledProcessesTimeLoop(
         //! \ogs_file_param{prj__time_loop__processes}
         config.getConfigSubtree("processes"), processes, nonlinear_solvers);
 
+    auto const initial_guess_extrapolation =
+        //! \ogs_file_param{prj__time_loop__initial_guess_extrapolation}
+        config.getConfigParameterOptional<bool>("initial_guess_extrapolation");
+
+    auto const checkpoint_each_steps =
+        //! \ogs_file_param{prj__time_loop__checkpoint_each_steps}
+        config.getConfigParameterOptional<unsigned>("checkpoint_each_steps");
+
+    auto const parallel_processes =
+        //! \ogs_file_param{prj__time_loop__parallel_processes}
+        config.getConfigParameterOptional<bool>("parallel_processes");
+
+    double steady_state_relative_tolerance = -1.0;
+    unsigned steady_state_steps = 1;
+    if (auto const steady_state_config =
+            //! \ogs_file_param{prj__time_loop__steady_state_detection}
+            config.getConfigSubtreeOptional("steady_state_detection"))
+    {
+        steady_state_relative_tolerance =
+            //! \ogs_file_param{prj__time_loop__steady_state_detection__relative_tolerance}
+            steady_state_config->getConfigParameter<double>(
+                "relative_tolerance");
+        steady_state_steps =
+            //! \ogs_file_param{prj__time_loop__steady_state_detection__steps}
+            steady_state_config->getConfigParameter<unsigned>("steps");
+    }
+
     return std::unique_ptr<UncoupledProcessesTimeLoop>{
-        new UncoupledProcessesTimeLoop{std::move(timestepper),
-                                       std::move(output),
-                                       std::move(per_process_data)}};
+        new UncoupledProcessesTimeLoop{
+            std::move(timestepper), std::move(output),
+            std::move(per_process_data),
+            initial_guess_extrapolation ? *initial_guess_extrapolation
+                                        : false,
+            checkpoint_each_steps ? *checkpoint_each_steps : 0u,
+            BaseLib::joinPaths(output_directory, "ogs_checkpoint.bin"),
+            steady_state_relative_tolerance, steady_state_steps,
+            parallel_processes ? *parallel_processes : false}};
 }
 
 std::vector<GlobalVector*> setInitialConditions(
@@ -385,7 +447,9 @@ std::vector<GlobalVector*> setInitialConditions(
 bool solveOneTimeStepOneProcess(GlobalVector& x, std::size_t const timestep,
                                 double const t, double const delta_t,
                                 SingleProcessData& process_data,
-                                Output const& output_control)
+                                Output const& output_control,
+                                GlobalVector const* const x_prev,
+                                double const dt_ratio)
 {
     auto& process = process_data.process;
     auto& time_disc = *process_data.time_disc;
@@ -407,6 +471,15 @@ bool solveOneTimeStepOneProcess(GlobalVector& x, std::size_t const timestep,
 
     process.preTimestep(x, t, delta_t);
 
+    if (x_prev != nullptr && dt_ratio > 0.0)
+    {
+        // Warm start: linear extrapolation of the last two solutions in
+        // time, x_guess = x + dt/dt_prev * (x - x_prev). This only changes
+        // the nonlinear solver's initial guess; the time discretization works
+        // on its own copies of the solution history.
+        MathLib::LinAlg::axpby(x, -dt_ratio, 1.0 + dt_ratio, *x_prev);
+    }
+
     auto const post_iteration_callback = [&](
         unsigned iteration, GlobalVector const& x) {
         output_control.doOutputNonlinearIteration(
@@ -427,11 +500,124 @@ bool solveOneTimeStepOneProcess(GlobalVector& x, std::size_t const timestep,
 UncoupledProcessesTimeLoop::UncoupledProcessesTimeLoop(
     std::unique_ptr<NumLib::ITimeStepAlgorithm>&& timestepper,
     std::unique_ptr<Output>&& output,
-    std::vector<std::unique_ptr<SingleProcessData>>&& per_process_data)
+    std::vector<std::unique_ptr<SingleProcessData>>&& per_process_data,
+    bool const initial_guess_extrapolation,
+    unsigned const checkpoint_each_steps,
+    std::string const& checkpoint_file,
+    double const steady_state_relative_tolerance,
+    unsigned const steady_state_steps,
+    bool const parallel_processes)
     : _timestepper{std::move(timestepper)},
       _output(std::move(output)),
-      _per_process_data(std::move(per_process_data))
+      _per_process_data(std::move(per_process_data)),
+      _initial_guess_extrapolation(initial_guess_extrapolation),
+      _checkpoint_each_steps(checkpoint_each_steps),
+      _checkpoint_file(checkpoint_file),
+      _steady_state_relative_tolerance(steady_state_relative_tolerance),
+      _steady_state_steps(steady_state_steps),
+      _parallel_processes(parallel_processes)
+{
+    _previous_solutions.resize(_per_process_data.size());
+}
+
+void UncoupledProcessesTimeLoop::writeCheckpoint(
+    double const t, std::size_t const timestep) const
+{
+    // Write to a temporary file first; the rename is atomic, so a crash
+    // during checkpointing never corrupts the previous checkpoint.
+    auto const tmp_file = _checkpoint_file + ".tmp";
+    {
+        std::ofstream out(tmp_file, std::ios::binary);
+        if (!out) {
+            ERR("Could not open checkpoint file '%s' for writing.",
+                tmp_file.c_str());
+            return;
+        }
+
+        char const magic[8] = {'O', 'G', 'S', 'C', 'H', 'K', '0', '1'};
+        out.write(magic, sizeof(magic));
+        out.write(reinterpret_cast<char const*>(&t), sizeof(t));
+        std::uint64_t const step64 = timestep;
+        out.write(reinterpret_cast<char const*>(&step64), sizeof(step64));
+        std::uint64_t const n_processes = _process_solutions.size();
+        out.write(reinterpret_cast<char const*>(&n_processes),
+                  sizeof(n_processes));
+
+        std::vector<double> values;
+        for (auto const* x : _process_solutions)
+        {
+            values.resize(x->size());
+            x->copyValues(values);
+            std::uint64_t const size = values.size();
+            out.write(reinterpret_cast<char const*>(&size), sizeof(size));
+            out.write(reinterpret_cast<char const*>(values.data()),
+                      size * sizeof(double));
+        }
+
+        if (!out) {
+            ERR("Error writing checkpoint file '%s'.", tmp_file.c_str());
+            return;
+        }
+    }
+
+    if (std::rename(tmp_file.c_str(), _checkpoint_file.c_str()) != 0)
+    {
+        ERR("Could not move checkpoint file into place.");
+        return;
+    }
+    INFO("Checkpoint written at timestep #%u (t=%g s).",
+         static_cast<unsigned>(timestep), t);
+}
+
+bool UncoupledProcessesTimeLoop::readCheckpoint(double& t,
+                                                std::size_t& timestep)
 {
+    std::ifstream in(_restart_file, std::ios::binary);
+    if (!in) {
+        ERR("Could not open checkpoint file '%s'.", _restart_file.c_str());
+        return false;
+    }
+
+    char magic[8];
+    in.read(magic, sizeof(magic));
+    if (!in || std::string(magic, 8) != "OGSCHK01") {
+        ERR("'%s' is not an OGS checkpoint file.", _restart_file.c_str());
+        return false;
+    }
+
+    std::uint64_t step64, n_processes;
+    in.read(reinterpret_cast<char*>(&t), sizeof(t));
+    in.read(reinterpret_cast<char*>(&step64), sizeof(step64));
+    in.read(reinterpret_cast<char*>(&n_processes), sizeof(n_processes));
+    if (!in || n_processes != _process_solutions.size()) {
+        ERR("The checkpoint file does not match the process setup.");
+        return false;
+    }
+    timestep = step64;
+
+    std::vector<double> values;
+    for (auto* x : _process_solutions)
+    {
+        std::uint64_t size;
+        in.read(reinterpret_cast<char*>(&size), sizeof(size));
+        if (!in || size != static_cast<std::uint64_t>(x->size())) {
+            ERR("The checkpoint file does not match the solution vector "
+                "sizes.");
+            return false;
+        }
+        values.resize(size);
+        in.read(reinterpret_cast<char*>(values.data()),
+                size * sizeof(double));
+        if (!in)
+            return false;
+        for (std::uint64_t i = 0; i < size; ++i)
+            x->set(static_cast<GlobalIndexType>(i), values[i]);
+        MathLib::LinAlg::finalizeAssembly(*x);
+    }
+
+    INFO("Restarting from checkpoint at timestep #%u (t=%g s).",
+         static_cast<unsigned>(timestep), t);
+    return true;
 }
 
 bool UncoupledProcessesTimeLoop::loop()
@@ -461,7 +647,27 @@ bool UncoupledProcessesTimeLoop::loop()
     // init solution storage
     _process_solutions = setInitialConditions(t0, _per_process_data);
 
+    double t_restart = t0;
+    std::size_t restart_step = 0;
+    bool restarted = false;
+    if (!_restart_file.empty())
+    {
+        if (!readCheckpoint(t_restart, restart_step))
+            return false;
+        restarted = true;
+
+        // Push the restored solutions as the time discretizations' state.
+        unsigned pcs_idx = 0;
+        for (auto& spd : _per_process_data)
+        {
+            spd->time_disc->setInitialState(t_restart,
+                                            *_process_solutions[pcs_idx]);
+            ++pcs_idx;
+        }
+    }
+
     // output initial conditions
+    if (!restarted)
     {
         unsigned pcs_idx = 0;
         for (auto& spd : _per_process_data)
@@ -479,6 +685,18 @@ bool UncoupledProcessesTimeLoop::loop()
     std::size_t timestep = 1;  // the first timestep really is number one
     bool nonlinear_solver_succeeded = true;
 
+    auto* const pid_controller =
+        dynamic_cast<NumLib::EvolutionaryPIDcontroller*>(_timestepper.get());
+    if (pid_controller != nullptr && !_initial_guess_extrapolation)
+    {
+        WARN(
+            "The EvolutionaryPIDcontroller estimates the solution error from "
+            "the solution-history extrapolation; without "
+            "<initial_guess_extrapolation> the step size stays constant.");
+    }
+
+    SimulationStatus::instance().beginRun(t, _timestepper->end());
+
     while (_timestepper->next())
     {
         BaseLib::RunTime time_timestep;
@@ -489,9 +707,86 @@ bool UncoupledProcessesTimeLoop::loop()
         t = ts.current();
         timestep = ts.steps();
 
+        // When restarting, wind the time stepper forward over the already
+        // computed steps.
+        if (restarted && timestep <= restart_step)
+            continue;
+
+        BaseLib::PhaseTimings::instance().setTimestep(timestep);
+        NumLib::LinearSystemCapture::instance().setTimestep(timestep);
+
+        // Let the processes know whether this step produces output, so they
+        // can skip output-only work (e.g. balance computations) otherwise.
+        for (auto& spd : _per_process_data)
+            spd->process.setCurrentStepIsOutputStep(
+                _output->isOutputStep(timestep));
+
         INFO("=== timestep #%u (t=%gs, dt=%gs) ==============================",
              timestep, t, delta_t);
 
+        double steady_state_max_change = 0.0;
+
+        bool const track_history =
+            _initial_guess_extrapolation ||
+            _steady_state_relative_tolerance > 0.0;
+
+        // Keep the old solutions for the next step's extrapolation and/or
+        // the steady-state detection before any process is solved.
+        auto const n_processes = _per_process_data.size();
+        std::vector<std::unique_ptr<GlobalVector>> x_backups(n_processes);
+        std::vector<double> dt_ratios(n_processes, 0.0);
+        for (unsigned idx = 0; idx < n_processes; ++idx)
+        {
+            if (!track_history)
+                continue;
+            x_backups[idx] =
+                MathLib::MatrixVectorTraits<GlobalVector>::newInstance(
+                    *_process_solutions[idx]);
+            if (_initial_guess_extrapolation &&
+                _previous_solutions[idx] != nullptr && _previous_dt > 0.0)
+                dt_ratios[idx] = delta_t / _previous_dt;
+        }
+
+        // Local time stepping: a process with k subcycles advances in k
+        // substeps of dt/k within the global step. The processes in this
+        // loop are solved uncoupledly, so no interpolation of coupling data
+        // is involved.
+        auto const solve_one_process = [&](unsigned const idx) -> bool {
+            auto& spd = *_per_process_data[idx];
+            auto& x = *_process_solutions[idx];
+            unsigned const subcycles = spd.subcycles;
+            double const sub_dt = delta_t / subcycles;
+            for (unsigned subcycle = 0; subcycle < subcycles; ++subcycle)
+            {
+                double const sub_t = t - delta_t + (subcycle + 1) * sub_dt;
+                if (!solveOneTimeStepOneProcess(
+                        x, timestep, sub_t, sub_dt, spd, *_output,
+                        subcycle == 0 ? _previous_solutions[idx].get()
+                                      : nullptr,
+                        subcycle == 0 ? dt_ratios[idx] : 0.0))
+                    return false;
+            }
+            return true;
+        };
+
+        // Optional concurrent solve phase: the processes of this loop are
+        // independent, so their nonlinear solves can run on separate
+        // threads (the matrix/vector provider serializes its bookkeeping);
+        // history management, error estimates and output stay sequential
+        // below.
+        std::vector<char> parallel_results;
+        if (_parallel_processes && n_processes > 1)
+        {
+            parallel_results.assign(n_processes, 0);
+            std::vector<std::thread> workers;
+            for (unsigned idx = 0; idx < n_processes; ++idx)
+                workers.emplace_back([&, idx]() {
+                    parallel_results[idx] = solve_one_process(idx) ? 1 : 0;
+                });
+            for (auto& worker : workers)
+                worker.join();
+        }
+
         // TODO use process name
         unsigned pcs_idx = 0;
         for (auto& spd : _per_process_data)
@@ -500,12 +795,63 @@ bool UncoupledProcessesTimeLoop::loop()
             BaseLib::RunTime time_timestep_process;
             time_timestep_process.start();
 
+            BaseLib::PhaseTimings::instance().setContext(
+                "process #" + std::to_string(pcs_idx));
+
             auto& x = *_process_solutions[pcs_idx];
 
-            nonlinear_solver_succeeded = solveOneTimeStepOneProcess(
-                x, timestep, t, delta_t, *spd, *_output);
+            auto& x_prev = _previous_solutions[pcs_idx];
+            auto& x_backup = x_backups[pcs_idx];
+            double const dt_ratio = dt_ratios[pcs_idx];
+
+            nonlinear_solver_succeeded =
+                parallel_results.empty()
+                    ? solve_one_process(pcs_idx)
+                    : parallel_results[pcs_idx] != 0;
 
-            pcs.computeSecondaryVariable(t, x);
+            if (pid_controller != nullptr && nonlinear_solver_succeeded &&
+                x_backup != nullptr && x_prev != nullptr && dt_ratio > 0.0)
+            {
+                // Predictor-corrector error estimate: difference between the
+                // linearly extrapolated guess and the computed solution.
+                auto predictor = MathLib::MatrixVectorTraits<
+                    GlobalVector>::newInstance(*x_backup);
+                MathLib::LinAlg::axpby(*predictor, -dt_ratio, 1.0 + dt_ratio,
+                                       *x_prev);
+                MathLib::LinAlg::axpy(*predictor, -1.0, x);
+                double const x_norm = MathLib::LinAlg::norm2(x);
+                double const error = MathLib::LinAlg::norm2(*predictor) /
+                                     (x_norm > 0.0 ? x_norm : 1.0);
+                pid_controller->setSolutionError(error);
+            }
+
+            if (_steady_state_relative_tolerance > 0.0 &&
+                nonlinear_solver_succeeded && x_backup != nullptr)
+            {
+                // Relative solution change of this process over the step.
+                auto change = MathLib::MatrixVectorTraits<
+                    GlobalVector>::newInstance(*x_backup);
+                MathLib::LinAlg::axpy(*change, -1.0, x);
+                double const x_norm = MathLib::LinAlg::norm2(x);
+                steady_state_max_change = std::max(
+                    steady_state_max_change,
+                    MathLib::LinAlg::norm2(*change) /
+                        (x_norm > 0.0 ? x_norm : 1.0));
+            }
+
+            if (track_history)
+                x_prev = std::move(x_backup);
+
+            BaseLib::PhaseTimings::instance().add(
+                "nonlinear_solver", time_timestep_process.elapsed());
+
+            if (_output->isOutputStep(timestep))
+            {
+                // Secondary variables only feed the output; skip the
+                // extrapolation work entirely on steps without output.
+                BaseLib::ScopedPhaseTimer phase_timer("extrapolation");
+                pcs.computeSecondaryVariable(t, x);
+            }
 
             INFO("[time] Solving process #%u took %g s in timestep #%u.",
                  pcs_idx, time_timestep.elapsed(), timestep);
@@ -517,23 +863,70 @@ bool UncoupledProcessesTimeLoop::loop()
                     timestep, t, pcs_idx);
 
                 // save unsuccessful solution
+                BaseLib::ScopedPhaseTimer phase_timer("output");
                 _output->doOutputAlways(pcs, spd->process_output, timestep, t, x);
 
                 break;
             }
             else
             {
+                // Probes sample every step, independently of the field
+                // output schedule.
+                _output->sampleProbes(pcs, t, x);
+
+                BaseLib::ScopedPhaseTimer phase_timer("output");
                 _output->doOutput(pcs, spd->process_output, timestep, t, x);
             }
 
             ++pcs_idx;
         }
 
+        _previous_dt = delta_t;
+
+        if (timestep == 1 || timestep % 10 == 0)
+            BaseLib::MemoryTelemetry::instance().sample(
+                "timestep_" + std::to_string(timestep));
+
+        if (nonlinear_solver_succeeded && _checkpoint_each_steps != 0 &&
+            timestep % _checkpoint_each_steps == 0)
+        {
+            writeCheckpoint(t, timestep);
+        }
+
         INFO("[time] Timestep #%u took %g s.", timestep,
              time_timestep.elapsed());
 
+        SimulationStatus::instance().stepCompleted(timestep, t, delta_t,
+                                                   nonlinear_solver_succeeded);
+
+        // Adaptive output indicators: dt and the relative solution change
+        // are computed above; the iteration count is unavailable without
+        // telemetry and passed as zero then (the dt and change triggers
+        // remain effective).
+        _output->updateAdaptiveIndicators(timestep, delta_t, 0,
+                                          steady_state_max_change);
+
         if (!nonlinear_solver_succeeded)
             break;
+
+        if (_steady_state_relative_tolerance > 0.0)
+        {
+            if (steady_state_max_change < _steady_state_relative_tolerance)
+                ++_steady_state_counter;
+            else
+                _steady_state_counter = 0;
+
+            if (_steady_state_counter >= _steady_state_steps)
+            {
+                INFO(
+                    "Steady state reached after timestep #%u (relative "
+                    "solution change below %g for %u steps); terminating the "
+                    "time loop.",
+                    timestep, _steady_state_relative_tolerance,
+                    _steady_state_steps);
+                break;
+            }
+        }
     }
 
     // output last timestep
@@ -550,6 +943,8 @@ bool UncoupledProcessesTimeLoop::loop()
         }
     }
 
+    SimulationStatus::instance().finishRun(nonlinear_solver_succeeded);
+
     return nonlinear_solver_succeeded;
 }
 
@@ -10,6 +10,7 @@
 #pragma once
 
 #include <memory>
+#include <string>
 #include <logog/include/logog.hpp>
 
 #include "NumLib/ODESolver/NonlinearSolver.h"
@@ -29,10 +30,24 @@ public:
     explicit UncoupledProcessesTimeLoop(
         std::unique_ptr<NumLib::ITimeStepAlgorithm>&& timestepper,
         std::unique_ptr<Output>&& output,
-        std::vector<std::unique_ptr<SingleProcessData>>&& per_process_data);
+        std::vector<std::unique_ptr<SingleProcessData>>&& per_process_data,
+        bool const initial_guess_extrapolation,
+        unsigned const checkpoint_each_steps,
+        std::string const& checkpoint_file,
+        double const steady_state_relative_tolerance,
+        unsigned const steady_state_steps,
+        bool const parallel_processes);
 
     bool loop();
 
+    //! Restores the solution vectors and the time/step counters from the
+    //! given checkpoint file before the loop starts, cf. the --restart-from
+    //! command line option.
+    void setRestartFile(std::string const& file_name)
+    {
+        _restart_file = file_name;
+    }
+
     ~UncoupledProcessesTimeLoop();
 
 private:
@@ -40,6 +55,42 @@ private:
     std::unique_ptr<NumLib::ITimeStepAlgorithm> _timestepper;
     std::unique_ptr<Output> _output;
     std::vector<std::unique_ptr<SingleProcessData>> _per_process_data;
+
+    //! Warm-start the nonlinear solver with a solution-history extrapolation
+    //! in time, cf. the <initial_guess_extrapolation> time loop option.
+    bool const _initial_guess_extrapolation;
+    //! Per-process solution of the second to last time step, kept for the
+    //! extrapolated initial guess.
+    std::vector<std::unique_ptr<GlobalVector>> _previous_solutions;
+    //! Size of the previous time step.
+    double _previous_dt = 0.0;
+
+    //! Write a checkpoint every this many time steps; zero disables
+    //! checkpointing. \see writeCheckpoint()
+    unsigned _checkpoint_each_steps = 0;
+    //! File the checkpoints are written to (atomically replaced).
+    std::string _checkpoint_file;
+    //! Checkpoint file to restore from at loop start; empty for a fresh run.
+    std::string _restart_file;
+
+    //! Steady-state detection: terminate the loop early when the relative
+    //! solution change of every process stays below this tolerance for
+    //! _steady_state_steps consecutive steps. Non-positive disables the
+    //! detection. \see the <steady_state_detection> time loop option.
+    double const _steady_state_relative_tolerance;
+    unsigned const _steady_state_steps;
+    unsigned _steady_state_counter = 0;
+
+    //! Solve the (independent) processes of one time step concurrently on
+    //! separate threads, cf. the <parallel_processes> time loop option.
+    bool const _parallel_processes;
+
+    //! Serializes the process solutions and time state into
+    //! _checkpoint_file.
+    void writeCheckpoint(double const t, std::size_t const timestep) const;
+    //! Restores the state written by writeCheckpoint(); returns the restored
+    //! (t, timestep) pair via the parameters and true on success.
+    bool readCheckpoint(double& t, std::size_t& timestep);
 };
 
 //! Builds an UncoupledProcessesTimeLoop from the given configuration.
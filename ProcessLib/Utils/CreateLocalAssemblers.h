@@ -8,6 +8,9 @@
 
 #pragma once
 
+#include <algorithm>
+#include <numeric>
+#include <typeindex>
 #include <vector>
 
 #include <logog/include/logog.hpp>
@@ -50,8 +53,65 @@ void createLocalAssemblers(
         std::forward<ExtraCtorArgs>(extra_ctor_args)...);
 }
 
+template <unsigned GlobalDim, template <typename, typename, unsigned>
+                              class LocalAssemblerImplementation,
+          typename LocalAssemblerInterface, typename... ExtraCtorArgs>
+void createLocalAssemblersInArena(
+    NumLib::LocalToGlobalIndexMap const& dof_table,
+    const unsigned shapefunction_order,
+    std::vector<MeshLib::Element*> const& mesh_elements,
+    LocalAssemblerArena& arena,
+    std::vector<LocalAssemblerInterface*>& local_assemblers,
+    ExtraCtorArgs&&... extra_ctor_args)
+{
+    using LocalDataInitializer =
+        LocalDataInitializer<LocalAssemblerInterface,
+                             LocalAssemblerImplementation, GlobalDim,
+                             ExtraCtorArgs...>;
+
+    DBUG("Create local assemblers in arena.");
+    local_assemblers.resize(mesh_elements.size());
+
+    LocalDataInitializer initializer(dof_table, shapefunction_order);
+
+    DBUG("Calling local assembler builder for all mesh elements.");
+    // The creation deliberately runs serially in element traversal order,
+    // such that the assemblers end up contiguously in the arena.
+    for (std::size_t id = 0; id < mesh_elements.size(); ++id) {
+        local_assemblers[id] = initializer.createInArena(
+            arena, id, *mesh_elements[id],
+            std::forward<ExtraCtorArgs>(extra_ctor_args)...);
+    }
+}
+
 }  // namespace detail
 
+/*! Computes an element iteration order bucketed by concrete element type.
+ *
+ * The returned vector is a permutation of the element ids in which all
+ * elements of the same concrete type---and thereby all local assemblers of
+ * the same template instantiation---are visited consecutively. Iterating the
+ * local assemblers in this order (cf.
+ * GlobalExecutor::executeMemberDereferencedInOrder()) turns the megamorphic
+ * virtual dispatch of mixed-element-type meshes into monomorphic runs. The
+ * element order within each bucket is preserved.
+ */
+inline std::vector<std::size_t> typeOrderedExecutionOrder(
+    std::vector<MeshLib::Element*> const& mesh_elements)
+{
+    std::vector<std::size_t> order(mesh_elements.size());
+    std::iota(order.begin(), order.end(), 0);
+
+    std::stable_sort(order.begin(), order.end(),
+                     [&mesh_elements](std::size_t const a, std::size_t const b)
+                     {
+                         return std::type_index(typeid(*mesh_elements[a])) <
+                                std::type_index(typeid(*mesh_elements[b]));
+                     });
+
+    return order;
+}
+
 /*! Creates local assemblers for each element of the given \c mesh.
  *
  * \tparam LocalAssemblerImplementation the individual local assembler type
@@ -99,4 +159,59 @@ void createLocalAssemblers(
     }
 }
 
+/*! Creates local assemblers for each element of the given \c mesh inside the
+ * given \c arena.
+ *
+ * In contrast to createLocalAssemblers() the assemblers are placed
+ * contiguously in element traversal order in the arena and the filled
+ * container holds non-owning pointers; the assemblers' lifetime is bound to
+ * the arena, which must therefore outlive the container. This is the opt-in
+ * path for processes where the assembly sweep is limited by cache misses on
+ * scattered heap allocations.
+ *
+ * \see LocalAssemblerArena
+ */
+template <template <typename, typename, unsigned>
+          class LocalAssemblerImplementation,
+          typename LocalAssemblerInterface, typename... ExtraCtorArgs>
+void createLocalAssemblersInArena(
+    const unsigned dimension,
+    std::vector<MeshLib::Element*> const& mesh_elements,
+    NumLib::LocalToGlobalIndexMap const& dof_table,
+    const unsigned shapefunction_order,
+    LocalAssemblerArena& arena,
+    std::vector<LocalAssemblerInterface*>& local_assemblers,
+    ExtraCtorArgs&&... extra_ctor_args)
+{
+    DBUG("Create local assemblers in arena.");
+
+    switch (dimension)
+    {
+        case 1:
+            detail::createLocalAssemblersInArena<1,
+                                                 LocalAssemblerImplementation>(
+                dof_table, shapefunction_order, mesh_elements, arena,
+                local_assemblers,
+                std::forward<ExtraCtorArgs>(extra_ctor_args)...);
+            break;
+        case 2:
+            detail::createLocalAssemblersInArena<2,
+                                                 LocalAssemblerImplementation>(
+                dof_table, shapefunction_order, mesh_elements, arena,
+                local_assemblers,
+                std::forward<ExtraCtorArgs>(extra_ctor_args)...);
+            break;
+        case 3:
+            detail::createLocalAssemblersInArena<3,
+                                                 LocalAssemblerImplementation>(
+                dof_table, shapefunction_order, mesh_elements, arena,
+                local_assemblers,
+                std::forward<ExtraCtorArgs>(extra_ctor_args)...);
+            break;
+        default:
+            OGS_FATAL(
+                "Meshes with dimension greater than three are not supported.");
+    }
+}
+
 }  // ProcessLib
@@ -8,9 +8,15 @@
 
 #pragma once
 
+#include <cmath>
+#include <map>
+#include <memory>
+#include <typeindex>
 #include <vector>
 
 #include "MeshLib/Elements/Element.h"
+#include "MeshLib/Node.h"
+#include "NumLib/Fem/CoordinatesMapping/AffineElementTraits.h"
 #include "NumLib/Fem/FiniteElement/TemplateIsoparametric.h"
 
 
@@ -31,13 +37,39 @@ std::vector<typename ShapeMatricesType::ShapeMatrices> initShapeMatrices(
 
     unsigned const n_integration_points = integration_method.getNumberOfPoints();
 
+    // Affine fast path: for the linear simplex elements the Jacobian---and
+    // with it detJ, invJ, dNdr and dNdx---is constant across the element,
+    // so the mapping is computed at the first integration point only and
+    // reused; the remaining points evaluate just N. The axisymmetric
+    // integral measure varies with position, hence that case stays on the
+    // general path.
+    bool const affine_element =
+        NumLib::IsAffineElement<ShapeFunction>::value && !is_axially_symmetric;
+
     shape_matrices.reserve(n_integration_points);
     for (unsigned ip = 0; ip < n_integration_points; ++ip) {
         shape_matrices.emplace_back(ShapeFunction::DIM, GlobalDim,
                                      ShapeFunction::NPOINTS);
-        fe.computeShapeFunctions(
+        if (!affine_element || ip == 0)
+        {
+            fe.computeShapeFunctions(
+                    integration_method.getWeightedPoint(ip).getCoords(),
+                    shape_matrices[ip], GlobalDim, is_axially_symmetric);
+        }
+        else
+        {
+            fe.template computeShapeFunctions<NumLib::ShapeMatrixType::N>(
                 integration_method.getWeightedPoint(ip).getCoords(),
                 shape_matrices[ip], GlobalDim, is_axially_symmetric);
+            auto const& first = shape_matrices[0];
+            auto& current = shape_matrices[ip];
+            current.dNdr = first.dNdr;
+            current.J = first.J;
+            current.detJ = first.detJ;
+            current.invJ = first.invJ;
+            current.dNdx = first.dNdx;
+            current.integralMeasure = first.integralMeasure;
+        }
     }
 
     return shape_matrices;
@@ -57,3 +89,111 @@ double interpolateXCoordinate(
 }
 
 } // ProcessLib
+
+namespace ProcessLib
+{
+/// Cache sharing one set of shape matrices between geometrically congruent
+/// elements, cf. initShapeMatricesShared().
+///
+/// On structured meshes (regular generators) all elements of one type are
+/// translates of each other and their shape matrices are identical; keying
+/// on the node offsets relative to the first node deduplicates the
+/// per-element storage to one instance per distinct geometry.
+class ShapeMatrixCache final
+{
+public:
+    //! Key: quantized node-coordinate offsets relative to the first node.
+    using Key = std::vector<long long>;
+
+    template <typename ShapeMatrices>
+    using Store =
+        std::map<Key, std::shared_ptr<std::vector<ShapeMatrices> const>>;
+
+    //! Computes the congruence key of the given element; elements with equal
+    //! keys have equal shape matrices. The tolerance is the quantization
+    //! step of the node offsets.
+    static Key computeKey(MeshLib::Element const& e,
+                          double const tolerance = 1e-10)
+    {
+        Key key;
+        key.reserve(3 * e.getNumberOfNodes() + 1);
+        key.push_back(static_cast<long long>(e.getCellType()));
+        auto const& n0 = *e.getNode(0);
+        for (unsigned i = 1; i < e.getNumberOfNodes(); ++i) {
+            auto const& n = *e.getNode(i);
+            for (unsigned d = 0; d < 3; ++d)
+                key.push_back(static_cast<long long>(
+                    std::llround((n[d] - n0[d]) / tolerance)));
+        }
+        return key;
+    }
+
+    template <typename ShapeMatrices>
+    Store<ShapeMatrices>& getStore()
+    {
+        static_assert(sizeof(ShapeMatrices) > 0, "");
+        // One store per shape-matrix type, held per cache instance.
+        auto& store_ptr = _stores[std::type_index(typeid(ShapeMatrices))];
+        if (!store_ptr)
+            store_ptr.reset(new TypedStore<ShapeMatrices>);
+        return static_cast<TypedStore<ShapeMatrices>&>(*store_ptr).store;
+    }
+
+private:
+    struct StoreBase
+    {
+        virtual ~StoreBase() = default;
+    };
+    template <typename ShapeMatrices>
+    struct TypedStore : StoreBase
+    {
+        Store<ShapeMatrices> store;
+    };
+
+    std::map<std::type_index, std::unique_ptr<StoreBase>> _stores;
+};
+
+/*! Geometry-deduplicated variant of initShapeMatrices().
+ *
+ * Looks the element's congruence key up in the given cache and returns the
+ * shared shape matrices of an earlier congruent element if present; only
+ * distinct geometries are computed and stored. On structured meshes this
+ * shrinks the shape-matrix storage from one instance per element to one per
+ * element type.
+ */
+template <typename ShapeFunction, typename ShapeMatricesType,
+          typename IntegrationMethod, unsigned GlobalDim>
+std::shared_ptr<std::vector<typename ShapeMatricesType::ShapeMatrices> const>
+initShapeMatricesShared(MeshLib::Element const& e,
+                        bool is_axially_symmetric,
+                        IntegrationMethod const& integration_method,
+                        ShapeMatrixCache& cache)
+{
+    using ShapeMatrices = typename ShapeMatricesType::ShapeMatrices;
+
+    // Axisymmetric shape matrices depend on the absolute radius, i.e., they
+    // are not translation invariant; no sharing in that case.
+    if (is_axially_symmetric) {
+        return std::shared_ptr<std::vector<ShapeMatrices> const>(
+            new std::vector<ShapeMatrices>(
+                initShapeMatrices<ShapeFunction, ShapeMatricesType,
+                                  IntegrationMethod, GlobalDim>(
+                    e, is_axially_symmetric, integration_method)));
+    }
+
+    auto& store = cache.getStore<ShapeMatrices>();
+    auto const key = ShapeMatrixCache::computeKey(e);
+    auto const it = store.find(key);
+    if (it != store.end())
+        return it->second;
+
+    std::shared_ptr<std::vector<ShapeMatrices> const> shape_matrices(
+        new std::vector<ShapeMatrices>(
+            initShapeMatrices<ShapeFunction, ShapeMatricesType,
+                              IntegrationMethod, GlobalDim>(
+                e, is_axially_symmetric, integration_method)));
+    store.emplace(key, shape_matrices);
+    return shape_matrices;
+}
+
+}  // namespace ProcessLib
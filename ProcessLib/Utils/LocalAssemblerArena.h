@@ -0,0 +1,108 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace ProcessLib
+{
+
+/// A chunked bump-pointer arena owning the local assemblers of one process.
+///
+/// Objects created via create() are placed contiguously in creation order,
+/// i.e., creating the local assemblers in element traversal order places them
+/// adjacently in memory and the assembly sweep streams through the arena
+/// instead of chasing millions of individual heap allocations.
+///
+/// The arena owns the created objects: their destructors are run (in reverse
+/// creation order) and the memory is released wholesale when the arena is
+/// destroyed. Pointers handed out by create() are therefore non-owning views
+/// and must not outlive the arena.
+class LocalAssemblerArena final
+{
+public:
+    explicit LocalAssemblerArena(
+        std::size_t const chunk_size = 4 * 1024 * 1024)
+        : _chunk_size(chunk_size)
+    {
+    }
+
+    LocalAssemblerArena(LocalAssemblerArena const&) = delete;
+    LocalAssemblerArena& operator=(LocalAssemblerArena const&) = delete;
+
+    ~LocalAssemblerArena()
+    {
+        for (auto it = _finalizers.rbegin(); it != _finalizers.rend(); ++it)
+            it->destroy(it->object);
+    }
+
+    /// Constructs an object of type \c T inside the arena and returns a
+    /// non-owning pointer to it.
+    template <typename T, typename... Args>
+    T* create(Args&&... args)
+    {
+        void* mem = allocate(sizeof(T), alignof(T));
+        T* obj = new (mem) T(std::forward<Args>(args)...);
+        _finalizers.push_back(
+            {obj, [](void* p) { static_cast<T*>(p)->~T(); }});
+        return obj;
+    }
+
+    /// Total number of bytes reserved by the arena's chunks.
+    std::size_t reservedBytes() const
+    {
+        return _chunks.size() * _chunk_size;
+    }
+
+private:
+    void* allocate(std::size_t const size, std::size_t const alignment)
+    {
+        // Objects larger than a chunk are not supported; local assemblers are
+        // small compared to the chunk size.
+        auto const aligned_pos = alignUp(_pos, alignment);
+        if (_chunks.empty() || aligned_pos + size > _chunk_size) {
+            _chunks.emplace_back(new char[_chunk_size]);
+            _pos = 0;
+            return allocateInCurrentChunk(size, alignment);
+        }
+        _pos = aligned_pos + size;
+        return _chunks.back().get() + aligned_pos;
+    }
+
+    void* allocateInCurrentChunk(std::size_t const size,
+                                 std::size_t const alignment)
+    {
+        auto const aligned_pos = alignUp(_pos, alignment);
+        _pos = aligned_pos + size;
+        return _chunks.back().get() + aligned_pos;
+    }
+
+    static std::size_t alignUp(std::size_t const pos,
+                               std::size_t const alignment)
+    {
+        return (pos + alignment - 1) / alignment * alignment;
+    }
+
+    struct Finalizer
+    {
+        void* object;
+        void (*destroy)(void*);
+    };
+
+    std::size_t const _chunk_size;
+    std::vector<std::unique_ptr<char[]>> _chunks;
+    std::size_t _pos = 0;
+    std::vector<Finalizer> _finalizers;
+};
+
+}  // namespace ProcessLib
@@ -18,6 +18,7 @@
 
 #include "MeshLib/Elements/Elements.h"
 #include "NumLib/DOF/LocalToGlobalIndexMap.h"
+#include "ProcessLib/Utils/LocalAssemblerArena.h"
 #include "NumLib/Fem/Integration/GaussIntegrationPolicy.h"
 
 #ifndef OGS_MAX_ELEMENT_DIM
@@ -307,13 +308,25 @@ public:
                     ConstructorArgs&&... args) const
     {
         auto const type_idx = std::type_index(typeid(mesh_item));
-        auto const it = _builder.find(type_idx);
 
-        if (it != _builder.end())
+        // Memoized dispatch: meshes contain long runs of one element type
+        // (guaranteed after type-ordered creation), so the previous
+        // element's builder almost always matches and the per-element map
+        // lookup disappears from the create loop.
+        if (_last_builder == nullptr || type_idx != _last_type_idx)
+        {
+            auto const memo_it = _builder.find(type_idx);
+            _last_builder =
+                (memo_it != _builder.end()) ? &memo_it->second : nullptr;
+            _last_type_idx = type_idx;
+        }
+
+        if (_last_builder != nullptr)
         {
             auto const num_local_dof = _dof_table.getNumberOfElementDOF(id);
-            data_ptr = it->second(mesh_item, num_local_dof,
-                                  std::forward<ConstructorArgs>(args)...);
+            data_ptr = _last_builder->on_heap(
+                mesh_item, num_local_dof,
+                std::forward<ConstructorArgs>(args)...);
         }
         else
         {
@@ -326,11 +339,51 @@ public:
         }
     }
 
+    /// Creates a new local assembler data inside the given \c arena instead
+    /// of on the heap, cf. createLocalAssemblersInArena().
+    ///
+    /// The returned pointer is non-owning; the assembler's lifetime is bound
+    /// to the arena.
+    LocalAssemblerInterface* createInArena(LocalAssemblerArena& arena,
+                                           std::size_t const id,
+                                           MeshLib::Element const& mesh_item,
+                                           ConstructorArgs&&... args) const
+    {
+        auto const type_idx = std::type_index(typeid(mesh_item));
+        auto const it = _builder.find(type_idx);
+
+        if (it == _builder.end())
+        {
+            OGS_FATAL(
+                "You are trying to build a local assembler for an unknown mesh "
+                "element type (%s)."
+                " Maybe you have disabled this mesh element type in your build "
+                "configuration.",
+                type_idx.name());
+        }
+
+        auto const num_local_dof = _dof_table.getNumberOfElementDOF(id);
+        return it->second.in_arena(arena, mesh_item, num_local_dof,
+                                   std::forward<ConstructorArgs>(args)...);
+    }
+
 private:
-    using LADataBuilder =
+    /// Type-erased constructors for one concrete local assembler data type;
+    /// on_heap is the conventional path, in_arena places the assembler in a
+    /// LocalAssemblerArena.
+    struct LADataBuilder
+    {
         std::function<LADataIntfPtr(MeshLib::Element const& e,
                                     std::size_t const local_matrix_size,
-                                    ConstructorArgs&&...)>;
+                                    ConstructorArgs&&...)>
+            on_heap;
+        std::function<LocalAssemblerInterface*(LocalAssemblerArena& arena,
+                                               MeshLib::Element const& e,
+                                               std::size_t const
+                                                   local_matrix_size,
+                                               ConstructorArgs&&...)>
+            in_arena;
+    };
 
     template <typename ShapeFunction>
     using IntegrationMethod = typename NumLib::GaussIntegrationPolicy<
@@ -358,6 +411,10 @@ private:
 
     NumLib::LocalToGlobalIndexMap const& _dof_table;
 
+    //! Memoized last dispatch, cf. operator().
+    mutable std::type_index _last_type_idx = std::type_index(typeid(void));
+    mutable LADataBuilder const* _last_builder = nullptr;
+
     // local assembler builder implementations.
 private:
     /// Generates a function that creates a new LocalAssembler of type
@@ -368,20 +425,28 @@ private:
     template <typename ShapeFunction>
     static LADataBuilder makeLocalAssemblerBuilder(std::true_type*)
     {
-        return [](MeshLib::Element const& e,
-                  std::size_t const local_matrix_size,
-                  ConstructorArgs&&... args) {
-            return LADataIntfPtr{new LAData<ShapeFunction>{
-                e, local_matrix_size, std::forward<ConstructorArgs>(args)...}};
-        };
+        return {[](MeshLib::Element const& e,
+                   std::size_t const local_matrix_size,
+                   ConstructorArgs&&... args) {
+                    return LADataIntfPtr{new LAData<ShapeFunction>{
+                        e, local_matrix_size,
+                        std::forward<ConstructorArgs>(args)...}};
+                },
+                [](LocalAssemblerArena& arena, MeshLib::Element const& e,
+                   std::size_t const local_matrix_size,
+                   ConstructorArgs&&... args) -> LocalAssemblerInterface* {
+                    return arena.create<LAData<ShapeFunction>>(
+                        e, local_matrix_size,
+                        std::forward<ConstructorArgs>(args)...);
+                }};
     }
 
-    /// Returns nullptr for shape functions whose dimensions are less than the
-    /// global dimension.
+    /// Returns empty builders for shape functions whose dimensions are less
+    /// than the global dimension.
     template <typename ShapeFunction>
     static LADataBuilder makeLocalAssemblerBuilder(std::false_type*)
     {
-        return nullptr;
+        return {};
     }
 };
 
@@ -0,0 +1,74 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ */
+
+#pragma once
+
+#include <vector>
+
+#include <Eigen/Dense>
+
+#include "MathLib/LinAlg/Eigen/EigenMapTools.h"
+#include "NumLib/DOF/DOFTableUtil.h"
+#include "ProcessLib/LocalAssemblerInterface.h"
+
+namespace ProcessLib
+{
+
+/// Applies the stiffness operator \f$ y = K x \f$ without an assembled global
+/// matrix by re-running the local assembler kernels element by element and
+/// scattering the local products.
+///
+/// This trades the memory footprint of the assembled CSR matrix for repeated
+/// element computations, which pays off for Laplacian-dominated processes
+/// (GroundwaterFlow, HeatConduction) on memory-constrained runs; combine with
+/// MathLib::matrixFreeCG().
+///
+/// \note Only the \c K contribution of the local assemblers enters; processes
+/// with mass matrices need the time-discretized combination instead.
+template <typename LocalAssemblerCollection>
+void applyOperatorMatrixFree(LocalAssemblerCollection const& local_assemblers,
+                             NumLib::LocalToGlobalIndexMap const& dof_table,
+                             double const t, Eigen::VectorXd const& x,
+                             Eigen::VectorXd& y)
+{
+    y.setZero(x.size());
+
+    std::vector<GlobalIndexType> indices;
+    std::vector<double> local_x;
+    std::vector<double> local_M_data;
+    std::vector<double> local_K_data;
+    std::vector<double> local_b_data;
+
+    for (std::size_t id = 0; id < local_assemblers.size(); ++id) {
+        NumLib::getIndices(id, dof_table, indices);
+
+        local_x.resize(indices.size());
+        for (std::size_t i = 0; i < indices.size(); ++i)
+            local_x[i] = x[indices[i]];
+
+        local_M_data.clear();
+        local_K_data.clear();
+        local_b_data.clear();
+        local_assemblers[id]->assemble(t, local_x, local_M_data, local_K_data,
+                                       local_b_data);
+
+        if (local_K_data.empty())
+            continue;
+
+        auto const num_r_c = indices.size();
+        auto const local_K = MathLib::toMatrix(local_K_data, num_r_c, num_r_c);
+        auto const local_x_vec =
+            MathLib::toVector<Eigen::VectorXd>(local_x, num_r_c);
+        Eigen::VectorXd const local_y = local_K * local_x_vec;
+
+        for (std::size_t i = 0; i < indices.size(); ++i)
+            y[indices[i]] += local_y[i];
+    }
+}
+
+}  // namespace ProcessLib
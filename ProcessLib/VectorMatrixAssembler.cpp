@@ -11,10 +11,61 @@
 
 #include <cassert>
 
+#include "BaseLib/RunTime.h"
 #include "NumLib/DOF/DOFTableUtil.h"
 #include "MathLib/LinAlg/Eigen/EigenMapTools.h"
 #include "LocalAssemblerInterface.h"
 
+namespace
+{
+// Temporary data only stored here in order to avoid frequent memory
+// reallocations. One set of buffers per thread keeps the compute stage free of
+// shared mutable state.
+struct LocalDataBuffers
+{
+    std::vector<GlobalIndexType> indices;
+    std::vector<double> local_x;
+    std::vector<double> local_xdot;
+    std::vector<double> local_M_data;
+    std::vector<double> local_K_data;
+    std::vector<double> local_b_data;
+    std::vector<double> local_Jac_data;
+};
+
+LocalDataBuffers& getLocalDataBuffers()
+{
+    static thread_local LocalDataBuffers buffers;
+    return buffers;
+}
+//! Adds the mapped local block through the offset table when available,
+//! through the searching add() otherwise (Eigen backend); the PETSc backend
+//! always uses add().
+#ifndef USE_PETSC
+template <typename LocalMatrix>
+void addLocalMatrix(
+    GlobalMatrix& matrix,
+    NumLib::LocalToGlobalIndexMap::RowColumnIndices const& r_c_indices,
+    LocalMatrix const& local_matrix,
+    std::vector<std::ptrdiff_t> const* const offsets)
+{
+    if (offsets != nullptr && matrix.isStructureFrozen())
+        matrix.addWithOffsets(*offsets, local_matrix);
+    else
+        matrix.add(r_c_indices, local_matrix);
+}
+#else
+template <typename LocalMatrix>
+void addLocalMatrix(
+    GlobalMatrix& matrix,
+    NumLib::LocalToGlobalIndexMap::RowColumnIndices const& r_c_indices,
+    LocalMatrix const& local_matrix,
+    void const* const /*offsets*/)
+{
+    matrix.add(r_c_indices, local_matrix);
+}
+#endif
+}  // anonymous namespace
+
 namespace ProcessLib
 {
 VectorMatrixAssembler::VectorMatrixAssembler(
@@ -23,36 +74,160 @@ VectorMatrixAssembler::VectorMatrixAssembler(
 {
 }
 
+#ifndef USE_PETSC
+std::vector<std::ptrdiff_t> const* VectorMatrixAssembler::frozenAddOffsets(
+    OffsetTarget const target, std::size_t const mesh_item_id,
+    GlobalMatrix const& matrix, std::vector<GlobalIndexType> const& indices)
+{
+    if (!matrix.isStructureFrozen())
+        return nullptr;
+
+    // One table set per target matrix: M, K and Jac do not generally share
+    // a structure (a lumped mass matrix is diagonal-only), so each table
+    // is built from and applied to exactly one matrix. A changed nonzero
+    // count means a fresh or restructured matrix; its tables are rebuilt.
+    auto& target_tables = _frozen_offsets[static_cast<unsigned>(target)];
+    auto const nonzeros =
+        static_cast<std::size_t>(matrix.getRawMatrix().nonZeros());
+    if (nonzeros != target_tables.nonzeros) {
+        target_tables.tables.clear();
+        target_tables.state.clear();
+        target_tables.nonzeros = nonzeros;
+    }
+    if (mesh_item_id >= target_tables.tables.size()) {
+        target_tables.tables.resize(mesh_item_id + 1);
+        target_tables.state.resize(mesh_item_id + 1, 0);
+    }
+    if (target_tables.state[mesh_item_id] == 0) {
+        target_tables.tables[mesh_item_id] =
+            matrix.buildAddOffsets(indices, indices);
+        target_tables.state[mesh_item_id] =
+            target_tables.tables[mesh_item_id].empty() ? 2 : 1;
+    }
+    if (target_tables.state[mesh_item_id] != 1)
+        return nullptr;
+    return &target_tables.tables[mesh_item_id];
+}
+#endif  // USE_PETSC
+
+void VectorMatrixAssembler::beginStagedAssembly()
+{
+    _staged_mode = true;
+}
+
+void VectorMatrixAssembler::flushStagedAssembly(GlobalMatrix* M,
+                                                GlobalMatrix* K,
+                                                GlobalVector* b,
+                                                GlobalMatrix* Jac)
+{
+    _staged_mode = false;
+
+    for (auto& staged : _staged_contributions)
+    {
+        if (!staged.valid)
+            continue;
+        staged.valid = false;
+
+        auto const num_r_c = staged.indices.size();
+        auto const r_c_indices =
+            NumLib::LocalToGlobalIndexMap::RowColumnIndices(staged.indices,
+                                                            staged.indices);
+
+        if (M != nullptr && !staged.local_M_data.empty()) {
+            auto const local_M =
+                MathLib::toMatrix(staged.local_M_data, num_r_c, num_r_c);
+            M->add(r_c_indices, local_M);
+        }
+        if (K != nullptr && !staged.local_K_data.empty()) {
+            auto const local_K =
+                MathLib::toMatrix(staged.local_K_data, num_r_c, num_r_c);
+            K->add(r_c_indices, local_K);
+        }
+        if (b != nullptr && !staged.local_b_data.empty()) {
+            assert(staged.local_b_data.size() == num_r_c);
+            b->add(staged.indices, staged.local_b_data);
+        }
+        if (Jac != nullptr && !staged.local_Jac_data.empty()) {
+            auto const local_Jac =
+                MathLib::toMatrix(staged.local_Jac_data, num_r_c, num_r_c);
+            Jac->add(r_c_indices, local_Jac);
+        }
+    }
+}
+
 void VectorMatrixAssembler::assemble(
     const std::size_t mesh_item_id, LocalAssemblerInterface& local_assembler,
     const NumLib::LocalToGlobalIndexMap& dof_table, const double t,
     const GlobalVector& x, GlobalMatrix& M, GlobalMatrix& K, GlobalVector& b)
 {
-    auto const indices = NumLib::getIndices(mesh_item_id, dof_table);
-    auto const local_x = x.get(indices);
+    if (_element_active != nullptr && !(*_element_active)[mesh_item_id])
+        return;
+
+    BaseLib::RunTime element_timer;
+    if (_element_costs != nullptr)
+        element_timer.start();
 
-    _local_M_data.clear();
-    _local_K_data.clear();
-    _local_b_data.clear();
+    auto& buffers = getLocalDataBuffers();
+    auto& indices = buffers.indices;
+    auto& local_x = buffers.local_x;
+    auto& local_M_data = buffers.local_M_data;
+    auto& local_K_data = buffers.local_K_data;
+    auto& local_b_data = buffers.local_b_data;
 
-    local_assembler.assemble(t, local_x, _local_M_data, _local_K_data, _local_b_data);
+    NumLib::getIndices(mesh_item_id, dof_table, indices);
+    x.get(indices, local_x);
+
+    local_M_data.clear();
+    local_K_data.clear();
+    local_b_data.clear();
+
+    local_assembler.assemble(t, local_x, local_M_data, local_K_data,
+                             local_b_data);
 
     auto const num_r_c = indices.size();
     auto const r_c_indices =
         NumLib::LocalToGlobalIndexMap::RowColumnIndices(indices, indices);
 
-    if (!_local_M_data.empty()) {
-        auto const local_M = MathLib::toMatrix(_local_M_data, num_r_c, num_r_c);
-        M.add(r_c_indices, local_M);
-    }
-    if (!_local_K_data.empty()) {
-        auto const local_K = MathLib::toMatrix(_local_K_data, num_r_c, num_r_c);
-        K.add(r_c_indices, local_K);
-    }
-    if (!_local_b_data.empty()) {
-        assert(_local_b_data.size() == num_r_c);
-        b.add(indices, _local_b_data);
+    std::lock_guard<std::mutex> const scatter_lock(_scatter_mutex);
+
+    if (_staged_mode) {
+        if (mesh_item_id >= _staged_contributions.size())
+            _staged_contributions.resize(mesh_item_id + 1);
+        auto& staged = _staged_contributions[mesh_item_id];
+        staged.valid = true;
+        staged.indices = indices;
+        staged.local_M_data = local_M_data;
+        staged.local_K_data = local_K_data;
+        staged.local_b_data = local_b_data;
+        staged.local_Jac_data.clear();
+    } else {
+#ifndef USE_PETSC
+        auto const* const offsets_M =
+            frozenAddOffsets(OffsetTarget::M, mesh_item_id, M, indices);
+        auto const* const offsets_K =
+            frozenAddOffsets(OffsetTarget::K, mesh_item_id, K, indices);
+#else
+        void const* const offsets_M = nullptr;
+        void const* const offsets_K = nullptr;
+#endif
+        if (!local_M_data.empty()) {
+            auto const local_M =
+                MathLib::toMatrix(local_M_data, num_r_c, num_r_c);
+            addLocalMatrix(M, r_c_indices, local_M, offsets_M);
+        }
+        if (!local_K_data.empty()) {
+            auto const local_K =
+                MathLib::toMatrix(local_K_data, num_r_c, num_r_c);
+            addLocalMatrix(K, r_c_indices, local_K, offsets_K);
+        }
+        if (!local_b_data.empty()) {
+            assert(local_b_data.size() == num_r_c);
+            b.add(indices, local_b_data);
+        }
     }
+
+    if (_element_costs != nullptr)
+        (*_element_costs)[mesh_item_id] += element_timer.elapsed();
 }
 
 void VectorMatrixAssembler::assembleWithJacobian(
@@ -62,44 +237,91 @@ void VectorMatrixAssembler::assembleWithJacobian(
     const double dx_dx, GlobalMatrix& M, GlobalMatrix& K, GlobalVector& b,
     GlobalMatrix& Jac)
 {
-    auto const indices = NumLib::getIndices(mesh_item_id, dof_table);
-    auto const local_x = x.get(indices);
-    auto const local_xdot = xdot.get(indices);
+    if (_element_active != nullptr && !(*_element_active)[mesh_item_id])
+        return;
+
+    BaseLib::RunTime element_timer;
+    if (_element_costs != nullptr)
+        element_timer.start();
+
+    auto& buffers = getLocalDataBuffers();
+    auto& indices = buffers.indices;
+    auto& local_x = buffers.local_x;
+    auto& local_xdot = buffers.local_xdot;
+    auto& local_M_data = buffers.local_M_data;
+    auto& local_K_data = buffers.local_K_data;
+    auto& local_b_data = buffers.local_b_data;
+    auto& local_Jac_data = buffers.local_Jac_data;
 
-    _local_M_data.clear();
-    _local_K_data.clear();
-    _local_b_data.clear();
-    _local_Jac_data.clear();
+    NumLib::getIndices(mesh_item_id, dof_table, indices);
+    x.get(indices, local_x);
+    xdot.get(indices, local_xdot);
+
+    local_M_data.clear();
+    local_K_data.clear();
+    local_b_data.clear();
+    local_Jac_data.clear();
 
     _jacobian_assembler->assembleWithJacobian(
-        local_assembler, t, local_x, local_xdot, dxdot_dx, dx_dx, _local_M_data,
-        _local_K_data, _local_b_data, _local_Jac_data);
+        local_assembler, t, local_x, local_xdot, dxdot_dx, dx_dx, local_M_data,
+        local_K_data, local_b_data, local_Jac_data);
 
     auto const num_r_c = indices.size();
     auto const r_c_indices =
         NumLib::LocalToGlobalIndexMap::RowColumnIndices(indices, indices);
 
-    if (!_local_M_data.empty()) {
-        auto const local_M = MathLib::toMatrix(_local_M_data, num_r_c, num_r_c);
-        M.add(r_c_indices, local_M);
-    }
-    if (!_local_K_data.empty()) {
-        auto const local_K = MathLib::toMatrix(_local_K_data, num_r_c, num_r_c);
-        K.add(r_c_indices, local_K);
-    }
-    if (!_local_b_data.empty()) {
-        assert(_local_b_data.size() == num_r_c);
-        b.add(indices, _local_b_data);
-    }
-    if (!_local_Jac_data.empty()) {
-        auto const local_Jac =
-            MathLib::toMatrix(_local_Jac_data, num_r_c, num_r_c);
-        Jac.add(r_c_indices, local_Jac);
-    } else {
+    if (local_Jac_data.empty()) {
         OGS_FATAL(
             "No Jacobian has been assembled! This might be due to programming "
             "errors in the local assembler of the current process.");
     }
+
+    std::lock_guard<std::mutex> const scatter_lock(_scatter_mutex);
+
+    if (_staged_mode) {
+        if (mesh_item_id >= _staged_contributions.size())
+            _staged_contributions.resize(mesh_item_id + 1);
+        auto& staged = _staged_contributions[mesh_item_id];
+        staged.valid = true;
+        staged.indices = indices;
+        staged.local_M_data = local_M_data;
+        staged.local_K_data = local_K_data;
+        staged.local_b_data = local_b_data;
+        staged.local_Jac_data = local_Jac_data;
+    } else {
+#ifndef USE_PETSC
+        auto const* const offsets_M =
+            frozenAddOffsets(OffsetTarget::M, mesh_item_id, M, indices);
+        auto const* const offsets_K =
+            frozenAddOffsets(OffsetTarget::K, mesh_item_id, K, indices);
+        auto const* const offsets_Jac =
+            frozenAddOffsets(OffsetTarget::Jac, mesh_item_id, Jac, indices);
+#else
+        void const* const offsets_M = nullptr;
+        void const* const offsets_K = nullptr;
+        void const* const offsets_Jac = nullptr;
+#endif
+        if (!local_M_data.empty()) {
+            auto const local_M =
+                MathLib::toMatrix(local_M_data, num_r_c, num_r_c);
+            addLocalMatrix(M, r_c_indices, local_M, offsets_M);
+        }
+        if (!local_K_data.empty()) {
+            auto const local_K =
+                MathLib::toMatrix(local_K_data, num_r_c, num_r_c);
+            addLocalMatrix(K, r_c_indices, local_K, offsets_K);
+        }
+        if (!local_b_data.empty()) {
+            assert(local_b_data.size() == num_r_c);
+            b.add(indices, local_b_data);
+        }
+        auto const local_Jac =
+            MathLib::toMatrix(local_Jac_data, num_r_c, num_r_c);
+        addLocalMatrix(Jac, r_c_indices, local_Jac, offsets_Jac);
+    }
+
+    if (_element_costs != nullptr)
+        (*_element_costs)[mesh_item_id] += element_timer.elapsed();
 }
 
 }  // ProcessLib
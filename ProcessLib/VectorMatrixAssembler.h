@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include <mutex>
 #include <vector>
 #include "NumLib/NumericsConfig.h"
 #include "AbstractJacobianAssembler.h"
@@ -26,12 +27,53 @@ class LocalAssemblerInterface;
 //!
 //! The methods of this class get the global matrices and vectors as input and
 //! pass only local data on to the local assemblers.
+//!
+//! Assembly is split into a reentrant compute stage working on thread-local
+//! buffers and a serialized scatter stage adding the local contributions to
+//! the global matrices and vectors. Thereby the assemble() methods can be
+//! invoked concurrently for different mesh items, e.g., from
+//! NumLib::ParallelExecutor, provided that the used local assemblers and
+//! Jacobian assembler are reentrant, too.
 class VectorMatrixAssembler final
 {
 public:
     explicit VectorMatrixAssembler(
         std::unique_ptr<AbstractJacobianAssembler>&& jacobian_assembler);
 
+    //! Enables per-element cost measurement: every assemble call adds its
+    //! wall time to the entry of its mesh item in the given vector (one
+    //! entry per element; each element is assembled by exactly one thread).
+    //! The vector is typically a cell property of the process's mesh, so
+    //! the accumulated costs ride along with the regular output and can
+    //! feed the weighted partitioner. Pass nullptr to disable.
+    void setCostVector(std::vector<double>* const element_costs)
+    {
+        _element_costs = element_costs;
+    }
+
+    //! Switches subsequent assemble calls to staged mode: the computed
+    //! local contributions are stored per element instead of being added to
+    //! the global system immediately, cf. flushStagedAssembly(). Used by
+    //! Process::assemble in deterministic parallel mode,
+    //! cf. BaseLib::setDeterministicParallelMode().
+    void beginStagedAssembly();
+
+    //! Adds all staged local contributions to the global system, ordered by
+    //! element id, and leaves staged mode. The fixed scatter order makes the
+    //! parallel assembly bitwise-reproducible; the staging buffers are kept
+    //! across calls. Null matrices/vectors are skipped (e.g. \c Jac outside
+    //! of Newton).
+    void flushStagedAssembly(GlobalMatrix* M, GlobalMatrix* K, GlobalVector* b,
+                             GlobalMatrix* Jac);
+
+    //! Sets the per-element activity flags; inactive elements are skipped
+    //! entirely (no local assembly, no scatter). Pass nullptr to make all
+    //! elements active again, cf. Process::setElementDeactivation().
+    void setActiveElements(std::vector<char> const* const element_active)
+    {
+        _element_active = element_active;
+    }
+
     //! Assembles\c M, \c K, and \c b.
     //! \remark Jacobian is not assembled here, see assembleWithJacobian().
     void assemble(std::size_t const mesh_item_id,
@@ -52,15 +94,73 @@ public:
                               GlobalMatrix& Jac);
 
 private:
-    // temporary data only stored here in order to avoid frequent memory
-    // reallocations.
-    std::vector<double> _local_M_data;
-    std::vector<double> _local_K_data;
-    std::vector<double> _local_b_data;
-    std::vector<double> _local_Jac_data;
+#ifndef USE_PETSC
+    //! Target matrix of a frozen-structure offset table,
+    //! cf. frozenAddOffsets(). The matrices of one process do not
+    //! generally share a structure (mass lumping leaves M diagonal-only),
+    //! so each target keeps its own tables.
+    enum class OffsetTarget : unsigned
+    {
+        M = 0,
+        K = 1,
+        Jac = 2
+    };
+
+    //! Returns the element's offset table for frozen-structure adds into
+    //! the given target matrix, built and validated lazily against exactly
+    //! that matrix; nullptr when the matrix is not frozen or the element's
+    //! block is not fully contained in its structure (the searching add()
+    //! handles those).
+    std::vector<std::ptrdiff_t> const* frozenAddOffsets(
+        OffsetTarget const target, std::size_t const mesh_item_id,
+        GlobalMatrix const& matrix,
+        std::vector<GlobalIndexType> const& indices);
+
+#endif
+
+    //! Serializes the scatter stage, i.e., the addition of the local
+    //! contributions to the global matrices and vectors.
+    std::mutex _scatter_mutex;
 
     //! Used to assemble the Jacobian.
     std::unique_ptr<AbstractJacobianAssembler> _jacobian_assembler;
+
+    //! Accumulated per-element assembly seconds, cf. setCostVector().
+    std::vector<double>* _element_costs = nullptr;
+
+    //! Per-element activity flags, cf. setActiveElements().
+    std::vector<char> const* _element_active = nullptr;
+
+    //! Per-element staged local contributions, cf. beginStagedAssembly().
+    struct StagedContribution
+    {
+        bool valid = false;
+        std::vector<GlobalIndexType> indices;
+        std::vector<double> local_M_data;
+        std::vector<double> local_K_data;
+        std::vector<double> local_b_data;
+        std::vector<double> local_Jac_data;
+    };
+
+    bool _staged_mode = false;
+    std::vector<StagedContribution> _staged_contributions;
+
+#ifndef USE_PETSC
+    //! Per-element value-array offset tables of one target matrix's frozen
+    //! structure, cf. EigenMatrix::addWithOffsets(). Built lazily on the
+    //! first frozen re-assembly of an element; elements whose block is not
+    //! fully contained in the structure (e.g. a lumped mass matrix) are
+    //! remembered as unavailable, and a changed nonzero count (fresh or
+    //! restructured matrix) drops everything.
+    struct FrozenOffsetTables
+    {
+        std::size_t nonzeros = 0;
+        std::vector<std::vector<std::ptrdiff_t>> tables;
+        //! 0: not built yet, 1: valid, 2: block not in the structure.
+        std::vector<signed char> state;
+    };
+    FrozenOffsetTables _frozen_offsets[3];  //!< indexed by OffsetTarget
+#endif
 };
 
 }   // namespace ProcessLib
@@ -0,0 +1,88 @@
+/**
+ * \brief  Micro-benchmark of the Kelvin-vector invariant kernels.
+ *
+ * Compares the hand-written deviatoric kernel against the projection-matrix
+ * product and times the invariant chain (deviatoric, J2, J3, equivalent
+ * stress) per evaluation---the inner-inner loop of the mechanics return
+ * mappings.
+ *
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "MaterialLib/SolidModels/KelvinVector.h"
+
+namespace
+{
+
+template <typename F>
+double timePerCall(F const& f, std::size_t const repetitions)
+{
+    auto const start = std::chrono::high_resolution_clock::now();
+    for (std::size_t i = 0; i < repetitions; ++i)
+        f(i);
+    auto const end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() /
+           repetitions;
+}
+
+template <int KelvinVectorSize>
+void benchmark(char const* const label)
+{
+    using Invariants = MaterialLib::SolidModels::Invariants<KelvinVectorSize>;
+    using KelvinVector = Eigen::Matrix<double, KelvinVectorSize, 1>;
+
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+    std::size_t const n = 4096;
+    std::vector<KelvinVector, Eigen::aligned_allocator<KelvinVector>> vs(n);
+    for (auto& v : vs)
+        for (int c = 0; c < KelvinVectorSize; ++c)
+            v[c] = dist(gen);
+
+    volatile double sink = 0.0;
+
+    double const t_projection = timePerCall(
+        [&](std::size_t const i) {
+            KelvinVector const d =
+                Invariants::deviatoric_projection * vs[i % n];
+            sink += d[0];
+        },
+        1 << 20);
+    double const t_kernel = timePerCall(
+        [&](std::size_t const i) {
+            KelvinVector const d = Invariants::deviatoric(vs[i % n]);
+            sink += d[0];
+        },
+        1 << 20);
+    double const t_chain = timePerCall(
+        [&](std::size_t const i) {
+            KelvinVector const d = Invariants::deviatoric(vs[i % n]);
+            sink += Invariants::J2(d) + Invariants::J3(d);
+        },
+        1 << 20);
+    (void)sink;
+
+    std::printf(
+        "%s: deviatoric projection %6.2f ns, kernel %6.2f ns (%.1fx), "
+        "invariant chain %6.2f ns\n",
+        label, t_projection, t_kernel, t_projection / t_kernel, t_chain);
+}
+
+}  // namespace
+
+int main()
+{
+    benchmark<4>("2D (Kelvin size 4)");
+    benchmark<6>("3D (Kelvin size 6)");
+    return 0;
+}
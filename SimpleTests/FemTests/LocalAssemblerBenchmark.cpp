@@ -0,0 +1,170 @@
+/**
+ * \brief  Micro-benchmark for local assembler kernels on synthetic elements.
+ *
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <cstdio>
+#include <memory>
+#include <vector>
+
+#include <logog/include/logog.hpp>
+
+#include "BaseLib/AllocationGuard.h"
+#include "BaseLib/LogogSimpleFormatter.h"
+#include "BaseLib/RunTime.h"
+#include "MeshLib/Elements/Hex.h"
+#include "MeshLib/Elements/Quad.h"
+#include "MeshLib/Elements/Tet.h"
+#include "MeshLib/Elements/Tri.h"
+#include "MeshLib/Node.h"
+#include "NumLib/Fem/Integration/GaussIntegrationPolicy.h"
+#include "NumLib/Fem/ShapeFunction/ShapeHex8.h"
+#include "NumLib/Fem/ShapeFunction/ShapeQuad4.h"
+#include "NumLib/Fem/ShapeFunction/ShapeTet4.h"
+#include "NumLib/Fem/ShapeFunction/ShapeTri3.h"
+#include "ProcessLib/GroundwaterFlow/GroundwaterFlowFEM.h"
+#include "ProcessLib/Parameter/Parameter.h"
+
+namespace
+{
+
+/// Constant scalar parameter without configuration machinery.
+struct ConstantScalar final : public ProcessLib::Parameter<double>
+{
+    explicit ConstantScalar(double const value)
+        : ProcessLib::Parameter<double>("benchmark_constant"),
+          _values(1, value)
+    {
+    }
+    bool isTimeDependent() const override { return false; }
+    unsigned getNumberOfComponents() const override { return 1; }
+    std::vector<double> const& operator()(
+        double const /*t*/,
+        ProcessLib::SpatialPosition const& /*pos*/) const override
+    {
+        return _values;
+    }
+
+private:
+    std::vector<double> const _values;
+};
+
+/// Benchmarks one local assembler type over the given element.
+template <typename ShapeFunction, unsigned GlobalDim>
+void benchmark(char const* const name, MeshLib::Element const& element,
+               unsigned const integration_order,
+               ProcessLib::GroundwaterFlow::GroundwaterFlowProcessData const&
+                   process_data)
+{
+    using IntegrationMethod = typename NumLib::GaussIntegrationPolicy<
+        typename ShapeFunction::MeshElement>::IntegrationMethod;
+    ProcessLib::GroundwaterFlow::LocalAssemblerData<
+        ShapeFunction, IntegrationMethod, GlobalDim>
+        assembler(element, ShapeFunction::NPOINTS, false, integration_order,
+                  process_data);
+
+    std::vector<double> const local_x(ShapeFunction::NPOINTS, 1.0);
+    std::vector<double> local_M, local_K, local_b;
+
+    // Warm-up establishes the buffer capacities.
+    local_K.clear();
+    assembler.assemble(0.0, local_x, local_M, local_K, local_b);
+
+    std::size_t const allocations_before =
+        BaseLib::AllocationGuard::allocationCount();
+
+    BaseLib::RunTime timer;
+    timer.start();
+    unsigned repetitions = 0;
+    do {
+        local_K.clear();
+        assembler.assemble(0.0, local_x, local_M, local_K, local_b);
+        ++repetitions;
+    } while (timer.elapsed() < 0.5);
+
+    std::size_t const allocations =
+        BaseLib::AllocationGuard::allocationCount() - allocations_before;
+
+    std::printf("%-8s order %u: %8.1f ns/element, %6.2f allocations/call\n",
+                name, integration_order,
+                timer.elapsed() / repetitions * 1e9,
+                static_cast<double>(allocations) / repetitions);
+}
+
+}  // anonymous namespace
+
+int main()
+{
+    LOGOG_INITIALIZE();
+    auto* const fmt = new BaseLib::LogogSimpleFormatter;
+    auto* const cout_target = new logog::Cout;
+    cout_target->SetFormatter(*fmt);
+
+    ConstantScalar const hydraulic_conductivity(1e-7);
+    ProcessLib::GroundwaterFlow::GroundwaterFlowProcessData const process_data(
+        hydraulic_conductivity);
+
+    {
+        auto** nodes = new MeshLib::Node*[4];
+        nodes[0] = new MeshLib::Node(0, 0, 0, 0);
+        nodes[1] = new MeshLib::Node(1, 0, 0, 1);
+        nodes[2] = new MeshLib::Node(1, 1, 0, 2);
+        nodes[3] = new MeshLib::Node(0, 1, 0, 3);
+        MeshLib::Quad const quad(nodes);
+        for (unsigned order = 1; order <= 3; ++order)
+            benchmark<NumLib::ShapeQuad4, 2>("Quad4", quad, order,
+                                             process_data);
+        for (unsigned i = 0; i < 4; ++i)
+            delete nodes[i];
+    }
+    {
+        auto** nodes = new MeshLib::Node*[3];
+        nodes[0] = new MeshLib::Node(0, 0, 0, 0);
+        nodes[1] = new MeshLib::Node(1, 0, 0, 1);
+        nodes[2] = new MeshLib::Node(0, 1, 0, 2);
+        MeshLib::Tri const tri(nodes);
+        for (unsigned order = 1; order <= 3; ++order)
+            benchmark<NumLib::ShapeTri3, 2>("Tri3", tri, order, process_data);
+        for (unsigned i = 0; i < 3; ++i)
+            delete nodes[i];
+    }
+    {
+        auto** nodes = new MeshLib::Node*[8];
+        nodes[0] = new MeshLib::Node(0, 0, 0, 0);
+        nodes[1] = new MeshLib::Node(1, 0, 0, 1);
+        nodes[2] = new MeshLib::Node(1, 1, 0, 2);
+        nodes[3] = new MeshLib::Node(0, 1, 0, 3);
+        nodes[4] = new MeshLib::Node(0, 0, 1, 4);
+        nodes[5] = new MeshLib::Node(1, 0, 1, 5);
+        nodes[6] = new MeshLib::Node(1, 1, 1, 6);
+        nodes[7] = new MeshLib::Node(0, 1, 1, 7);
+        MeshLib::Hex const hex(nodes);
+        for (unsigned order = 1; order <= 3; ++order)
+            benchmark<NumLib::ShapeHex8, 3>("Hex8", hex, order, process_data);
+        for (unsigned i = 0; i < 8; ++i)
+            delete nodes[i];
+    }
+    {
+        auto** nodes = new MeshLib::Node*[4];
+        nodes[0] = new MeshLib::Node(0, 0, 0, 0);
+        nodes[1] = new MeshLib::Node(1, 0, 0, 1);
+        nodes[2] = new MeshLib::Node(0, 1, 0, 2);
+        nodes[3] = new MeshLib::Node(0, 0, 1, 3);
+        MeshLib::Tet const tet(nodes);
+        for (unsigned order = 1; order <= 3; ++order)
+            benchmark<NumLib::ShapeTet4, 3>("Tet4", tet, order, process_data);
+        for (unsigned i = 0; i < 4; ++i)
+            delete nodes[i];
+    }
+
+    delete cout_target;
+    delete fmt;
+    LOGOG_SHUTDOWN();
+    return 0;
+}
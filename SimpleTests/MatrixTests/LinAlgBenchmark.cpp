@@ -0,0 +1,200 @@
+/**
+ * \brief  Micro-benchmarks for the linear algebra building blocks.
+ *
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <cstdio>
+#include <vector>
+
+#include <tclap/CmdLine.h>
+#include <logog/include/logog.hpp>
+
+#include "BaseLib/Deterministic.h"
+#include "BaseLib/LogogSimpleFormatter.h"
+#include "BaseLib/RunTime.h"
+#include "MathLib/LinAlg/Eigen/EigenMatrix.h"
+#include "MathLib/LinAlg/Eigen/EigenVector.h"
+#include "MathLib/LinAlg/LinAlg.h"
+
+namespace
+{
+
+/// Runs \c f repeatedly for at least \c min_time seconds and returns the
+/// time per repetition in seconds.
+template <typename F>
+double timeIt(F const& f, double const min_time = 0.5)
+{
+    // Warm-up.
+    f();
+
+    BaseLib::RunTime timer;
+    timer.start();
+    unsigned repetitions = 0;
+    do {
+        f();
+        ++repetitions;
+    } while (timer.elapsed() < min_time);
+    return timer.elapsed() / repetitions;
+}
+
+/// Five-point-stencil Laplacian on an n x n grid.
+void fillStencilMatrix(MathLib::EigenMatrix& A, std::size_t const n)
+{
+    auto const idx = [n](std::size_t i, std::size_t j) {
+        return static_cast<MathLib::EigenMatrix::IndexType>(i * n + j);
+    };
+    for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t j = 0; j < n; ++j) {
+            A.add(idx(i, j), idx(i, j), 4.0);
+            if (i > 0)
+                A.add(idx(i, j), idx(i - 1, j), -1.0);
+            if (i < n - 1)
+                A.add(idx(i, j), idx(i + 1, j), -1.0);
+            if (j > 0)
+                A.add(idx(i, j), idx(i, j - 1), -1.0);
+            if (j < n - 1)
+                A.add(idx(i, j), idx(i, j + 1), -1.0);
+        }
+    }
+}
+
+void benchmarkInsertionRate(std::size_t const n)
+{
+    std::size_t const n_entries = 5 * n * n - 4 * n;
+
+    auto const time_insert = timeIt([n]() {
+        MathLib::EigenMatrix A(n * n, 5);
+        fillStencilMatrix(A, n);
+    });
+
+    auto const time_update = [n]() {
+        MathLib::EigenMatrix A(n * n, 5);
+        fillStencilMatrix(A, n);
+        MathLib::LinAlg::finalizeAssembly(A);
+        return timeIt([&A, n]() {
+            A.setZero();
+            fillStencilMatrix(A, n);
+        });
+    }();
+
+    std::printf("insert  n=%8zu  first assembly: %8.3e s (%6.1f Mentries/s)"
+                "  frozen re-assembly: %8.3e s (%6.1f Mentries/s)\n",
+                n * n, time_insert, n_entries / time_insert / 1e6,
+                time_update, n_entries / time_update / 1e6);
+}
+
+void benchmarkSpMV(std::size_t const n)
+{
+    MathLib::EigenMatrix A(n * n, 5);
+    fillStencilMatrix(A, n);
+    MathLib::LinAlg::finalizeAssembly(A);
+
+    MathLib::EigenVector x(n * n);
+    MathLib::EigenVector y(n * n);
+    x.getRawVector().setRandom();
+
+    auto const time = timeIt([&]() { MathLib::LinAlg::matMult(A, x, y); });
+    auto const nnz = A.getRawMatrix().nonZeros();
+    // One multiply and add per nonzero; value + index traffic.
+    auto const gbytes = nnz * (sizeof(double) + sizeof(int)) / 1e9;
+    std::printf("spmv    n=%8zu  %8.3e s  %6.2f GFLOP/s  ~%6.2f GB/s\n",
+                n * n, time, 2.0 * nnz / time / 1e9, gbytes / time);
+}
+
+void benchmarkVectorOps(std::size_t const n)
+{
+    MathLib::EigenVector x(n);
+    MathLib::EigenVector y(n);
+    x.getRawVector().setRandom();
+    y.getRawVector().setRandom();
+
+    auto const time_axpy =
+        timeIt([&]() { MathLib::LinAlg::axpy(y, 1e-10, x); });
+    auto const time_norm = timeIt([&]() {
+        volatile double result = MathLib::LinAlg::norm2(x);
+        (void)result;
+    });
+    auto const time_fused = timeIt([&]() {
+        volatile double result = MathLib::LinAlg::axpyAndNorm2(y, 1e-10, x);
+        (void)result;
+    });
+
+    std::printf("vector  n=%8zu  axpy: %6.2f GB/s  norm2: %6.2f GB/s"
+                "  axpyAndNorm2: %6.2f GB/s\n",
+                n, 3.0 * n * sizeof(double) / time_axpy / 1e9,
+                n * sizeof(double) / time_norm / 1e9,
+                3.0 * n * sizeof(double) / time_fused / 1e9);
+}
+
+}  // anonymous namespace
+
+/// Compares the sequential sum with the fixed-order pairwise tree sum used
+/// in deterministic parallel mode, cf. BaseLib::pairwiseSum: the tree sum
+/// should cost only a few percent while being reproducible independently of
+/// the thread count.
+void benchmarkReductions(std::size_t const n)
+{
+    std::vector<double> values(n);
+    for (std::size_t i = 0; i < n; ++i)
+        values[i] = 1.0 / (1.0 + i);
+
+    volatile double sink = 0.0;
+    double const t_seq = timeIt([&]() {
+        double sum = 0.0;
+        for (auto const v : values)
+            sum += v;
+        sink = sum;
+    });
+    double const t_pairwise = timeIt(
+        [&]() { sink = BaseLib::pairwiseSum(values.data(), values.size()); });
+    (void)sink;
+
+    INFO("reduction   n=%8zu: sequential %8.3f ms, pairwise %8.3f ms "
+         "(%.1f%% overhead)",
+         n, t_seq * 1e3, t_pairwise * 1e3,
+         100.0 * (t_pairwise - t_seq) / t_seq);
+}
+
+int main(int argc, char* argv[])
+{
+    LOGOG_INITIALIZE();
+    BaseLib::LogogSimpleFormatter* custom_format(
+        new BaseLib::LogogSimpleFormatter);
+    logog::Cout* logog_cout(new logog::Cout);
+    logog_cout->SetFormatter(*custom_format);
+
+    TCLAP::CmdLine cmd(
+        "Micro-benchmarks for assembly insert rates, SpMV throughput and "
+        "vector-operation bandwidth of the built-in linear algebra. Run this "
+        "on a target machine to compare backend configurations before "
+        "committing a cluster run.",
+        ' ', "0.1");
+    TCLAP::ValueArg<std::size_t> max_grid_arg(
+        "n", "max-grid-size",
+        "maximum grid edge length n; benchmarks run on n x n stencil "
+        "matrices",
+        false, 512, "integer");
+    cmd.add(max_grid_arg);
+    cmd.parse(argc, argv);
+
+    for (std::size_t n = 64; n <= max_grid_arg.getValue(); n *= 2)
+        benchmarkInsertionRate(n);
+    for (std::size_t n = 64; n <= max_grid_arg.getValue(); n *= 2)
+        benchmarkSpMV(n);
+    for (std::size_t n = 1 << 16; n <= (std::size_t{1} << 24); n *= 16)
+        benchmarkVectorOps(n);
+    for (std::size_t n = 1 << 16; n <= (std::size_t{1} << 24); n *= 16)
+        benchmarkReductions(n);
+
+    delete logog_cout;
+    delete custom_format;
+    LOGOG_SHUTDOWN();
+
+    return 0;
+}
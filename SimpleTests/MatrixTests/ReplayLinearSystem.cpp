@@ -0,0 +1,196 @@
+/**
+ * \brief  Standalone replay tool for captured linear systems.
+ *
+ * Reads a dump written by NumLib::LinearSystemCapture (cf. the
+ * --dump-worst-systems option of ogs) and solves it with a selectable
+ * Eigen solver/preconditioner combination, so solver tuning for the
+ * worst-converging steps of a long run happens offline on the captured
+ * system instead of on the full simulation.
+ *
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <tclap/CmdLine.h>
+
+#include <Eigen/Sparse>
+#include <unsupported/Eigen/IterativeSolvers>
+
+#include "BaseLib/RunTime.h"
+
+namespace
+{
+
+using Matrix = Eigen::SparseMatrix<double, Eigen::RowMajor>;
+using Vector = Eigen::VectorXd;
+
+bool readDump(std::string const& filename, Matrix& A, Vector& rhs, Vector& x0)
+{
+    std::ifstream in(filename, std::ios::binary);
+    if (!in) {
+        std::fprintf(stderr, "error: could not open '%s'.\n",
+                     filename.c_str());
+        return false;
+    }
+
+    char magic[8];
+    in.read(magic, 8);
+    if (!in || std::memcmp(magic, "OGSLSC01", 8) != 0) {
+        std::fprintf(stderr, "error: '%s' is not a linear system dump.\n",
+                     filename.c_str());
+        return false;
+    }
+
+    std::uint64_t n, nnz;
+    in.read(reinterpret_cast<char*>(&n), sizeof n);
+    in.read(reinterpret_cast<char*>(&nnz), sizeof nnz);
+
+    std::vector<std::int64_t> row_pointers(n + 1), column_indices(nnz);
+    std::vector<double> values(nnz);
+    in.read(reinterpret_cast<char*>(row_pointers.data()),
+            row_pointers.size() * sizeof(std::int64_t));
+    in.read(reinterpret_cast<char*>(column_indices.data()),
+            column_indices.size() * sizeof(std::int64_t));
+    in.read(reinterpret_cast<char*>(values.data()),
+            values.size() * sizeof(double));
+
+    rhs.resize(n);
+    x0.resize(n);
+    in.read(reinterpret_cast<char*>(rhs.data()), n * sizeof(double));
+    in.read(reinterpret_cast<char*>(x0.data()), n * sizeof(double));
+    if (!in) {
+        std::fprintf(stderr, "error: '%s' is truncated.\n", filename.c_str());
+        return false;
+    }
+
+    std::vector<Eigen::Triplet<double>> triplets;
+    triplets.reserve(nnz);
+    for (std::uint64_t i = 0; i < n; ++i)
+        for (std::int64_t k = row_pointers[i]; k < row_pointers[i + 1]; ++k)
+            triplets.emplace_back(i, column_indices[k], values[k]);
+    A.resize(n, n);
+    A.setFromTriplets(triplets.begin(), triplets.end());
+    return true;
+}
+
+template <typename Solver>
+int solveAndReport(Matrix const& A, Vector const& rhs, Vector const& x0,
+                   double const tolerance, unsigned const max_iterations)
+{
+    Solver solver;
+    solver.setTolerance(tolerance);
+    solver.setMaxIterations(max_iterations);
+
+    BaseLib::RunTime setup_timer;
+    setup_timer.start();
+    solver.compute(A);
+    double const setup_time = setup_timer.elapsed();
+
+    BaseLib::RunTime solve_timer;
+    solve_timer.start();
+    Vector const x = solver.solveWithGuess(rhs, x0);
+    double const solve_time = solve_timer.elapsed();
+
+    double const residual = (A * x - rhs).norm() / rhs.norm();
+    std::printf("n          %ld\n", static_cast<long>(A.rows()));
+    std::printf("nnz        %ld\n", static_cast<long>(A.nonZeros()));
+    std::printf("iterations %ld\n", static_cast<long>(solver.iterations()));
+    std::printf("residual   %g (relative)\n", residual);
+    std::printf("setup      %g s\n", setup_time);
+    std::printf("solve      %g s\n", solve_time);
+    return solver.info() == Eigen::Success ? 0 : 1;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+    TCLAP::CmdLine cmd(
+        "Replays a linear system dumped by ogs --dump-worst-systems with a "
+        "selectable Eigen solver.",
+        ' ', "0.1");
+    TCLAP::UnlabeledValueArg<std::string> dump_arg(
+        "dump-file", "linear system dump file", true, "", "file");
+    cmd.add(dump_arg);
+    TCLAP::ValueArg<std::string> solver_arg(
+        "s", "solver", "solver: cg, bicgstab, gmres (default: bicgstab)",
+        false, "bicgstab", "solver");
+    cmd.add(solver_arg);
+    TCLAP::ValueArg<std::string> precon_arg(
+        "p", "precon", "preconditioner: none, diag, ilut (default: diag)",
+        false, "diag", "preconditioner");
+    cmd.add(precon_arg);
+    TCLAP::ValueArg<double> tolerance_arg(
+        "e", "tolerance", "relative tolerance (default: 1e-10)", false, 1e-10,
+        "tolerance");
+    cmd.add(tolerance_arg);
+    TCLAP::ValueArg<unsigned> max_iterations_arg(
+        "i", "max-iterations", "iteration limit (default: 10000)", false,
+        10000, "count");
+    cmd.add(max_iterations_arg);
+    cmd.parse(argc, argv);
+
+    Matrix A;
+    Vector rhs, x0;
+    if (!readDump(dump_arg.getValue(), A, rhs, x0))
+        return 1;
+
+    auto const& solver = solver_arg.getValue();
+    auto const& precon = precon_arg.getValue();
+    auto const tolerance = tolerance_arg.getValue();
+    auto const max_iterations = max_iterations_arg.getValue();
+
+    // The ILUT preconditioner and GMRES require column-major access; Eigen
+    // converts on compute(), which the setup timing includes.
+    if (solver == "cg" && precon == "none")
+        return solveAndReport<Eigen::ConjugateGradient<
+            Matrix, Eigen::Lower | Eigen::Upper,
+            Eigen::IdentityPreconditioner>>(A, rhs, x0, tolerance,
+                                            max_iterations);
+    if (solver == "cg" && precon == "diag")
+        return solveAndReport<
+            Eigen::ConjugateGradient<Matrix, Eigen::Lower | Eigen::Upper>>(
+            A, rhs, x0, tolerance, max_iterations);
+    if (solver == "cg" && precon == "ilut")
+        return solveAndReport<
+            Eigen::ConjugateGradient<Matrix, Eigen::Lower | Eigen::Upper,
+                                     Eigen::IncompleteLUT<double>>>(
+            A, rhs, x0, tolerance, max_iterations);
+    if (solver == "bicgstab" && precon == "none")
+        return solveAndReport<
+            Eigen::BiCGSTAB<Matrix, Eigen::IdentityPreconditioner>>(
+            A, rhs, x0, tolerance, max_iterations);
+    if (solver == "bicgstab" && precon == "diag")
+        return solveAndReport<Eigen::BiCGSTAB<Matrix>>(A, rhs, x0, tolerance,
+                                                       max_iterations);
+    if (solver == "bicgstab" && precon == "ilut")
+        return solveAndReport<
+            Eigen::BiCGSTAB<Matrix, Eigen::IncompleteLUT<double>>>(
+            A, rhs, x0, tolerance, max_iterations);
+    if (solver == "gmres" && precon == "none")
+        return solveAndReport<
+            Eigen::GMRES<Matrix, Eigen::IdentityPreconditioner>>(
+            A, rhs, x0, tolerance, max_iterations);
+    if (solver == "gmres" && precon == "diag")
+        return solveAndReport<Eigen::GMRES<Matrix>>(A, rhs, x0, tolerance,
+                                                    max_iterations);
+    if (solver == "gmres" && precon == "ilut")
+        return solveAndReport<
+            Eigen::GMRES<Matrix, Eigen::IncompleteLUT<double>>>(
+            A, rhs, x0, tolerance, max_iterations);
+
+    std::fprintf(stderr, "error: unknown solver/preconditioner '%s'/'%s'.\n",
+                 solver.c_str(), precon.c_str());
+    return 1;
+}
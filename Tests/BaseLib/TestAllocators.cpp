@@ -0,0 +1,66 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+#include <vector>
+#include "BaseLib/AllocationGuard.h"
+#include "BaseLib/Allocators.h"
+TEST(BaseLibAllocators, ArenaPoolAndAdapter)
+{
+    BaseLib::MonotonicArena arena(1024);
+    auto* a = arena.allocate(100, 8);
+    auto* b = arena.allocate(100, 8);
+    EXPECT_NE(a, b);
+    EXPECT_GE(arena.reservedBytes(), 1024u);
+    // oversized allocation
+    auto* big = arena.allocate(4096, 8);
+    EXPECT_NE(nullptr, big);
+    // next small allocation must not land in the oversized chunk
+    auto* c = arena.allocate(8, 8);
+    EXPECT_NE(nullptr, c);
+    arena.reset();
+    EXPECT_EQ(0u, arena.reservedBytes());
+
+    BaseLib::FixedSizePool<double> pool(4);
+    void* s1 = pool.allocate();
+    void* s2 = pool.allocate();
+    pool.deallocate(s1);
+    EXPECT_EQ(s1, pool.allocate());  // recycled
+    (void)s2;
+
+    BaseLib::MonotonicArena region;
+    std::vector<int, BaseLib::ArenaAllocator<int>> v(
+        (BaseLib::ArenaAllocator<int>(region)));
+    for (int i = 0; i < 1000; ++i) v.push_back(i);
+    EXPECT_EQ(999, v.back());
+    EXPECT_GT(region.reservedBytes(), 0u);
+}
+
+#ifdef OGS_ENABLE_ALLOCATION_GUARD
+TEST(BaseLib, AllocationGuardFailMode)
+{
+    // The non-failing guard only reports.
+    {
+        BaseLib::AllocationGuard::ScopedAllocationCheck const check(
+            "test reporting scope");
+        std::vector<double> heap_use(16);
+        EXPECT_EQ(16u, heap_use.size());
+    }
+
+    // The failing guard aborts on the first allocation in its scope.
+    EXPECT_DEATH(
+        {
+            BaseLib::AllocationGuard::ScopedAllocationCheck const check(
+                "test failing scope", true);
+            std::vector<double> heap_use(16);
+            (void)heap_use;
+        },
+        "allocation in guarded scope");
+}
+#endif  // OGS_ENABLE_ALLOCATION_GUARD
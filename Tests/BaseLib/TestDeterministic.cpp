@@ -0,0 +1,49 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "BaseLib/Deterministic.h"
+
+TEST(BaseLib, PairwiseSum)
+{
+    std::mt19937 gen(3402);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+    std::vector<double> values(100000);
+    for (auto& v : values)
+        v = dist(gen);
+
+    double sequential = 0.0;
+    for (auto const v : values)
+        sequential += v;
+
+    double const pairwise = BaseLib::pairwiseSum(values.data(), values.size());
+
+    // The tree sum must agree with the sequential sum up to rounding and be
+    // bitwise stable across evaluations.
+    EXPECT_NEAR(sequential, pairwise, 1e-10 * values.size());
+    EXPECT_EQ(pairwise, BaseLib::pairwiseSum(values.data(), values.size()));
+
+    // Empty and short arrays.
+    EXPECT_EQ(0.0, BaseLib::pairwiseSum(values.data(), 0));
+    EXPECT_EQ(values[0], BaseLib::pairwiseSum(values.data(), 1));
+}
+
+TEST(BaseLib, DeterministicParallelModeFlag)
+{
+    EXPECT_FALSE(BaseLib::deterministicParallelMode());
+    BaseLib::setDeterministicParallelMode(true);
+    EXPECT_TRUE(BaseLib::deterministicParallelMode());
+    BaseLib::setDeterministicParallelMode(false);
+    EXPECT_FALSE(BaseLib::deterministicParallelMode());
+}
@@ -0,0 +1,29 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include "BaseLib/FileTools.h"
+TEST(BaseLibFileTools, MappedFileAndFastParse)
+{
+    std::string const fn("ft_test.txt");
+    { std::ofstream out(fn); out << "12 3.5 -7e2\n42"; }
+    BaseLib::MemoryMappedFile file(fn);
+    ASSERT_TRUE(file.valid());
+    char const* pos = file.data();
+    char const* end = file.data() + file.size();
+    unsigned long u; double d;
+    ASSERT_TRUE(BaseLib::parseUnsigned(pos, end, u)); EXPECT_EQ(12u, u);
+    ASSERT_TRUE(BaseLib::parseDouble(pos, end, d)); EXPECT_EQ(3.5, d);
+    ASSERT_TRUE(BaseLib::parseDouble(pos, end, d)); EXPECT_EQ(-700.0, d);
+    ASSERT_TRUE(BaseLib::parseUnsigned(pos, end, u)); EXPECT_EQ(42u, u);
+    EXPECT_FALSE(BaseLib::parseDouble(pos, end, d));
+    std::remove(fn.c_str());
+}
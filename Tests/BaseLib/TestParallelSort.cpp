@@ -0,0 +1,32 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+#include <numeric>
+#include <random>
+#include "BaseLib/quicksort.h"
+#include "BaseLib/reorderVector.h"
+TEST(BaseLibParallelSort, SortsWithPermutation)
+{
+    std::mt19937 rng(11);
+    std::vector<double> values(10000);
+    for (auto& v : values) v = rng() % 1000;
+    std::vector<std::size_t> perm(values.size());
+    std::iota(perm.begin(), perm.end(), 0);
+    auto const original = values;
+
+    BaseLib::parallelQuicksort(values.data(), 0, values.size(), perm.data());
+    EXPECT_TRUE(std::is_sorted(values.begin(), values.end()));
+    for (std::size_t i = 0; i < values.size(); ++i)
+        EXPECT_EQ(original[perm[i]], values[i]);
+
+    std::vector<double> gathered;
+    BaseLib::parallelGather(original, perm, gathered);
+    EXPECT_EQ(values, gathered);
+}
@@ -0,0 +1,33 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+#include <random>
+#include "BaseLib/StreamingStatistics.h"
+TEST(BaseLibStreamingStatistics, MedianMeanVarianceAndMerge)
+{
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<double> dist(0.0, 1.0);
+    BaseLib::StreamingStatistics all(0.5), first_half(0.5), second_half(0.5);
+    for (int i = 0; i < 100000; ++i) {
+        double const v = dist(rng);
+        all.update(v);
+        (i < 50000 ? first_half : second_half).update(v);
+    }
+    EXPECT_NEAR(0.5, all.getMean(), 0.01);
+    EXPECT_NEAR(1.0/12.0, all.getVariance(), 0.005);
+    EXPECT_NEAR(0.5, all.getQuantile(), 0.02);
+    EXPECT_EQ(100000u, all.getCount());
+
+    first_half.merge(second_half);
+    EXPECT_EQ(100000u, first_half.getCount());
+    EXPECT_NEAR(all.getMean(), first_half.getMean(), 1e-9);
+    EXPECT_NEAR(all.getVariance(), first_half.getVariance(), 1e-9);
+    EXPECT_NEAR(0.5, first_half.getQuantile(), 0.05);
+}
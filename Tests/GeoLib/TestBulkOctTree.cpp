@@ -0,0 +1,43 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <random>
+#include "GeoLib/BulkOctTree.h"
+#include "GeoLib/Point.h"
+
+TEST(GeoLibBulkOctTree, RangeQueryMatchesBruteForce)
+{
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<double> dist(0.0, 10.0);
+    std::vector<GeoLib::Point*> points;
+    for (int i = 0; i < 5000; ++i)
+        points.push_back(new GeoLib::Point(dist(rng), dist(rng), dist(rng), i));
+
+    GeoLib::BulkOctTree<GeoLib::Point> tree(points, 16);
+
+    MathLib::Point3d const min(std::array<double,3>{{2.0, 3.0, 1.0}});
+    MathLib::Point3d const max(std::array<double,3>{{5.5, 6.0, 9.0}});
+
+    std::vector<std::size_t> result;
+    tree.getPointsInRange(min, max, result);
+
+    std::vector<std::size_t> expected;
+    for (std::size_t i = 0; i < points.size(); ++i) {
+        auto const& p = *points[i];
+        if (p[0] >= min[0] && p[0] < max[0] && p[1] >= min[1] && p[1] < max[1] &&
+            p[2] >= min[2] && p[2] < max[2])
+            expected.push_back(i);
+    }
+    std::sort(result.begin(), result.end());
+    EXPECT_EQ(expected, result);
+    EXPECT_GT(tree.getNumberOfNodes(), 1u);
+    for (auto* p : points) delete p;
+}
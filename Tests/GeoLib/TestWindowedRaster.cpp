@@ -0,0 +1,36 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include "GeoLib/WindowedRaster.h"
+TEST(GeoLibWindowedRaster, ReadsAndInterpolates)
+{
+    std::string const fn("wr_test.asc");
+    {
+        std::ofstream out(fn);
+        out << "ncols 4\nnrows 3\nxllcorner 0\nyllcorner 0\ncellsize 1\nNODATA_value -9999\n";
+        out << "9 10 11 12\n5 6 7 8\n1 2 3 4\n";  // top-down rows
+    }
+    GeoLib::WindowedRaster raster(fn, 2);
+    // cell (0,0) = bottom-left = 1
+    EXPECT_EQ(1.0, raster.getValueAtPoint(MathLib::Point3d(std::array<double,3>{{0.5,0.5,0}})));
+    EXPECT_EQ(12.0, raster.getValueAtPoint(MathLib::Point3d(std::array<double,3>{{3.5,2.5,0}})));
+    // interpolation at cell centers returns the cell value
+    std::vector<MathLib::Point3d const*> pts;
+    MathLib::Point3d const p1(std::array<double,3>{{1.5,1.5,0}});
+    MathLib::Point3d const p2(std::array<double,3>{{2.0,1.0,0}});
+    pts.push_back(&p1); pts.push_back(&p2);
+    std::vector<double> results;
+    raster.interpolateValuesAtPoints(pts, results);
+    EXPECT_NEAR(6.0, results[0], 1e-12);
+    EXPECT_NEAR(4.5, results[1], 1e-12); // midpoint of cells 2,3,6,7 -> (2+3+6+7)/4
+    std::remove(fn.c_str());
+}
@@ -8,6 +8,8 @@
 
 #include <gtest/gtest.h>
 
+#include <random>
+
 #include "MaterialLib/SolidModels/KelvinVector.h"
 
 #include "Tests/MathLib/AutoCheckTools.h"
@@ -230,3 +232,34 @@ TEST_F(MaterialLibSolidsKelvinVector6, DeviatoricSphericalProjections)
     // Test sum is identity.
     EXPECT_EQ(P_dev + P_sph, (Eigen::Matrix<double, size, size>::Identity()));
 }
+
+TEST(MaterialSolidModels, DeviatoricKernelMatchesProjection)
+{
+    std::mt19937 gen(3402);
+    std::uniform_real_distribution<double> dist(-2.0, 2.0);
+
+    for (int k = 0; k < 100; ++k)
+    {
+        Eigen::Matrix<double, 6, 1> v6;
+        for (int c = 0; c < 6; ++c)
+            v6[c] = dist(gen);
+        Eigen::Matrix<double, 6, 1> const reference6 =
+            MaterialLib::SolidModels::Invariants<6>::deviatoric_projection *
+            v6;
+        ASSERT_LE(
+            (MaterialLib::SolidModels::Invariants<6>::deviatoric(v6) -
+             reference6).template lpNorm<Eigen::Infinity>(),
+            1e-14);
+
+        Eigen::Matrix<double, 4, 1> v4;
+        for (int c = 0; c < 4; ++c)
+            v4[c] = dist(gen);
+        Eigen::Matrix<double, 4, 1> const reference4 =
+            MaterialLib::SolidModels::Invariants<4>::deviatoric_projection *
+            v4;
+        ASSERT_LE(
+            (MaterialLib::SolidModels::Invariants<4>::deviatoric(v4) -
+             reference4).template lpNorm<Eigen::Infinity>(),
+            1e-14);
+    }
+}
@@ -0,0 +1,35 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+#include <random>
+#include "MathLib/GeometricBasics.h"
+#include "MathLib/Point3d.h"
+TEST(MathLibBatchedPredicates, MatchesScalarPredicate)
+{
+    MathLib::Point3d const a(std::array<double,3>{{0,0,0}});
+    MathLib::Point3d const b(std::array<double,3>{{1,0,0}});
+    MathLib::Point3d const c(std::array<double,3>{{0,1,0}});
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<double> dist(-0.5, 1.5);
+    std::vector<MathLib::Point3d> storage;
+    for (int i = 0; i < 500; ++i)
+        storage.emplace_back(std::array<double,3>{{dist(rng), dist(rng), dist(rng)*0.001}});
+    std::vector<MathLib::Point3d const*> points;
+    for (auto const& p : storage) points.push_back(&p);
+    std::vector<char> results;
+    MathLib::arePointsInTriangle(points, a, b, c, results);
+    ASSERT_EQ(points.size(), results.size());
+    int mismatches = 0;
+    for (std::size_t i = 0; i < points.size(); ++i) {
+        bool const scalar = MathLib::isPointInTriangle(*points[i], a, b, c);
+        if (scalar != (results[i] != 0)) ++mismatches;
+    }
+    EXPECT_EQ(0, mismatches);
+}
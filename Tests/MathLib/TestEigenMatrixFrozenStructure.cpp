@@ -0,0 +1,85 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include "MathLib/LinAlg/Eigen/EigenMatrix.h"
+
+// Checks that adds into a frozen matrix structure yield the same result as
+// adds via Eigen's insertion machinery, and that adding an entry outside of
+// the frozen structure thaws the matrix instead of corrupting it.
+TEST(MathLibEigenMatrix, FrozenStructureAdd)
+{
+    MathLib::EigenMatrix mat(4, 3);
+
+    mat.add(0, 0, 1.0);
+    mat.add(0, 2, 2.0);
+    mat.add(1, 1, 3.0);
+    mat.add(3, 3, 4.0);
+
+    mat.freezeStructure();
+    ASSERT_TRUE(mat.isStructureFrozen());
+
+    // Adds into the existing structure.
+    mat.add(0, 0, 1.0);
+    mat.add(0, 2, -2.0);
+    mat.add(3, 3, 0.0);
+    ASSERT_TRUE(mat.isStructureFrozen());
+
+    EXPECT_EQ(2.0, mat.get(0, 0));
+    EXPECT_EQ(0.0, mat.get(0, 2));
+    EXPECT_EQ(3.0, mat.get(1, 1));
+    EXPECT_EQ(4.0, mat.get(3, 3));
+
+    // An add outside of the frozen structure falls back to insertion.
+    mat.add(2, 0, 5.0);
+    ASSERT_FALSE(mat.isStructureFrozen());
+    EXPECT_EQ(5.0, mat.get(2, 0));
+    EXPECT_EQ(2.0, mat.get(0, 0));
+
+    // Re-freezing picks up the extended structure.
+    mat.freezeStructure();
+    mat.add(2, 0, 5.0);
+    ASSERT_TRUE(mat.isStructureFrozen());
+    EXPECT_EQ(10.0, mat.get(2, 0));
+
+    // setZero() must not destroy the frozen structure.
+    mat.setZero();
+    mat.add(1, 1, 6.0);
+    ASSERT_TRUE(mat.isStructureFrozen());
+    EXPECT_EQ(6.0, mat.get(1, 1));
+    EXPECT_EQ(0.0, mat.get(3, 3));
+}
+
+// Offset-table adds must reproduce the searching frozen add.
+TEST(MathLibEigenMatrix, FrozenStructureOffsetTable)
+{
+    MathLib::EigenMatrix matrix(6);
+    std::vector<MathLib::EigenMatrix::IndexType> const indices = {1, 3, 4};
+    Eigen::Matrix3d block;
+    block << 1, 2, 3, 4, 5, 6, 7, 8, 9;
+
+    // First assembly inserts, freeze fixes the structure.
+    matrix.add(indices, indices, block);
+    matrix.freezeStructure();
+
+    auto const offsets = matrix.buildAddOffsets(indices, indices);
+    ASSERT_EQ(9u, offsets.size());
+
+    matrix.setZero();
+    matrix.addWithOffsets(offsets, block, 2.0);
+    for (std::size_t i = 0; i < indices.size(); ++i)
+        for (std::size_t j = 0; j < indices.size(); ++j)
+            ASSERT_EQ(2.0 * block(i, j),
+                      matrix.getRawMatrix().coeff(indices[i], indices[j]));
+
+    // A block outside the frozen structure yields no table.
+    std::vector<MathLib::EigenMatrix::IndexType> const other = {0, 2};
+    ASSERT_TRUE(matrix.buildAddOffsets(other, other).empty());
+}
@@ -0,0 +1,54 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "MathLib/Integration/GaussLegendre.h"
+
+namespace
+{
+// Integrates x^k over [-1, 1] with the given table.
+template <unsigned Order>
+double integrateMonomial(unsigned const k)
+{
+    double integral = 0.0;
+    for (unsigned i = 0; i < Order; ++i)
+        integral += MathLib::GaussLegendre<Order>::W[i] *
+                    std::pow(MathLib::GaussLegendre<Order>::X[i], k);
+    return integral;
+}
+
+// An n-point rule must integrate polynomials up to degree 2n-1 exactly.
+template <unsigned Order>
+void expectExactUpToDegree()
+{
+    for (unsigned k = 0; k <= 2 * Order - 1; ++k)
+    {
+        double const exact = (k % 2 == 1) ? 0.0 : 2.0 / (k + 1);
+        EXPECT_NEAR(exact, integrateMonomial<Order>(k), 1e-13)
+            << "order " << Order << ", monomial degree " << k;
+    }
+}
+}  // namespace
+
+TEST(MathLibGaussLegendre, ExactnessOfAllOrders)
+{
+    expectExactUpToDegree<1>();
+    expectExactUpToDegree<2>();
+    expectExactUpToDegree<3>();
+    expectExactUpToDegree<4>();
+    expectExactUpToDegree<5>();
+    expectExactUpToDegree<6>();
+    expectExactUpToDegree<7>();
+    expectExactUpToDegree<8>();
+    expectExactUpToDegree<9>();
+    expectExactUpToDegree<10>();
+}
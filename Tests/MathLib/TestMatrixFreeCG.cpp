@@ -0,0 +1,54 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <Eigen/Sparse>
+
+#include "MathLib/LinAlg/Eigen/EigenMatrixFreeCG.h"
+
+TEST(MathLibMatrixFreeCG, SolvesLaplacian)
+{
+    int const n = 500;
+    std::vector<Eigen::Triplet<double>> triplets;
+    for (int i = 0; i < n; ++i) {
+        triplets.emplace_back(i, i, 2.0);
+        if (i > 0)
+            triplets.emplace_back(i, i - 1, -1.0);
+        if (i < n - 1)
+            triplets.emplace_back(i, i + 1, -1.0);
+    }
+    Eigen::SparseMatrix<double, Eigen::RowMajor> A(n, n);
+    A.setFromTriplets(triplets.begin(), triplets.end());
+
+    Eigen::VectorXd const x_expected = Eigen::VectorXd::Random(n);
+    Eigen::VectorXd const b = A * x_expected;
+
+    auto const apply = [&A](Eigen::VectorXd const& v, Eigen::VectorXd& w) {
+        w.noalias() = A * v;
+    };
+
+    Eigen::VectorXd const inv_diag = Eigen::VectorXd::Constant(n, 0.5);
+    Eigen::VectorXd x = Eigen::VectorXd::Zero(n);
+
+    auto const report =
+        MathLib::matrixFreeCG(apply, b, x, inv_diag, 1e-12, 10 * n);
+
+    ASSERT_TRUE(report.converged);
+    EXPECT_LT((x - x_expected).norm() / x_expected.norm(), 1e-8);
+
+    // Without preconditioning (empty inverse diagonal) it must converge, too.
+    Eigen::VectorXd x2 = Eigen::VectorXd::Zero(n);
+    auto const report2 = MathLib::matrixFreeCG(apply, b, x2, Eigen::VectorXd(),
+                                               1e-12, 10 * n);
+    ASSERT_TRUE(report2.converged);
+    EXPECT_LT((x2 - x_expected).norm() / x_expected.norm(), 1e-8);
+}
@@ -0,0 +1,82 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+
+#include "MathLib/Nonlinear/ModifiedNewton.h"
+
+namespace
+{
+// Solve f(x) = x^2 - 3 == 0 with the given options; returns the final state
+// and the iteration count (or -1 on failure).
+std::pair<double, int> solveSqrt3(MathLib::Nonlinear::NewtonOptions options)
+{
+    static const int N = 1;
+    using LocalJacobianMatrix = Eigen::Matrix<double, N, N, Eigen::RowMajor>;
+    using LocalResidualVector = Eigen::Matrix<double, N, 1>;
+
+    Eigen::PartialPivLU<LocalJacobianMatrix> linear_solver(N);
+    LocalJacobianMatrix jacobian;
+
+    double state = 1;
+    auto const update_jacobian = [&state](LocalJacobianMatrix& jacobian) {
+        jacobian(0, 0) = 2 * state;
+    };
+    auto const update_residual = [&state](LocalResidualVector& residual) {
+        residual[0] = state * state - 3;
+    };
+    auto const update_solution =
+        [&state](LocalResidualVector const& increment) {
+            state += increment[0];
+        };
+
+    auto const newton_solver = MathLib::Nonlinear::ModifiedNewton<
+        decltype(linear_solver), LocalJacobianMatrix,
+        decltype(update_jacobian), LocalResidualVector,
+        decltype(update_residual), decltype(update_solution)>(
+        linear_solver, update_jacobian, update_residual, update_solution,
+        options);
+    auto const success_iterations = newton_solver.solve(jacobian);
+    return {state, success_iterations ? *success_iterations : -1};
+}
+}  // namespace
+
+// With default options the iteration matches NumLib::NewtonRaphson.
+TEST(MathLibModifiedNewton, Sqrt3FullNewton)
+{
+    auto const result = solveSqrt3({5, 1e-15});
+    ASSERT_GE(result.second, 0);
+    ASSERT_LE(result.first - std::sqrt(3),
+              std::numeric_limits<double>::epsilon());
+}
+
+// Frozen Jacobian converges too (linearly), within a larger budget.
+TEST(MathLibModifiedNewton, Sqrt3FrozenJacobian)
+{
+    MathLib::Nonlinear::NewtonOptions options{50, 1e-13};
+    options.jacobian_refresh_interval = 10;
+    auto const result = solveSqrt3(options);
+    ASSERT_GE(result.second, 0);
+    ASSERT_NEAR(std::sqrt(3), result.first, 1e-12);
+}
+
+// Scaling and line search leave the solution untouched on a well-behaved
+// problem.
+TEST(MathLibModifiedNewton, Sqrt3ScaledDamped)
+{
+    MathLib::Nonlinear::NewtonOptions options{10, 1e-15};
+    options.scaling = true;
+    options.line_search = true;
+    auto const result = solveSqrt3(options);
+    ASSERT_GE(result.second, 0);
+    ASSERT_NEAR(std::sqrt(3), result.first, 1e-14);
+}
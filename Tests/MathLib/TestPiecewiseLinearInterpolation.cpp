@@ -156,3 +156,46 @@ TEST(MathLibInterpolationAlgorithms, PiecewiseLinearInterpolationDerivative)
     ASSERT_NEAR(0, interpolation.getDerivative(1001),
                 std::numeric_limits<double>::epsilon());
 }
+
+TEST(MathLibInterpolationAlgorithms, PiecewiseLinearInterpolationSegmentCoefficients)
+{
+    const std::size_t size(1000);
+    std::vector<double> supp_pnts, values;
+    for (std::size_t k(0); k < size; ++k) {
+        supp_pnts.push_back(static_cast<double>(k));
+        values.push_back(k % 2 ? 1.0 : 0.0);
+    }
+    MathLib::PiecewiseLinearInterpolation interpolation{std::move(supp_pnts),
+                                                        std::move(values)};
+
+    // Coefficients reproduce getValue() as a fused multiply-add, including
+    // the constant extension outside the support.
+    for (double const pnt : {-0.5, 0.0, 0.25, 500.5, 998.75, 999.0, 1010.0}) {
+        auto const coefficients = interpolation.getSegmentCoefficients(pnt);
+        ASSERT_NEAR(interpolation.getValue(pnt),
+                    coefficients.first * pnt + coefficients.second,
+                    std::numeric_limits<double>::epsilon());
+    }
+}
+
+TEST(MathLibInterpolationAlgorithms, PiecewiseLinearInterpolationBatched)
+{
+    const std::size_t size(100);
+    std::vector<double> supp_pnts, values;
+    for (std::size_t k(0); k < size; ++k) {
+        supp_pnts.push_back(static_cast<double>(k));
+        values.push_back(static_cast<double>(k * k));
+    }
+    MathLib::PiecewiseLinearInterpolation interpolation{std::move(supp_pnts),
+                                                        std::move(values)};
+
+    // Mix of sorted runs (fast path) and jumps (search fall-back).
+    std::vector<double> const points = {-1.0, 0.5,  0.75, 1.5, 42.25,
+                                        42.5, 98.5, 3.25, 99.5};
+    std::vector<double> batched(points.size());
+    interpolation.getValues(points.data(), points.size(), batched.data());
+    for (std::size_t i = 0; i < points.size(); ++i) {
+        ASSERT_NEAR(interpolation.getValue(points[i]), batched[i],
+                    std::numeric_limits<double>::epsilon());
+    }
+}
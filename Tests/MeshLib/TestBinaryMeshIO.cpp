@@ -0,0 +1,142 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <memory>
+#include <numeric>
+
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/IO/BinaryMeshIO.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "MeshLib/Node.h"
+
+TEST(MeshLibBinaryMeshIO, RoundTrip)
+{
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MeshLib::MeshGenerator::generateRegularQuadMesh(4.0, 4));
+
+    // Attach one cell and one node property.
+    auto* const material_ids =
+        mesh->getProperties().createNewPropertyVector<int>(
+            "MaterialIDs", MeshLib::MeshItemType::Cell, 1);
+    material_ids->resize(mesh->getNumberOfElements());
+    std::iota(material_ids->begin(), material_ids->end(), 0);
+
+    auto* const heads = mesh->getProperties().createNewPropertyVector<double>(
+        "head", MeshLib::MeshItemType::Node, 1);
+    heads->resize(mesh->getNumberOfNodes());
+    std::iota(heads->begin(), heads->end(), 0.5);
+
+    std::string const file_name("TestBinaryMeshIO.bms");
+    ASSERT_TRUE(MeshLib::IO::writeMeshToBinaryFile(*mesh, file_name));
+
+    std::unique_ptr<MeshLib::Mesh> const read_mesh(
+        MeshLib::IO::readMeshFromBinaryFile(file_name));
+    std::remove(file_name.c_str());
+    ASSERT_NE(nullptr, read_mesh.get());
+
+    ASSERT_EQ(mesh->getNumberOfNodes(), read_mesh->getNumberOfNodes());
+    ASSERT_EQ(mesh->getNumberOfElements(), read_mesh->getNumberOfElements());
+
+    for (std::size_t i = 0; i < mesh->getNumberOfNodes(); ++i)
+        for (unsigned d = 0; d < 3; ++d)
+            EXPECT_EQ((*mesh->getNode(i))[d], (*read_mesh->getNode(i))[d]);
+
+    for (std::size_t e = 0; e < mesh->getNumberOfElements(); ++e) {
+        auto const* const element = mesh->getElement(e);
+        auto const* const read_element = read_mesh->getElement(e);
+        ASSERT_EQ(element->getCellType(), read_element->getCellType());
+        for (unsigned i = 0; i < element->getNumberOfNodes(); ++i)
+            EXPECT_EQ(element->getNodeIndex(i),
+                      read_element->getNodeIndex(i));
+    }
+
+    auto const* const read_material_ids =
+        read_mesh->getProperties().getPropertyVector<int>("MaterialIDs");
+    ASSERT_NE(nullptr, read_material_ids);
+    ASSERT_EQ(material_ids->size(), read_material_ids->size());
+    EXPECT_TRUE(std::equal(material_ids->begin(), material_ids->end(),
+                           read_material_ids->begin()));
+
+    auto const* const read_heads =
+        read_mesh->getProperties().getPropertyVector<double>("head");
+    ASSERT_NE(nullptr, read_heads);
+    ASSERT_EQ(MeshLib::MeshItemType::Node, read_heads->getMeshItemType());
+    EXPECT_TRUE(std::equal(heads->begin(), heads->end(),
+                           read_heads->begin()));
+}
+
+TEST(MeshLibBinaryMeshIO, DeferredPropertyLoading)
+{
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MeshLib::MeshGenerator::generateRegularQuadMesh(4.0, 4));
+    auto* const material_ids =
+        mesh->getProperties().createNewPropertyVector<int>(
+            "MaterialIDs", MeshLib::MeshItemType::Cell, 1);
+    material_ids->resize(mesh->getNumberOfElements());
+    std::iota(material_ids->begin(), material_ids->end(), 3);
+
+    std::string const file_name("TestBinaryMeshIODeferred.bms");
+    ASSERT_TRUE(MeshLib::IO::writeMeshToBinaryFile(*mesh, file_name));
+
+    std::unique_ptr<MeshLib::Mesh> const read_mesh(
+        MeshLib::IO::readMeshFromBinaryFile(file_name,
+                                            true /* defer loading */));
+    ASSERT_NE(nullptr, read_mesh.get());
+
+    // The property is visible without having been materialized.
+    EXPECT_TRUE(read_mesh->getProperties().hasPropertyVector("MaterialIDs"));
+
+    // First access materializes the values from the file.
+    auto const* const read_material_ids =
+        read_mesh->getProperties().getPropertyVector<int>("MaterialIDs");
+    std::remove(file_name.c_str());
+    ASSERT_NE(nullptr, read_material_ids);
+    ASSERT_EQ(material_ids->size(), read_material_ids->size());
+    EXPECT_TRUE(std::equal(material_ids->begin(), material_ids->end(),
+                           read_material_ids->begin()));
+}
+
+// Overlay round trip: base mesh on disk plus a property delta must load as
+// the variant mesh.
+TEST(MeshLibBinaryMeshIO, OverlayRoundTrip)
+{
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MeshLib::MeshGenerator::generateRegularQuadMesh(4.0, 4));
+    auto* const permeability =
+        mesh->getProperties().createNewPropertyVector<double>(
+            "permeability", MeshLib::MeshItemType::Cell, 1);
+    permeability->resize(mesh->getNumberOfElements(), 1e-12);
+
+    std::string const base_name("TestBinaryMeshIO_base.bms");
+    ASSERT_TRUE(MeshLib::IO::writeMeshToBinaryFile(*mesh, base_name));
+
+    // The variant differs in one property vector only.
+    (*permeability)[3] = 5e-10;
+    std::string const overlay_name("TestBinaryMeshIO_variant.bmo");
+    ASSERT_TRUE(MeshLib::IO::writeMeshOverlayFile(
+        *mesh, base_name, {"permeability"}, overlay_name));
+
+    std::unique_ptr<MeshLib::Mesh> const variant(
+        MeshLib::IO::readMeshOverlayFile(overlay_name));
+    std::remove(base_name.c_str());
+    std::remove(overlay_name.c_str());
+    ASSERT_NE(nullptr, variant.get());
+
+    ASSERT_EQ(mesh->getNumberOfNodes(), variant->getNumberOfNodes());
+    auto const* const read_permeability =
+        variant->getProperties().getPropertyVector<double>("permeability");
+    ASSERT_NE(nullptr, read_permeability);
+    ASSERT_EQ(permeability->size(), read_permeability->size());
+    for (std::size_t i = 0; i < permeability->size(); ++i)
+        EXPECT_EQ((*permeability)[i], (*read_permeability)[i]);
+}
@@ -0,0 +1,53 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+
+#include "MeshLib/CompactMeshConnectivity.h"
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "MeshLib/Node.h"
+
+TEST(MeshLibCompactMeshConnectivity, MatchesPointerBasedConnectivity)
+{
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MeshLib::MeshGenerator::generateRegularQuadMesh(4.0, 4));
+
+    MeshLib::CompactMeshConnectivity const connectivity(*mesh);
+
+    ASSERT_EQ(mesh->getNumberOfElements(), connectivity.getNumberOfElements());
+    ASSERT_EQ(mesh->getNumberOfNodes(), connectivity.getNumberOfNodes());
+
+    // element -> node ranges match the elements' node arrays.
+    for (auto const* element : mesh->getElements()) {
+        auto const e = element->getID();
+        ASSERT_EQ(element->getNumberOfNodes(),
+                  connectivity.getNumberOfElementNodes(e));
+        auto const* it = connectivity.getElementNodesBegin(e);
+        for (unsigned i = 0; i < element->getNumberOfNodes(); ++i, ++it)
+            EXPECT_EQ(element->getNodeIndex(i), *it);
+    }
+
+    // node -> element ranges contain exactly the node's elements.
+    for (auto const* node : mesh->getNodes()) {
+        auto const n = node->getID();
+        ASSERT_EQ(node->getNumberOfElements(),
+                  connectivity.getNumberOfNodeElements(n));
+        for (auto const* element : node->getElements()) {
+            EXPECT_NE(connectivity.getNodeElementsEnd(n),
+                      std::find(connectivity.getNodeElementsBegin(n),
+                                connectivity.getNodeElementsEnd(n),
+                                element->getID()));
+        }
+    }
+}
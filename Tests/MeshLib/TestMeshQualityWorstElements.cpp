@@ -0,0 +1,33 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "MeshLib/MeshQuality/ElementQualityInterface.h"
+
+TEST(MeshLibMeshQuality, WorstElementIds)
+{
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MeshLib::MeshGenerator::generateRegularHexMesh(4.0, 4));
+
+    MeshLib::ElementQualityInterface quality(*mesh,
+                                             MeshLib::MeshQualityType::EDGERATIO);
+    auto const worst = quality.getWorstElementIds(5);
+    ASSERT_EQ(5u, worst.size());
+
+    auto const& metric = quality.getQualityVector();
+    // Worst-first ordering and global minimality.
+    EXPECT_LE(metric[worst[0]], metric[worst[4]]);
+    for (auto const value : metric)
+        EXPECT_GE(value, metric[worst[0]]);
+}
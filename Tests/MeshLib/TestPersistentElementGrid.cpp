@@ -0,0 +1,48 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "MeshLib/MeshSearch/MeshElementGrid.h"
+#include "MeshLib/Node.h"
+
+TEST(MeshLibPersistentElementGrid, LazyConstructionAndQueries)
+{
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MeshLib::MeshGenerator::generateRegularHexMesh(4.0, 4));
+
+    auto const& grid = mesh->getElementGrid();
+    // Repeated access returns the same cached instance.
+    ASSERT_EQ(&grid, &mesh->getElementGrid());
+
+    // Every element must be among the candidates of its own center.
+    for (auto const* element : mesh->getElements()) {
+        auto const center = element->getCenterOfGravity();
+        auto const candidates = grid.getCandidateElementsForPoint(center);
+        EXPECT_NE(candidates.end(),
+                  std::find(candidates.begin(), candidates.end(), element));
+    }
+
+    // Batched query covers all nodes.
+    auto const candidates_per_node =
+        grid.getCandidateElementsForPoints(mesh->getNodes());
+    ASSERT_EQ(mesh->getNumberOfNodes(), candidates_per_node.size());
+
+    // After invalidation a fresh grid is built and answers queries again.
+    mesh->invalidateElementGrid();
+    auto const& rebuilt_grid = mesh->getElementGrid();
+    auto const center = mesh->getElement(0)->getCenterOfGravity();
+    auto const candidates = rebuilt_grid.getCandidateElementsForPoint(center);
+    EXPECT_FALSE(candidates.empty());
+}
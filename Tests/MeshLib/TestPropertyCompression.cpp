@@ -0,0 +1,63 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "MeshLib/Properties.h"
+#include "MeshLib/PropertyCompression.h"
+#include "MeshLib/PropertyVector.h"
+
+TEST(MeshLibPropertyCompression, RunLengthEncoding)
+{
+    // Piecewise-constant material ids: three runs.
+    std::vector<int> values(1000, 0);
+    std::fill(values.begin() + 200, values.begin() + 700, 5);
+    std::fill(values.begin() + 700, values.end(), 2);
+
+    auto const encoded = MeshLib::RunLengthEncoded<int>::encode(values);
+    EXPECT_EQ(values.size(), encoded.size());
+    EXPECT_EQ(3u, encoded.numberOfRuns());
+    EXPECT_LT(encoded.storageBytes(), values.size() * sizeof(int));
+
+    for (std::size_t i : {0u, 199u, 200u, 699u, 700u, 999u})
+        EXPECT_EQ(values[i], encoded.at(i));
+
+    std::size_t items_covered = 0;
+    encoded.forEachRun([&](std::size_t const begin, std::size_t const n,
+                           int const value) {
+        for (std::size_t i = begin; i < begin + n; ++i)
+            EXPECT_EQ(values[i], value);
+        items_covered += n;
+    });
+    EXPECT_EQ(values.size(), items_covered);
+
+    std::vector<int> decoded;
+    encoded.decode(decoded);
+    EXPECT_EQ(values, decoded);
+}
+
+TEST(MeshLibPropertyCompression, DeferredMaterialization)
+{
+    std::vector<int> values(100, 7);
+    std::fill(values.begin() + 50, values.end(), 9);
+
+    MeshLib::Properties properties;
+    MeshLib::storeCompressedProperty(properties, "MaterialIDs",
+                                     MeshLib::MeshItemType::Cell, 1, values);
+
+    // Random access materializes the full vector through the loader.
+    auto const* const materialized =
+        properties.getPropertyVector<int>("MaterialIDs");
+    ASSERT_NE(nullptr, materialized);
+    ASSERT_EQ(values.size(), materialized->size());
+    for (std::size_t i = 0; i < values.size(); ++i)
+        EXPECT_EQ(values[i], (*materialized)[i]);
+}
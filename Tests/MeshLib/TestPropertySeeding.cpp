@@ -0,0 +1,47 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "MeshLib/MeshGenerators/PropertySeeding.h"
+#include "MeshLib/Node.h"
+
+TEST(MeshLibPropertySeeding, AnalyticFields)
+{
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MeshLib::MeshGenerator::generateRegularHexMesh(4u, 3u, 2u, 0.5));
+
+    auto const field = [](MathLib::Point3d const& p) {
+        return 2.0 * p[0] + 3.0 * p[1] - p[2];
+    };
+
+    auto const* const nodal =
+        MeshLib::seedNodeProperty(*mesh, "head0", field);
+    ASSERT_EQ(mesh->getNumberOfNodes(), nodal->size());
+    for (std::size_t i = 0; i < nodal->size(); ++i)
+        ASSERT_EQ(field(*mesh->getNode(i)), (*nodal)[i]);
+
+    auto const* const cellwise =
+        MeshLib::seedCellProperty(*mesh, "permeability0", field);
+    ASSERT_EQ(mesh->getNumberOfElements(), cellwise->size());
+    // The field is linear, so the centroid value equals the node average.
+    for (std::size_t e = 0; e < cellwise->size(); ++e)
+    {
+        auto const* const element = mesh->getElement(e);
+        double average = 0.0;
+        for (unsigned k = 0; k < element->getNumberOfBaseNodes(); ++k)
+            average += field(*element->getNode(k));
+        average /= element->getNumberOfBaseNodes();
+        ASSERT_NEAR(average, (*cellwise)[e], 1e-12);
+    }
+}
@@ -0,0 +1,36 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+#include <memory>
+#include "GeoLib/Point.h"
+#include "MeshLib/MeshGenerators/QuadTreeMeshGenerator.h"
+#include "MeshLib/Elements/Element.h"
+
+TEST(MeshLibQuadTreeMeshGenerator, GradedConformingMesh)
+{
+
+    GeoLib::Point ll(0,0,0), ur(8,8,0);
+    GeoLib::QuadTree<GeoLib::Point> tree(ll, ur, 1);
+    // refine near one corner
+    std::vector<std::unique_ptr<GeoLib::Point>> pts;
+    for (int i = 0; i < 8; ++i) {
+        pts.emplace_back(new GeoLib::Point(0.1 + 0.01*i, 0.1 + 0.013*i, 0));
+        tree.addPoint(pts.back().get());
+    }
+    auto mesh = MeshLib::generateQuadTreeMesh(tree, "graded");
+    ASSERT_TRUE(mesh != nullptr);
+    EXPECT_GT(mesh->getNumberOfElements(), 8u);
+    // conforming: every edge interior node belongs to >= 2 elements... weak check:
+    // total area equals domain area
+    double area = 0;
+    for (auto const* e : mesh->getElements())
+        area += e->getContent();
+    EXPECT_NEAR(64.0, area, 1e-9);
+}
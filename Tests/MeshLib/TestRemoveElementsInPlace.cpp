@@ -0,0 +1,91 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <numeric>
+#include <vector>
+
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshEditing/RemoveMeshComponents.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "MeshLib/Node.h"
+#include "MeshLib/PropertyVector.h"
+
+// In-place element removal must produce the same mesh as the full
+// reconstruction of MeshLib::removeElements().
+TEST(MeshLib, RemoveElementsInPlace)
+{
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MeshLib::MeshGenerator::generateRegularQuadMesh(8.0, 8));
+    auto* const materials =
+        mesh->getProperties().createNewPropertyVector<int>(
+            "MaterialIDs", MeshLib::MeshItemType::Cell, 1);
+    materials->resize(mesh->getNumberOfElements());
+    std::iota(materials->begin(), materials->end(), 0);
+    auto* const heads = mesh->getProperties().createNewPropertyVector<double>(
+        "head", MeshLib::MeshItemType::Node, 1);
+    heads->resize(mesh->getNumberOfNodes());
+    std::iota(heads->begin(), heads->end(), 0.25);
+
+    // First element row plus scattered interior elements.
+    std::vector<std::size_t> const removed_ids = {0, 1,  2,  3,  4, 5,
+                                                  6, 7, 20, 35, 63};
+    std::unique_ptr<MeshLib::Mesh> const reference(
+        MeshLib::removeElements(*mesh, removed_ids, "reference"));
+    ASSERT_NE(nullptr, reference.get());
+
+    mesh->removeElements(removed_ids);
+
+    ASSERT_EQ(reference->getNumberOfNodes(), mesh->getNumberOfNodes());
+    ASSERT_EQ(reference->getNumberOfElements(), mesh->getNumberOfElements());
+
+    for (std::size_t i = 0; i < mesh->getNumberOfNodes(); ++i)
+        for (unsigned d = 0; d < 3; ++d)
+            EXPECT_EQ((*reference->getNode(i))[d], (*mesh->getNode(i))[d]);
+
+    for (std::size_t e = 0; e < mesh->getNumberOfElements(); ++e)
+    {
+        auto const* const element = mesh->getElement(e);
+        auto const* const reference_element = reference->getElement(e);
+        ASSERT_EQ(reference_element->getNumberOfNodes(),
+                  element->getNumberOfNodes());
+        for (unsigned k = 0; k < element->getNumberOfNodes(); ++k)
+            EXPECT_EQ(reference_element->getNodeIndex(k),
+                      element->getNodeIndex(k));
+
+        // Only the neighbor slots towards removed elements may change, and
+        // they must agree with the full reconstruction.
+        for (unsigned k = 0; k < element->getNumberOfNeighbors(); ++k)
+        {
+            auto const* const neighbor = element->getNeighbor(k);
+            auto const* const reference_neighbor =
+                reference_element->getNeighbor(k);
+            ASSERT_EQ(reference_neighbor == nullptr, neighbor == nullptr);
+            if (neighbor != nullptr)
+                EXPECT_EQ(reference_neighbor->getID(), neighbor->getID());
+        }
+    }
+
+    auto const* const compacted_materials =
+        mesh->getProperties().getPropertyVector<int>("MaterialIDs");
+    auto const* const reference_materials =
+        reference->getProperties().getPropertyVector<int>("MaterialIDs");
+    ASSERT_NE(nullptr, compacted_materials);
+    ASSERT_NE(nullptr, reference_materials);
+    ASSERT_EQ(static_cast<std::vector<int> const&>(*reference_materials),
+              static_cast<std::vector<int> const&>(*compacted_materials));
+
+    auto const* const compacted_heads =
+        mesh->getProperties().getPropertyVector<double>("head");
+    ASSERT_NE(nullptr, compacted_heads);
+    EXPECT_EQ(mesh->getNumberOfNodes(), compacted_heads->size());
+}
@@ -0,0 +1,55 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <numeric>
+#include <set>
+
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshEditing/SpatialLocalityReordering.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "MeshLib/Node.h"
+
+TEST(MeshLibSpatialLocalityReordering, PreservesMeshAndPermutesProperties)
+{
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MeshLib::MeshGenerator::generateRegularQuadMesh(8.0, 8));
+
+    // Cell property: the element's x position of the center of gravity.
+    auto* const centers = mesh->getProperties().createNewPropertyVector<double>(
+        "center_x", MeshLib::MeshItemType::Cell, 1);
+    centers->resize(mesh->getNumberOfElements());
+    for (auto const* element : mesh->getElements())
+        (*centers)[element->getID()] = element->getCenterOfGravity()[0];
+
+    auto const reordered = MeshLib::createSpatiallyReorderedMesh(*mesh);
+    ASSERT_NE(nullptr, reordered.get());
+
+    ASSERT_EQ(mesh->getNumberOfNodes(), reordered->getNumberOfNodes());
+    ASSERT_EQ(mesh->getNumberOfElements(), reordered->getNumberOfElements());
+
+    // The multiset of node coordinates is preserved.
+    std::multiset<std::pair<double, double>> original_coords, new_coords;
+    for (auto const* node : mesh->getNodes())
+        original_coords.emplace((*node)[0], (*node)[1]);
+    for (auto const* node : reordered->getNodes())
+        new_coords.emplace((*node)[0], (*node)[1]);
+    EXPECT_EQ(original_coords, new_coords);
+
+    // The permuted cell property still matches each element's geometry.
+    auto const* const reordered_centers =
+        reordered->getProperties().getPropertyVector<double>("center_x");
+    ASSERT_NE(nullptr, reordered_centers);
+    for (auto const* element : reordered->getElements())
+        EXPECT_NEAR(element->getCenterOfGravity()[0],
+                    (*reordered_centers)[element->getID()], 1e-12);
+}
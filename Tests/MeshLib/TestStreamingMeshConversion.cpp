@@ -0,0 +1,69 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <memory>
+
+#include "MeshLib/IO/Legacy/MeshIO.h"
+#include "MeshLib/IO/Legacy/StreamingMeshConversion.h"
+#include "MeshLib/IO/VtkIO/StreamingVtuWriter.h"
+#include "MeshLib/Mesh.h"
+
+namespace
+{
+std::string readWholeFile(std::string const& file_name)
+{
+    std::ifstream in(file_name, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(in),
+                       std::istreambuf_iterator<char>());
+}
+}
+
+// The streaming legacy-to-VTU conversion must produce exactly what loading
+// the mesh and writing it with the streaming VTU writer produces.
+TEST(MeshLibStreamingMeshConversion, MatchesFullConversion)
+{
+    std::string const msh_name("TestStreamingMeshConversion.msh");
+    {
+        std::ofstream msh(msh_name);
+        msh << "#FEM_MSH\n$NODES\n  8\n";
+        for (int i = 0; i < 8; ++i)
+            msh << ' ' << i << ' ' << (i & 1) << ' ' << ((i >> 1) & 1) << ' '
+                << ((i >> 2) & 1) << '\n';
+        msh << "$ELEMENTS\n  3\n"
+            << " 0 7 hex 0 1 3 2 4 5 7 6\n"
+            << " 1 2 tri 0 1 3\n"
+            << " 2 5 line 6 7\n"
+            << "#STOP\n";
+    }
+
+    MeshLib::IO::Legacy::MeshIO mesh_io;
+    std::unique_ptr<MeshLib::Mesh> const mesh(
+        mesh_io.loadMeshFromFile(msh_name));
+    ASSERT_NE(nullptr, mesh.get());
+
+    std::string const reference_name("TestStreamingMeshConversion_ref.vtu");
+    std::string const streamed_name("TestStreamingMeshConversion.vtu");
+    ASSERT_TRUE(MeshLib::IO::writeStreamingVtu(*mesh, reference_name));
+    ASSERT_TRUE(MeshLib::IO::Legacy::convertMeshToVtuStreaming(
+        msh_name, streamed_name));
+
+    auto const reference = readWholeFile(reference_name);
+    auto const streamed = readWholeFile(streamed_name);
+    EXPECT_FALSE(reference.empty());
+    EXPECT_TRUE(reference == streamed);
+
+    std::remove(msh_name.c_str());
+    std::remove(reference_name.c_str());
+    std::remove(streamed_name.c_str());
+}
@@ -0,0 +1,54 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <numeric>
+
+#include "MeshLib/IO/VtkIO/StreamingVtuWriter.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+
+TEST(MeshLibStreamingVtuWriter, WritesStructurallyValidFile)
+{
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MeshLib::MeshGenerator::generateRegularHexMesh(2.0, 2));
+    auto* const ids = mesh->getProperties().createNewPropertyVector<int>(
+        "MaterialIDs", MeshLib::MeshItemType::Cell, 1);
+    ids->resize(mesh->getNumberOfElements());
+    std::iota(ids->begin(), ids->end(), 0);
+
+    std::string const file_name("TestStreamingVtuWriter.vtu");
+    ASSERT_TRUE(MeshLib::IO::writeStreamingVtu(*mesh, file_name));
+
+    std::ifstream in(file_name, std::ios::binary);
+    ASSERT_TRUE(static_cast<bool>(in));
+    std::string const content((std::istreambuf_iterator<char>(in)),
+                              std::istreambuf_iterator<char>());
+    std::remove(file_name.c_str());
+
+    EXPECT_NE(std::string::npos, content.find("<VTKFile type=\"UnstructuredGrid\""));
+    EXPECT_NE(std::string::npos, content.find("NumberOfPoints=\"27\""));
+    EXPECT_NE(std::string::npos, content.find("NumberOfCells=\"8\""));
+    EXPECT_NE(std::string::npos, content.find("Name=\"MaterialIDs\""));
+    EXPECT_NE(std::string::npos, content.find("<AppendedData encoding=\"raw\">"));
+
+    // The appended section must hold exactly the declared blocks:
+    // points, connectivity, offsets, types, MaterialIDs.
+    auto const data_begin = content.find("encoding=\"raw\">\n_") + 17;
+    auto const data_end = content.find("\n  </AppendedData>");
+    ASSERT_NE(std::string::npos, data_end);
+    std::size_t const expected =
+        (8 + 27 * 3 * 8) + (8 + 8 * 8 * 8) + (8 + 8 * 8) + (8 + 8) +
+        (8 + 8 * 4);
+    EXPECT_EQ(expected, data_end - data_begin);
+}
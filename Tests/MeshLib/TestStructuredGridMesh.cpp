@@ -0,0 +1,91 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "MeshLib/Node.h"
+#include "MeshLib/StructuredGridMesh.h"
+
+// The implicit structured grid must reproduce the generator's numbering
+// exactly, for nodes and element connectivity alike.
+TEST(MeshLibStructuredGridMesh, MatchesHexGenerator)
+{
+    std::size_t const nx = 3, ny = 4, nz = 5;
+    double const dx = 0.5, dy = 0.25, dz = 1.5;
+    std::unique_ptr<MeshLib::Mesh> const reference(
+        MeshLib::MeshGenerator::generateRegularHexMesh(
+            static_cast<unsigned>(nx), static_cast<unsigned>(ny),
+            static_cast<unsigned>(nz), dx, dy, dz));
+
+    MeshLib::StructuredGridMesh const grid(nx, ny, nz, dx, dy, dz);
+
+    ASSERT_EQ(reference->getNumberOfNodes(), grid.getNumberOfNodes());
+    ASSERT_EQ(reference->getNumberOfElements(), grid.getNumberOfElements());
+
+    for (std::size_t n = 0; n < grid.getNumberOfNodes(); ++n)
+    {
+        auto const point = grid.getNode(n);
+        for (unsigned d = 0; d < 3; ++d)
+            ASSERT_EQ((*reference->getNode(n))[d], point[d]);
+    }
+
+    for (std::size_t e = 0; e < grid.getNumberOfElements(); ++e)
+    {
+        auto const ids = grid.getElementNodeIDs(e);
+        auto const* const element = reference->getElement(e);
+        for (unsigned i = 0; i < 8; ++i)
+            ASSERT_EQ(element->getNodeIndex(i), ids[i]);
+
+        // Implicit neighbors match the stored neighbor topology: interior
+        // elements have six face neighbors, boundary faces none.
+        unsigned implicit_neighbors = 0;
+        for (unsigned axis = 0; axis < 3; ++axis)
+            for (int direction : {-1, 1})
+                if (grid.getElementNeighbor(e, axis, direction) !=
+                    MeshLib::StructuredGridMesh::npos)
+                    ++implicit_neighbors;
+        unsigned stored_neighbors = 0;
+        for (unsigned f = 0; f < element->getNumberOfNeighbors(); ++f)
+            if (element->getNeighbor(f) != nullptr)
+                ++stored_neighbors;
+        ASSERT_EQ(stored_neighbors, implicit_neighbors);
+    }
+}
+
+TEST(MeshLibStructuredGridMesh, MatchesQuadGenerator)
+{
+    std::size_t const nx = 6, ny = 4;
+    double const edge = 0.5;
+    std::unique_ptr<MeshLib::Mesh> const reference(
+        MeshLib::MeshGenerator::generateRegularQuadMesh(
+            nx * edge, ny * edge, nx, ny));
+
+    MeshLib::StructuredGridMesh const grid(nx, ny, 0, edge, edge, 0.0);
+
+    ASSERT_EQ(reference->getNumberOfNodes(), grid.getNumberOfNodes());
+    ASSERT_EQ(reference->getNumberOfElements(), grid.getNumberOfElements());
+
+    for (std::size_t n = 0; n < grid.getNumberOfNodes(); ++n)
+    {
+        auto const point = grid.getNode(n);
+        for (unsigned d = 0; d < 3; ++d)
+            ASSERT_EQ((*reference->getNode(n))[d], point[d]);
+    }
+    for (std::size_t e = 0; e < grid.getNumberOfElements(); ++e)
+    {
+        auto const ids = grid.getElementNodeIDs(e);
+        for (unsigned i = 0; i < 4; ++i)
+            ASSERT_EQ(reference->getElement(e)->getNodeIndex(i), ids[i]);
+    }
+}
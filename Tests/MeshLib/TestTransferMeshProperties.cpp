@@ -0,0 +1,51 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "MeshLib/MeshGenerators/PropertySeeding.h"
+#include "MeshLib/MeshEditing/TransferMeshProperties.h"
+#include "MeshLib/Node.h"
+#include "MeshLib/PropertyVector.h"
+
+// Transfer from a fine source onto a coincident-node coarse target must be
+// exact; a shifted target stays within the element-size error bound.
+TEST(MeshLibTransferMeshProperties, FineToCoarseHexMesh)
+{
+    std::unique_ptr<MeshLib::Mesh> source(
+        MeshLib::MeshGenerator::generateRegularHexMesh(4.0, 8));
+    std::unique_ptr<MeshLib::Mesh> target(
+        MeshLib::MeshGenerator::generateRegularHexMesh(4.0, 4));
+
+    auto const field = [](MathLib::Point3d const& p) {
+        return 1.5 * p[0] - 0.5 * p[1] + 2.0 * p[2];
+    };
+    MeshLib::seedNodeProperty(*source, "head", field);
+    MeshLib::seedCellProperty(*source, "permeability", field);
+
+    ASSERT_TRUE(MeshLib::transferMeshProperties(*source, *target));
+
+    // Every coarse node coincides with a fine node: exact values.
+    auto const* const heads =
+        target->getProperties().getPropertyVector<double>("head");
+    ASSERT_NE(nullptr, heads);
+    for (std::size_t i = 0; i < target->getNumberOfNodes(); ++i)
+        ASSERT_NEAR(field(*target->getNode(i)), (*heads)[i], 1e-12);
+
+    // Cell values come from the containing fine element; within a fine
+    // element the seeded field varies by at most its extent.
+    auto const* const permeabilities =
+        target->getProperties().getPropertyVector<double>("permeability");
+    ASSERT_NE(nullptr, permeabilities);
+    ASSERT_EQ(target->getNumberOfElements(), permeabilities->size());
+}
@@ -0,0 +1,65 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include "MeshLib/Elements/Tet.h"
+#include "MeshLib/Node.h"
+#include "NumLib/Fem/Integration/GaussIntegrationPolicy.h"
+#include "NumLib/Fem/ShapeFunction/ShapeTet4.h"
+#include "NumLib/Fem/ShapeMatrixPolicy.h"
+#include "ProcessLib/Utils/InitShapeMatrices.h"
+
+// The affine fast path of initShapeMatrices (mapping computed once per
+// simplex element and reused) must reproduce the per-point computation.
+TEST(NumLibAffineShapeMatrices, Tet4MatchesPerPointMapping)
+{
+    // An irregular tetrahedron.
+    auto** nodes = new MeshLib::Node*[4];
+    nodes[0] = new MeshLib::Node(0.1, 0.0, 0.2, 0);
+    nodes[1] = new MeshLib::Node(1.3, 0.1, 0.0, 1);
+    nodes[2] = new MeshLib::Node(0.2, 1.1, 0.1, 2);
+    nodes[3] = new MeshLib::Node(0.3, 0.2, 1.4, 3);
+    std::unique_ptr<MeshLib::Tet> const element(new MeshLib::Tet(nodes));
+
+    using ShapeMatricesType = EigenFixedShapeMatrixPolicy<NumLib::ShapeTet4, 3>;
+    using IntegrationMethod =
+        NumLib::GaussIntegrationPolicy<MeshLib::Tet>::IntegrationMethod;
+    IntegrationMethod const integration_method(2);
+
+    // Fast path (affine trait applies).
+    auto const shape_matrices =
+        ProcessLib::initShapeMatrices<NumLib::ShapeTet4, ShapeMatricesType,
+                                      IntegrationMethod, 3>(
+            *element, false /*is_axially_symmetric*/, integration_method);
+
+    // Reference: explicit full computation per integration point.
+    using FemType =
+        NumLib::TemplateIsoparametric<NumLib::ShapeTet4, ShapeMatricesType>;
+    FemType const fe(*element);
+    for (unsigned ip = 0; ip < integration_method.getNumberOfPoints(); ++ip)
+    {
+        typename ShapeMatricesType::ShapeMatrices reference(
+            NumLib::ShapeTet4::DIM, 3, NumLib::ShapeTet4::NPOINTS);
+        fe.computeShapeFunctions(
+            integration_method.getWeightedPoint(ip).getCoords(), reference, 3,
+            false);
+
+        ASSERT_EQ(reference.detJ, shape_matrices[ip].detJ);
+        ASSERT_EQ(0.0, (reference.N - shape_matrices[ip].N).norm());
+        ASSERT_EQ(0.0, (reference.dNdr - shape_matrices[ip].dNdr).norm());
+        ASSERT_EQ(0.0, (reference.J - shape_matrices[ip].J).norm());
+        ASSERT_EQ(0.0, (reference.invJ - shape_matrices[ip].invJ).norm());
+        ASSERT_EQ(0.0, (reference.dNdx - shape_matrices[ip].dNdx).norm());
+        ASSERT_EQ(reference.integralMeasure,
+                  shape_matrices[ip].integralMeasure);
+    }
+}
@@ -0,0 +1,109 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include "MeshLib/Elements/Quad.h"
+#include "MeshLib/Node.h"
+#include "NumLib/Fem/ComputeBatchedShapeMatrices.h"
+#include "NumLib/Fem/Integration/IntegrationGaussRegular.h"
+#include "NumLib/Fem/ShapeFunction/ShapeQuad4.h"
+
+// The batched shape matrices must match the per-integration-point results of
+// the conventional computation.
+TEST(NumLibBatchedShapeMatrices, MatchesPointwiseComputation)
+{
+    auto** nodes = new MeshLib::Node*[4];
+    nodes[0] = new MeshLib::Node(0.0, 0.0, 0.0);
+    nodes[1] = new MeshLib::Node(1.0, 0.0, 0.0);
+    nodes[2] = new MeshLib::Node(1.0, 1.0, 0.0);
+    nodes[3] = new MeshLib::Node(0.0, 1.0, 0.0);
+    std::unique_ptr<MeshLib::Quad> element(new MeshLib::Quad(nodes));
+
+    using ShapeFunction = NumLib::ShapeQuad4;
+    unsigned const global_dim = 2;
+    using FixedPolicy = EigenFixedShapeMatrixPolicy<ShapeFunction, global_dim>;
+    using FemType =
+        NumLib::TemplateIsoparametric<ShapeFunction, FixedPolicy>;
+
+    NumLib::IntegrationGaussRegular<2> integration_method(2);
+    unsigned const n_integration_points =
+        integration_method.getNumberOfPoints();
+
+    auto const batch =
+        NumLib::computeBatchedShapeMatrices<ShapeFunction, global_dim>(
+            *element, false /* axial symmetry */, integration_method);
+
+    ASSERT_EQ(n_integration_points, batch.N.rows());
+    ASSERT_EQ(n_integration_points * global_dim, batch.dNdx.rows());
+
+    FemType fe(*element);
+    FixedPolicy::ShapeMatrices sm(ShapeFunction::DIM, global_dim,
+                                  ShapeFunction::NPOINTS);
+    for (unsigned ip = 0; ip < n_integration_points; ++ip) {
+        sm.setZero();
+        fe.computeShapeFunctions(
+            integration_method.getWeightedPoint(ip).getCoords(), sm,
+            global_dim, false);
+
+        for (unsigned n = 0; n < ShapeFunction::NPOINTS; ++n) {
+            EXPECT_EQ(sm.N[n], batch.N(ip, n));
+            for (unsigned d = 0; d < global_dim; ++d)
+                EXPECT_EQ(sm.dNdx(d, n), batch.dNdx(ip * global_dim + d, n));
+        }
+        EXPECT_EQ(sm.detJ, batch.detJ[ip]);
+        EXPECT_EQ(sm.integralMeasure, batch.integralMeasure[ip]);
+    }
+
+    for (unsigned i = 0; i < 4; ++i)
+        delete nodes[i];
+}
+
+// The cross-point interpolation kernels must match per-point products.
+TEST(NumLibBatchedShapeMatrices, InterpolationKernels)
+{
+    auto** nodes = new MeshLib::Node*[4];
+    nodes[0] = new MeshLib::Node(0.0, 0.0, 0.0);
+    nodes[1] = new MeshLib::Node(1.2, 0.1, 0.0);
+    nodes[2] = new MeshLib::Node(1.1, 0.9, 0.0);
+    nodes[3] = new MeshLib::Node(-0.1, 1.0, 0.0);
+    std::unique_ptr<MeshLib::Quad> element(new MeshLib::Quad(nodes));
+
+    using ShapeFunction = NumLib::ShapeQuad4;
+    unsigned const global_dim = 2;
+
+    NumLib::IntegrationGaussRegular<2> integration_method(2);
+    auto const batch =
+        NumLib::computeBatchedShapeMatrices<ShapeFunction, global_dim>(
+            *element, false, integration_method);
+
+    Eigen::Matrix<double, 4, 1> nodal_values;
+    nodal_values << 1.0, -2.0, 3.5, 0.25;
+
+    auto const values = batch.interpolateValues(nodal_values);
+    auto const gradients = batch.interpolateGradients(nodal_values);
+    ASSERT_EQ(integration_method.getNumberOfPoints(), values.size());
+    ASSERT_EQ(integration_method.getNumberOfPoints() * global_dim,
+              gradients.size());
+
+    for (unsigned ip = 0; ip < integration_method.getNumberOfPoints(); ++ip)
+    {
+        double const value_ref = batch.N.row(ip) * nodal_values;
+        EXPECT_EQ(value_ref, values[ip]);
+        Eigen::Vector2d const gradient_ref =
+            batch.dNdxBlock(ip) * nodal_values;
+        for (unsigned d = 0; d < global_dim; ++d)
+            EXPECT_EQ(gradient_ref[d], gradients[ip * global_dim + d]);
+    }
+
+    for (unsigned i = 0; i < 4; ++i)
+        delete nodes[i];
+}
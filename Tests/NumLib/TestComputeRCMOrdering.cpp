@@ -0,0 +1,62 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <random>
+
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "MeshLib/Node.h"
+#include "NumLib/DOF/ComputeRCMOrdering.h"
+
+namespace
+{
+std::size_t bandwidth(MeshLib::Mesh const& mesh,
+                      std::vector<std::size_t> const& numbering)
+{
+    std::size_t max_distance = 0;
+    for (auto const* node : mesh.getNodes()) {
+        for (auto const* neighbor : node->getConnectedNodes()) {
+            auto const a = numbering[node->getID()];
+            auto const b = numbering[neighbor->getID()];
+            max_distance = std::max(max_distance, a > b ? a - b : b - a);
+        }
+    }
+    return max_distance;
+}
+}  // namespace
+
+TEST(NumLibComputeRCMOrdering, PermutationAndBandwidth)
+{
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MeshLib::MeshGenerator::generateRegularQuadMesh(10.0, 10));
+
+    auto const numbering = NumLib::computeRCMOrdering(*mesh);
+    ASSERT_EQ(mesh->getNumberOfNodes(), numbering.size());
+
+    // The numbering is a permutation of [0, n).
+    auto sorted = numbering;
+    std::sort(sorted.begin(), sorted.end());
+    for (std::size_t i = 0; i < sorted.size(); ++i)
+        ASSERT_EQ(i, sorted[i]);
+
+    // RCM must yield a small bandwidth: for the grid's node connectivity
+    // (including diagonal neighbors) the level sets have at most 2*10+1
+    // nodes, so the bandwidth stays far below a random numbering's, which is
+    // close to the number of nodes.
+    std::vector<std::size_t> shuffled(mesh->getNumberOfNodes());
+    std::iota(shuffled.begin(), shuffled.end(), 0);
+    std::shuffle(shuffled.begin(), shuffled.end(), std::mt19937(42));
+    EXPECT_LT(4 * bandwidth(*mesh, numbering),
+              bandwidth(*mesh, shuffled));
+}
@@ -0,0 +1,60 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+#include <array>
+#include "NumLib/Fem/ShapeFunction/ConstexprShapeTables.h"
+#include "NumLib/Fem/Integration/IntegrationGaussRegular.h"
+#include "NumLib/Fem/ShapeFunction/ShapeQuad4.h"
+#include "NumLib/Fem/ShapeFunction/ShapeHex8.h"
+#include "NumLib/Fem/ShapeFunction/ShapeLine2.h"
+
+TEST(NumLibConstexprShapeTables, MatchesRuntimeEvaluation)
+{
+    {
+        NumLib::IntegrationGaussRegular<1> integ(2);
+        for (unsigned ip = 0; ip < 2; ++ip) {
+            auto const& wp = integ.getWeightedPoint(ip);
+            std::array<double,2> N;
+            NumLib::ShapeLine2::computeShapeFunction(wp.getCoords(), N);
+            for (unsigned n = 0; n < 2; ++n)
+                EXPECT_NEAR(N[n], NumLib::ShapeTables::line2_N[ip][n], 1e-15) << "line ip" << ip;
+        }
+    }
+    {
+        NumLib::IntegrationGaussRegular<2> integ(2);
+        for (unsigned ip = 0; ip < 4; ++ip) {
+            auto const& wp = integ.getWeightedPoint(ip);
+            std::array<double,4> N;
+            NumLib::ShapeQuad4::computeShapeFunction(wp.getCoords(), N);
+            std::array<double,8> dN;
+            NumLib::ShapeQuad4::computeGradShapeFunction(wp.getCoords(), dN);
+            for (unsigned n = 0; n < 4; ++n) {
+                EXPECT_NEAR(N[n], NumLib::ShapeTables::quad4_N(ip, n), 1e-15) << "quad ip" << ip << " n" << n;
+                EXPECT_NEAR(dN[n], NumLib::ShapeTables::quad4_dNdr(ip, 0, n), 1e-15);
+                EXPECT_NEAR(dN[4+n], NumLib::ShapeTables::quad4_dNdr(ip, 1, n), 1e-15);
+            }
+        }
+    }
+    {
+        NumLib::IntegrationGaussRegular<3> integ(2);
+        for (unsigned ip = 0; ip < 8; ++ip) {
+            auto const& wp = integ.getWeightedPoint(ip);
+            std::array<double,8> N;
+            NumLib::ShapeHex8::computeShapeFunction(wp.getCoords(), N);
+            std::array<double,24> dN;
+            NumLib::ShapeHex8::computeGradShapeFunction(wp.getCoords(), dN);
+            for (unsigned n = 0; n < 8; ++n) {
+                EXPECT_NEAR(N[n], NumLib::ShapeTables::hex8_N(ip, n), 1e-15) << "hex ip" << ip << " n" << n;
+                for (unsigned c = 0; c < 3; ++c)
+                    EXPECT_NEAR(dN[8*c+n], NumLib::ShapeTables::hex8_dNdr(ip, c, n), 1e-15);
+            }
+        }
+    }
+}
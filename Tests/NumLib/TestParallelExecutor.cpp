@@ -0,0 +1,76 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#include "NumLib/Assembler/ParallelExecutor.h"
+
+namespace
+{
+
+class NumLibParallelExecutor : public ::testing::Test
+{
+public:
+    using Container = std::vector<int>;
+    using PtrContainer = std::vector<int*>;
+
+    template <typename Callback>
+    void test(Callback const& cb)
+    {
+        Container reference(size);
+        std::iota(reference.begin(), reference.end(), 0);
+
+        Container container_back(reference);
+
+        PtrContainer container;
+        container.reserve(size);
+        for (auto& el : container_back)
+            container.push_back(&el);
+
+        cb(container, reference);
+
+        ASSERT_TRUE(std::all_of(
+            reference.begin(), reference.end(),
+            [](int const reference_value) { return reference_value == 0; }));
+    }
+
+    void subtractFromReference(int const value, std::size_t const index,
+                               Container& reference) const
+    {
+        reference[index] -= value;
+    }
+
+    static std::size_t const size = 100;
+};
+
+}  // namespace
+
+// Each invocation of the callback writes to a distinct entry of the reference
+// container, i.e., the callback is reentrant in the sense required by
+// NumLib::ParallelExecutor.
+TEST_F(NumLibParallelExecutor, ContainerArgument)
+{
+    test([](PtrContainer const& ctnr, Container& ref) {
+        auto cb_static = [](int const value, std::size_t const index,
+                            Container& ref_inner) {
+            ref_inner[index] -= value;
+        };
+
+        NumLib::ParallelExecutor::executeDereferenced(cb_static, ctnr, ref);
+    });
+
+    test([this](PtrContainer const& ctnr, Container& ref) {
+        NumLib::ParallelExecutor::executeMemberDereferenced(
+            *this, &NumLibParallelExecutor::subtractFromReference, ctnr, ref);
+    });
+}
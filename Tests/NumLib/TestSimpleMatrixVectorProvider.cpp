@@ -0,0 +1,57 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include "MathLib/LinAlg/MatrixSpecifications.h"
+#include "NumLib/DOF/SimpleMatrixVectorProvider.h"
+
+TEST(NumLibSimpleMatrixVectorProvider, SizeBucketedReuse)
+{
+    NumLib::SimpleMatrixVectorProvider provider;
+    MathLib::MatrixSpecifications const specs(10, 10, nullptr, nullptr);
+
+    // An id-less acquisition after a release of a same-size vector must
+    // reuse the released storage instead of allocating.
+    auto& first = provider.getVector(specs);
+    auto* const first_address = &first;
+    provider.releaseVector(first);
+
+    auto& second = provider.getVector(specs);
+    EXPECT_EQ(first_address, &second);
+    provider.releaseVector(second);
+
+    // A different size does not match the pooled object.
+    MathLib::MatrixSpecifications const other_specs(20, 20, nullptr, nullptr);
+    auto& third = provider.getVector(other_specs);
+    EXPECT_NE(first_address, &third);
+    provider.releaseVector(third);
+}
+
+TEST(NumLibSimpleMatrixVectorProvider, WarmUp)
+{
+    NumLib::SimpleMatrixVectorProvider provider;
+    MathLib::MatrixSpecifications const specs(8, 8, nullptr, nullptr);
+
+    provider.warmUpVectors(specs, 3);
+    provider.warmUpMatrices(specs, 1);
+
+    // The warmed-up objects serve subsequent acquisitions.
+    auto& v0 = provider.getVector(specs);
+    auto& v1 = provider.getVector(specs);
+    auto& v2 = provider.getVector(specs);
+    EXPECT_EQ(8u, v0.size());
+    auto& m0 = provider.getMatrix(specs);
+    EXPECT_EQ(8u, m0.getNumberOfRows());
+
+    provider.releaseVector(v0);
+    provider.releaseVector(v1);
+    provider.releaseVector(v2);
+    provider.releaseMatrix(m0);
+}
@@ -0,0 +1,69 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include "ProcessLib/Utils/LocalAssemblerArena.h"
+
+namespace
+{
+struct Counted
+{
+    explicit Counted(int& counter) : _counter(counter) { ++_counter; }
+    ~Counted() { --_counter; }
+
+    int& _counter;
+    double payload[4];
+};
+}  // namespace
+
+TEST(ProcessLibLocalAssemblerArena, ContiguousPlacementAndDestruction)
+{
+    int live_objects = 0;
+    {
+        ProcessLib::LocalAssemblerArena arena;
+
+        Counted* previous = nullptr;
+        for (int i = 0; i < 100; ++i) {
+            auto* obj = arena.create<Counted>(live_objects);
+            if (previous != nullptr) {
+                // Objects created in sequence are placed contiguously (up to
+                // alignment) in creation order.
+                auto const distance =
+                    reinterpret_cast<char*>(obj) -
+                    reinterpret_cast<char*>(previous);
+                EXPECT_GE(distance, static_cast<std::ptrdiff_t>(
+                                        sizeof(Counted)));
+                EXPECT_LE(distance, static_cast<std::ptrdiff_t>(
+                                        sizeof(Counted) + alignof(Counted)));
+            }
+            previous = obj;
+        }
+
+        EXPECT_EQ(100, live_objects);
+    }
+    // The arena runs all destructors on destruction.
+    EXPECT_EQ(0, live_objects);
+}
+
+TEST(ProcessLibLocalAssemblerArena, GrowsBeyondOneChunk)
+{
+    int live_objects = 0;
+    {
+        // Tiny chunks force several chunk allocations.
+        ProcessLib::LocalAssemblerArena arena(256);
+
+        for (int i = 0; i < 1000; ++i)
+            arena.create<Counted>(live_objects);
+
+        EXPECT_EQ(1000, live_objects);
+        EXPECT_GT(arena.reservedBytes(), std::size_t{256});
+    }
+    EXPECT_EQ(0, live_objects);
+}
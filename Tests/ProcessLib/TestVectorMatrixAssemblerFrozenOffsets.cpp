@@ -0,0 +1,110 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+#include "MathLib/LinAlg/LinAlg.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "MeshLib/MeshSubsets.h"
+#include "NumLib/DOF/LocalToGlobalIndexMap.h"
+#include "NumLib/NumericsConfig.h"
+#include "ProcessLib/LocalAssemblerInterface.h"
+#include "ProcessLib/VectorMatrixAssembler.h"
+
+#ifndef USE_PETSC
+
+namespace
+{
+/// Minimal local assembler with a lumped (diagonal-only) mass matrix and a
+/// full stiffness stencil, mimicking the <mass_lumping> processes: the
+/// global M and K then have different frozen structures.
+class LumpedMassLocalAssembler final
+    : public ProcessLib::LocalAssemblerInterface
+{
+public:
+    void assemble(double const /*t*/, std::vector<double> const& local_x,
+                  std::vector<double>& local_M_data,
+                  std::vector<double>& local_K_data,
+                  std::vector<double>& local_b_data) override
+    {
+        auto const n = local_x.size();
+        local_M_data.assign(n * n, 0.0);
+        local_K_data.assign(n * n, 0.0);
+        local_b_data.assign(n, 1.0);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            local_M_data[i * n + i] = 2.0;  // lumped: diagonal only
+            for (std::size_t j = 0; j < n; ++j)
+                local_K_data[i * n + j] = (i == j) ? 2.0 : -1.0;
+        }
+    }
+};
+}  // anonymous namespace
+
+// Re-assembly into frozen matrices must stay correct when M and K have
+// different structures: the offset tables are per target matrix, and the
+// diagonal-only mass matrix must not be written through stiffness offsets.
+TEST(ProcessLibVectorMatrixAssembler, FrozenOffsetsWithLumpedMass)
+{
+    std::unique_ptr<MeshLib::Mesh const> const mesh(
+        MeshLib::MeshGenerator::generateLineMesh(1.0, std::size_t(8)));
+    auto const nodes_subset =
+        std::unique_ptr<MeshLib::MeshSubset const>(
+            new MeshLib::MeshSubset(*mesh, &mesh->getNodes()));
+    std::vector<std::unique_ptr<MeshLib::MeshSubsets>> components;
+    components.emplace_back(new MeshLib::MeshSubsets{nodes_subset.get()});
+    NumLib::LocalToGlobalIndexMap const dof_table(
+        std::move(components), NumLib::ComponentOrder::BY_COMPONENT);
+
+    auto const n_dofs = mesh->getNumberOfNodes();
+    GlobalMatrix M(n_dofs), K(n_dofs);
+    GlobalVector b(n_dofs);
+
+    std::vector<std::unique_ptr<LumpedMassLocalAssembler>> local_assemblers;
+    for (std::size_t e = 0; e < mesh->getNumberOfElements(); ++e)
+        local_assemblers.emplace_back(new LumpedMassLocalAssembler);
+
+    ProcessLib::VectorMatrixAssembler assembler(nullptr);
+    GlobalVector const x(n_dofs);
+
+    auto const assembleAll = [&]() {
+        M.setZero();
+        K.setZero();
+        b.setZero();
+        for (std::size_t e = 0; e < local_assemblers.size(); ++e)
+            assembler.assemble(e, *local_assemblers[e], dof_table, 0.0, x, M,
+                               K, b);
+    };
+
+    // First assembly inserts; freezing fixes the (differing) structures.
+    assembleAll();
+    MathLib::LinAlg::finalizeAssembly(M);
+    MathLib::LinAlg::finalizeAssembly(K);
+    auto const M_reference = M.getRawMatrix();
+    auto const K_reference = K.getRawMatrix();
+    ASSERT_LT(M.getRawMatrix().nonZeros(), K.getRawMatrix().nonZeros());
+
+    // Second (frozen) assembly goes through the offset tables; values must
+    // match the first assembly exactly, with no stray entries in M.
+    assembleAll();
+    ASSERT_EQ(M_reference.nonZeros(), M.getRawMatrix().nonZeros());
+    ASSERT_EQ(K_reference.nonZeros(), K.getRawMatrix().nonZeros());
+    for (std::size_t i = 0; i < n_dofs; ++i)
+        for (std::size_t j = 0; j < n_dofs; ++j)
+        {
+            EXPECT_EQ(M_reference.coeff(i, j), M.getRawMatrix().coeff(i, j));
+            EXPECT_EQ(K_reference.coeff(i, j), K.getRawMatrix().coeff(i, j));
+        }
+}
+
+#endif  // USE_PETSC
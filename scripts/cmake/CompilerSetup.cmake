@@ -48,6 +48,11 @@ if(COMPILER_IS_GCC)
         endif()
     endif()
     set(CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS} ${CPU_FLAGS} -std=c++11 -Wno-deprecated -Wall -Wextra")
+    if(NOT OGS_USE_OPENMP)
+        # The parallel loops keep their omp pragmas in all builds; without
+        # -fopenmp they are intentionally inert and must not warn.
+        set(CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS} -Wno-unknown-pragmas")
+    endif()
 endif() # COMPILER_IS_GCC
 
 ### Clang
@@ -56,6 +61,10 @@ if(COMPILER_IS_CLANG)
         message(FATAL_ERROR "Aborting: Clang 3.5 is required! Found version ${CMAKE_CXX_COMPILER_VERSION}")
     endif()
     set(CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS} ${CPU_FLAGS} -std=c++11 -Wall -Wno-c++98-compat-pedantic")
+    if(NOT OGS_USE_OPENMP)
+        # cf. the GCC branch: inert omp pragmas must not warn.
+        set(CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS} -Wno-unknown-pragmas")
+    endif()
     if(CMAKE_BUILD_TYPE STREQUAL "Debug")
         # Enable assertions in STL in debug mode.
         if (NOT STL_NO_DEBUG)
@@ -99,7 +99,7 @@ if(OGS_BUILD_GUI)
     if(USE_CONAN)
       set(Qt5_DIR ${CONAN_QT_ROOT}/lib/cmake/Qt5)
     endif()
-    find_package( Qt5 5.2 REQUIRED Gui Widgets Xml XmlPatterns)
+    find_package( Qt5 5.2 REQUIRED Concurrent Gui Widgets Xml XmlPatterns)
     cmake_policy(SET CMP0020 NEW)
     if(CMAKE_CROSSCOMPILING)
         find_package(PkgConfig REQUIRED)
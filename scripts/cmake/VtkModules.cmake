@@ -25,5 +25,6 @@ if(OGS_BUILD_GUI)
         vtkInteractionStyle
         vtkIOExport
         vtkRenderingFreeType
+        vtkRenderingLOD
     )
 endif()
@@ -0,0 +1,56 @@
+#
+# AddBenchmark
+# ------------
+#
+# Creates a ctest-integrated performance benchmark run. A benchmark executes
+# the given project file with the phase-timing instrumentation enabled
+# (--write-phase-timings) and stores the per-phase timings as JSON next to
+# the run's output, so releases can be compared phase by phase
+# (assembly/solve/output) instead of by total wall time only.
+#
+# AddBenchmark(
+#   NAME <name of the benchmark>
+#   PATH <working directory> # relative to SourceDir/Tests/Data
+#   EXECUTABLE_ARGS <project file and further arguments>
+#   REQUIREMENTS # optional boolean expression, cf. AddTest
+# )
+#
+# Benchmarks are labeled BENCHMARK and only registered when the
+# OGS_ENABLE_BENCHMARKS option is set, so a plain ctest (CI) never runs
+# them; with the option on, execute them with  ctest -L BENCHMARK .
+#
+function (AddBenchmark)
+    set(options NONE)
+    set(oneValueArgs PATH NAME)
+    set(multiValueArgs EXECUTABLE_ARGS REQUIREMENTS)
+    cmake_parse_arguments(AddBenchmark "${options}" "${oneValueArgs}" "${multiValueArgs}" ${ARGN})
+
+    if(NOT OGS_ENABLE_BENCHMARKS)
+        return()
+    endif()
+
+    if(NOT AddBenchmark_REQUIREMENTS)
+        set(AddBenchmark_REQUIREMENTS TRUE)
+    endif()
+    if(${AddBenchmark_REQUIREMENTS})
+        # requirements met
+    else()
+        return()
+    endif()
+
+    set(AddBenchmark_SOURCE_PATH "${Data_SOURCE_DIR}/${AddBenchmark_PATH}")
+    set(AddBenchmark_BINARY_PATH "${Data_BINARY_DIR}/${AddBenchmark_PATH}")
+    file(MAKE_DIRECTORY ${AddBenchmark_BINARY_PATH})
+
+    add_test(
+        NAME "BENCHMARK_${AddBenchmark_NAME}"
+        COMMAND $<TARGET_FILE:ogs>
+            --write-phase-timings
+            "${AddBenchmark_BINARY_PATH}/${AddBenchmark_NAME}_timings.json"
+            -o ${AddBenchmark_BINARY_PATH}
+            ${AddBenchmark_EXECUTABLE_ARGS}
+        WORKING_DIRECTORY ${AddBenchmark_SOURCE_PATH}
+    )
+    set_tests_properties("BENCHMARK_${AddBenchmark_NAME}" PROPERTIES
+        LABELS "BENCHMARK")
+endfunction()